@@ -13,6 +13,7 @@
 #ifndef CHC_COLLISIONMODEL_H
 #define CHC_COLLISIONMODEL_H
 
+#include <memory>
 #include <vector>
 
 #include "chrono/core/ChApiCE.h"
@@ -29,6 +30,9 @@ class ChPhysicsItem;
 
 
 namespace collision {
+
+class ChSignedDistanceField;
+
 /// Shape types that can be created.
 enum ShapeType {
     SPHERE,
@@ -44,7 +48,9 @@ enum ShapeType {
     ROUNDEDCYL,   // Currently implemented in parallel only
     ROUNDEDCONE,  // Currently implemented in parallel only
     CONVEX,       // Currently implemented in parallel only
-    TETRAHEDRON   // Currently implemented in parallel only
+    TETRAHEDRON,  // Currently implemented in parallel only
+    MESH,         // Currently implemented in parallel only
+    SDF
 };
 
 ///
@@ -170,6 +176,18 @@ class ChApi ChCollisionModel {
         double sphereswept_thickness = 0.0      ///< optional: outward sphereswept layer (when supported)
         ) = 0;
 
+    /// Add a signed distance field to this model, for static geometry that is too complex to be
+    /// described with convex shapes or triangle meshes (terrains, hoppers, molds).
+    /// The field is shared, not copied: build it once (or load it from file) and reuse it in many models.
+    /// Only spheres and convex shapes collide with it (see ChSignedDistanceField).
+    /// Returns false if the collision model does not support distance fields.
+    virtual bool AddSignedDistanceField(std::shared_ptr<ChSignedDistanceField> sdf,  ///< the distance field
+                                        const ChVector<>& pos = ChVector<>(),        ///< field frame position
+                                        const ChMatrix33<>& rot = ChMatrix33<>(1)    ///< field frame rotation
+                                        ) {
+        return false;
+    }
+
     /// Add a barrel-like shape to this model (main axis on Y direction), for collision purposes.
     /// The barrel shape is made by lathing an arc of an ellipse around the vertical Y axis.
     /// The center of the ellipse is on Y=0 level, and it is offsetted by R_offset from
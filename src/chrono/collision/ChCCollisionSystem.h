@@ -15,6 +15,8 @@
 #ifndef CHC_COLLISIONSYSTEM_H
 #define CHC_COLLISIONSYSTEM_H
 
+#include <vector>
+
 #include "chrono/collision/ChCCollisionInfo.h"
 #include "chrono/core/ChFrame.h"
 #include "chrono/core/ChApiCE.h"
@@ -143,6 +145,50 @@ class ChApi ChCollisionSystem {
     /// Perform a ray-hit test with the specified collision model.
     virtual bool RayHit(const ChVector<>& from, const ChVector<>& to, ChCollisionModel* model, ChRayhitResult& mresult) const = 0;
 
+    /// Perform a sphere-cast test with the collision models: a sphere with given radius is swept from
+    /// 'from' to 'to' and the first contact, if any, is reported (the hit point is on the surface of the
+    /// hit model). The default implementation reports no hit.
+    virtual bool SphereCast(const ChVector<>& from, const ChVector<>& to, double radius, ChRayhitResult& mresult) const {
+        mresult.hit = false;
+        return false;
+    }
+
+    /// Perform a sphere-cast test for the continuous collision detection of the given model: a sphere with
+    /// given radius is swept from 'from' to 'to' and the first contact with the other models is reported.
+    /// The given model, the models it cannot collide with (see collision families) and the surfaces the
+    /// sphere moves away from are ignored. The default implementation reports no hit.
+    virtual bool SweepSphere(ChCollisionModel* model,
+                             const ChVector<>& from,
+                             const ChVector<>& to,
+                             double radius,
+                             ChRayhitResult& mresult) const {
+        mresult.hit = false;
+        return false;
+    }
+
+    /// Perform a batch of ray-hit tests with the collision models, for the rays from[i] -> to[i].
+    /// The results vector is resized to the number of rays. The default implementation calls RayHit()
+    /// for each ray in turn; derived classes may process the rays in parallel.
+    virtual void BatchRayHit(const std::vector<ChVector<>>& from,
+                             const std::vector<ChVector<>>& to,
+                             std::vector<ChRayhitResult>& results) const {
+        results.resize(from.size());
+        for (size_t i = 0; i < from.size(); i++)
+            RayHit(from[i], to[i], results[i]);
+    }
+
+    /// Perform a batch of sphere-cast tests with the collision models, for the segments from[i] -> to[i].
+    /// The results vector is resized to the number of segments. The default implementation calls
+    /// SphereCast() for each segment in turn; derived classes may process the segments in parallel.
+    virtual void BatchSphereCast(const std::vector<ChVector<>>& from,
+                                 const std::vector<ChVector<>>& to,
+                                 double radius,
+                                 std::vector<ChRayhitResult>& results) const {
+        results.resize(from.size());
+        for (size_t i = 0; i < from.size(); i++)
+            SphereCast(from[i], to[i], radius, results[i]);
+    }
+
     // SERIALIZATION
 
     virtual void ArchiveOUT(ChArchiveOut& marchive) {
@@ -12,6 +12,11 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include "chrono/collision/ChCCollisionSystemBullet.h"
 #include "chrono/collision/ChCModelBullet.h"
 #include "chrono/collision/gimpact/GIMPACT/Bullet/btGImpactCollisionAlgorithm.h"
@@ -19,11 +24,13 @@
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChProximityContainer.h"
+#include "chrono/parallel/ChOpenMP.h"
 #include "chrono/collision/bullet/LinearMath/btPoolAllocator.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btSphereShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btCylinderShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/bt2DShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btCEtriangleShape.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/btSDFShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionDispatch/btEmptyCollisionAlgorithm.h"
 
 extern btScalar gContactBreakingThreshold;
@@ -1162,16 +1169,418 @@ private:
 };
 
 
+////////////////////////////////////
+////////////////////////////////////
+
+// Utility class for the collision of convex shapes with signed distance fields (static geometry).
+// Spheres (and points) are tested at their center; boxes and convex hulls at their vertices, swept
+// by the shape margin; other convex shapes at their support point opposite to the field gradient.
+class btSDFConvexCollisionAlgorithm : public btActivatingCollisionAlgorithm {
+    bool m_ownManifold;
+    btPersistentManifold* m_manifoldPtr;
+    bool m_isSwapped;
+
+  public:
+    btSDFConvexCollisionAlgorithm(btPersistentManifold* mf,
+                                  const btCollisionAlgorithmConstructionInfo& ci,
+                                  btCollisionObject* col0,
+                                  btCollisionObject* col1,
+                                  bool isSwapped)
+        : btActivatingCollisionAlgorithm(ci, col0, col1),
+          m_ownManifold(false),
+          m_manifoldPtr(mf),
+          m_isSwapped(isSwapped) {
+        btCollisionObject* convexObj = m_isSwapped ? col1 : col0;
+        btCollisionObject* sdfObj = m_isSwapped ? col0 : col1;
+
+        if (!m_manifoldPtr) {
+            m_manifoldPtr = m_dispatcher->getNewManifold(convexObj, sdfObj);
+            m_ownManifold = true;
+        }
+    }
+
+    btSDFConvexCollisionAlgorithm(const btCollisionAlgorithmConstructionInfo& ci)
+        : btActivatingCollisionAlgorithm(ci) {}
+
+    virtual void processCollision(btCollisionObject* body0,
+                                  btCollisionObject* body1,
+                                  const btDispatcherInfo& dispatchInfo,
+                                  btManifoldResult* resultOut) {
+        (void)dispatchInfo;
+
+        if (!m_manifoldPtr)
+            return;
+
+        btCollisionObject* convexObj = m_isSwapped ? body1 : body0;
+        btCollisionObject* sdfObj = m_isSwapped ? body0 : body1;
+
+        resultOut->setPersistentManifold(m_manifoldPtr);
+
+        btConvexShape* convex = (btConvexShape*)convexObj->getCollisionShape();
+        btSDFShape* sdfShape = (btSDFShape*)sdfObj->getCollisionShape();
+        const btTransform& convexT = convexObj->getWorldTransform();
+        const btTransform& sdfT = sdfObj->getWorldTransform();
+
+        // the margin of the SDF shape is its outward envelope
+        btScalar envelope = sdfShape->getMargin();
+
+        if (convex->getShapeType() == SPHERE_SHAPE_PROXYTYPE || convex->getShapeType() == POINT_SHAPE_PROXYTYPE) {
+            btSphereShape* sphere = (btSphereShape*)convex;
+            addSphereContact(resultOut, sdfShape, sdfT, convexT.getOrigin(), sphere->getRadius(), envelope);
+        } else if (convex->isPolyhedral()) {
+            btPolyhedralConvexShape* polyhedron = (btPolyhedralConvexShape*)convex;
+            btVector3 vertex;
+            for (int i = 0; i < polyhedron->getNumVertices(); i++) {
+                polyhedron->getVertex(i, vertex);
+                addSphereContact(resultOut, sdfShape, sdfT, convexT(vertex), polyhedron->getMargin(), envelope);
+            }
+        } else {
+            // Start from the gradient at the shape center, then refine it at the support point.
+            btVector3 point = convexT.getOrigin();
+            for (int iter = 0; iter < 3; iter++) {
+                btVector3 normal;
+                if (!getNormal(sdfShape, sdfT, point, normal))
+                    break;
+                point = convexT(convex->localGetSupportingVertex(-normal * convexT.getBasis()));
+            }
+            addSphereContact(resultOut, sdfShape, sdfT, point, 0, envelope);
+        }
+
+        resultOut->refreshContactPoints();
+    }
+
+    virtual btScalar calculateTimeOfImpact(btCollisionObject* body0,
+                                           btCollisionObject* body1,
+                                           const btDispatcherInfo& dispatchInfo,
+                                           btManifoldResult* resultOut) {
+        // not yet
+        return btScalar(1.);
+    }
+
+    virtual void getAllContactManifolds(btManifoldArray& manifoldArray) {
+        if (m_manifoldPtr && m_ownManifold) {
+            manifoldArray.push_back(m_manifoldPtr);
+        }
+    }
+
+    virtual ~btSDFConvexCollisionAlgorithm() {
+        if (m_ownManifold) {
+            if (m_manifoldPtr)
+                m_dispatcher->releaseManifold(m_manifoldPtr);
+        }
+    }
+
+    struct CreateFunc : public btCollisionAlgorithmCreateFunc {
+        virtual btCollisionAlgorithm* CreateCollisionAlgorithm(btCollisionAlgorithmConstructionInfo& ci,
+                                                               btCollisionObject* body0,
+                                                               btCollisionObject* body1) {
+            void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(btSDFConvexCollisionAlgorithm));
+            if (!m_swapped) {
+                return new (mem) btSDFConvexCollisionAlgorithm(0, ci, body0, body1, false);
+            } else {
+                return new (mem) btSDFConvexCollisionAlgorithm(0, ci, body0, body1, true);
+            }
+        }
+    };
+
+  private:
+    // Evaluate the field gradient at the given point (world frame); return false outside the sampled blocks.
+    static bool getNormal(const btSDFShape* sdfShape,
+                          const btTransform& sdfT,
+                          const btVector3& point,
+                          btVector3& normal) {
+        btVector3 local = sdfT.invXform(point);
+        ChVector<> gradient;
+        sdfShape->get_sdf()->GetDistance(ChVector<>(local.x(), local.y(), local.z()), &gradient);
+        if (gradient.Length2() == 0)
+            return false;
+        gradient.Normalize();
+        normal = sdfT.getBasis() * btVector3((btScalar)gradient.x(), (btScalar)gradient.y(), (btScalar)gradient.z());
+        return true;
+    }
+
+    // Report the contact between a sphere (given center and radius) and the field surface inflated by the
+    // envelope, if they overlap.
+    static void addSphereContact(btManifoldResult* resultOut,
+                                 const btSDFShape* sdfShape,
+                                 const btTransform& sdfT,
+                                 const btVector3& center,
+                                 btScalar radius,
+                                 btScalar envelope) {
+        btVector3 local = sdfT.invXform(center);
+        ChVector<> gradient;
+        double distance = sdfShape->get_sdf()->GetDistance(ChVector<>(local.x(), local.y(), local.z()), &gradient);
+        btScalar dist = (btScalar)distance - envelope - radius;
+        if (dist > 0 || gradient.Length2() == 0)
+            return;
+        gradient.Normalize();
+        btVector3 normalOnSurfaceB =
+            sdfT.getBasis() * btVector3((btScalar)gradient.x(), (btScalar)gradient.y(), (btScalar)gradient.z());
+        /// point on B (worldspace)
+        btVector3 pos1 = center - normalOnSurfaceB * ((btScalar)distance - envelope);
+        resultOut->addContactPoint(normalOnSurfaceB, pos1, dist);
+    }
+};
+
+
+// Collision dispatcher that runs the narrowphase of the broadphase pairs in parallel (OpenMP).
+// Persistent manifolds and collision algorithms are allocated from per-thread pools. Compound and
+// GImpact algorithms temporarily modify their collision objects, so the pairs that share such an
+// object are grouped and processed sequentially by the same thread; all other pairs are independent.
+// With a single thread, the default (sequential) Bullet dispatching is used.
+class btParallelCollisionDispatcher : public btCollisionDispatcher {
+  public:
+    btParallelCollisionDispatcher(btCollisionConfiguration* collisionConfiguration)
+        : btCollisionDispatcher(collisionConfiguration), m_num_threads(1) {
+        SetNumThreads(1);
+    }
+
+    virtual ~btParallelCollisionDispatcher() {
+        for (auto pools : m_pools) {
+            pools->manifolds->~btPoolAllocator();
+            btAlignedFree(pools->manifolds);
+            pools->algorithms->~btPoolAllocator();
+            btAlignedFree(pools->algorithms);
+            delete pools;
+        }
+    }
+
+    // Set the number of threads used in dispatchAllCollisionPairs. Must not be called during dispatching.
+    void SetNumThreads(int num_threads) {
+        m_num_threads = std::max(num_threads, 1);
+        int algorithm_size = m_collisionConfiguration->getCollisionAlgorithmPool()->getElementSize();
+        while ((int)m_pools.size() < m_num_threads) {
+            ThreadPools* pools = new ThreadPools;
+            void* mem = btAlignedAlloc(sizeof(btPoolAllocator), 16);
+            pools->manifolds = new (mem) btPoolAllocator(sizeof(btPersistentManifold), 1024);
+            mem = btAlignedAlloc(sizeof(btPoolAllocator), 16);
+            pools->algorithms = new (mem) btPoolAllocator(algorithm_size, 1024);
+            m_pools.push_back(pools);
+        }
+    }
+
+    int GetNumThreads() const { return m_num_threads; }
+
+    virtual btPersistentManifold* getNewManifold(void* b0, void* b1) override {
+        btCollisionObject* body0 = (btCollisionObject*)b0;
+        btCollisionObject* body1 = (btCollisionObject*)b1;
+
+        // optional relative contact breaking threshold (as in btCollisionDispatcher)
+        btScalar contactBreakingThreshold =
+            (m_dispatcherFlags & btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD)
+                ? btMin(body0->getCollisionShape()->getContactBreakingThreshold(gContactBreakingThreshold),
+                        body1->getCollisionShape()->getContactBreakingThreshold(gContactBreakingThreshold))
+                : gContactBreakingThreshold;
+        btScalar contactProcessingThreshold =
+            btMin(body0->getContactProcessingThreshold(), body1->getContactProcessingThreshold());
+
+        void* mem = Allocate(&ThreadPools::manifolds, sizeof(btPersistentManifold));
+        btPersistentManifold* manifold = new (mem)
+            btPersistentManifold(body0, body1, 0, contactBreakingThreshold, contactProcessingThreshold);
+
+        CHOMPscopedLock lock(m_mutex);
+        manifold->m_index1a = m_manifoldsPtr.size();
+        m_manifoldsPtr.push_back(manifold);
+
+        return manifold;
+    }
+
+    virtual void releaseManifold(btPersistentManifold* manifold) override {
+        clearManifold(manifold);
+        {
+            CHOMPscopedLock lock(m_mutex);
+            int findIndex = manifold->m_index1a;
+            btAssert(findIndex < m_manifoldsPtr.size());
+            m_manifoldsPtr.swap(findIndex, m_manifoldsPtr.size() - 1);
+            m_manifoldsPtr[findIndex]->m_index1a = findIndex;
+            m_manifoldsPtr.pop_back();
+        }
+        manifold->~btPersistentManifold();
+        Free(&ThreadPools::manifolds, manifold);
+    }
+
+    virtual void* allocateCollisionAlgorithm(int size) override { return Allocate(&ThreadPools::algorithms, size); }
+
+    virtual void freeCollisionAlgorithm(void* ptr) override { Free(&ThreadPools::algorithms, ptr); }
+
+    virtual void dispatchAllCollisionPairs(btOverlappingPairCache* pairCache,
+                                           const btDispatcherInfo& dispatchInfo,
+                                           btDispatcher* dispatcher) override {
+        if (m_num_threads == 1 || dispatchInfo.m_dispatchFunc != btDispatcherInfo::DISPATCH_DISCRETE ||
+            getNearCallback() != defaultNearCallback) {
+            btCollisionDispatcher::dispatchAllCollisionPairs(pairCache, dispatchInfo, dispatcher);
+            return;
+        }
+
+        btBroadphasePairArray& pairs = pairCache->getOverlappingPairArray();
+        int num_pairs = pairs.size();
+
+        // Filter the pairs and create the missing collision algorithms (sequentially, in pair order).
+        m_active.clear();
+        for (int i = 0; i < num_pairs; i++) {
+            btBroadphasePair& pair = pairs[i];
+            btCollisionObject* obj0 = (btCollisionObject*)pair.m_pProxy0->m_clientObject;
+            btCollisionObject* obj1 = (btCollisionObject*)pair.m_pProxy1->m_clientObject;
+            if (!needsCollision(obj0, obj1))
+                continue;
+            if (!pair.m_algorithm)
+                pair.m_algorithm = findAlgorithm(obj0, obj1);
+            if (pair.m_algorithm)
+                m_active.push_back(i);
+        }
+        int num_active = (int)m_active.size();
+
+        // Group the pairs that share a collision object modified during processing (compound objects,
+        // and both objects of a pair processed with a GImpact algorithm), with a union-find structure.
+        std::unordered_map<btCollisionObject*, int> object_index;
+        std::vector<int> parent;
+        auto find_root = [&parent](int i) {
+            while (parent[i] != i)
+                i = parent[i] = parent[parent[i]];
+            return i;
+        };
+        auto get_index = [&object_index, &parent](btCollisionObject* obj) {
+            auto it = object_index.find(obj);
+            if (it != object_index.end())
+                return it->second;
+            int index = (int)parent.size();
+            object_index[obj] = index;
+            parent.push_back(index);
+            return index;
+        };
+        std::unordered_map<btCollisionShape*, bool> gimpact_shapes;
+        for (int k = 0; k < num_active; k++) {
+            btBroadphasePair& pair = pairs[m_active[k]];
+            btCollisionObject* obj0 = (btCollisionObject*)pair.m_pProxy0->m_clientObject;
+            btCollisionObject* obj1 = (btCollisionObject*)pair.m_pProxy1->m_clientObject;
+            bool gimpact = HasGImpact(obj0->getCollisionShape(), gimpact_shapes) ||
+                           HasGImpact(obj1->getCollisionShape(), gimpact_shapes);
+            if (gimpact || obj0->getCollisionShape()->isCompound())
+                get_index(obj0);
+            if (gimpact || obj1->getCollisionShape()->isCompound())
+                get_index(obj1);
+        }
+        int num_modified = (int)parent.size();
+        auto is_modified = [&object_index, num_modified](btCollisionObject* obj) {
+            auto it = object_index.find(obj);
+            return it != object_index.end() && it->second < num_modified;
+        };
+        for (int k = 0; k < num_active; k++) {
+            btBroadphasePair& pair = pairs[m_active[k]];
+            btCollisionObject* obj0 = (btCollisionObject*)pair.m_pProxy0->m_clientObject;
+            btCollisionObject* obj1 = (btCollisionObject*)pair.m_pProxy1->m_clientObject;
+            if (is_modified(obj0) || is_modified(obj1))
+                parent[find_root(get_index(obj1))] = find_root(get_index(obj0));
+        }
+
+        // Build the tasks: one task per group (pairs in pair order), one task per independent pair.
+        m_tasks.clear();
+        std::unordered_map<int, int> root_task;
+        for (int k = 0; k < num_active; k++) {
+            btBroadphasePair& pair = pairs[m_active[k]];
+            btCollisionObject* obj0 = (btCollisionObject*)pair.m_pProxy0->m_clientObject;
+            btCollisionObject* obj1 = (btCollisionObject*)pair.m_pProxy1->m_clientObject;
+            if (!is_modified(obj0) && !is_modified(obj1)) {
+                m_tasks.push_back(std::vector<int>(1, m_active[k]));
+                continue;
+            }
+            int root = find_root(object_index[obj0]);
+            auto task = root_task.find(root);
+            if (task == root_task.end()) {
+                root_task[root] = (int)m_tasks.size();
+                m_tasks.push_back(std::vector<int>(1, m_active[k]));
+            } else {
+                m_tasks[task->second].push_back(m_active[k]);
+            }
+        }
+
+        // Start with the largest groups, for a better load balance.
+        std::stable_sort(m_tasks.begin(), m_tasks.end(),
+                         [](const std::vector<int>& a, const std::vector<int>& b) { return a.size() > b.size(); });
+
+        // Concave algorithms must not modify the shared collision objects while pairs are processed concurrently.
+        dispatchInfo.m_concurrentDispatch = true;
+        int num_tasks = (int)m_tasks.size();
+#pragma omp parallel for schedule(dynamic, 16) num_threads(m_num_threads)
+        for (int t = 0; t < num_tasks; t++) {
+            for (auto i : m_tasks[t]) {
+                btBroadphasePair& pair = pairs[i];
+                btCollisionObject* obj0 = (btCollisionObject*)pair.m_pProxy0->m_clientObject;
+                btCollisionObject* obj1 = (btCollisionObject*)pair.m_pProxy1->m_clientObject;
+                btManifoldResult contactPointResult(obj0, obj1);
+                pair.m_algorithm->processCollision(obj0, obj1, dispatchInfo, &contactPointResult);
+            }
+        }
+        dispatchInfo.m_concurrentDispatch = false;
+    }
+
+    // Check if a shape is a GImpact shape or a compound with some GImpact child shape.
+    static bool HasGImpact(btCollisionShape* shape, std::unordered_map<btCollisionShape*, bool>& cache) {
+        if (shape->getShapeType() == GIMPACT_SHAPE_PROXYTYPE)
+            return true;
+        if (!shape->isCompound())
+            return false;
+        auto it = cache.find(shape);
+        if (it != cache.end())
+            return it->second;
+        btCompoundShape* compound = static_cast<btCompoundShape*>(shape);
+        bool gimpact = false;
+        for (int i = 0; i < compound->getNumChildShapes() && !gimpact; i++)
+            gimpact = HasGImpact(compound->getChildShape(i), cache);
+        cache[shape] = gimpact;
+        return gimpact;
+    }
+
+  private:
+    struct ThreadPools {
+        btPoolAllocator* manifolds;
+        btPoolAllocator* algorithms;
+        CHOMPmutex mutex;
+    };
+
+    // Allocate from the pool of the calling thread (if not exhausted and if the pool elements are large
+    // enough; e.g. GImpact algorithms are not accounted for in the pool element size).
+    void* Allocate(btPoolAllocator* ThreadPools::*pool, int size) {
+        int thread = CHOMPfunctions::GetThreadNum();
+        if (thread < (int)m_pools.size()) {
+            ThreadPools* pools = m_pools[thread];
+            CHOMPscopedLock lock(pools->mutex);
+            if ((pools->*pool)->getFreeCount() && size <= (pools->*pool)->getElementSize())
+                return (pools->*pool)->allocate(size);
+        }
+        return btAlignedAlloc(static_cast<size_t>(size), 16);
+    }
+
+    // Return memory to the pool it was allocated from (possibly owned by another thread).
+    void Free(btPoolAllocator* ThreadPools::*pool, void* ptr) {
+        for (auto pools : m_pools) {
+            if ((pools->*pool)->validPtr(ptr)) {
+                CHOMPscopedLock lock(pools->mutex);
+                (pools->*pool)->freeMemory(ptr);
+                return;
+            }
+        }
+        btAlignedFree(ptr);
+    }
+
+    int m_num_threads;
+    std::vector<ThreadPools*> m_pools;
+    CHOMPmutex m_mutex;
+    std::vector<int> m_active;
+    std::vector<std::vector<int>> m_tasks;
+};
 
 ////////////////////////////////////
 ////////////////////////////////////
 
 
 ChCollisionSystemBullet::ChCollisionSystemBullet(unsigned int max_objects, double scene_size) {
+    num_threads = 1;
+
     // btDefaultCollisionConstructionInfo conf_info(...); ***TODO***
     bt_collision_configuration = new btDefaultCollisionConfiguration();
 
-    bt_dispatcher = new btCollisionDispatcher(bt_collision_configuration);
+    bt_dispatcher = new btParallelCollisionDispatcher(bt_collision_configuration);
     //((btDefaultCollisionConfiguration*)bt_collision_configuration)->setConvexConvexMultipointIterations(4,4);
 
     //***OLD***
@@ -1214,6 +1623,15 @@ ChCollisionSystemBullet::ChCollisionSystemBullet(unsigned int max_objects, doubl
     btCollisionAlgorithmCreateFunc* m_collision_cetri_cetri = new btCEtriangleShapeCollisionAlgorithm::CreateFunc;
     bt_dispatcher->registerCollisionCreateFunc(CE_TRIANGLE_SHAPE_PROXYTYPE, CE_TRIANGLE_SHAPE_PROXYTYPE, m_collision_cetri_cetri);
 
+     // custom collision for convex shapes vs. signed distance fields
+    btCollisionAlgorithmCreateFunc* m_collision_convex_sdf = new btSDFConvexCollisionAlgorithm::CreateFunc;
+    btCollisionAlgorithmCreateFunc* m_collision_sdf_convex = new btSDFConvexCollisionAlgorithm::CreateFunc;
+    m_collision_sdf_convex->m_swapped = true;
+    for (int i = 0; i < CONCAVE_SHAPES_START_HERE; i++) {
+        bt_dispatcher->registerCollisionCreateFunc(i, SDF_SHAPE_PROXYTYPE, m_collision_convex_sdf);
+        bt_dispatcher->registerCollisionCreateFunc(SDF_SHAPE_PROXYTYPE, i, m_collision_sdf_convex);
+    }
+
      // custom collision for point-point case (in point clouds, just never create point-point contacts)
     //btCollisionAlgorithmCreateFunc* m_collision_point_point = new btPointPointCollisionAlgorithm::CreateFunc;
     void* mem = btAlignedAlloc(sizeof(btEmptyAlgorithm::CreateFunc),16);
@@ -1266,7 +1684,57 @@ void ChCollisionSystemBullet::Run() {
     }
 }
 
+void ChCollisionSystemBullet::SetNumThreads(int nthreads) {
+    num_threads = std::max(nthreads, 1);
+    static_cast<btParallelCollisionDispatcher*>(bt_dispatcher)->SetNumThreads(num_threads);
+}
+
+// Fill the collision info for a manifold point between the two models.
+// Return false if the point must be discarded because "too far" (the Bullet engine also has its threshold).
+static bool SetContactInfo(btManifoldPoint& pt,
+                           ChModelBullet* modelA,
+                           ChModelBullet* modelB,
+                           ChCollisionInfo& icontact) {
+    // If a model aggregates child models, report the contact for the child owning the shape.
+    icontact.modelA = modelA->GetChildModel(pt.m_index0);
+    icontact.modelB = modelB->GetChildModel(pt.m_index1);
+
+    double envelopeA = icontact.modelA->GetEnvelope();
+    double envelopeB = icontact.modelB->GetEnvelope();
+
+    double marginA = icontact.modelA->GetSafeMargin();
+    double marginB = icontact.modelB->GetSafeMargin();
+
+    // Discard "too far" constraints (the Bullet engine also has its threshold)
+    if (pt.getDistance() >= marginA + marginB)
+        return false;
+
+    btVector3 ptA = pt.getPositionWorldOnA();
+    btVector3 ptB = pt.getPositionWorldOnB();
+
+    icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
+    icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
+
+    icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(), -pt.m_normalWorldOnB.getZ());
+    icontact.vN.Normalize();
+
+    double ptdist = pt.getDistance();
+
+    icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
+    icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
+    icontact.distance = ptdist + envelopeA + envelopeB;
+
+    icontact.reaction_cache = pt.reactions_cache;
+
+    return true;
+}
+
 void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontainer) {
+    if (num_threads > 1) {
+        ReportContactsParallel(mcontactcontainer);
+        return;
+    }
+
     // This should remove all old contacts (or at least rewind the index)
     mcontactcontainer->BeginAddContact();
 
@@ -1279,19 +1747,13 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
         btCollisionObject* obB = static_cast<btCollisionObject*>(contactManifold->getBody1());
         contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
 
-        icontact.modelA = (ChCollisionModel*)obA->getUserPointer();
-        icontact.modelB = (ChCollisionModel*)obB->getUserPointer();
-
-        double envelopeA = icontact.modelA->GetEnvelope();
-        double envelopeB = icontact.modelB->GetEnvelope();
-
-        double marginA = icontact.modelA->GetSafeMargin();
-        double marginB = icontact.modelB->GetSafeMargin();
+        ChModelBullet* modelA = (ChModelBullet*)obA->getUserPointer();
+        ChModelBullet* modelB = (ChModelBullet*)obB->getUserPointer();
 
         // Execute custom broadphase callback, if any
         bool do_narrow_contactgeneration = true;
         if (this->broad_callback)
-            do_narrow_contactgeneration = this->broad_callback->OnBroadphase(icontact.modelA, icontact.modelB);
+            do_narrow_contactgeneration = this->broad_callback->OnBroadphase(modelA, modelB);
 
         if (do_narrow_contactgeneration) {
             int numContacts = contactManifold->getNumContacts();
@@ -1299,26 +1761,7 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
             for (int j = 0; j < numContacts; j++) {
                 btManifoldPoint& pt = contactManifold->getContactPoint(j);
 
-                // Discard "too far" constraints (the Bullet engine also has its threshold)
-                if (pt.getDistance() < marginA + marginB) {
-                    btVector3 ptA = pt.getPositionWorldOnA();
-                    btVector3 ptB = pt.getPositionWorldOnB();
-
-                    icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
-                    icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
-
-                    icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(),
-                                    -pt.m_normalWorldOnB.getZ());
-                    icontact.vN.Normalize();
-
-                    double ptdist = pt.getDistance();
-
-                    icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
-                    icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
-                    icontact.distance = ptdist + envelopeA + envelopeB;
-
-                    icontact.reaction_cache = pt.reactions_cache;
-
+                if (SetContactInfo(pt, modelA, modelB, icontact)) {
                     // Execute some user custom callback, if any
                     if (this->narrow_callback)
                         this->narrow_callback->OnNarrowphase(icontact);
@@ -1335,6 +1778,91 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
     mcontactcontainer->EndAddContact();
 }
 
+void ChCollisionSystemBullet::ReportContactsParallel(ChContactContainer* mcontactcontainer) {
+    btDispatcher* dispatcher = bt_collision_world->getDispatcher();
+
+    // Collect the manifolds in the order of the broadphase pairs, so that contacts are reported in
+    // an order independent of the (thread-dependent) order of creation of the manifolds.
+    btBroadphasePairArray& pairs = bt_broadphase->getOverlappingPairCache()->getOverlappingPairArray();
+    btManifoldArray manifolds;
+    btManifoldArray pair_manifolds;
+    for (int i = 0; i < pairs.size(); i++) {
+        if (pairs[i].m_algorithm) {
+            pair_manifolds.resize(0);
+            pairs[i].m_algorithm->getAllContactManifolds(pair_manifolds);
+            for (int j = 0; j < pair_manifolds.size(); j++)
+                manifolds.push_back(pair_manifolds[j]);
+        }
+    }
+    if (manifolds.size() != dispatcher->getNumManifolds()) {
+        // Some manifold is not reachable from its pair: fall back to the dispatcher list, whose order
+        // depends on the thread scheduling.
+        GetLog() << "WARNING: ChCollisionSystemBullet: " << dispatcher->getNumManifolds() - manifolds.size()
+                 << " contact manifolds not owned by a broadphase pair; contacts are reported in non-deterministic "
+                    "order.\n";
+        manifolds.resize(0);
+        for (int i = 0; i < dispatcher->getNumManifolds(); i++)
+            manifolds.push_back(dispatcher->getManifoldByIndexInternal(i));
+    }
+    int num_manifolds = manifolds.size();
+
+    // Refresh the manifolds and reserve one slot per manifold point.
+    std::vector<int> offsets(num_manifolds + 1, 0);
+#pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads)
+    for (int i = 0; i < num_manifolds; i++) {
+        btPersistentManifold* contactManifold = manifolds[i];
+        btCollisionObject* obA = static_cast<btCollisionObject*>(contactManifold->getBody0());
+        btCollisionObject* obB = static_cast<btCollisionObject*>(contactManifold->getBody1());
+        contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
+        offsets[i + 1] = contactManifold->getNumContacts();
+    }
+    for (int i = 0; i < num_manifolds; i++)
+        offsets[i + 1] += offsets[i];
+
+    // Fill the collision info of all manifold points, flagging those to be reported.
+    std::vector<ChCollisionInfo> contacts(offsets[num_manifolds]);
+    std::vector<char> valid(offsets[num_manifolds]);
+#pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads)
+    for (int i = 0; i < num_manifolds; i++) {
+        btPersistentManifold* contactManifold = manifolds[i];
+        btCollisionObject* obA = static_cast<btCollisionObject*>(contactManifold->getBody0());
+        btCollisionObject* obB = static_cast<btCollisionObject*>(contactManifold->getBody1());
+        ChModelBullet* modelA = (ChModelBullet*)obA->getUserPointer();
+        ChModelBullet* modelB = (ChModelBullet*)obB->getUserPointer();
+        for (int j = 0; j < contactManifold->getNumContacts(); j++) {
+            int k = offsets[i] + j;
+            valid[k] = SetContactInfo(contactManifold->getContactPoint(j), modelA, modelB, contacts[k]);
+        }
+    }
+
+    // Invoke the user callbacks and add to the contact container, sequentially and in order.
+    mcontactcontainer->BeginAddContact();
+    for (int i = 0; i < num_manifolds; i++) {
+        btPersistentManifold* contactManifold = manifolds[i];
+        btCollisionObject* obA = static_cast<btCollisionObject*>(contactManifold->getBody0());
+        btCollisionObject* obB = static_cast<btCollisionObject*>(contactManifold->getBody1());
+        ChModelBullet* modelA = (ChModelBullet*)obA->getUserPointer();
+        ChModelBullet* modelB = (ChModelBullet*)obB->getUserPointer();
+
+        // Execute custom broadphase callback, if any
+        if (this->broad_callback && !this->broad_callback->OnBroadphase(modelA, modelB))
+            continue;
+
+        for (int k = offsets[i]; k < offsets[i + 1]; k++) {
+            if (!valid[k])
+                continue;
+
+            // Execute some user custom callback, if any
+            if (this->narrow_callback)
+                this->narrow_callback->OnNarrowphase(contacts[k]);
+
+            // Add to contact container
+            mcontactcontainer->AddContact(contacts[k]);
+        }
+    }
+    mcontactcontainer->EndAddContact();
+}
+
 void ChCollisionSystemBullet::ReportProximities(ChProximityContainer* mproximitycontainer) {
     mproximitycontainer->BeginAddProximities();
     /*
@@ -1433,6 +1961,193 @@ bool ChCollisionSystemBullet::RayHit(const ChVector<>& from,
     return true;
 }
 
+// -----------------------------------------------------------------------------
+// Batched ray-hit and sphere-cast tests
+// -----------------------------------------------------------------------------
+
+// Closest-hit callback (ray test or convex sweep) that skips the collision objects in the given set
+// (accept = false) or considers only those (accept = true).
+template <class Callback>
+class btFilteredClosestCallback : public Callback {
+  public:
+    btFilteredClosestCallback(const btVector3& from,
+                              const btVector3& to,
+                              const std::unordered_set<btCollisionObject*>& objects,
+                              bool accept)
+        : Callback(from, to), m_objects(objects), m_accept(accept) {}
+
+    virtual bool needsCollision(btBroadphaseProxy* proxy) const override {
+        btCollisionObject* object = static_cast<btCollisionObject*>(proxy->m_clientObject);
+        return Callback::needsCollision(proxy) && (m_objects.count(object) > 0) == m_accept;
+    }
+
+  private:
+    const std::unordered_set<btCollisionObject*>& m_objects;
+    bool m_accept;
+};
+
+static btCollisionObject* GetHitObject(const btCollisionWorld::ClosestRayResultCallback& callback) {
+    return callback.m_collisionObject;
+}
+
+static btCollisionObject* GetHitObject(const btCollisionWorld::ClosestConvexResultCallback& callback) {
+    return callback.m_hitCollisionObject;
+}
+
+// Copy the closest hit recorded by the callback (if any) in the ray-hit result.
+template <class Callback>
+static bool SetRayhitResult(const Callback& callback, ChCollisionSystem::ChRayhitResult& mresult) {
+    btCollisionObject* object = GetHitObject(callback);
+    mresult.hitModel = object ? static_cast<ChCollisionModel*>(object->getUserPointer()) : nullptr;
+    mresult.hit = mresult.hitModel != nullptr;
+    if (!mresult.hit)
+        return false;
+    mresult.abs_hitPoint.Set(callback.m_hitPointWorld.x(), callback.m_hitPointWorld.y(), callback.m_hitPointWorld.z());
+    mresult.abs_hitNormal.Set(callback.m_hitNormalWorld.x(), callback.m_hitNormalWorld.y(),
+                              callback.m_hitNormalWorld.z());
+    mresult.abs_hitNormal.Normalize();
+    mresult.dist_factor = callback.m_closestHitFraction;
+    return true;
+}
+
+// Run a batch of closest-hit queries, in parallel over the queries. The query function performs the
+// ray test or convex sweep between the given end points, with the given callback.
+// GImpact shapes lock their vertex buffers during queries (through an unprotected counter), so the
+// objects with GImpact shapes are queried in a second, sequential pass, starting from the closest hit
+// found in the first pass. All other queries only read the collision world.
+template <class Callback, class Query>
+static void RunBatch(btCollisionWorld* world,
+                     int num_threads,
+                     const std::vector<ChVector<>>& from,
+                     const std::vector<ChVector<>>& to,
+                     Query query,
+                     std::vector<ChCollisionSystem::ChRayhitResult>& results) {
+    int num_queries = (int)from.size();
+    results.resize(num_queries);
+
+    std::unordered_set<btCollisionObject*> sequential;
+    std::unordered_map<btCollisionShape*, bool> gimpact_shapes;
+    btCollisionObjectArray& objects = world->getCollisionObjectArray();
+    for (int i = 0; i < objects.size(); i++) {
+        if (btParallelCollisionDispatcher::HasGImpact(objects[i]->getCollisionShape(), gimpact_shapes))
+            sequential.insert(objects[i]);
+    }
+
+#pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads)
+    for (int i = 0; i < num_queries; i++) {
+        btVector3 btfrom((btScalar)from[i].x(), (btScalar)from[i].y(), (btScalar)from[i].z());
+        btVector3 btto((btScalar)to[i].x(), (btScalar)to[i].y(), (btScalar)to[i].z());
+        btFilteredClosestCallback<Callback> callback(btfrom, btto, sequential, false);
+        query(btfrom, btto, callback);
+        SetRayhitResult(callback, results[i]);
+    }
+
+    if (sequential.empty())
+        return;
+
+    for (int i = 0; i < num_queries; i++) {
+        btVector3 btfrom((btScalar)from[i].x(), (btScalar)from[i].y(), (btScalar)from[i].z());
+        btVector3 btto((btScalar)to[i].x(), (btScalar)to[i].y(), (btScalar)to[i].z());
+        btFilteredClosestCallback<Callback> callback(btfrom, btto, sequential, true);
+        if (results[i].hit)
+            callback.m_closestHitFraction = (btScalar)results[i].dist_factor;
+        query(btfrom, btto, callback);
+        if (GetHitObject(callback))
+            SetRayhitResult(callback, results[i]);
+    }
+}
+
+bool ChCollisionSystemBullet::SphereCast(const ChVector<>& from,
+                                         const ChVector<>& to,
+                                         double radius,
+                                         ChRayhitResult& mresult) const {
+    btVector3 btfrom((btScalar)from.x(), (btScalar)from.y(), (btScalar)from.z());
+    btVector3 btto((btScalar)to.x(), (btScalar)to.y(), (btScalar)to.z());
+    btSphereShape sphere((btScalar)radius);
+
+    btCollisionWorld::ClosestConvexResultCallback sweepCallback(btfrom, btto);
+
+    bt_collision_world->convexSweepTest(&sphere, btTransform(btQuaternion(0, 0, 0, 1), btfrom),
+                                        btTransform(btQuaternion(0, 0, 0, 1), btto), sweepCallback);
+
+    return SetRayhitResult(sweepCallback, mresult);
+}
+
+// Closest convex sweep callback for the continuous collision detection of a collision object: the object
+// itself and the objects it cannot collide with are skipped, and so are the hits on surfaces the swept
+// shape moves away from.
+class btSweptObjectCallback : public btCollisionWorld::ClosestConvexResultCallback {
+  public:
+    btSweptObjectCallback(btCollisionObject* object, const btVector3& from, const btVector3& to)
+        : ClosestConvexResultCallback(from, to), m_object(object) {
+        m_collisionFilterGroup = object->getBroadphaseHandle()->m_collisionFilterGroup;
+        m_collisionFilterMask = object->getBroadphaseHandle()->m_collisionFilterMask;
+    }
+
+    virtual bool needsCollision(btBroadphaseProxy* proxy) const override {
+        return proxy->m_clientObject != m_object && ClosestConvexResultCallback::needsCollision(proxy);
+    }
+
+    virtual btScalar addSingleResult(btCollisionWorld::LocalConvexResult& convexResult,
+                                     bool normalInWorldSpace) override {
+        btVector3 normal = normalInWorldSpace ? convexResult.m_hitNormalLocal
+                                              : convexResult.m_hitCollisionObject->getWorldTransform().getBasis() *
+                                                    convexResult.m_hitNormalLocal;
+        if (normal.dot(m_convexToWorld - m_convexFromWorld) >= 0)
+            return btScalar(1);
+        return ClosestConvexResultCallback::addSingleResult(convexResult, normalInWorldSpace);
+    }
+
+  private:
+    btCollisionObject* m_object;
+};
+
+bool ChCollisionSystemBullet::SweepSphere(ChCollisionModel* model,
+                                          const ChVector<>& from,
+                                          const ChVector<>& to,
+                                          double radius,
+                                          ChRayhitResult& mresult) const {
+    btCollisionObject* object = static_cast<ChModelBullet*>(model)->GetBulletModel();
+    if (!object->getBroadphaseHandle()) {
+        mresult.hit = false;
+        return false;
+    }
+
+    btVector3 btfrom((btScalar)from.x(), (btScalar)from.y(), (btScalar)from.z());
+    btVector3 btto((btScalar)to.x(), (btScalar)to.y(), (btScalar)to.z());
+    btSphereShape sphere((btScalar)radius);
+
+    btSweptObjectCallback sweepCallback(object, btfrom, btto);
+
+    bt_collision_world->convexSweepTest(&sphere, btTransform(btQuaternion(0, 0, 0, 1), btfrom),
+                                        btTransform(btQuaternion(0, 0, 0, 1), btto), sweepCallback);
+
+    return SetRayhitResult(sweepCallback, mresult);
+}
+
+void ChCollisionSystemBullet::BatchRayHit(const std::vector<ChVector<>>& from,
+                                          const std::vector<ChVector<>>& to,
+                                          std::vector<ChRayhitResult>& results) const {
+    btCollisionWorld* world = bt_collision_world;
+    auto query = [world](const btVector3& btfrom, const btVector3& btto,
+                         btCollisionWorld::RayResultCallback& callback) { world->rayTest(btfrom, btto, callback); };
+    RunBatch<btCollisionWorld::ClosestRayResultCallback>(world, num_threads, from, to, query, results);
+}
+
+void ChCollisionSystemBullet::BatchSphereCast(const std::vector<ChVector<>>& from,
+                                              const std::vector<ChVector<>>& to,
+                                              double radius,
+                                              std::vector<ChRayhitResult>& results) const {
+    btCollisionWorld* world = bt_collision_world;
+    btSphereShape sphere((btScalar)radius);
+    auto query = [world, &sphere](const btVector3& btfrom, const btVector3& btto,
+                                  btCollisionWorld::ConvexResultCallback& callback) {
+        world->convexSweepTest(&sphere, btTransform(btQuaternion(0, 0, 0, 1), btfrom),
+                               btTransform(btQuaternion(0, 0, 0, 1), btto), callback);
+    };
+    RunBatch<btCollisionWorld::ClosestConvexResultCallback>(world, num_threads, from, to, query, results);
+}
+
 void ChCollisionSystemBullet::SetContactBreakingThreshold(double threshold) {
     gContactBreakingThreshold = (btScalar)threshold;
 }
@@ -81,6 +81,44 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& mresult) const override;
 
+    /// Perform a sphere-cast test with all collision models.
+    virtual bool SphereCast(const ChVector<>& from,
+                            const ChVector<>& to,
+                            double radius,
+                            ChRayhitResult& mresult) const override;
+
+    /// Perform a sphere-cast test for the continuous collision detection of the given model.
+    virtual bool SweepSphere(ChCollisionModel* model,
+                             const ChVector<>& from,
+                             const ChVector<>& to,
+                             double radius,
+                             ChRayhitResult& mresult) const override;
+
+    /// Perform a batch of ray-hit tests with all collision models.
+    /// The rays are processed in parallel, with the number of threads set through SetNumThreads().
+    virtual void BatchRayHit(const std::vector<ChVector<>>& from,
+                             const std::vector<ChVector<>>& to,
+                             std::vector<ChRayhitResult>& results) const override;
+
+    /// Perform a batch of sphere-cast tests with all collision models.
+    /// The segments are processed in parallel, with the number of threads set through SetNumThreads().
+    virtual void BatchSphereCast(const std::vector<ChVector<>>& from,
+                                 const std::vector<ChVector<>>& to,
+                                 double radius,
+                                 std::vector<ChRayhitResult>& results) const override;
+
+    /// Set the number of threads used for the narrowphase and for reporting contacts (default: 1).
+    /// With more than one thread, the narrowphase of the broadphase pairs is processed in parallel
+    /// and contacts are reported in the order of the broadphase pairs, which does not depend on the
+    /// number of threads (with a single thread, the original sequential Bullet processing is used).
+    /// Pairs that share a compound or GImpact collision object are processed sequentially.
+    /// User callbacks (broadphase and narrowphase) are always invoked sequentially.
+    /// The same number of threads is used for batched ray-hit and sphere-cast tests.
+    void SetNumThreads(int nthreads);
+
+    /// Get the number of threads used for the narrowphase and for reporting contacts.
+    int GetNumThreads() const { return num_threads; }
+
     // For Bullet related stuff
     btCollisionWorld* GetBulletCollisionWorld() { return bt_collision_world; }
 
@@ -90,6 +128,9 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     static void SetContactBreakingThreshold(double threshold);
 
   private:
+    void ReportContactsParallel(ChContactContainer* mcontactcontainer);
+
+    int num_threads;
     btCollisionConfiguration* bt_collision_configuration;
     btCollisionDispatcher* bt_dispatcher;
     btBroadphaseInterface* bt_broadphase;
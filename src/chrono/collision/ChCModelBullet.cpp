@@ -19,9 +19,11 @@
 #include "chrono/collision/ChCCollisionUtils.h"
 #include "chrono/collision/ChCConvexDecomposition.h"
 #include "chrono/collision/ChCModelBullet.h"
+#include "chrono/collision/bullet/BulletCollision/BroadphaseCollision/btDbvt.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/bt2DShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btBarrelShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btCEtriangleShape.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/btSDFShape.h"
 #include "chrono/collision/bullet/BulletWorldImporter/btBulletWorldImporter.h"
 #include "chrono/collision/bullet/btBulletCollisionCommon.h"
 #include "chrono/collision/gimpact/GIMPACT/Bullet/btGImpactCollisionAlgorithm.h"
@@ -52,6 +54,7 @@ ChModelBullet::ChModelBullet() {
 ChModelBullet::~ChModelBullet() {
     // ClearModel(); not possible, would call GetPhysicsItem() that is pure virtual, enough to use instead..
     shapes.clear();
+    child_models.clear();
 
     bt_collision_object->setCollisionShape(0);
 
@@ -65,6 +68,7 @@ int ChModelBullet::ClearModel() {
     if (shapes.size() > 0) {
         // deletes shared pointers, so also deletes shapes if uniquely referenced
         shapes.clear();
+        child_models.clear();
 
         // tell to the parent collision system to remove this from collision system,
         // if still connected to a physical system
@@ -381,6 +385,106 @@ bool ChModelBullet::AddTriangleProxy(ChVector<>* p1,                ///< points
 }
 
 
+// Compound shape used to aggregate the shapes of child models.
+// The dynamic AABB tree of the base class is refit in place when the child shapes
+// deform, and the overall AABB is taken from the root of the tree (the base class
+// recomputes it by iterating over all children).
+class btRefitCompoundShape : public btCompoundShape {
+  public:
+    btRefitCompoundShape() : btCompoundShape(true), m_aabbMin(0, 0, 0), m_aabbMax(0, 0, 0) {}
+
+    virtual void getAabb(const btTransform& trans, btVector3& aabbMin, btVector3& aabbMax) const override {
+        btVector3 localHalfExtents = btScalar(0.5) * (m_aabbMax - m_aabbMin);
+        btVector3 localCenter = btScalar(0.5) * (m_aabbMax + m_aabbMin);
+        localHalfExtents += btVector3(getMargin(), getMargin(), getMargin());
+
+        btMatrix3x3 abs_b = trans.getBasis().absolute();
+        btVector3 center = trans(localCenter);
+        btVector3 extent = btVector3(abs_b[0].dot(localHalfExtents), abs_b[1].dot(localHalfExtents),
+                                     abs_b[2].dot(localHalfExtents));
+        aabbMin = center - extent;
+        aabbMax = center + extent;
+    }
+
+    virtual void recalculateLocalAabb() override { refit(); }
+
+    void refit() {
+        // Recompute the leaf volumes (independent, so done in parallel).
+        int num_children = getNumChildShapes();
+        btCompoundShapeChild* children = getChildList();
+#pragma omp parallel for
+        for (int i = 0; i < num_children; i++) {
+            btVector3 childMin, childMax;
+            children[i].m_childShape->getAabb(children[i].m_transform, childMin, childMax);
+            children[i].m_node->volume = btDbvtVolume::FromMM(childMin, childMax);
+        }
+
+        // Refit the internal nodes bottom-up.
+        btDbvt* tree = getDynamicAabbTree();
+        if (!tree->m_root) {
+            m_aabbMin.setValue(0, 0, 0);
+            m_aabbMax.setValue(0, 0, 0);
+            return;
+        }
+        refitNode(tree->m_root);
+        m_aabbMin = tree->m_root->volume.Mins();
+        m_aabbMax = tree->m_root->volume.Maxs();
+    }
+
+  private:
+    static void refitNode(btDbvtNode* node) {
+        if (node->isleaf())
+            return;
+        refitNode(node->childs[0]);
+        refitNode(node->childs[1]);
+        Merge(node->childs[0]->volume, node->childs[1]->volume, node->volume);
+    }
+
+    btVector3 m_aabbMin;
+    btVector3 m_aabbMax;
+};
+
+bool ChModelBullet::AddChildModels(const std::vector<ChModelBullet*>& models) {
+    if (shapes.size() > 0 || models.empty())
+        return false;
+
+    // All child shapes must be single centered shapes.
+    for (auto model : models) {
+        if (model->shapes.size() != 1 || model->bt_collision_object->getCollisionShape() != model->shapes[0].get())
+            return false;
+    }
+
+    // Use the margins of the child models.
+    this->SetSafeMargin(models[0]->GetSafeMargin());
+    this->SetEnvelope(models[0]->GetEnvelope());
+
+    btTransform identity;
+    identity.setIdentity();
+
+    btRefitCompoundShape* mcompound = new btRefitCompoundShape;
+    shapes.push_back(std::shared_ptr<btCollisionShape>(mcompound));
+    for (auto model : models) {
+        // Share the child shape, so that it stays alive as long as this model.
+        shapes.push_back(model->shapes[0]);
+        mcompound->addChildShape(identity, model->shapes[0].get());
+    }
+
+    // Balance the tree once; afterwards, it is only refit.
+    mcompound->getDynamicAabbTree()->optimizeTopDown();
+    mcompound->refit();
+
+    bt_collision_object->setCollisionShape(mcompound);
+    child_models = models;
+
+    return true;
+}
+
+void ChModelBullet::RefitChildModels() {
+    if (child_models.empty())
+        return;
+    static_cast<btRefitCompoundShape*>(shapes[0].get())->refit();
+}
+
 bool ChModelBullet::AddConvexHull(std::vector<ChVector<double> >& pointlist,
                                   const ChVector<>& pos,
                                   const ChMatrix33<>& rot) {
@@ -676,6 +780,22 @@ bool ChModelBullet::AddTriangleMeshConcave(const geometry::ChTriangleMesh& trime
     return true;
 }
 
+bool ChModelBullet::AddSignedDistanceField(std::shared_ptr<ChSignedDistanceField> sdf,
+                                           const ChVector<>& pos,
+                                           const ChMatrix33<>& rot) {
+    if (!sdf || sdf->GetNumBlocks() == 0)
+        return false;
+
+    // The margin of the shape is used as the outward envelope of the surface.
+    btSDFShape* pShape = new btSDFShape(sdf);
+    pShape->setMargin((btScalar) this->GetEnvelope());
+    this->SetSafeMargin(0);
+
+    _injectShape(pos, rot, pShape);
+
+    return true;
+}
+
 bool ChModelBullet::AddTriangleMeshConcaveDecomposed(ChConvexDecomposition& mydecomposition,
                                                      const ChVector<>& pos,
                                                      const ChMatrix33<>& rot) {
@@ -799,6 +919,8 @@ void ChModelBullet::SyncPosition()
                        (btScalar)rA(1, 1), (btScalar)rA(1, 2), (btScalar)rA(2, 0), (btScalar)rA(2, 1),
                        (btScalar)rA(2, 2));
     bt_collision_object->getWorldTransform().setBasis(basisA);
+
+    RefitChildModels();
 }
 
 
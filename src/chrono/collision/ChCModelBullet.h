@@ -45,6 +45,9 @@ class ChApi ChModelBullet : public ChCollisionModel {
     // Vector of shared pointers to geometric objects.
     std::vector<std::shared_ptr<btCollisionShape>> shapes;
 
+    // Child models whose shapes were aggregated in this model (see AddChildModels).
+    std::vector<ChModelBullet*> child_models;
+
   public:
     ChModelBullet();
     virtual ~ChModelBullet();
@@ -156,6 +159,13 @@ class ChApi ChModelBullet : public ChCollisionModel {
                                  const ChMatrix33<>& rot = ChMatrix33<>(1),
                                  double sphereswept_thickness = 0.0);
 
+    /// Add a signed distance field to this model (see ChCollisionModel::AddSignedDistanceField).
+    /// Contacts with spheres use the distance at the sphere center, contacts with boxes and convex hulls
+    /// use the distance at their vertices, other convex shapes use a support point along the field gradient.
+    virtual bool AddSignedDistanceField(std::shared_ptr<ChSignedDistanceField> sdf,
+                                        const ChVector<>& pos = ChVector<>(),
+                                        const ChMatrix33<>& rot = ChMatrix33<>(1)) override;
+
     /// CUSTOM for this class only: add a concave triangle mesh that will be managed
     /// by GImpact mesh-mesh algorithm. Note that, despite this can work with
     /// arbitrary meshes, there could be issues of robustness and precision, so
@@ -237,6 +247,28 @@ class ChApi ChModelBullet : public ChCollisionModel {
     /// The 'another' model must be of ChModelBullet subclass.
     virtual bool AddCopyOfAnotherModel(ChCollisionModel* another);
 
+    /// Aggregate the shapes of the specified models in a single compound shape of this model.
+    /// Each child model must contain a single centered shape (e.g., a triangle proxy), and must not be added
+    /// to the collision system itself. The child shapes are organized in a bounding volume hierarchy which is
+    /// refit (not rebuilt) at each SyncPosition(), so that a deformable surface with many faces is inserted in
+    /// the broadphase as a single object. Contacts on a child shape are reported for the corresponding child
+    /// model. The child models must outlive this model. Must be called on an empty model.
+    bool AddChildModels(const std::vector<ChModelBullet*>& models);
+
+    /// Get the number of child models aggregated in this model.
+    int GetNumChildModels() const { return (int)child_models.size(); }
+
+    /// Get the child model corresponding to the specified child shape index.
+    /// Return this model if it has no child models or if the index is invalid.
+    ChModelBullet* GetChildModel(int index) {
+        return (index >= 0 && index < (int)child_models.size()) ? child_models[index] : this;
+    }
+
+    /// Update the bounding volume hierarchy of the child shapes after they were deformed.
+    /// Leaf bounding boxes are recomputed in parallel, then internal nodes are refit bottom-up.
+    /// Called automatically by SyncPosition().
+    void RefitChildModels();
+
     virtual void SetFamily(int mfamily);
     virtual int GetFamily();
     virtual void SetFamilyMaskNoCollisionWithFamily(int mfamily);
@@ -260,7 +292,8 @@ class ChApi ChModelBullet : public ChCollisionModel {
     virtual void GetAABB(ChVector<>& bbmin, ChVector<>& bbmax) const;
 
     /// Sets the position and orientation of the collision
-    /// model as the current position of the corresponding ChContactable
+    /// model as the current position of the corresponding ChContactable.
+    /// If this model aggregates child models, also refit their bounding volume hierarchy.
     virtual void SyncPosition();
 
     /// If the collision shape is a sphere, resize it and return true (if no
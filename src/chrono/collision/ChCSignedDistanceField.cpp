@@ -0,0 +1,448 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+
+#include "chrono/collision/ChCSignedDistanceField.h"
+
+namespace chrono {
+namespace collision {
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Welded triangle mesh, with the angle-weighted pseudo-normals of its faces, edges and vertices.
+struct PseudoNormalMesh {
+    std::vector<ChVector<>> vertices;
+    std::vector<ChVector<int>> triangles;
+    std::vector<ChVector<>> face_normals;
+    std::vector<ChVector<>> edge_normals;  // 3 per triangle, edge k from vertex k to vertex k+1
+    std::vector<ChVector<>> vertex_normals;
+};
+
+struct VertexLess {
+    bool operator()(const ChVector<>& a, const ChVector<>& b) const {
+        if (a.x() != b.x())
+            return a.x() < b.x();
+        if (a.y() != b.y())
+            return a.y() < b.y();
+        return a.z() < b.z();
+    }
+};
+
+void BuildPseudoNormalMesh(const geometry::ChTriangleMesh& trimesh, PseudoNormalMesh& mesh) {
+    // Weld coincident vertices and discard degenerate triangles.
+    std::map<ChVector<>, int, VertexLess> vertex_map;
+    for (int i = 0; i < trimesh.getNumTriangles(); i++) {
+        geometry::ChTriangle triangle = trimesh.getTriangle(i);
+        const ChVector<>* points[3] = {&triangle.p1, &triangle.p2, &triangle.p3};
+        ChVector<int> tri;
+        for (int k = 0; k < 3; k++) {
+            auto it = vertex_map.find(*points[k]);
+            if (it == vertex_map.end()) {
+                it = vertex_map.insert(std::make_pair(*points[k], (int)mesh.vertices.size())).first;
+                mesh.vertices.push_back(*points[k]);
+            }
+            tri[k] = it->second;
+        }
+        ChVector<> n = Vcross(*points[1] - *points[0], *points[2] - *points[0]);
+        if (n.Length2() == 0)
+            continue;
+        mesh.triangles.push_back(tri);
+        mesh.face_normals.push_back(n.GetNormalized());
+    }
+
+    // Vertex normals: sum of the incident face normals, weighted by the incident angles.
+    // Edge normals: sum of the normals of the (one or two) faces sharing the edge.
+    mesh.vertex_normals.assign(mesh.vertices.size(), VNULL);
+    std::map<std::pair<int, int>, ChVector<>> edge_map;
+    for (size_t t = 0; t < mesh.triangles.size(); t++) {
+        const ChVector<int>& tri = mesh.triangles[t];
+        for (int k = 0; k < 3; k++) {
+            const ChVector<>& v = mesh.vertices[tri[k]];
+            ChVector<> e1 = (mesh.vertices[tri[(k + 1) % 3]] - v).GetNormalized();
+            ChVector<> e2 = (mesh.vertices[tri[(k + 2) % 3]] - v).GetNormalized();
+            double angle = std::acos(std::max(-1.0, std::min(1.0, Vdot(e1, e2))));
+            mesh.vertex_normals[tri[k]] += mesh.face_normals[t] * angle;
+            std::pair<int, int> key(std::min(tri[k], tri[(k + 1) % 3]), std::max(tri[k], tri[(k + 1) % 3]));
+            edge_map[key] += mesh.face_normals[t];
+        }
+    }
+    mesh.edge_normals.resize(3 * mesh.triangles.size());
+    for (size_t t = 0; t < mesh.triangles.size(); t++) {
+        const ChVector<int>& tri = mesh.triangles[t];
+        for (int k = 0; k < 3; k++) {
+            std::pair<int, int> key(std::min(tri[k], tri[(k + 1) % 3]), std::max(tri[k], tri[(k + 1) % 3]));
+            mesh.edge_normals[3 * t + k] = edge_map[key];
+        }
+    }
+}
+
+// Closest point q on the triangle (a,b,c) to the point p (Ericson, Real-Time Collision Detection, 5.1.5).
+// Return the feature containing q: -1 for the face, k for vertex k, 3+k for the edge from vertex k to k+1.
+int ClosestPointTriangle(const ChVector<>& p,
+                         const ChVector<>& a,
+                         const ChVector<>& b,
+                         const ChVector<>& c,
+                         ChVector<>& q) {
+    ChVector<> ab = b - a;
+    ChVector<> ac = c - a;
+    ChVector<> ap = p - a;
+    double d1 = Vdot(ab, ap);
+    double d2 = Vdot(ac, ap);
+    if (d1 <= 0 && d2 <= 0) {
+        q = a;
+        return 0;
+    }
+    ChVector<> bp = p - b;
+    double d3 = Vdot(ab, bp);
+    double d4 = Vdot(ac, bp);
+    if (d3 >= 0 && d4 <= d3) {
+        q = b;
+        return 1;
+    }
+    double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        q = a + ab * (d1 / (d1 - d3));
+        return 3;
+    }
+    ChVector<> cp = p - c;
+    double d5 = Vdot(ab, cp);
+    double d6 = Vdot(ac, cp);
+    if (d6 >= 0 && d5 <= d6) {
+        q = c;
+        return 2;
+    }
+    double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        q = a + ac * (d2 / (d2 - d6));
+        return 5;
+    }
+    double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+        q = b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+        return 4;
+    }
+    double denom = 1 / (va + vb + vc);
+    q = a + ab * (vb * denom) + ac * (vc * denom);
+    return -1;
+}
+
+// Signed distance from the point p to the specified triangle, using the pseudo-normal of the closest feature.
+double SignedDistance(const PseudoNormalMesh& mesh, int t, const ChVector<>& p) {
+    const ChVector<int>& tri = mesh.triangles[t];
+    ChVector<> q;
+    int feature = ClosestPointTriangle(p, mesh.vertices[tri[0]], mesh.vertices[tri[1]], mesh.vertices[tri[2]], q);
+    const ChVector<>& n = (feature < 0) ? mesh.face_normals[t]
+                                        : (feature < 3 ? mesh.vertex_normals[tri[feature]]
+                                                       : mesh.edge_normals[3 * t + feature - 3]);
+    double d = (p - q).Length();
+    return Vdot(p - q, n) >= 0 ? d : -d;
+}
+
+// Signed distance from the point p to the closest of the specified triangles.
+double SignedDistance(const PseudoNormalMesh& mesh, const std::vector<int>& triangles, const ChVector<>& p) {
+    double dist = std::numeric_limits<double>::max();
+    for (auto t : triangles) {
+        double d = SignedDistance(mesh, t, p);
+        if (std::abs(d) < std::abs(dist))
+            dist = d;
+    }
+    return dist;
+}
+
+const char sdf_file_tag[8] = {'C', 'H', 'S', 'D', 'F', '0', '0', '1'};
+
+}  // end anonymous namespace
+
+// -----------------------------------------------------------------------------
+
+const int ChSignedDistanceField::block_size;
+const int ChSignedDistanceField::block_nodes;
+const int ChSignedDistanceField::block_outside;
+const int ChSignedDistanceField::block_inside;
+
+ChSignedDistanceField::ChSignedDistanceField() : m_spacing(0), m_band(0), m_num_blocks(0, 0, 0) {}
+
+bool ChSignedDistanceField::Build(const geometry::ChTriangleMesh& trimesh,
+                                  double spacing,
+                                  double band_width) {
+    if (spacing <= 0 || band_width <= 0)
+        return false;
+
+    PseudoNormalMesh mesh;
+    BuildPseudoNormalMesh(trimesh, mesh);
+    if (mesh.triangles.empty())
+        return false;
+
+    // Grid covering the mesh bounding box, inflated by the band half-width, with an integer number of blocks.
+    m_bbmin = mesh.vertices[0];
+    m_bbmax = mesh.vertices[0];
+    for (const auto& v : mesh.vertices) {
+        m_bbmin = ChVector<>(std::min(m_bbmin.x(), v.x()), std::min(m_bbmin.y(), v.y()), std::min(m_bbmin.z(), v.z()));
+        m_bbmax = ChVector<>(std::max(m_bbmax.x(), v.x()), std::max(m_bbmax.y(), v.y()), std::max(m_bbmax.z(), v.z()));
+    }
+    m_bbmin -= ChVector<>(band_width);
+    m_bbmax += ChVector<>(band_width);
+    m_spacing = spacing;
+    m_band = band_width;
+    m_origin = m_bbmin;
+    double block_length = block_size * spacing;
+    for (int i = 0; i < 3; i++)
+        m_num_blocks[i] = std::max(1, (int)std::ceil((m_bbmax[i] - m_bbmin[i]) / block_length));
+    int num_blocks = m_num_blocks.x() * m_num_blocks.y() * m_num_blocks.z();
+
+    // Candidate triangles of each block: those whose bounding box, inflated by the band half-width, overlaps
+    // the block. These include all triangles within the band of any node of the block.
+    std::vector<std::vector<int>> candidates(num_blocks);
+    for (int t = 0; t < (int)mesh.triangles.size(); t++) {
+        const ChVector<int>& tri = mesh.triangles[t];
+        ChVector<int> bmin, bmax;
+        for (int i = 0; i < 3; i++) {
+            double v0 = mesh.vertices[tri[0]][i];
+            double v1 = mesh.vertices[tri[1]][i];
+            double v2 = mesh.vertices[tri[2]][i];
+            double tmin = std::min(std::min(v0, v1), v2);
+            double tmax = std::max(std::max(v0, v1), v2);
+            bmin[i] = std::max(0, (int)std::floor((tmin - band_width - m_origin[i]) / block_length));
+            bmax[i] = std::min(m_num_blocks[i] - 1, (int)std::floor((tmax + band_width - m_origin[i]) / block_length));
+        }
+        for (int bz = bmin.z(); bz <= bmax.z(); bz++)
+            for (int by = bmin.y(); by <= bmax.y(); by++)
+                for (int bx = bmin.x(); bx <= bmax.x(); bx++)
+                    candidates[(bz * m_num_blocks.y() + by) * m_num_blocks.x() + bx].push_back(t);
+    }
+
+    // Sampled blocks are those with candidate triangles.
+    m_block_index.assign(num_blocks, block_outside);
+    std::vector<int> sampled;
+    for (int b = 0; b < num_blocks; b++) {
+        if (!candidates[b].empty()) {
+            m_block_index[b] = (int)sampled.size();
+            sampled.push_back(b);
+        }
+    }
+    m_values.assign(sampled.size() * block_nodes, 0.0f);
+
+    // Sample the distance at all nodes of the sampled blocks, clamped to the band.
+#pragma omp parallel for schedule(dynamic)
+    for (int s = 0; s < (int)sampled.size(); s++) {
+        int b = sampled[s];
+        int bx = b % m_num_blocks.x();
+        int by = (b / m_num_blocks.x()) % m_num_blocks.y();
+        int bz = b / (m_num_blocks.x() * m_num_blocks.y());
+        float* values = &m_values[s * block_nodes];
+        int n = 0;
+        for (int k = 0; k <= block_size; k++) {
+            for (int j = 0; j <= block_size; j++) {
+                for (int i = 0; i <= block_size; i++) {
+                    ChVector<> node(bx * block_size + i, by * block_size + j, bz * block_size + k);
+                    ChVector<> p = m_origin + node * spacing;
+                    double d = SignedDistance(mesh, candidates[b], p);
+                    values[n++] = (float)std::max(-band_width, std::min(band_width, d));
+                }
+            }
+        }
+    }
+
+    // The surface does not cross unsampled blocks, so each connected region of unsampled blocks lies entirely
+    // inside or outside the mesh: classify each region with the sign of the distance at one of its blocks.
+    std::vector<int> region(num_blocks, -1);
+    std::vector<int> stack;
+    std::vector<int> all_triangles(mesh.triangles.size());
+    for (int t = 0; t < (int)all_triangles.size(); t++)
+        all_triangles[t] = t;
+    for (int b = 0; b < num_blocks; b++) {
+        if (m_block_index[b] >= 0 || region[b] >= 0)
+            continue;
+        int bx = b % m_num_blocks.x();
+        int by = (b / m_num_blocks.x()) % m_num_blocks.y();
+        int bz = b / (m_num_blocks.x() * m_num_blocks.y());
+        ChVector<> center = m_origin + ChVector<>(bx + 0.5, by + 0.5, bz + 0.5) * block_length;
+        int flag = SignedDistance(mesh, all_triangles, center) < 0 ? block_inside : block_outside;
+
+        // Flood fill the region (6-connected neighbors).
+        region[b] = b;
+        stack.push_back(b);
+        while (!stack.empty()) {
+            int c = stack.back();
+            stack.pop_back();
+            m_block_index[c] = flag;
+            int cx = c % m_num_blocks.x();
+            int cy = (c / m_num_blocks.x()) % m_num_blocks.y();
+            int cz = c / (m_num_blocks.x() * m_num_blocks.y());
+            int nbrs[6][3] = {{cx - 1, cy, cz}, {cx + 1, cy, cz}, {cx, cy - 1, cz},
+                              {cx, cy + 1, cz}, {cx, cy, cz - 1}, {cx, cy, cz + 1}};
+            for (auto& nb : nbrs) {
+                if (nb[0] < 0 || nb[1] < 0 || nb[2] < 0 || nb[0] >= m_num_blocks.x() || nb[1] >= m_num_blocks.y() ||
+                    nb[2] >= m_num_blocks.z())
+                    continue;
+                int n = (nb[2] * m_num_blocks.y() + nb[1]) * m_num_blocks.x() + nb[0];
+                if (candidates[n].empty() && region[n] < 0) {
+                    region[n] = b;
+                    stack.push_back(n);
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool ChSignedDistanceField::Save(const std::string& filename) const {
+    std::ofstream stream(filename, std::ios::binary);
+    if (!stream.good())
+        return false;
+
+    int num_blocks = (int)m_block_index.size();
+    int num_values = (int)m_values.size();
+    double header[9] = {m_origin.x(), m_origin.y(), m_origin.z(), m_bbmin.x(), m_bbmin.y(),
+                        m_bbmin.z(),  m_bbmax.x(),  m_bbmax.y(),  m_bbmax.z()};
+    stream.write(sdf_file_tag, sizeof(sdf_file_tag));
+    stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+    stream.write(reinterpret_cast<const char*>(&m_spacing), sizeof(double));
+    stream.write(reinterpret_cast<const char*>(&m_band), sizeof(double));
+    for (int i = 0; i < 3; i++) {
+        int n = m_num_blocks[i];
+        stream.write(reinterpret_cast<const char*>(&n), sizeof(int));
+    }
+    stream.write(reinterpret_cast<const char*>(&num_blocks), sizeof(int));
+    stream.write(reinterpret_cast<const char*>(&num_values), sizeof(int));
+    stream.write(reinterpret_cast<const char*>(m_block_index.data()), num_blocks * sizeof(int));
+    stream.write(reinterpret_cast<const char*>(m_values.data()), num_values * sizeof(float));
+
+    return stream.good();
+}
+
+bool ChSignedDistanceField::Load(const std::string& filename) {
+    std::ifstream stream(filename, std::ios::binary);
+    if (!stream.good())
+        return false;
+
+    char tag[sizeof(sdf_file_tag)];
+    stream.read(tag, sizeof(tag));
+    if (!stream.good() || std::memcmp(tag, sdf_file_tag, sizeof(tag)) != 0)
+        return false;
+
+    double header[9];
+    double spacing, band;
+    int nb[3];
+    int num_blocks, num_values;
+    stream.read(reinterpret_cast<char*>(header), sizeof(header));
+    stream.read(reinterpret_cast<char*>(&spacing), sizeof(double));
+    stream.read(reinterpret_cast<char*>(&band), sizeof(double));
+    stream.read(reinterpret_cast<char*>(nb), sizeof(nb));
+    stream.read(reinterpret_cast<char*>(&num_blocks), sizeof(int));
+    stream.read(reinterpret_cast<char*>(&num_values), sizeof(int));
+    if (!stream.good() || num_blocks != nb[0] * nb[1] * nb[2] || num_values % block_nodes != 0)
+        return false;
+
+    std::vector<int> block_index(num_blocks);
+    std::vector<float> values(num_values);
+    stream.read(reinterpret_cast<char*>(block_index.data()), num_blocks * sizeof(int));
+    stream.read(reinterpret_cast<char*>(values.data()), num_values * sizeof(float));
+    if (!stream.good())
+        return false;
+    for (auto b : block_index) {
+        if (b >= num_values / block_nodes || b < block_inside)
+            return false;
+    }
+
+    m_origin = ChVector<>(header[0], header[1], header[2]);
+    m_bbmin = ChVector<>(header[3], header[4], header[5]);
+    m_bbmax = ChVector<>(header[6], header[7], header[8]);
+    m_spacing = spacing;
+    m_band = band;
+    m_num_blocks = ChVector<int>(nb[0], nb[1], nb[2]);
+    m_block_index.swap(block_index);
+    m_values.swap(values);
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+double ChSignedDistanceField::GetDistance(const ChVector<>& point, ChVector<>* gradient) const {
+    if (gradient)
+        *gradient = VNULL;
+    if (m_block_index.empty())
+        return m_band;
+
+    // Grid cell containing the point, and local coordinates in the cell.
+    ChVector<> q = (point - m_origin) / m_spacing;
+    int cell[3];
+    double f[3];
+    for (int i = 0; i < 3; i++) {
+        double c = std::floor(q[i]);
+        if (c < 0 || c >= m_num_blocks[i] * block_size)
+            return m_band;
+        cell[i] = (int)c;
+        f[i] = q[i] - c;
+    }
+
+    int block = GetBlock(cell[0] / block_size, cell[1] / block_size, cell[2] / block_size);
+    if (block < 0)
+        return block == block_inside ? -m_band : m_band;
+
+    // Trilinear interpolation of the 8 nodes of the cell, all within the same block.
+    const int sx = 1;
+    const int sy = block_size + 1;
+    const int sz = sy * sy;
+    const float* v = &m_values[block * block_nodes + (cell[2] % block_size) * sz + (cell[1] % block_size) * sy +
+                               (cell[0] % block_size) * sx];
+    double v000 = v[0], v100 = v[sx], v010 = v[sy], v110 = v[sx + sy];
+    double v001 = v[sz], v101 = v[sx + sz], v011 = v[sy + sz], v111 = v[sx + sy + sz];
+
+    double v00 = v000 + (v100 - v000) * f[0];
+    double v10 = v010 + (v110 - v010) * f[0];
+    double v01 = v001 + (v101 - v001) * f[0];
+    double v11 = v011 + (v111 - v011) * f[0];
+    double v0 = v00 + (v10 - v00) * f[1];
+    double v1 = v01 + (v11 - v01) * f[1];
+
+    if (gradient) {
+        double dx0 = (v100 - v000) + ((v110 - v010) - (v100 - v000)) * f[1];
+        double dx1 = (v101 - v001) + ((v111 - v011) - (v101 - v001)) * f[1];
+        double dy0 = (v10 - v00);
+        double dy1 = (v11 - v01);
+        *gradient = ChVector<>(dx0 + (dx1 - dx0) * f[2], dy0 + (dy1 - dy0) * f[2], v1 - v0) / m_spacing;
+    }
+
+    return v0 + (v1 - v0) * f[2];
+}
+
+bool ChSignedDistanceField::IsSampled(const ChVector<>& point) const {
+    if (m_block_index.empty())
+        return false;
+    ChVector<> q = (point - m_origin) / m_spacing;
+    int block[3];
+    for (int i = 0; i < 3; i++) {
+        double c = std::floor(q[i]);
+        if (c < 0 || c >= m_num_blocks[i] * block_size)
+            return false;
+        block[i] = (int)c / block_size;
+    }
+    return GetBlock(block[0], block[1], block[2]) >= 0;
+}
+
+}  // end namespace collision
+}  // end namespace chrono
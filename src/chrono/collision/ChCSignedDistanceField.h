@@ -0,0 +1,105 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CHC_SIGNEDDISTANCEFIELD_H
+#define CHC_SIGNEDDISTANCEFIELD_H
+
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChVector.h"
+#include "chrono/geometry/ChTriangleMesh.h"
+
+namespace chrono {
+namespace collision {
+
+/// Signed distance field (SDF) of a closed triangle mesh, sampled on a sparse voxel grid.
+/// The distance (positive outside, negative inside) is sampled at the nodes of a regular grid, but only
+/// in the blocks of 8x8x8 cells that intersect a narrow band around the surface; each block stores all
+/// its 9x9x9 nodes, so that the distance at any point is obtained in constant time by trilinear
+/// interpolation of the samples of a single block. Outside the sampled blocks, the distance is reported
+/// as +/- the band half-width, depending on the side of the surface.\n
+/// The field is typically built offline (see Build) and saved to a binary file (see Save), then loaded
+/// at run time (see Load) and used as a collision shape for static geometry (see
+/// ChCollisionModel::AddSignedDistanceField), with sphere and vertex contacts.
+class ChApi ChSignedDistanceField {
+  public:
+    ChSignedDistanceField();
+    ~ChSignedDistanceField() {}
+
+    /// Build the field from a closed, consistently oriented triangle mesh (normals pointing outside).
+    /// The distance is sampled with the given grid spacing in all blocks within the specified band
+    /// half-width from the surface; the band should be larger than the largest expected penetration plus
+    /// the radius of the colliding spheres. The sign is obtained from the angle-weighted pseudo-normal of
+    /// the closest mesh feature. Coincident mesh vertices are welded.
+    /// Returns false if the mesh is empty or the parameters are not positive.
+    bool Build(const geometry::ChTriangleMesh& mesh, double spacing, double band_width);
+
+    /// Save the field to a binary file. Returns false if the file cannot be written.
+    bool Save(const std::string& filename) const;
+
+    /// Load the field from a binary file created with Save(). Returns false if the file cannot be read.
+    bool Load(const std::string& filename);
+
+    /// Evaluate the signed distance at the given point (expressed in the mesh frame).
+    /// If requested, also return the gradient of the interpolated field (approximately the outward unit
+    /// normal of the closest surface point); the gradient is zero outside the sampled blocks.
+    double GetDistance(const ChVector<>& point, ChVector<>* gradient = nullptr) const;
+
+    /// Return true if the given point (expressed in the mesh frame) is in a sampled block.
+    bool IsSampled(const ChVector<>& point) const;
+
+    /// Get the bounding box of the region within the band half-width from the surface (in the mesh frame).
+    void GetBoundingBox(ChVector<>& bbmin, ChVector<>& bbmax) const {
+        bbmin = m_bbmin;
+        bbmax = m_bbmax;
+    }
+
+    /// Get the grid spacing.
+    double GetSpacing() const { return m_spacing; }
+
+    /// Get the band half-width.
+    double GetBandWidth() const { return m_band; }
+
+    /// Get the number of sampled blocks.
+    int GetNumSampledBlocks() const { return (int)(m_values.size() / block_nodes); }
+
+    /// Get the total number of blocks in the grid.
+    int GetNumBlocks() const { return (int)m_block_index.size(); }
+
+  private:
+    static const int block_size = 8;                                                  ///< cells per block edge
+    static const int block_nodes = (block_size + 1) * (block_size + 1) * (block_size + 1);  ///< nodes per block
+    static const int block_outside = -1;                                              ///< unsampled block outside
+    static const int block_inside = -2;                                               ///< unsampled block inside
+
+    int GetBlock(int bx, int by, int bz) const {
+        return m_block_index[(bz * m_num_blocks.y() + by) * m_num_blocks.x() + bx];
+    }
+
+    ChVector<> m_origin;              ///< position of the first grid node
+    double m_spacing;                 ///< grid spacing
+    double m_band;                    ///< band half-width
+    ChVector<int> m_num_blocks;       ///< number of blocks in each direction
+    ChVector<> m_bbmin;               ///< lower corner of the bounding box
+    ChVector<> m_bbmax;               ///< upper corner of the bounding box
+    std::vector<int> m_block_index;   ///< block offsets in m_values (or block_outside / block_inside)
+    std::vector<float> m_values;      ///< distance samples of the sampled blocks (x fastest)
+};
+
+}  // end namespace collision
+}  // end namespace chrono
+
+#endif
@@ -64,6 +64,8 @@ CONCAVE_SHAPES_START_HERE,
     // for 2d collision between polylines:
     ARC_SHAPE_PROXYTYPE,   //***ALEX***
     SEGMENT_SHAPE_PROXYTYPE,   //***ALEX***
+    // signed distance fields:
+    SDF_SHAPE_PROXYTYPE,   //***CHRONO***
 ///Used for GIMPACT Trimesh integration
 	GIMPACT_SHAPE_PROXYTYPE,
 ///Multimaterial mesh
@@ -49,7 +49,8 @@ struct btDispatcherInfo
 		m_useConvexConservativeDistanceUtil(false),
 		m_convexConservativeDistanceThreshold(0.0f),
 		m_convexMaxDistanceUseCPT(false),
-		m_stackAllocator(0)
+		m_stackAllocator(0),
+		m_concurrentDispatch(false)
 	{
 
 	}
@@ -67,6 +68,7 @@ struct btDispatcherInfo
 	btScalar	m_convexConservativeDistanceThreshold;
 	bool		m_convexMaxDistanceUseCPT;
 	btStackAlloc*	m_stackAllocator;
+	mutable bool	m_concurrentDispatch;	//***CHRONO*** true while pairs are processed concurrently
 };
 
 ///The btDispatcher interface class can be used in combination with broadphase to dispatch calculations for overlapping pairs.
@@ -487,9 +487,9 @@ void	btCollisionWorld::rayTestSingle(const btTransform& rayFromTrans,const btTra
 						const btTransform& childTrans = m_compoundShape->getChildTransform(i);
 						btTransform childWorldTrans = m_colObjWorldTransform * childTrans;
 						
-						// replace collision shape so that callback can determine the triangle
-						btCollisionShape* saveCollisionShape = m_collisionObject->getCollisionShape();
-						m_collisionObject->internalSetTemporaryCollisionShape((btCollisionShape*)childCollisionShape);
+						//***CHRONO*** do not replace the collision shape of the object (the child shape is passed
+						// explicitly and its index is reported in the shape info), so that concurrent ray tests
+						// only read the collision objects
 
 						LocalInfoAdder2 my_cb(i, &m_resultCallback);
 
@@ -500,9 +500,6 @@ void	btCollisionWorld::rayTestSingle(const btTransform& rayFromTrans,const btTra
 							childCollisionShape,
 							childWorldTrans,
 							my_cb);
-						
-						// restore
-						m_collisionObject->internalSetTemporaryCollisionShape(saveCollisionShape);
 					}
 					
 					void Process(const btDbvtNode* leaf)
@@ -718,7 +715,8 @@ void	btCollisionWorld::objectQuerySingle(const btConvexShape* castShape,const bt
 			///@todo : use AABB tree or other BVH acceleration structure!
 			if (collisionShape->isCompound())
 			{
-				BT_PROFILE("convexSweepCompound");
+				//***CHRONO*** no profiling, so that concurrent sweep tests only read the collision world
+				//BT_PROFILE("convexSweepCompound");
 				const btCompoundShape* compoundShape = static_cast<const btCompoundShape*>(collisionShape);
 				int i=0;
 				for (i=0;i<compoundShape->getNumChildShapes();i++)
@@ -726,9 +724,7 @@ void	btCollisionWorld::objectQuerySingle(const btConvexShape* castShape,const bt
 					btTransform childTrans = compoundShape->getChildTransform(i);
 					const btCollisionShape* childCollisionShape = compoundShape->getChildShape(i);
 					btTransform childWorldTrans = colObjWorldTransform * childTrans;
-					// replace collision shape so that callback can determine the triangle
-					btCollisionShape* saveCollisionShape = collisionObject->getCollisionShape();
-					collisionObject->internalSetTemporaryCollisionShape((btCollisionShape*)childCollisionShape);
+					//***CHRONO*** do not replace the collision shape of the object (see rayTestSingle)
                     struct	LocalInfoAdder : public ConvexResultCallback {
                             ConvexResultCallback* m_userCallback;
 							int m_i;
@@ -760,8 +756,6 @@ void	btCollisionWorld::objectQuerySingle(const btConvexShape* castShape,const bt
 						childCollisionShape,
 						childWorldTrans,
 						my_cb, allowedPenetration);
-					// restore
-					collisionObject->internalSetTemporaryCollisionShape(saveCollisionShape);
 				}
 			}
 		}
@@ -928,7 +922,8 @@ struct btSingleSweepCallback : public btBroadphaseRayCallback
 void	btCollisionWorld::convexSweepTest(const btConvexShape* castShape, const btTransform& convexFromWorld, const btTransform& convexToWorld, ConvexResultCallback& resultCallback, btScalar allowedCcdPenetration) const
 {
 
-	BT_PROFILE("convexSweepTest");
+	//***CHRONO*** no profiling, so that concurrent sweep tests only read the collision world
+	//BT_PROFILE("convexSweepTest");
 	/// use the broadphase to accelerate the search for objects, based on their aabb
 	/// and for each object with ray-aabb overlap, perform an exact ray test
 	/// unfortunately the implementation for rayTest and convexSweepTest duplicated, albeit practically identical
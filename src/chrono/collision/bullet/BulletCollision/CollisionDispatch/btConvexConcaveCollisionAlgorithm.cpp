@@ -117,10 +117,20 @@ void btConvexTriangleCallback::processTriangle(btVector3* triangle,int partId, i
 		btTriangleShape tm(triangle[0],triangle[1],triangle[2]);	
 		tm.setMargin(m_collisionMarginTriangle);
 		
+		//***CHRONO*** when pairs are processed concurrently, use a temporary copy of the triangle mesh
+		// object instead of temporarily changing the shape of the shared object.
+		btCollisionObject* triObj = ob;
+		btCollisionObject* triObjCopy = 0;
+		ATTRIBUTE_ALIGNED16(unsigned char triObjStorage[sizeof(btCollisionObject)]);
 		btCollisionShape* tmpShape = ob->getCollisionShape();
-		ob->internalSetTemporaryCollisionShape( &tm );
+		if (m_dispatchInfoPtr->m_concurrentDispatch)
+		{
+			triObjCopy = new (triObjStorage) btCollisionObject(*ob);
+			triObj = triObjCopy;
+		}
+		triObj->internalSetTemporaryCollisionShape( &tm );
 		
-		btCollisionAlgorithm* colAlgo = ci.m_dispatcher1->findAlgorithm(m_convexBody,m_triBody,m_manifoldPtr);
+		btCollisionAlgorithm* colAlgo = ci.m_dispatcher1->findAlgorithm(m_convexBody,triObj,m_manifoldPtr);
 
 		if (m_resultOut->getBody0Internal() == m_triBody)
 		{
@@ -131,10 +141,17 @@ void btConvexTriangleCallback::processTriangle(btVector3* triangle,int partId, i
 			m_resultOut->setShapeIdentifiersB(partId,triangleIndex);
 		}
 	
-		colAlgo->processCollision(m_convexBody,m_triBody,*m_dispatchInfoPtr,m_resultOut);
+		colAlgo->processCollision(m_convexBody,triObj,*m_dispatchInfoPtr,m_resultOut);
 		colAlgo->~btCollisionAlgorithm();
 		ci.m_dispatcher1->freeCollisionAlgorithm(colAlgo);
-		ob->internalSetTemporaryCollisionShape( tmpShape);
+		if (triObjCopy)
+		{
+			triObjCopy->~btCollisionObject();
+		}
+		else
+		{
+			ob->internalSetTemporaryCollisionShape( tmpShape);
+		}
 	}
 
 
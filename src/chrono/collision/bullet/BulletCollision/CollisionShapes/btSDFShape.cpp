@@ -0,0 +1,45 @@
+/*
+*** CHRONO ***
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2006 Erwin Coumans  http://continuousphysics.com/Bullet/
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose, 
+including commercial applications, and to alter it and redistribute it freely, 
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "btSDFShape.h"
+#include "LinearMath/btAabbUtil2.h"
+
+btSDFShape::btSDFShape(std::shared_ptr<chrono::collision::ChSignedDistanceField> msdf)
+    : sdf(msdf), m_localScaling(btScalar(1.), btScalar(1.), btScalar(1.))
+{
+    m_shapeType = SDF_SHAPE_PROXYTYPE;
+}
+
+void btSDFShape::getAabb(const btTransform& t,btVector3& aabbMin,btVector3& aabbMax) const
+{
+    chrono::ChVector<> bbmin, bbmax;
+    sdf->GetBoundingBox(bbmin, bbmax);
+    btTransformAabb(btVector3((btScalar)bbmin.x(), (btScalar)bbmin.y(), (btScalar)bbmin.z()),
+                    btVector3((btScalar)bbmax.x(), (btScalar)bbmax.y(), (btScalar)bbmax.z()),
+                    getMargin(), t, aabbMin, aabbMax);
+}
+
+void btSDFShape::calculateLocalInertia(btScalar mass,btVector3& inertia) const
+{
+    // Inertia of the bounding box (the shape is meant for static geometry anyway).
+    chrono::ChVector<> bbmin, bbmax;
+    sdf->GetBoundingBox(bbmin, bbmax);
+    chrono::ChVector<> size = bbmax - bbmin;
+    btScalar lx = (btScalar)size.x();
+    btScalar ly = (btScalar)size.y();
+    btScalar lz = (btScalar)size.z();
+    inertia.setValue(mass / 12 * (ly * ly + lz * lz), mass / 12 * (lx * lx + lz * lz), mass / 12 * (lx * lx + ly * ly));
+}
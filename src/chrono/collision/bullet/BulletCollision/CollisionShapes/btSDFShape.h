@@ -0,0 +1,64 @@
+/*
+*** CHRONO ***
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2006 Erwin Coumans  http://continuousphysics.com/Bullet/
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose, 
+including commercial applications, and to alter it and redistribute it freely, 
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef BT_SDF_SHAPE_H
+#define BT_SDF_SHAPE_H
+
+#include <memory>
+
+#include "btConcaveShape.h"
+#include "BulletCollision/BroadphaseCollision/btBroadphaseProxy.h" // for the types
+#include "LinearMath/btVector3.h"
+#include "chrono/collision/ChCSignedDistanceField.h"
+
+/// btSDFShape represents static geometry described by a signed distance field.
+/// It does not provide triangles: collisions with convex shapes are handled by a
+/// dedicated algorithm that queries the distance field at the sphere centers,
+/// at the vertices of polyhedra, or at support points of other convex shapes.
+/// The collision margin is used as the outward envelope of the surface.
+
+class btSDFShape : public btConcaveShape
+{
+private:
+    std::shared_ptr<chrono::collision::ChSignedDistanceField> sdf;
+    btVector3 m_localScaling;
+
+public:
+    btSDFShape(std::shared_ptr<chrono::collision::ChSignedDistanceField> msdf);
+
+    /// No triangles are reported.
+    virtual void processAllTriangles(btTriangleCallback* callback,const btVector3& aabbMin,const btVector3& aabbMax) const {}
+
+    ///CollisionShape Interface
+    virtual void calculateLocalInertia(btScalar mass,btVector3& inertia) const;
+
+    virtual void getAabb(const btTransform& t,btVector3& aabbMin,btVector3& aabbMax) const;
+
+    /// Scaling is not supported: the distance field is always used with unit scaling.
+    virtual void setLocalScaling(const btVector3& scaling) {}
+    virtual const btVector3& getLocalScaling() const {return m_localScaling;}
+
+    virtual const char* getName()const 
+    {
+        return "SDFShape";
+    }
+
+    /// access the distance field
+    chrono::collision::ChSignedDistanceField* get_sdf() const {return sdf.get();}
+};
+
+
+#endif 
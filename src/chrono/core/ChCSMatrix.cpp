@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include <algorithm>
+#include <atomic>
 
 #include "chrono/core/ChCSMatrix.h"
 #include "chrono/core/ChMapMatrix.h"
@@ -84,6 +85,23 @@ double ChCSMatrix::GetElement(int row_sel, int col_sel) const {
     return 0.0;
 }
 
+int ChCSMatrix::GetValueIndex(int row_sel, int col_sel) const {
+    if (!isCompressed)
+        return -1;
+
+    auto lead_sel = row_major_format ? row_sel : col_sel;
+    auto trail_sel = row_major_format ? col_sel : row_sel;
+
+    // in a compressed matrix the trailing indexes are sorted within each row (CSR) | column (CSC)
+    auto first = trailIndex.begin() + leadIndex[lead_sel];
+    auto last = trailIndex.begin() + leadIndex[lead_sel + 1];
+    auto it = std::lower_bound(first, last, trail_sel);
+    if (it == last || *it != trail_sel)
+        return -1;
+
+    return static_cast<int>(it - trailIndex.begin());
+}
+
 double& ChCSMatrix::Element(int row_sel, int col_sel) {
     auto lead_sel = row_major_format ? row_sel : col_sel;
     auto trail_sel = row_major_format ? col_sel : row_sel;
@@ -127,7 +145,7 @@ void ChCSMatrix::Reset(int nrows, int ncols, int nonzeros_hint) {
     auto trail_dim_new = row_major_format ? ncols : nrows;
 
     if (nonzeros_hint == 0 && lead_dim_new == *leading_dimension && trail_dim_new == *trailing_dimension && m_lock) {
-        std::fill(values.begin(), values.begin() + leadIndex[*leading_dimension] - 1, 0);
+        std::fill(values.begin(), values.begin() + leadIndex[*leading_dimension], 0);
     } else {
         if (nonzeros_hint == 0)
             nonzeros_hint = GetTrailingIndexLength();
@@ -176,6 +194,7 @@ bool ChCSMatrix::Compress() {
     std::fill(initialized_element.begin(), initialized_element.begin() + leadIndex[*leading_dimension], true);
     isCompressed = true;
     m_lock_broken = false;
+    update_pattern_stamp();
     return trail_i_dest != trail_i;
 }
 
@@ -217,6 +236,7 @@ int ChCSMatrix::Inflate(int storage_augm, int lead_sel, int trail_sel) {
                             lead_sel, storage_augm);
     }
 
+    update_pattern_stamp();
     return trail_sel;
 }
 
@@ -246,6 +266,7 @@ void ChCSMatrix::Prune(double pruning_threshold) {
     std::fill(initialized_element.begin(), initialized_element.begin() + leadIndex[*leading_dimension], true);
     m_lock_broken = false;
     isCompressed = true;
+    update_pattern_stamp();
 }
 
 int ChCSMatrix::VerifyMatrix() const {
@@ -374,6 +395,15 @@ void ChCSMatrix::LoadSparsityPattern(ChSparsityPatternLearner& sparsity_learner)
     initialized_element.assign(nnz, true);
     m_lock_broken = false;
     isCompressed = true;
+    update_pattern_stamp();
+}
+
+void ChCSMatrix::update_pattern_stamp() {
+    static std::atomic<unsigned int> stamp_counter(0);
+    unsigned int stamp = ++stamp_counter;
+    if (stamp == 0)  // 0 is reserved (never matches a valid pattern)
+        stamp = ++stamp_counter;
+    pattern_stamp = stamp;
 }
 
 void ChCSMatrix::distribute_integer_range_on_vector(index_vector_t& vector, int initial_number, int final_number) {
@@ -407,11 +437,13 @@ void ChCSMatrix::reset_arrays(int lead_dim, int trail_dim, int nonzeros) {
     // max_shifts = GetNNZ() * 2 / *leading_dimension;
 
     isCompressed = false;
+    update_pattern_stamp();
 }
 
 void ChCSMatrix::insert(int& trail_i_sel, const int& lead_sel) {
     isCompressed = false;
     m_lock_broken = true;
+    update_pattern_stamp();
 
     bool OK_also_out_of_row = true;  // look for viable positions also in other rows respect to the one selected
     bool OK_also_onelement_rows = false;
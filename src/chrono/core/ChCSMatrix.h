@@ -139,7 +139,12 @@ class ChApi ChCSMatrix : public ChSparseMatrix {
 
     bool m_lock_broken = false;  ///< true if a modification was made that overrules m_lock
 
+    unsigned int pattern_stamp = 0;  ///< identifier of the current arrangement of the index arrays
+
   protected:
+    /// (internal) Mark the index arrays as modified, invalidating positions previously returned by GetValueIndex().
+    void update_pattern_stamp();
+
     /// (internal) The \a vector elements will contain equally spaced indexes, going from \a initial_number to \a
     /// final_number.
     void static distribute_integer_range_on_vector(index_vector_t& vector, int initial_number, int final_number);
@@ -187,6 +192,16 @@ class ChApi ChCSMatrix : public ChSparseMatrix {
     /// Create the element with index (\a row_sel, \a col_sel) (if it doesn't exist) and return its reference.
     double& Element(int row_sel, int col_sel);
 
+    /// Return the position of the element (\a row_sel, \a col_sel) in the value array (see GetCS_ValueArray()).
+    /// Returns -1 if the matrix is not compressed or if the element is not part of the sparsity pattern.
+    /// The position remains valid as long as GetSparsityPatternStamp() does not change.
+    int GetValueIndex(int row_sel, int col_sel) const;
+
+    /// Return an identifier of the current arrangement of the index arrays.
+    /// The value changes (and is unique across all matrices) whenever elements are moved in the internal arrays,
+    /// e.g. after an insertion, a compression, or a full reset. It does not change after a \e partial reset.
+    unsigned int GetSparsityPatternStamp() const { return pattern_stamp; }
+
     /// Create the element with index (\a row_sel, \a col_sel)(if it doesn't exist) and return its reference.
     double& operator()(int row_sel, int col_sel) { return Element(row_sel, col_sel); }
 
@@ -19,6 +19,11 @@
 #include <omp.h>
 #endif
 
+#ifdef __linux__
+#include <sched.h>
+#include <vector>
+#endif
+
 namespace chrono {
 
 #ifdef _OPENMP
@@ -62,6 +67,21 @@ class ChApi CHOMPfunctions {
     /// by default if num_threads not specified. This is the same
     /// number as GetNumProcs() on most OMP implementations.
     static int GetMaxThreads() { return omp_get_max_threads(); }
+
+    /// Pins each thread of subsequent parallel regions (of default
+    /// size) to a processor, in order, starting at 'first_proc'.
+    /// Processors are taken from the set this process is allowed to run
+    /// on (its affinity mask when first called), so 'first_proc' is an
+    /// index in that set, not a CPU id. The calling (master) thread is
+    /// pinned to the processor with index 'first_proc'.
+    /// Only implemented on Linux; returns false otherwise or on failure.
+    static bool PinThreads(int first_proc = 0);
+
+#ifdef __linux__
+    /// Returns the ids of the processors in the affinity mask of the calling
+    /// thread at the first call (cached, since pinning narrows the mask).
+    static const std::vector<int>& GetAllowedProcs();
+#endif
 };
 
 #else
@@ -82,10 +102,54 @@ class ChApi CHOMPfunctions {
     static int GetThreadNum() { return 0; }
     static int GetNumProcs() { return 1; }
     static int GetMaxThreads() { return 1; }
+    static bool PinThreads(int first_proc = 0);
+#ifdef __linux__
+    static const std::vector<int>& GetAllowedProcs();
+#endif
 };
 
 #endif
 
+// Thread pinning is shared by both versions of CHOMPfunctions (without OpenMP, only the calling thread is pinned).
+
+#ifdef __linux__
+inline const std::vector<int>& CHOMPfunctions::GetAllowedProcs() {
+    static const std::vector<int> procs = []() {
+        std::vector<int> ids;
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(cpu_set_t), &set) == 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                if (CPU_ISSET(cpu, &set))
+                    ids.push_back(cpu);
+            }
+        }
+        return ids;
+    }();
+    return procs;
+}
+#endif
+
+inline bool CHOMPfunctions::PinThreads(int first_proc) {
+#ifdef __linux__
+    const std::vector<int>& procs = GetAllowedProcs();
+    if (procs.empty())
+        return false;
+    int nprocs = (int)procs.size();
+    bool ok = true;
+#pragma omp parallel reduction(&& : ok)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(procs[(first_proc + GetThreadNum()) % nprocs], &set);
+        ok = (sched_setaffinity(0, sizeof(cpu_set_t), &set) == 0);
+    }
+    return ok;
+#else
+    return false;
+#endif
+}
+
 /// Exception-safe wrapper to a mutex: it automatically locks the
 /// mutex as soon as the wrapper is created, and releases the
 /// mutex when the wrapper is deleted (you simply put the wrapper in
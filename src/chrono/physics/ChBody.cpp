@@ -66,6 +66,8 @@ ChBody::ChBody(ChMaterialSurface::ContactMethod contact_method) {
     max_speed = 0.5f;
     max_wvel = 2.0f * float(CH_C_PI);
 
+    ccd_radius = 0;
+
     sleep_time = 0.6f;
     sleep_starttime = 0;
     sleep_minspeed = 0.1f;
@@ -110,6 +112,8 @@ ChBody::ChBody(std::shared_ptr<collision::ChCollisionModel> new_collision_model,
     max_speed = 0.5f;
     max_wvel = 2.0f * float(CH_C_PI);
 
+    ccd_radius = 0;
+
     sleep_time = 0.6f;
     sleep_starttime = 0;
     sleep_minspeed = 0.1f;
@@ -149,6 +153,8 @@ ChBody::ChBody(const ChBody& other) : ChPhysicsItem(other), ChBodyFrame(other) {
     max_speed = other.max_speed;
     max_wvel = other.max_wvel;
 
+    ccd_radius = other.ccd_radius;
+
     sleep_time = other.sleep_time;
     sleep_starttime = other.sleep_starttime;
     sleep_minspeed = other.sleep_minspeed;
@@ -754,6 +760,14 @@ bool ChBody::GetLimitSpeed() const {
     return BFlagGet(BodyFlag::LIMITSPEED);
 }
 
+void ChBody::SetContinuousCollision(bool state) {
+    BFlagSet(BodyFlag::CONTINUOUS_COLLISION, state);
+}
+
+bool ChBody::GetContinuousCollision() const {
+    return BFlagGet(BodyFlag::CONTINUOUS_COLLISION);
+}
+
 void ChBody::SetNoGyroTorque(bool state) {
     BFlagSet(BodyFlag::NOGYROTORQUE, state);
 }
@@ -78,6 +78,8 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     float max_speed;  ///< limit on linear speed
     float max_wvel;   ///< limit on angular velocity
 
+    float ccd_radius;  ///< radius of the sphere swept for continuous collision detection
+
     float sleep_time;
     float sleep_minspeed;
     float sleep_minwvel;
@@ -150,6 +152,18 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     /// Return true if maximum linear speed is limited.
     bool GetLimitSpeed() const;
 
+    /// Enable/disable the continuous collision detection (CCD) for this body.
+    /// At the end of each step, a sphere (see SetCcdRadius) is swept along the path of the body
+    /// center of mass during the step; if it hits a collision model of another body, the body is moved
+    /// back to the time of impact and its velocity towards the hit surface is removed, so that the
+    /// contact is detected at the next step instead of the body tunneling through the surface.
+    /// This is useful for small, fast bodies (e.g. projectiles or debris) which would otherwise require
+    /// a small step for the whole system. Only the translation is considered.
+    void SetContinuousCollision(bool state);
+
+    /// Return true if the continuous collision detection is enabled for this body.
+    bool GetContinuousCollision() const;
+
     /// Deactivate the gyroscopic torque (quadratic term).
     /// This is useful in virtual reality and real-time
     /// simulations, where objects that spin too fast with non-uniform inertia
@@ -498,6 +512,14 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     void SetMaxWvel(float m_max_wvel) { max_wvel = m_max_wvel; }
     float GetMaxWvel() const { return max_wvel; }
 
+    /// Set the radius of the sphere swept for continuous collision detection (default: 0, i.e. a ray).
+    /// This should not exceed the radius of the largest sphere centered at the body center of mass
+    /// and contained in its collision shapes. The sweep is performed only if the body moved by more
+    /// than this radius during the step.
+    /// The continuous collision detection is active only if you set SetContinuousCollision(true);
+    void SetCcdRadius(float m_ccd_radius) { ccd_radius = m_ccd_radius; }
+    float GetCcdRadius() const { return ccd_radius; }
+
     /// Clamp the body speed to the provided limits.
     /// When this function is called, the speed of the body is clamped
     /// to the range specified by max_speed and max_wvel. Remember to
@@ -819,7 +841,8 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
         SLEEPING = (1L << 9),         // body is sleeping [internal]
         USESLEEPING = (1L << 10),     // if body remains in same place for too long time, it will be frozen
         NOGYROTORQUE = (1L << 11),    // do not get the gyroscopic (quadratic) term, for low-fi but stable simulation
-        COULDSLEEP = (1L << 12)       // if body remains in same place for too long time, it will be frozen
+        COULDSLEEP = (1L << 12),      // if body remains in same place for too long time, it will be frozen
+        CONTINUOUS_COLLISION = (1L << 13)  // continuous collision detection
     };
 
     int bflags;  ///< encoding for all body flags
@@ -135,8 +135,16 @@ void ChLoadCustom::ComputeJacobian(ChState* state_x,       // state position to
 }
 
 void ChLoadCustom::LoadIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {
+    if (load_variables.empty())
+        this->loadable->LoadableGetVariables(load_variables);
+    bool check_active = ((int)load_variables.size() == this->loadable->GetSubBlocks());
     unsigned int rowQ = 0;
     for (int i = 0; i < this->loadable->GetSubBlocks(); ++i) {
+        // skip sub-blocks of fixed variables: their offsets are not valid
+        if (check_active && !load_variables[i]->IsActive()) {
+            rowQ += this->loadable->GetSubBlockSize(i);
+            continue;
+        }
         unsigned int moffset = this->loadable->GetSubBlockOffset(i);
         for (unsigned int row = 0; row < this->loadable->GetSubBlockSize(i); ++row) {
             R(row + moffset) += this->load_Q(rowQ) * c;
@@ -150,9 +158,9 @@ void ChLoadCustom::CreateJacobianMatrices() {
         // create jacobian structure
         this->jacobians = new ChLoadJacobians;
         // set variables forsparse KRM block
-        std::vector<ChVariables*> mvars;
-        loadable->LoadableGetVariables(mvars);
-        this->jacobians->SetVariables(mvars);
+        if (load_variables.empty())
+            loadable->LoadableGetVariables(load_variables);
+        this->jacobians->SetVariables(load_variables);
     }
 }
 
@@ -269,12 +277,15 @@ void ChLoadCustomMultiple::ComputeJacobian(ChState* state_x,       // state posi
 }
 
 void ChLoadCustomMultiple::LoadIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {
+    if (load_variables.empty()) {
+        for (int k = 0; k < loadables.size(); ++k)
+            loadables[k]->LoadableGetVariables(load_variables);
+    }
     unsigned int mQoffset = 0;
+    unsigned int mvar = 0;
     for (int k = 0; k < loadables.size(); ++k) {
-        std::vector<ChVariables*> kvars;
-        loadables[k]->LoadableGetVariables(kvars);
-        for (int i = 0; i < loadables[k]->GetSubBlocks(); ++i) {
-            if (kvars[i]->IsActive()) {
+        for (int i = 0; i < loadables[k]->GetSubBlocks(); ++i, ++mvar) {
+            if (load_variables[mvar]->IsActive()) {
                 unsigned int mblockoffset = loadables[k]->GetSubBlockOffset(i);
                 for (unsigned int row = 0; row < loadables[k]->GetSubBlockSize(i); ++row) {
                     R(row + mblockoffset) += this->load_Q(row + mQoffset) * c;
@@ -291,10 +302,11 @@ void ChLoadCustomMultiple::CreateJacobianMatrices() {
         // create jacobian structure
         this->jacobians = new ChLoadJacobians;
         // set variables for sparse KRM block appending them to mvars list
-        std::vector<ChVariables*> mvars;
-        for (int i = 0; i < loadables.size(); ++i)
-            loadables[i]->LoadableGetVariables(mvars);
-        this->jacobians->SetVariables(mvars);
+        if (load_variables.empty()) {
+            for (int i = 0; i < loadables.size(); ++i)
+                loadables[i]->LoadableGetVariables(load_variables);
+        }
+        this->jacobians->SetVariables(load_variables);
     }
 }
 
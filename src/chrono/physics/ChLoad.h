@@ -56,6 +56,7 @@ class ChApi ChLoadJacobians {
 class ChApi ChLoadBase : public ChObj {
   protected:
     ChLoadJacobians* jacobians;
+    std::vector<ChVariables*> load_variables;  ///< variables of the loaded item(s), reused between calls
 
   public:
     ChLoadBase();
@@ -398,8 +399,17 @@ inline void ChLoad<Tloader>::ComputeJacobian(ChState* state_x,
 
 template <class Tloader>
 inline void ChLoad<Tloader>::LoadIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {
+    // the loader may be retargeted between calls (as ChMesh does for gravity): refresh the variables, reusing storage
+    this->load_variables.clear();
+    this->loader.GetLoadable()->LoadableGetVariables(this->load_variables);
+    bool check_active = ((int)this->load_variables.size() == this->loader.GetLoadable()->GetSubBlocks());
     unsigned int rowQ = 0;
     for (int i = 0; i < this->loader.GetLoadable()->GetSubBlocks(); ++i) {
+        // skip sub-blocks of fixed variables: their offsets are not valid
+        if (check_active && !this->load_variables[i]->IsActive()) {
+            rowQ += this->loader.GetLoadable()->GetSubBlockSize(i);
+            continue;
+        }
         unsigned int moffset = this->loader.GetLoadable()->GetSubBlockOffset(i);
         for (unsigned int row = 0; row < this->loader.GetLoadable()->GetSubBlockSize(i); ++row) {
             R(row + moffset) += this->loader.Q(rowQ) * c;
@@ -414,9 +424,9 @@ inline void ChLoad<Tloader>::CreateJacobianMatrices() {
         // create jacobian structure
         this->jacobians = new ChLoadJacobians;
         // set variables forsparse KRM block
-        std::vector<ChVariables*> mvars;
-        loader.GetLoadable()->LoadableGetVariables(mvars);
-        this->jacobians->SetVariables(mvars);
+        this->load_variables.clear();
+        loader.GetLoadable()->LoadableGetVariables(this->load_variables);
+        this->jacobians->SetVariables(this->load_variables);
     }
 }
 
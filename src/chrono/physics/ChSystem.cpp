@@ -21,6 +21,7 @@
 #include "chrono/physics/ChSystem.h"
 #include "chrono/solver/ChSolverAPGD.h"
 #include "chrono/solver/ChSolverBB.h"
+#include "chrono/solver/ChSolverBlockTridiagonal.h"
 #include "chrono/solver/ChSolverJacobi.h"
 #include "chrono/solver/ChSolverMINRES.h"
 #include "chrono/solver/ChSolverPCG.h"
@@ -329,6 +330,10 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
             solver_speed = std::make_shared<ChSolverMINRES>();
             solver_stab = std::make_shared<ChSolverMINRES>();
             break;
+        case ChSolver::Type::BLOCK_TRIDIAGONAL:
+            solver_speed = std::make_shared<ChSolverBlockTridiagonal>();
+            solver_stab = std::make_shared<ChSolverBlockTridiagonal>();
+            break;
         default:
             solver_speed = std::make_shared<ChSolverSymmSOR>();
             solver_stab = std::make_shared<ChSolverSymmSOR>();
@@ -416,6 +421,9 @@ void ChSystem::SetParallelThreadNumber(int mthreads) {
 
     descriptor->SetNumThreads(mthreads);
 
+    if (auto collision_system_bullet = std::dynamic_pointer_cast<ChCollisionSystemBullet>(collision_system))
+        collision_system_bullet->SetNumThreads(mthreads);
+
     if (solver_speed->GetType() == ChSolver::Type::SOR_MULTITHREAD) {
         std::static_pointer_cast<ChSolverSORmultithread>(solver_speed)->ChangeNumberOfThreads(mthreads);
         std::static_pointer_cast<ChSolverSORmultithread>(solver_stab)->ChangeNumberOfThreads(mthreads);
@@ -613,6 +621,9 @@ void ChSystem::SetTimestepperType(ChTimestepper::Type type) {
         case ChTimestepper::Type::LEAPFROG:
             timestepper = std::make_shared<ChTimestepperLeapfrog>(this);
             break;
+        case ChTimestepper::Type::CENTRAL_DIFFERENCE:
+            timestepper = std::make_shared<ChTimestepperCentralDifference>(this);
+            break;
         case ChTimestepper::Type::NEWMARK:
             timestepper = std::make_shared<ChTimestepperNewmark>(this);
             break;
@@ -1339,6 +1350,16 @@ void ChSystem::LoadResidual_Mv(ChVectorDynamic<>& R,        ///< result: the R r
     IntLoadResidual_Mv(0, R, w, c);
 }
 
+// Increment a vector Md with the diagonal of a lumped approximation of the mass matrix:
+//    Md += c*diag(M_lumped)
+void ChSystem::LoadLumpedMass_Md(ChVectorDynamic<>& Md,  ///< result: Md += c*diag(M_lumped)
+                                 const double c          ///< a scaling factor
+                                 ) {
+    if (GetNbodies() > 0)
+        throw ChException("LoadLumpedMass_Md() not supported with rigid bodies, use an implicit integrator.");
+    ChIntegrableIIorder::LoadLumpedMass_Md(Md, c);
+}
+
 // Increment a vectorR with the term Cq'*L:
 //    R += c*Cq'*L
 void ChSystem::LoadResidual_CqL(ChVectorDynamic<>& R,        ///< result: the R residual, R += c*Cq'*L
@@ -1390,6 +1411,12 @@ double ChSystem::ComputeCollisions() {
     // Update all positions of collision models: delegate this to the ChAssembly
     SyncCollisionModels();
 
+    // Cache the positions of the bodies which need continuous collision detection at the end of the step.
+    for (int ip = 0; ip < bodylist.size(); ++ip) {
+        if (bodylist[ip]->GetContinuousCollision())
+            bodylist[ip]->SynchronizeLastCollPos();
+    }
+
     // Perform the collision detection ( broadphase and narrowphase )
     collision_system->Run();
 
@@ -1426,6 +1453,33 @@ double ChSystem::ComputeCollisions() {
     return mretC;
 }
 
+void ChSystem::ComputeContinuousCollisions() {
+    for (int ip = 0; ip < bodylist.size(); ++ip) {
+        auto body = bodylist[ip];
+        if (!body->GetContinuousCollision() || !body->GetCollide() || !body->IsActive())
+            continue;
+
+        // Skip the bodies that moved less than the swept sphere radius: the discrete collision
+        // detection at the next step is sufficient for them.
+        ChVector<> start = body->GetLastCollPos().pos;
+        ChVector<> motion = body->GetPos() - start;
+        if (motion.Length() <= body->GetCcdRadius())
+            continue;
+
+        collision::ChCollisionSystem::ChRayhitResult result;
+        if (!collision_system->SweepSphere(body->GetCollisionModel().get(), start, body->GetPos(),
+                                           body->GetCcdRadius(), result))
+            continue;
+
+        // Move the body back to the time of impact and remove its velocity towards the hit surface.
+        body->SetPos(start + motion * result.dist_factor);
+        double vn = body->GetPos_dt() ^ result.abs_hitNormal;
+        if (vn < 0)
+            body->SetPos_dt(body->GetPos_dt() - result.abs_hitNormal * vn);
+        body->Update(ChTime, false);
+    }
+}
+
 // =============================================================================
 //   PHYSICAL OPERATIONS
 // =============================================================================
@@ -1584,6 +1638,9 @@ bool ChSystem::Integrate_Y() {
         timestepper->Advance(step);
     }
 
+    // Prevent the bodies flagged for continuous collision detection from tunneling
+    ComputeContinuousCollisions();
+
     // Executes custom processing at the end of step
     CustomEndOfStep();
 
@@ -259,6 +259,8 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     /// Changes the number of parallel threads (by default is n.of cores).
     /// Note that not all solvers use parallel computation.
     /// If you have a N-core processor, this should be set at least =N for maximum performance.
+    /// This also sets the number of threads used by the Bullet collision narrowphase
+    /// (see ChCollisionSystemBullet::SetNumThreads).
     void SetParallelThreadNumber(int mthreads = 2);
     /// Get the number of parallel threads.
     /// Note that not all solvers use parallel computation.
@@ -515,6 +517,14 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
                                  const double c               ///< a scaling factor
                                  ) override;
 
+    /// Increment a vector Md with the diagonal of a lumped approximation of the mass matrix:
+    ///    Md += c*diag(M_lumped)
+    /// Row-sum lumping is only meaningful for node variables, so an exception is thrown if the system
+    /// contains active rigid bodies (whose rotational inertia is not diagonal in general).
+    virtual void LoadLumpedMass_Md(ChVectorDynamic<>& Md,  ///< result: Md += c*diag(M_lumped)
+                                   const double c          ///< a scaling factor
+                                   ) override;
+
     /// Increment a vectorR with the term Cq'*L:
     ///    R += c*Cq'*L
     virtual void LoadResidual_CqL(ChVectorDynamic<>& R,        ///< result: the R residual, R += c*Cq'*L
@@ -567,6 +577,13 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     /// This is mostly called automatically by time integration.
     double ComputeCollisions();
 
+    /// Perform the continuous collision detection for the bodies that require it (see
+    /// ChBody::SetContinuousCollision). The path of each such body since the last collision detection
+    /// is tested with a sphere cast; if the sphere hits another collision model, the body is moved
+    /// back to the time of impact and its velocity towards the hit surface is removed.
+    /// This is called automatically at the end of each time step.
+    void ComputeContinuousCollisions();
+
     /// Class to be used as a callback interface for user defined actions performed 
     /// at each collision detection step.  For example, additional contact points can
     /// be added to the underlying contact container.
@@ -22,6 +22,8 @@
 
 namespace chrono {
 
+class ChCSMatrix;
+
 /// Base class for representing items which introduce block-sparse
 /// matrices, that is blocks that connect some 'variables'
 /// and build a matrix K in a sparse variational inequality VI(Z*x-d,K):
@@ -44,6 +46,11 @@ class ChApi ChKblock {
     /// Returns the number of referenced ChVariables items
     virtual size_t GetNvars() const = 0;
 
+    /// Access the m-th vector variable object.
+    /// The default implementation returns nullptr, i.e. the referenced variables are not known; such blocks
+    /// are then treated conservatively by the features that need them (assembly coloring, chain solvers).
+    virtual ChVariables* GetVariableN(unsigned int m_var) const { return nullptr; }
+
     /// Access the K stiffness matrix as a single block,
     /// referring only to the referenced ChVariable objects
     virtual ChMatrix<double>* Get_K() = 0;
@@ -67,6 +74,19 @@ class ChApi ChKblock {
     /// Most solvers do not need this: the sparse 'storage' matrix is used for testing, for
     /// direct solvers, for dumping full matrix to Matlab for checks, etc.
     virtual void Build_K(ChSparseMatrix& storage, bool add = true) = 0;
+
+    /// Compute the positions of the entries of this block in the value array of the given compressed
+    /// sparse matrix, so that later assemblies can bypass the index lookups of Build_K.
+    /// Return false if not supported or if some entries are missing from the sparsity pattern of 'storage'.
+    virtual bool SetupScatterMap(const ChCSMatrix& storage) { return false; }
+
+    /// Return true if the scatter map can be used with the given matrix, i.e. if neither the sparsity
+    /// pattern of 'storage' nor the offsets of the referenced variables changed since SetupScatterMap.
+    virtual bool IsScatterMapValid(const ChCSMatrix& storage) const { return false; }
+
+    /// Add the K matrix associated to these variables into the value array of a compressed sparse matrix,
+    /// using the scatter map (see SetupScatterMap).
+    virtual void Scatter_K(double* values) const {}
 };
 
 }  // end namespace chrono
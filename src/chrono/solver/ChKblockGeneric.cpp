@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include "chrono/core/ChCSMatrix.h"
 #include "chrono/solver/ChKblockGeneric.h"
 
 namespace chrono {
@@ -19,11 +20,11 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChKblockGeneric)
 
-ChKblockGeneric::ChKblockGeneric(std::vector<ChVariables*> mvariables) : K(NULL) {
+ChKblockGeneric::ChKblockGeneric(std::vector<ChVariables*> mvariables) : K(NULL), scatter_stamp(0) {
     SetVariables(mvariables);
 }
 
-ChKblockGeneric::ChKblockGeneric(ChVariables* mvariableA, ChVariables* mvariableB) : K(NULL) {
+ChKblockGeneric::ChKblockGeneric(ChVariables* mvariableA, ChVariables* mvariableB) : K(NULL), scatter_stamp(0) {
     std::vector<ChVariables*> mvars;
     mvars.push_back(mvariableA);
     mvars.push_back(mvariableB);
@@ -44,6 +45,7 @@ ChKblockGeneric& ChKblockGeneric::operator=(const ChKblockGeneric& other) {
     // ChKblock::operator=(other);
 
     this->variables = other.variables;
+    this->scatter_stamp = 0;
 
     if (other.K) {
         if (K == 0)
@@ -62,6 +64,7 @@ void ChKblockGeneric::SetVariables(std::vector<ChVariables*> mvariables) {
     assert(mvariables.size() > 0);
 
     variables = mvariables;
+    scatter_stamp = 0;
 
     // destroy the K matrix if needed
     if (K)
@@ -157,5 +160,72 @@ void ChKblockGeneric::Build_K(ChSparseMatrix& storage, bool add) {
     }
 }
 
+bool ChKblockGeneric::SetupScatterMap(const ChCSMatrix& storage) {
+    scatter_stamp = 0;
+    if (!K || !storage.IsCompressed())
+        return false;
+
+    int msize = K->GetRows();
+    scatter_map.assign(msize * msize, -1);
+    scatter_offsets.resize(variables.size());
+
+    int kio = 0;
+    for (unsigned int iv = 0; iv < this->GetNvars(); iv++) {
+        int io = this->GetVariableN(iv)->GetOffset();
+        int in = this->GetVariableN(iv)->Get_ndof();
+        scatter_offsets[iv] = this->GetVariableN(iv)->IsActive() ? io : -1;
+
+        if (this->GetVariableN(iv)->IsActive()) {
+            int kjo = 0;
+            for (unsigned int jv = 0; jv < this->GetNvars(); jv++) {
+                int jo = this->GetVariableN(jv)->GetOffset();
+                int jn = this->GetVariableN(jv)->Get_ndof();
+
+                if (this->GetVariableN(jv)->IsActive()) {
+                    for (int r = 0; r < in; r++) {
+                        for (int c = 0; c < jn; c++) {
+                            int pos = storage.GetValueIndex(io + r, jo + c);
+                            if (pos < 0)
+                                return false;
+                            scatter_map[(kio + r) * msize + kjo + c] = pos;
+                        }
+                    }
+                }
+
+                kjo += jn;
+            }
+        }
+
+        kio += in;
+    }
+
+    scatter_stamp = storage.GetSparsityPatternStamp();
+    return true;
+}
+
+bool ChKblockGeneric::IsScatterMapValid(const ChCSMatrix& storage) const {
+    if (scatter_stamp == 0 || scatter_stamp != storage.GetSparsityPatternStamp() || !storage.IsCompressed())
+        return false;
+
+    for (unsigned int iv = 0; iv < this->GetNvars(); iv++) {
+        int io = this->GetVariableN(iv)->IsActive() ? this->GetVariableN(iv)->GetOffset() : -1;
+        if (io != scatter_offsets[iv])
+            return false;
+    }
+
+    return true;
+}
+
+void ChKblockGeneric::Scatter_K(double* values) const {
+    assert(K && scatter_stamp != 0);
+
+    const double* Kvalues = K->GetAddress();
+    int nentries = static_cast<int>(scatter_map.size());
+    for (int i = 0; i < nentries; i++) {
+        int pos = scatter_map[i];
+        if (pos >= 0)
+            values[pos] += Kvalues[i];
+    }
+}
 
 }  // end namespace chrono
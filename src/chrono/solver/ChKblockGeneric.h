@@ -38,8 +38,12 @@ class ChApi ChKblockGeneric : public ChKblock {
     ChMatrixDynamic<double>* K;
     std::vector<ChVariables*> variables;
 
+    std::vector<int> scatter_map;      ///< positions of the K entries in a CS value array (-1 if not assembled)
+    std::vector<int> scatter_offsets;  ///< variable offsets used to build the scatter map (-1 if inactive)
+    unsigned int scatter_stamp;        ///< sparsity pattern stamp of the matrix used to build the scatter map
+
   public:
-    ChKblockGeneric() : K(NULL) {}
+    ChKblockGeneric() : K(NULL), scatter_stamp(0) {}
     ChKblockGeneric(std::vector<ChVariables*> mvariables);
     ChKblockGeneric(ChVariables* mvariableA, ChVariables* mvariableB);
     virtual ~ChKblockGeneric();
@@ -55,7 +59,7 @@ class ChApi ChKblockGeneric : public ChKblock {
     virtual size_t GetNvars() const override { return variables.size(); }
 
     /// Access the m-th vector variable object
-    ChVariables* GetVariableN(unsigned int m_var) const { return variables[m_var]; }
+    virtual ChVariables* GetVariableN(unsigned int m_var) const override { return variables[m_var]; }
 
     /// Access the K stiffness matrix as a single block,
     /// referring only to the referenced ChVariable objects
@@ -80,6 +84,16 @@ class ChApi ChKblockGeneric : public ChKblock {
     /// Most solvers do not need this: the sparse 'storage' matrix is used for testing, for
     /// direct solvers, for dumping full matrix to Matlab for checks, etc.
     virtual void Build_K(ChSparseMatrix& storage, bool add) override;
+
+    /// Compute the positions of the entries of K in the value array of the given compressed
+    /// sparse matrix (at the current offsets of the variables).
+    virtual bool SetupScatterMap(const ChCSMatrix& storage) override;
+
+    /// Return true if the scatter map is still valid for the given matrix.
+    virtual bool IsScatterMapValid(const ChCSMatrix& storage) const override;
+
+    /// Add the K matrix into the value array of a compressed sparse matrix, using the scatter map.
+    virtual void Scatter_K(double* values) const override;
 };
 
 }  // end namespace chrono
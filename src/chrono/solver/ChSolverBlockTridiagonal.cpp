@@ -0,0 +1,599 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <numeric>
+#include <unordered_map>
+
+#include "chrono/core/ChCSMatrix.h"
+#include "chrono/solver/ChSolverBlockTridiagonal.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverBlockTridiagonal)
+
+// -----------------------------------------------------------------------------
+// Dense LU factorization with partial pivoting, used for the diagonal blocks of
+// the chains and for the Schur complement of the constraint clusters.
+// A (near) zero pivot, as obtained for redundant constraints, is replaced with a
+// very large value, which forces the corresponding unknown to zero.
+// -----------------------------------------------------------------------------
+
+static void FactorizeLU(ChMatrixDynamic<>& A, std::vector<int>& pivots) {
+    int n = A.GetRows();
+    pivots.resize(n);
+
+    double max_abs = 0;
+    for (int i = 0; i < n * n; i++)
+        max_abs = std::max(max_abs, std::abs(A(i)));
+    double min_pivot = 1e-14 * max_abs;
+
+    for (int k = 0; k < n; k++) {
+        int p = k;
+        for (int i = k + 1; i < n; i++)
+            if (std::abs(A(i, k)) > std::abs(A(p, k)))
+                p = i;
+        pivots[k] = p;
+        if (p != k)
+            A.SwapRows(k, p);
+
+        if (std::abs(A(k, k)) <= min_pivot) {
+            A(k, k) = 1e34;
+            continue;
+        }
+
+        double inv_pivot = 1.0 / A(k, k);
+        for (int i = k + 1; i < n; i++) {
+            double r = A(i, k) * inv_pivot;
+            A(i, k) = r;
+            if (r != 0)
+                for (int j = k + 1; j < n; j++)
+                    A(i, j) -= r * A(k, j);
+        }
+    }
+}
+
+static void SolveLU(const ChMatrixDynamic<>& A, const std::vector<int>& pivots, double* x) {
+    int n = A.GetRows();
+    for (int k = 0; k < n; k++)
+        if (pivots[k] != k)
+            std::swap(x[k], x[pivots[k]]);
+    for (int i = 1; i < n; i++)
+        for (int j = 0; j < i; j++)
+            x[i] -= A(i, j) * x[j];
+    for (int i = n - 1; i >= 0; i--) {
+        for (int j = i + 1; j < n; j++)
+            x[i] -= A(i, j) * x[j];
+        x[i] /= A(i, i);
+    }
+}
+
+static void InvertDense(ChMatrixDynamic<>& A) {
+    int n = A.GetRows();
+    std::vector<int> pivots;
+    FactorizeLU(A, pivots);
+    ChMatrixDynamic<> Ainv(n, n);
+    std::vector<double> col(n);
+    for (int j = 0; j < n; j++) {
+        std::fill(col.begin(), col.end(), 0.0);
+        col[j] = 1;
+        SolveLU(A, pivots, col.data());
+        for (int i = 0; i < n; i++)
+            Ainv(i, j) = col[i];
+    }
+    A.CopyFromMatrix(Ainv);
+}
+
+// -----------------------------------------------------------------------------
+
+int ChSolverBlockTridiagonal::GetMaxChainLength() const {
+    size_t len = 0;
+    for (const auto& chain : m_chains)
+        len = std::max(len, chain.Dinv.size());
+    return (int)len;
+}
+
+int ChSolverBlockTridiagonal::GetMaxClusterSize() const {
+    size_t size = 0;
+    for (const auto& cluster : m_clusters)
+        size = std::max(size, cluster.constraints.size());
+    return (int)size;
+}
+
+// Solve H_chain * x = rhs for one chain (x contains rhs on input), with the block Thomas algorithm.
+void ChSolverBlockTridiagonal::SolveChain(const Chain& chain, double* x) const {
+    int len = (int)chain.Dinv.size();
+    std::vector<double> tmp;
+
+    // Forward elimination: y_i = Dinv_i * (x_i - L_i * y_(i-1))
+    for (int i = 0; i < len; i++) {
+        int n = chain.block_offsets[i + 1] - chain.block_offsets[i];
+        double* xi = x + chain.block_offsets[i];
+        if (i > 0) {
+            const ChMatrixDynamic<>& L = chain.L[i];
+            const double* yp = x + chain.block_offsets[i - 1];
+            for (int r = 0; r < n; r++)
+                for (int c = 0; c < L.GetColumns(); c++)
+                    xi[r] -= L(r, c) * yp[c];
+        }
+        tmp.assign(xi, xi + n);
+        const ChMatrixDynamic<>& Dinv = chain.Dinv[i];
+        for (int r = 0; r < n; r++) {
+            double sum = 0;
+            for (int c = 0; c < n; c++)
+                sum += Dinv(r, c) * tmp[c];
+            xi[r] = sum;
+        }
+    }
+
+    // Back substitution: x_i = y_i - G_i * x_(i+1)
+    for (int i = len - 2; i >= 0; i--) {
+        int n = chain.block_offsets[i + 1] - chain.block_offsets[i];
+        double* xi = x + chain.block_offsets[i];
+        const double* xn = x + chain.block_offsets[i + 1];
+        const ChMatrixDynamic<>& G = chain.G[i];
+        for (int r = 0; r < n; r++)
+            for (int c = 0; c < G.GetColumns(); c++)
+                xi[r] -= G(r, c) * xn[c];
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+bool ChSolverBlockTridiagonal::Setup(ChSystemDescriptor& sysd) {
+    m_timer_setup.start();
+    m_ready = false;
+    m_chains.clear();
+    m_constraints.clear();
+    m_clusters.clear();
+
+    m_nq = sysd.CountActiveVariables();
+    int nc = sysd.CountActiveConstraints();
+    double c_a = sysd.GetMassFactor();
+    std::vector<ChKblock*>& kblocks = sysd.GetKblocksList();
+
+    // Index the active variables.
+    std::vector<ChVariables*> vars;
+    std::unordered_map<ChVariables*, int> var_index;
+    for (auto var : sysd.GetVariablesList()) {
+        if (var->IsActive()) {
+            var_index[var] = (int)vars.size();
+            vars.push_back(var);
+        }
+    }
+    int nv = (int)vars.size();
+
+    // Group the variables referenced by the same set of stiffness blocks (e.g. position and slope
+    // variables of an ANCF node) in a single chain block. Variables without stiffness blocks are
+    // kept in their own group.
+    std::vector<std::vector<int>> var_kblocks(nv);
+    for (int kb = 0; kb < (int)kblocks.size(); kb++) {
+        for (unsigned int k = 0; k < kblocks[kb]->GetNvars(); k++) {
+            if (!kblocks[kb]->GetVariableN(k)) {
+                if (verbose)
+                    GetLog() << "Block-tridiagonal solver: stiffness block with unknown variables\n";
+                m_timer_setup.stop();
+                return false;
+            }
+            auto it = var_index.find(kblocks[kb]->GetVariableN(k));
+            if (it != var_index.end() && (var_kblocks[it->second].empty() || var_kblocks[it->second].back() != kb))
+                var_kblocks[it->second].push_back(kb);
+        }
+    }
+    std::vector<int> var_group(nv);
+    std::vector<std::vector<int>> groups;
+    std::map<std::vector<int>, int> signature_group;
+    for (int iv = 0; iv < nv; iv++) {
+        if (!var_kblocks[iv].empty()) {
+            auto it = signature_group.find(var_kblocks[iv]);
+            if (it != signature_group.end()) {
+                var_group[iv] = it->second;
+                groups[it->second].push_back(iv);
+                continue;
+            }
+            signature_group[var_kblocks[iv]] = (int)groups.size();
+        }
+        var_group[iv] = (int)groups.size();
+        groups.push_back(std::vector<int>(1, iv));
+    }
+    int ng = (int)groups.size();
+
+    // Build the connectivity graph of the groups from the stiffness blocks.
+    // Each block can connect at most two groups, each group can have at most two neighbors.
+    std::vector<std::vector<int>> neighbors(ng);
+    for (auto kblock : kblocks) {
+        std::vector<int> kgroups;
+        for (unsigned int k = 0; k < kblock->GetNvars(); k++) {
+            auto it = var_index.find(kblock->GetVariableN(k));
+            if (it != var_index.end() &&
+                std::find(kgroups.begin(), kgroups.end(), var_group[it->second]) == kgroups.end())
+                kgroups.push_back(var_group[it->second]);
+        }
+        if (kgroups.size() > 2) {
+            if (verbose)
+                GetLog() << "Block-tridiagonal solver: stiffness block connecting " << (int)kgroups.size()
+                         << " nodes\n";
+            m_timer_setup.stop();
+            return false;
+        }
+        if (kgroups.size() == 2) {
+            for (int a = 0; a < 2; a++) {
+                auto& nbrs = neighbors[kgroups[a]];
+                if (std::find(nbrs.begin(), nbrs.end(), kgroups[1 - a]) == nbrs.end())
+                    nbrs.push_back(kgroups[1 - a]);
+            }
+        }
+    }
+    for (int ig = 0; ig < ng; ig++) {
+        if (neighbors[ig].size() > 2) {
+            if (verbose)
+                GetLog() << "Block-tridiagonal solver: node connected to " << (int)neighbors[ig].size()
+                         << " other nodes\n";
+            m_timer_setup.stop();
+            return false;
+        }
+    }
+
+    // Traverse the graph to extract the chains, starting from their end groups.
+    std::vector<int> var_chain(nv, -1);
+    std::vector<int> var_block(nv, -1);
+    std::vector<int> var_block_offset(nv, -1);
+    std::vector<bool> visited(ng, false);
+    for (int pass = 0; pass < 2; pass++) {
+        for (int ig = 0; ig < ng; ig++) {
+            if (visited[ig] || (pass == 0 && neighbors[ig].size() == 2))
+                continue;
+            if (pass == 1) {
+                // All groups left over at the second pass belong to closed loops.
+                if (verbose)
+                    GetLog() << "Block-tridiagonal solver: closed loop of stiffness blocks\n";
+                m_timer_setup.stop();
+                return false;
+            }
+            Chain chain;
+            chain.ndof = 0;
+            int prev = -1;
+            int cur = ig;
+            while (cur >= 0) {
+                visited[cur] = true;
+                int block = (int)chain.block_offsets.size();
+                chain.block_offsets.push_back(chain.ndof);
+                for (auto iv : groups[cur]) {
+                    var_chain[iv] = (int)m_chains.size();
+                    var_block[iv] = block;
+                    var_block_offset[iv] = chain.ndof - chain.block_offsets[block];
+                    chain.vars.push_back(vars[iv]);
+                    chain.offsets.push_back(chain.ndof);
+                    chain.ndof += vars[iv]->Get_ndof();
+                }
+                int next = -1;
+                for (auto nbr : neighbors[cur])
+                    if (nbr != prev)
+                        next = nbr;
+                prev = cur;
+                cur = next;
+            }
+            chain.block_offsets.push_back(chain.ndof);
+            m_chains.push_back(std::move(chain));
+        }
+    }
+    int nchains = (int)m_chains.size();
+
+    // Map the system degrees of freedom to their chains.
+    m_dof_chain.assign(m_nq, -1);
+    m_dof_local.assign(m_nq, -1);
+    for (int iv = 0; iv < nv; iv++) {
+        int offset = m_chains[var_chain[iv]].block_offsets[var_block[iv]] + var_block_offset[iv];
+        for (int k = 0; k < vars[iv]->Get_ndof(); k++) {
+            m_dof_chain[vars[iv]->GetOffset() + k] = var_chain[iv];
+            m_dof_local[vars[iv]->GetOffset() + k] = offset + k;
+        }
+    }
+
+    // Collect the stiffness blocks acting on each chain.
+    std::vector<std::vector<ChKblock*>> chain_kblocks(nchains);
+    for (auto kblock : kblocks) {
+        for (unsigned int k = 0; k < kblock->GetNvars(); k++) {
+            auto it = var_index.find(kblock->GetVariableN(k));
+            if (it != var_index.end()) {
+                chain_kblocks[var_chain[it->second]].push_back(kblock);
+                break;
+            }
+        }
+    }
+
+    // Assemble and factorize the chains (in parallel, chains are independent).
+#pragma omp parallel for schedule(dynamic, 4)
+    for (int ic = 0; ic < nchains; ic++) {
+        Chain& chain = m_chains[ic];
+        int len = (int)chain.block_offsets.size() - 1;
+
+        // Diagonal blocks, upper (i,i+1) blocks and lower (i,i-1) blocks.
+        std::vector<ChMatrixDynamic<>> D(len);
+        std::vector<ChMatrixDynamic<>> U(len);
+        chain.L.assign(len, ChMatrixDynamic<>(0, 0));
+        for (int i = 0; i < len; i++) {
+            int n = chain.block_offsets[i + 1] - chain.block_offsets[i];
+            D[i].Reset(n, n);
+            if (i + 1 < len)
+                U[i].Reset(n, chain.block_offsets[i + 2] - chain.block_offsets[i + 1]);
+            if (i > 0)
+                chain.L[i].Reset(n, chain.block_offsets[i] - chain.block_offsets[i - 1]);
+        }
+
+        // Mass of the variables, in the diagonal blocks.
+        for (auto var : chain.vars) {
+            int n = var->Get_ndof();
+            int iv = var_index.find(var)->second;
+            int off = var_block_offset[iv];
+            ChMatrixDynamic<> unit(n, 1);
+            ChMatrixDynamic<> column(n, 1);
+            for (int j = 0; j < n; j++) {
+                unit.FillElem(0);
+                unit(j) = 1;
+                column.FillElem(0);
+                var->Compute_inc_Mb_v(column, unit);
+                for (int r = 0; r < n; r++)
+                    D[var_block[iv]](off + r, off + j) += c_a * column(r);
+            }
+        }
+
+        // Scatter the stiffness blocks.
+        for (auto kblock : chain_kblocks[ic]) {
+            const ChMatrix<>& K = *kblock->Get_K();
+            int row_a = 0;
+            for (unsigned int a = 0; a < kblock->GetNvars(); a++) {
+                ChVariables* var_a = kblock->GetVariableN(a);
+                int n_a = var_a->Get_ndof();
+                auto it_a = var_index.find(var_a);
+                if (it_a != var_index.end()) {
+                    int pos_a = var_block[it_a->second];
+                    int off_a = var_block_offset[it_a->second];
+                    int row_b = 0;
+                    for (unsigned int b = 0; b < kblock->GetNvars(); b++) {
+                        ChVariables* var_b = kblock->GetVariableN(b);
+                        int n_b = var_b->Get_ndof();
+                        auto it_b = var_index.find(var_b);
+                        if (it_b != var_index.end()) {
+                            int pos_b = var_block[it_b->second];
+                            int off_b = var_block_offset[it_b->second];
+                            ChMatrixDynamic<>& block =
+                                (pos_b == pos_a) ? D[pos_a] : (pos_b == pos_a + 1) ? U[pos_a] : chain.L[pos_a];
+                            for (int r = 0; r < n_a; r++)
+                                for (int c = 0; c < n_b; c++)
+                                    block(off_a + r, off_b + c) += K(row_a + r, row_b + c);
+                        }
+                        row_b += n_b;
+                    }
+                }
+                row_a += n_a;
+            }
+        }
+
+        // Block LU factorization (block Thomas algorithm).
+        chain.Dinv.resize(len);
+        chain.G.assign(len, ChMatrixDynamic<>(0, 0));
+        for (int i = 0; i < len; i++) {
+            chain.Dinv[i] = D[i];
+            if (i > 0) {
+                ChMatrixDynamic<> LG(chain.L[i].GetRows(), chain.G[i - 1].GetColumns());
+                LG.MatrMultiply(chain.L[i], chain.G[i - 1]);
+                chain.Dinv[i].MatrDec(LG);
+            }
+            InvertDense(chain.Dinv[i]);
+            if (i + 1 < len) {
+                chain.G[i].Reset(U[i].GetRows(), U[i].GetColumns());
+                chain.G[i].MatrMultiply(chain.Dinv[i], U[i]);
+            }
+        }
+    }
+
+    // Extract the sparse rows of the constraint Jacobian.
+    if (nc > 0) {
+        ChCSMatrix Cq(nc, m_nq, true);
+        int s_c = 0;
+        m_constraints.resize(nc);
+        for (auto constraint : sysd.GetConstraintsList()) {
+            if (constraint->IsActive()) {
+                constraint->Build_Cq(Cq, s_c);
+                m_constraints[s_c].cfm = constraint->Get_cfm_i();
+                s_c++;
+            }
+        }
+        Cq.Compress();
+        const int* rows = Cq.GetCS_LeadingIndexArray();
+        const int* cols = Cq.GetCS_TrailingIndexArray();
+        const double* vals = Cq.GetCS_ValueArray();
+        for (int i = 0; i < nc; i++) {
+            ConstraintRow& row = m_constraints[i];
+            for (int k = rows[i]; k < rows[i + 1]; k++) {
+                if (vals[k] == 0)
+                    continue;
+                row.dofs.push_back(cols[k]);
+                row.values.push_back(vals[k]);
+                int chain = m_dof_chain[cols[k]];
+                if (std::find(row.chains.begin(), row.chains.end(), chain) == row.chains.end())
+                    row.chains.push_back(chain);
+            }
+        }
+    }
+
+    // Compute Y = H^-1 * Cq' for each constraint, on the chains it acts on.
+#pragma omp parallel for schedule(dynamic, 4)
+    for (int i = 0; i < nc; i++) {
+        ConstraintRow& row = m_constraints[i];
+        row.Y.resize(row.chains.size());
+        for (size_t k = 0; k < row.chains.size(); k++) {
+            const Chain& chain = m_chains[row.chains[k]];
+            row.Y[k].assign(chain.ndof, 0.0);
+            for (size_t j = 0; j < row.dofs.size(); j++)
+                if (m_dof_chain[row.dofs[j]] == row.chains[k])
+                    row.Y[k][m_dof_local[row.dofs[j]]] = row.values[j];
+            SolveChain(chain, row.Y[k].data());
+        }
+    }
+
+    // Group the constraints in clusters (constraints coupled through the chains they act on).
+    std::vector<int> chain_root(nchains);
+    std::iota(chain_root.begin(), chain_root.end(), 0);
+    auto find_root = [&chain_root](int c) {
+        while (chain_root[c] != c)
+            c = chain_root[c] = chain_root[chain_root[c]];
+        return c;
+    };
+    for (const auto& row : m_constraints)
+        for (size_t k = 1; k < row.chains.size(); k++)
+            chain_root[find_root(row.chains[k])] = find_root(row.chains[0]);
+
+    std::vector<int> root_cluster(nchains, -1);
+    for (int i = 0; i < nc; i++) {
+        const ConstraintRow& row = m_constraints[i];
+        int cluster = -1;
+        if (!row.chains.empty()) {
+            int root = find_root(row.chains[0]);
+            if (root_cluster[root] < 0) {
+                root_cluster[root] = (int)m_clusters.size();
+                m_clusters.push_back(Cluster());
+            }
+            cluster = root_cluster[root];
+        } else {
+            // Constraint not acting on any active variable.
+            cluster = (int)m_clusters.size();
+            m_clusters.push_back(Cluster());
+        }
+        m_clusters[cluster].constraints.push_back(i);
+    }
+
+    // Assemble and factorize the Schur complement N = Cq * H^-1 * Cq' - cfm of each cluster.
+    int nclusters = (int)m_clusters.size();
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int icl = 0; icl < nclusters; icl++) {
+        Cluster& cluster = m_clusters[icl];
+        int m = (int)cluster.constraints.size();
+        cluster.N.Reset(m, m);
+        for (int a = 0; a < m; a++) {
+            const ConstraintRow& row_a = m_constraints[cluster.constraints[a]];
+            for (int b = 0; b < m; b++) {
+                const ConstraintRow& row_b = m_constraints[cluster.constraints[b]];
+                double sum = 0;
+                for (size_t k = 0; k < row_b.chains.size(); k++) {
+                    int chain = row_b.chains[k];
+                    for (size_t j = 0; j < row_a.dofs.size(); j++)
+                        if (m_dof_chain[row_a.dofs[j]] == chain)
+                            sum += row_a.values[j] * row_b.Y[k][m_dof_local[row_a.dofs[j]]];
+                }
+                cluster.N(a, b) = sum;
+            }
+            cluster.N(a, a) -= row_a.cfm;
+        }
+        FactorizeLU(cluster.N, cluster.pivots);
+    }
+
+    m_ready = true;
+    m_timer_setup.stop();
+
+    if (verbose) {
+        GetLog() << " Block-tridiagonal setup n = " << m_nq << "  chains = " << nchains
+                 << "  max length = " << GetMaxChainLength() << "  constraints = " << nc
+                 << "  clusters = " << nclusters << "  max cluster = " << GetMaxClusterSize() << "\n";
+        GetLog() << "  time: " << m_timer_setup.GetTimeSecondsIntermediate() << "s\n";
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+double ChSolverBlockTridiagonal::Solve(ChSystemDescriptor& sysd) {
+    if (!m_ready) {
+        GetLog() << "Block-tridiagonal solver: Solve() called without a successful Setup()\n";
+        return -1.0;
+    }
+
+    m_timer_solve.start();
+
+    int nc = (int)m_constraints.size();
+    ChMatrixDynamic<> x(m_nq + nc, 1);
+
+    // Solve H * z = f, chain by chain.
+    int nchains = (int)m_chains.size();
+#pragma omp parallel for schedule(dynamic, 4)
+    for (int ic = 0; ic < nchains; ic++) {
+        const Chain& chain = m_chains[ic];
+        std::vector<double> z(chain.ndof);
+        for (size_t i = 0; i < chain.vars.size(); i++) {
+            const ChMatrix<>& fb = chain.vars[i]->Get_fb();
+            for (int k = 0; k < chain.vars[i]->Get_ndof(); k++)
+                z[chain.offsets[i] + k] = fb(k);
+        }
+        SolveChain(chain, z.data());
+        for (size_t i = 0; i < chain.vars.size(); i++) {
+            int offset = chain.vars[i]->GetOffset();
+            for (int k = 0; k < chain.vars[i]->Get_ndof(); k++)
+                x(offset + k) = z[chain.offsets[i] + k];
+        }
+    }
+
+    if (nc > 0) {
+        // Right-hand side of the constraint equations.
+        std::vector<double> b;
+        b.reserve(nc);
+        for (auto constraint : sysd.GetConstraintsList())
+            if (constraint->IsActive())
+                b.push_back(constraint->Get_b_i());
+
+        // For each cluster: solve N * y = Cq * z + b, then correct q = z - H^-1 * Cq' * y.
+        // Clusters act on disjoint sets of chains, so they can be processed in parallel.
+        int nclusters = (int)m_clusters.size();
+#pragma omp parallel for schedule(dynamic, 1)
+        for (int icl = 0; icl < nclusters; icl++) {
+            const Cluster& cluster = m_clusters[icl];
+            int m = (int)cluster.constraints.size();
+            std::vector<double> y(m);
+            for (int a = 0; a < m; a++) {
+                const ConstraintRow& row = m_constraints[cluster.constraints[a]];
+                double sum = b[cluster.constraints[a]];
+                for (size_t j = 0; j < row.dofs.size(); j++)
+                    sum += row.values[j] * x(row.dofs[j]);
+                y[a] = sum;
+            }
+            SolveLU(cluster.N, cluster.pivots, y.data());
+
+            for (int a = 0; a < m; a++) {
+                const ConstraintRow& row = m_constraints[cluster.constraints[a]];
+                x(m_nq + cluster.constraints[a]) = y[a];
+                for (size_t k = 0; k < row.chains.size(); k++) {
+                    const Chain& chain = m_chains[row.chains[k]];
+                    for (size_t i = 0; i < chain.vars.size(); i++) {
+                        int offset = chain.vars[i]->GetOffset();
+                        for (int j = 0; j < chain.vars[i]->Get_ndof(); j++)
+                            x(offset + j) -= row.Y[k][chain.offsets[i] + j] * y[a];
+                    }
+                }
+            }
+        }
+    }
+
+    // Scatter the solution to the system descriptor.
+    sysd.FromVectorToUnknowns(x);
+
+    m_timer_solve.stop();
+
+    return 0;
+}
+
+}  // end namespace chrono
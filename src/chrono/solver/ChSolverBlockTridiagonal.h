@@ -0,0 +1,137 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CHSOLVERBLOCKTRIDIAGONAL_H
+#define CHSOLVERBLOCKTRIDIAGONAL_H
+
+#include <vector>
+
+#include "chrono/core/ChMatrixDynamic.h"
+#include "chrono/core/ChTimer.h"
+#include "chrono/solver/ChSolver.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Direct solver for systems whose stiffness blocks connect the variables in chains, as is the
+/// case for cables, hoses and wire harnesses modeled with two-node beam elements (for example
+/// meshes created with ChBuilderBeam, ChBuilderBeamANCF or ChExtruderBeamEuler).\n
+/// In the Setup() phase, the variables referenced by the same set of ChKblock items (e.g. the
+/// position and slope variables of an ANCF node) are grouped in nodes, and the nodes are ordered
+/// in chains following the ChKblock items, so that the matrix H = c_a*M + K of each chain is
+/// block-tridiagonal; each chain is assembled and factorized independently (in parallel), with
+/// cost linear in the chain length.
+/// Constraints are handled through their Schur complement. Constraints are grouped in clusters
+/// of constraints acting on the same chains (directly or indirectly) and each cluster is
+/// factorized as a dense matrix, so the solver is efficient when each chain is constrained by a
+/// few constraints (e.g. the end attachments of the cables), as the total cost is then linear
+/// in the number of variables.\n
+/// The Setup() phase fails (returning false) if some ChKblock connects more than two nodes,
+/// if a node is connected to more than two others, or if the connections form a closed loop.\n
+/// As other direct solvers, it cannot handle VI and complementarity problems (all constraints are
+/// treated as bilateral), so it cannot be used with NSC contacts.\n
+/// See ChSystemDescriptor for more information about the problem formulation and the data structures
+/// passed to the solver.
+class ChApi ChSolverBlockTridiagonal : public ChSolver {
+  public:
+    ChSolverBlockTridiagonal() {}
+    ~ChSolverBlockTridiagonal() override {}
+
+    virtual Type GetType() const override { return Type::BLOCK_TRIDIAGONAL; }
+
+    /// Indicate whether or not the Solve() phase requires an up-to-date problem matrix.
+    /// As typical of direct solvers, this solver only requires the matrix for its Setup() phase.
+    virtual bool SolveRequiresMatrix() const override { return false; }
+
+    /// Perform the solver setup operations: find the variable chains, assemble and factorize
+    /// the block-tridiagonal chain matrices and the Schur complement of the constraints.
+    /// Returns true if successful and false otherwise.
+    virtual bool Setup(ChSystemDescriptor& sysd) override;
+
+    /// Solve the problem using the factorization obtained at the last call to Setup().
+    virtual double Solve(ChSystemDescriptor& sysd) override;
+
+    /// Get the number of variable chains found at the last call to Setup().
+    int GetNumChains() const { return (int)m_chains.size(); }
+
+    /// Get the number of nodes in the longest chain found at the last call to Setup().
+    int GetMaxChainLength() const;
+
+    /// Get the number of constraint clusters found at the last call to Setup().
+    int GetNumClusters() const { return (int)m_clusters.size(); }
+
+    /// Get the number of constraints in the largest cluster found at the last call to Setup().
+    int GetMaxClusterSize() const;
+
+    /// Reset timers for internal phases in Solve and Setup.
+    void ResetTimers() {
+        m_timer_setup.reset();
+        m_timer_solve.reset();
+    }
+
+    /// Get cumulative time for the Setup phase.
+    double GetTimeSetup() const { return m_timer_setup(); }
+
+    /// Get cumulative time for the Solve phase.
+    double GetTimeSolve() const { return m_timer_solve(); }
+
+  private:
+    /// Factorized block-tridiagonal matrix of a chain of variables.
+    struct Chain {
+        std::vector<ChVariables*> vars;       ///< variables, in chain order
+        std::vector<int> offsets;             ///< offset of each variable in the chain vector
+        std::vector<int> block_offsets;       ///< offset of each block (node) in the chain vector, plus ndof
+        std::vector<ChMatrixDynamic<>> Dinv;  ///< inverses of the factorized diagonal blocks
+        std::vector<ChMatrixDynamic<>> G;     ///< Dinv_i * U_i, with U_i the block coupling i and i+1
+        std::vector<ChMatrixDynamic<>> L;     ///< lower blocks, coupling i and i-1
+        int ndof;                             ///< total number of degrees of freedom
+    };
+
+    /// Sparse row of the constraint Jacobian and its Schur complement contribution H^-1 * Cq'.
+    struct ConstraintRow {
+        std::vector<int> dofs;               ///< system indices of the non-zero entries
+        std::vector<double> values;          ///< values of the non-zero entries
+        std::vector<int> chains;             ///< chains touched by this constraint
+        std::vector<std::vector<double>> Y;  ///< H^-1 * Cq' restricted to each touched chain
+        double cfm;                          ///< constraint compliance (constraint force mixing)
+    };
+
+    /// Dense factorized Schur complement of a cluster of constraints.
+    struct Cluster {
+        std::vector<int> constraints;  ///< indices of the constraints in this cluster
+        ChMatrixDynamic<> N;           ///< LU factorization of the Schur complement
+        std::vector<int> pivots;       ///< pivoting of the LU factorization
+    };
+
+    void SolveChain(const Chain& chain, double* x) const;
+
+    std::vector<Chain> m_chains;               ///< variable chains
+    std::vector<int> m_dof_chain;              ///< chain of each system degree of freedom
+    std::vector<int> m_dof_local;              ///< index of each system degree of freedom in its chain
+    std::vector<ConstraintRow> m_constraints;  ///< active constraints
+    std::vector<Cluster> m_clusters;           ///< constraint clusters
+    int m_nq = 0;                              ///< number of active degrees of freedom
+    bool m_ready = false;                      ///< was the last Setup() successful?
+
+    ChTimer<> m_timer_setup;  ///< timer for the Setup phase
+    ChTimer<> m_timer_solve;  ///< timer for the Solve phase
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
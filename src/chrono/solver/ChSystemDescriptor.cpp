@@ -10,9 +10,13 @@
 //
 // =============================================================================
 
+#include <cstdint>
+#include <unordered_map>
+
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
+#include "chrono/core/ChCSMatrix.h"
 #include "chrono/core/ChLinkedListMatrix.h"
 
 namespace chrono {
@@ -165,11 +169,8 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Cq,
 
     // If some stiffness / hessian matrix has been added to H ,
     // also add it to the sparse H
-    int s_k = 0;
     if (H) {
-        for (unsigned int ik = 0; ik < this->vstiffness.size(); ik++) {
-            this->vstiffness[ik]->Build_K(*H, true);
-        }
+        BuildKblocks(*H);
     }
 
     // Fills Cq jacobian, E 'compliance' matrix , the 'b' vector and friction coeff.vector,
@@ -232,10 +233,7 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChMatrix<>* rhs)
 		}
 
 		// If present, add stiffness matrix K to upper-left block of Z.
-		int s_k = 0;
-		for (unsigned int ik = 0; ik < this->vstiffness.size(); ik++) {
-			this->vstiffness[ik]->Build_K(*Z, true);
-		}
+		BuildKblocks(*Z);
 
 		// Fill Z by looping over constraints.
 		int s_c = 0;
@@ -711,6 +709,95 @@ void ChSystemDescriptor::UnknownsProject(
     }
 }
 
+void ChSystemDescriptor::BuildKblocks(ChSparseMatrix& storage) {
+    // Direct scatter in the value array of a compressed CS matrix. All scatter maps are validated (and rebuilt
+    // if needed) before any value is written, so that a missing entry can still fall back to Build_K.
+    ChCSMatrix* csmat = dynamic_cast<ChCSMatrix*>(&storage);
+    if (csmat && csmat->IsCompressed()) {
+        bool mapped = true;
+        for (unsigned int ik = 0; ik < vstiffness.size(); ik++) {
+            if (!vstiffness[ik]->IsScatterMapValid(*csmat) && !vstiffness[ik]->SetupScatterMap(*csmat)) {
+                mapped = false;
+                break;
+            }
+        }
+
+        if (mapped) {
+            UpdateKblockColoring();
+            double* values = csmat->GetCS_ValueArray();
+            int num_colors = (int)kblock_color_start.size() - 1;
+            for (int color = 0; color < num_colors; color++) {
+                int start = kblock_color_start[color];
+                int end = kblock_color_start[color + 1];
+                // The last group collects blocks that could not be colored: assemble those sequentially.
+                bool parallel = (color < 64);
+#pragma omp parallel for schedule(static) num_threads(num_threads) if (parallel)
+                for (int i = start; i < end; i++) {
+                    vstiffness[kblock_color_order[i]]->Scatter_K(values);
+                }
+            }
+            return;
+        }
+    }
+
+    for (unsigned int ik = 0; ik < vstiffness.size(); ik++) {
+        vstiffness[ik]->Build_K(storage, true);
+    }
+}
+
+void ChSystemDescriptor::UpdateKblockColoring() {
+    // Blocks may be reused with different variables (e.g. contacts), so check the referenced variables as well.
+    std::vector<ChVariables*> block_vars;
+    for (unsigned int ik = 0; ik < vstiffness.size(); ik++) {
+        for (size_t iv = 0; iv < vstiffness[ik]->GetNvars(); iv++)
+            block_vars.push_back(vstiffness[ik]->GetVariableN((unsigned int)iv));
+    }
+    if (kblock_colored == vstiffness && kblock_colored_vars == block_vars)
+        return;
+
+    // Greedy coloring, with the colors used by the blocks referencing each variable tracked in a bit mask.
+    // Blocks for which none of the 64 colors is available are assigned to an extra (sequential) group.
+    int num_blocks = (int)vstiffness.size();
+    std::vector<int> block_color(num_blocks);
+    std::vector<int> color_count(65, 0);
+    std::unordered_map<ChVariables*, uint64_t> var_colors;
+
+    for (int ik = 0; ik < num_blocks; ik++) {
+        ChKblock* block = vstiffness[ik];
+        uint64_t used = 0;
+        for (size_t iv = 0; iv < block->GetNvars(); iv++) {
+            ChVariables* var = block->GetVariableN((unsigned int)iv);
+            // Blocks which do not expose their variables may conflict with any other block.
+            used |= var ? var_colors[var] : ~uint64_t(0);
+        }
+
+        int color = 0;
+        while (color < 64 && (used & (uint64_t(1) << color)))
+            color++;
+
+        if (color < 64) {
+            for (size_t iv = 0; iv < block->GetNvars(); iv++)
+                var_colors[block->GetVariableN((unsigned int)iv)] |= (uint64_t(1) << color);
+        }
+
+        block_color[ik] = color;
+        color_count[color]++;
+    }
+
+    // Group the block indexes by color (counting sort).
+    kblock_color_start.assign(66, 0);
+    for (int color = 0; color < 65; color++)
+        kblock_color_start[color + 1] = kblock_color_start[color] + color_count[color];
+
+    kblock_color_order.resize(num_blocks);
+    std::vector<int> next(kblock_color_start.begin(), kblock_color_start.end() - 1);
+    for (int ik = 0; ik < num_blocks; ik++)
+        kblock_color_order[next[block_color[ik]]++] = ik;
+
+    kblock_colored = vstiffness;
+    kblock_colored_vars = block_vars;
+}
+
 void ChSystemDescriptor::SetNumThreads(int nthreads) {
     if (nthreads == this->num_threads)
         return;
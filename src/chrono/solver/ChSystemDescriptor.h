@@ -89,6 +89,15 @@ class ChApi ChSystemDescriptor {
     int n_c;            ///< number of active constraints
     bool freeze_count;  ///< for optimization: avoid to re-count the number of active variables and constraints
 
+    std::vector<ChKblock*> kblock_colored;         ///< K blocks for which the current coloring was computed
+    std::vector<ChVariables*> kblock_colored_vars;  ///< variables referenced by these K blocks
+    std::vector<int> kblock_color_order;           ///< indexes of the K blocks, grouped by color
+    std::vector<int> kblock_color_start;           ///< start of each color group in kblock_color_order
+
+    /// Partition the K blocks in groups (colors) such that blocks in the same group do not share variables.
+    /// The coloring is recomputed only if the list of K blocks changed since the last call.
+    void UpdateKblockColoring();
+
   public:
     /// Constructor
     ChSystemDescriptor();
@@ -358,6 +367,13 @@ class ChApi ChSystemDescriptor {
                                      ChMatrix<>* rhs     ///< [out] assembled RHS vector
     );
 
+    /// Add all K blocks to the given sparse matrix (at the current variable offsets).
+    /// If 'storage' is a compressed ChCSMatrix whose sparsity pattern contains all the K block entries (e.g.
+    /// with sparsity pattern lock enabled, after the first assembly), the blocks are written directly in its
+    /// value array through cached scatter maps, in parallel over groups of blocks that do not share variables.
+    /// Otherwise, this falls back to ChKblock::Build_K.
+    virtual void BuildKblocks(ChSparseMatrix& storage);
+
     /// Saves to disk the LAST used matrices of the problem.
     /// If assembled == true,
     ///    dump_Z.dat   has the assembled optimization matrix (Matlab sparse format)
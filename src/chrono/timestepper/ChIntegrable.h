@@ -337,6 +337,20 @@ class ChApi ChIntegrableIIorder : public ChIntegrable {
         throw ChException("LoadResidual_Mv() not implemented, implicit integrators cannot be used. ");
     };
 
+    /// Assuming   M*a = F(x,v,t) + Cq'*L
+    ///         C(x,t) = 0
+    /// increment a vector Md with the diagonal of a lumped approximation of the mass matrix M:
+    ///    Md += c*diag(M_lumped)
+    /// The default implementation uses row-sum lumping, Md += c*M*[1,1,...]', which is exact for diagonal
+    /// mass matrices. Used by explicit integrators that do not solve a linear system at each step.
+    virtual void LoadLumpedMass_Md(ChVectorDynamic<>& Md,  ///< result: Md += c*diag(M_lumped)
+                                   const double c          ///< a scaling factor
+                                   ) {
+        ChVectorDynamic<> ones(Md.GetRows());
+        ones.FillElem(1.0);
+        LoadResidual_Mv(Md, ones, c);
+    }
+
     /// Assuming   M*a = F(x,v,t) + Cq'*L
     ///         C(x,t) = 0
     /// increment a vectorR (usually the residual in a Newton Raphson iteration
@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepper.h"
@@ -36,6 +37,7 @@ class my_enum_mappers : public ChTimestepper {
     CH_ENUM_VAL(Type::EULER_EXPLICIT);
     CH_ENUM_VAL(Type::LEAPFROG);
     CH_ENUM_VAL(Type::NEWMARK);
+    CH_ENUM_VAL(Type::CENTRAL_DIFFERENCE);
     CH_ENUM_VAL(Type::CUSTOM);
     CH_ENUM_MAPPER_END(Type);
 };
@@ -298,6 +300,87 @@ void ChTimestepperLeapfrog::Advance(const double dt) {
 
 // -----------------------------------------------------------------------------
 
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChTimestepperCentralDifference)
+
+// Performs a step of the explicit central difference integrator (velocity-Verlet form), with lumped mass.
+// The step is split in equal substeps no larger than max_substep.
+void ChTimestepperCentralDifference::Advance(const double dt) {
+    // downcast
+    ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
+
+    if (mintegrable->GetNconstr() > 0)
+        throw ChException("ChTimestepperCentralDifference: constraints are not supported.");
+
+    // setup main vectors
+    mintegrable->StateSetup(X, V, A);
+
+    // setup auxiliary vectors
+    int n = mintegrable->GetNcoords_v();
+    Dx.Reset(n, GetIntegrable());
+    R.Reset(n);
+    L.Reset(0);
+
+    // (re)evaluate the lumped mass matrix, if needed
+    if (Md.GetRows() != n) {
+        acc_valid = false;
+        Md.Reset(n);
+        mintegrable->LoadLumpedMass_Md(Md, 1.0);
+        for (int i = 0; i < n; i++) {
+            if (Md(i) <= 0)
+                throw ChException("ChTimestepperCentralDifference: non-positive lumped mass.");
+        }
+    }
+
+    num_substeps = (max_substep > 0) ? std::max(1, (int)std::ceil(dt / max_substep - 1e-9)) : 1;
+    double h = dt / num_substeps;
+
+    mintegrable->StateGather(X, V, T);  // state <- system
+
+    // initial accelerations: reuse those of the last step, unless the state was changed in between
+    if (acc_valid && T == acc_time)
+        mintegrable->StateGatherAcceleration(A);
+    else
+        ComputeAccelerations(mintegrable);
+
+    for (int k = 0; k < num_substeps; k++) {
+        // half-step velocities and position increment
+        for (int i = 0; i < n; i++) {
+            V(i) += A(i) * (0.5 * h);
+            Dx(i) = V(i) * h;
+        }
+
+        // advance X (the increment also handles rotation coordinates, if any)
+        mintegrable->StateIncrementX(X, X, Dx);
+        T += h;
+
+        // new accelerations, evaluated with half-step velocities
+        ComputeAccelerations(mintegrable);
+
+        // advance V
+        for (int i = 0; i < n; i++)
+            V(i) += A(i) * (0.5 * h);
+    }
+
+    mintegrable->StateScatter(X, V, T);        // state -> system
+    mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data
+
+    acc_valid = true;
+    acc_time = T;
+}
+
+void ChTimestepperCentralDifference::ComputeAccelerations(ChIntegrableIIorder* mintegrable) {
+    mintegrable->StateScatter(X, V, T);  // state -> system (also updates the system)
+
+    R.FillElem(0);
+    mintegrable->LoadResidual_F(R, 1.0);
+
+    for (int i = 0; i < R.GetRows(); i++)
+        A(i) = R(i) / Md(i);
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerImplicit)
 
@@ -46,6 +46,7 @@ class ChApi ChTimestepper {
           EULER_EXPLICIT = 8,
           LEAPFROG = 9,
           NEWMARK = 10,
+          CENTRAL_DIFFERENCE = 11,
           CUSTOM = 20
       };
 
@@ -376,6 +377,66 @@ class ChApi ChTimestepperLeapfrog : public ChTimestepperIIorder {
                          ) override;
 };
 
+/// Explicit central difference timestepper, with lumped (diagonal) mass matrix.
+/// This integrator implements the central difference scheme in velocity-Verlet form:
+///    v_half = v + a * dt/2
+///    x_new  = x + v_half * dt
+///    a_new  = Md^-1 * F(x_new, v_half)
+///    v_new  = v_half + a_new * dt/2
+/// where Md is a lumped approximation of the mass matrix (see ChIntegrableIIorder::LoadLumpedMass_Md), evaluated
+/// at the first step and reused as long as the number of coordinates does not change. No linear system is solved,
+/// so each substep requires a single force evaluation: the accelerations at the start of a step are those computed
+/// at the end of the previous step (they are only re-evaluated at the first step, if the system time was changed
+/// in between, or after ResetAccelerations). The scheme is only conditionally stable: each call to
+/// Advance is split into equal substeps no larger than the maximum substep (see SetMaxSubstep), which should be a
+/// fraction of the critical time step (e.g. as estimated with ChMesh::ComputeStableTimestep for FEA meshes).
+/// Constraints are not supported (use fixed nodes and penalty-based SMC contact instead). Rigid bodies are not
+/// supported either: row-sum lumping of their rotational inertia is not a valid approximation, so ChSystem throws
+/// an exception if it contains active bodies. Use this integrator for systems of FEA nodes (and other variables
+/// with a diagonal mass matrix).
+class ChApi ChTimestepperCentralDifference : public ChTimestepperIIorder {
+
+  protected:
+    ChVectorDynamic<> Md;  ///< lumped mass matrix (diagonal)
+    ChVectorDynamic<> R;   ///< force residual
+    ChStateDelta Dx;       ///< position increment
+    double max_substep;    ///< maximum substep (0: no subcycling)
+    int num_substeps;      ///< number of substeps taken in the last call to Advance
+    bool acc_valid;        ///< true if the accelerations of the last step can be reused
+    double acc_time;       ///< time at the end of the last step
+
+  public:
+    /// Constructors (default empty)
+    ChTimestepperCentralDifference(ChIntegrableIIorder* mintegrable = nullptr)
+        : ChTimestepperIIorder(mintegrable), max_substep(0), num_substeps(0), acc_valid(false), acc_time(0) {}
+
+    virtual Type GetType() const override { return Type::CENTRAL_DIFFERENCE; }
+
+    /// Set the maximum substep (default: 0, i.e. a single substep per call to Advance).
+    void SetMaxSubstep(double val) { max_substep = val; }
+
+    /// Get the maximum substep.
+    double GetMaxSubstep() const { return max_substep; }
+
+    /// Get the number of substeps taken in the last call to Advance.
+    int GetNumSubsteps() const { return num_substeps; }
+
+    /// Force the re-evaluation of the lumped mass matrix at the next step (e.g., after changing masses).
+    void ResetLumpedMass() { Md.Reset(0); }
+
+    /// Force the re-evaluation of the accelerations at the start of the next step, rather than reusing those
+    /// of the last step (e.g., after modifying the state or the applied loads between steps).
+    void ResetAccelerations() { acc_valid = false; }
+
+    /// Performs an integration timestep
+    virtual void Advance(const double dt  ///< timestep to advance
+                         ) override;
+
+  private:
+    /// Evaluate the accelerations A = Md^-1 * F(X,V,T).
+    void ComputeAccelerations(ChIntegrableIIorder* mintegrable);
+};
+
 /// Performs a step of Euler implicit for II order systems.
 class ChApi ChTimestepperEulerImplicit : public ChTimestepperIIorder, public ChImplicitIterativeTimestepper {
 
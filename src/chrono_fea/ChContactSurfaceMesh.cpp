@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/collision/ChCModelBullet.h"
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChSystem.h"
@@ -247,6 +249,13 @@ ChVector<> ChContactTriangleXYZROT::ComputeNormal(const double U, const double V
 //////////////////////////////////////////////////////////////////////////////
 ////  ChContactSurfaceMesh
 
+ChContactSurfaceMesh::ChContactSurfaceMesh(ChMesh* parentmesh)
+    : ChContactSurface(parentmesh), use_single_model(false), mesh_model(nullptr) {}
+
+ChContactSurfaceMesh::~ChContactSurfaceMesh() {
+    delete mesh_model;
+}
+
 void ChContactSurfaceMesh::AddFacesFromBoundary(double sphere_swept, bool ccw) {
     std::vector<std::array<ChNodeFEAxyz*, 3>> triangles;
     std::vector<std::array<std::shared_ptr<ChNodeFEAxyz>, 3>> triangles_ptrs;
@@ -905,6 +914,11 @@ unsigned int ChContactSurfaceMesh::GetNumVertices() const {
 }
 
 void ChContactSurfaceMesh::SurfaceSyncCollisionModels() {
+    if (mesh_model) {
+        // refits the hierarchy of face bounding boxes
+        mesh_model->SyncPosition();
+        return;
+    }
     for (unsigned int j = 0; j < vfaces.size(); j++) {
         this->vfaces[j]->GetCollisionModel()->SyncPosition();
     }
@@ -915,7 +929,60 @@ void ChContactSurfaceMesh::SurfaceSyncCollisionModels() {
 
 void ChContactSurfaceMesh::SurfaceAddCollisionModelsToSystem(ChSystem* msys) {
     assert(msys);
+
+    // Aggregate all faces in a single collision model (rebuilt here, since faces may have been added).
+    if (mesh_model)
+        msys->GetCollisionSystem()->Remove(mesh_model);
+    delete mesh_model;
+    mesh_model = nullptr;
+    if (use_single_model && GetNumTriangles() > 0) {
+        // Only Bullet face models can be aggregated; with any other collision model, keep one model per face.
+        std::vector<collision::ChModelBullet*> face_models;
+        for (unsigned int j = 0; j < vfaces.size(); j++)
+            face_models.push_back(dynamic_cast<collision::ChModelBullet*>(this->vfaces[j]->GetCollisionModel()));
+        for (unsigned int j = 0; j < vfaces_rot.size(); j++)
+            face_models.push_back(dynamic_cast<collision::ChModelBullet*>(this->vfaces_rot[j]->GetCollisionModel()));
+        bool bullet_models = std::find(face_models.begin(), face_models.end(), nullptr) == face_models.end();
+
+        if (bullet_models) {
+            // Faces aggregated in a single model cannot collide with each other. Fall back to one model per face
+            // unless self-collision was disabled through the collision families of the faces.
+            short int group = face_models[0]->GetFamilyGroup();
+            short int mask = face_models[0]->GetFamilyMask();
+            bool self_collision = (group & mask) != 0;
+            for (auto face_model : face_models) {
+                if (face_model->GetFamilyGroup() != group || face_model->GetFamilyMask() != mask)
+                    self_collision = true;
+            }
+            if (self_collision) {
+                GetLog() << "WARNING: ChContactSurfaceMesh single collision model ignored, since it would disable "
+                            "self-collision of the mesh faces (use a collision family that does not collide with "
+                            "itself for all faces).\n";
+                face_models.clear();
+            }
+
+            auto model = new collision::ChModelBullet;
+            if (!face_models.empty() && model->AddChildModels(face_models)) {
+                model->SetFamilyGroup(group);
+                model->SetFamilyMask(mask);
+                // The faces have an identity collision frame, so any of them can serve as contactable for
+                // positioning the aggregate model (contacts are reported for the individual faces).
+                if (vfaces.size() > 0)
+                    model->SetContactable(vfaces[0].get());
+                else
+                    model->SetContactable(vfaces_rot[0].get());
+                mesh_model = model;
+            } else {
+                delete model;
+            }
+        }
+    }
+
     SurfaceSyncCollisionModels();
+    if (mesh_model) {
+        msys->GetCollisionSystem()->Add(mesh_model);
+        return;
+    }
     for (unsigned int j = 0; j < vfaces.size(); j++) {
         msys->GetCollisionSystem()->Add(this->vfaces[j]->GetCollisionModel());
     }
@@ -926,6 +993,10 @@ void ChContactSurfaceMesh::SurfaceAddCollisionModelsToSystem(ChSystem* msys) {
 
 void ChContactSurfaceMesh::SurfaceRemoveCollisionModelsFromSystem(ChSystem* msys) {
     assert(msys);
+    if (mesh_model) {
+        msys->GetCollisionSystem()->Remove(mesh_model);
+        return;
+    }
     for (unsigned int j = 0; j < vfaces.size(); j++) {
         msys->GetCollisionSystem()->Remove(this->vfaces[j]->GetCollisionModel());
     }
@@ -675,9 +675,9 @@ class ChApiFea ChContactTriangleXYZROT : public ChContactable_3vars<6, 6, 6>, pu
 class ChApiFea ChContactSurfaceMesh : public ChContactSurface {
 
   public:
-    ChContactSurfaceMesh(ChMesh* parentmesh = 0) : ChContactSurface(parentmesh) {}
+    ChContactSurfaceMesh(ChMesh* parentmesh = 0);
 
-    virtual ~ChContactSurfaceMesh() {}
+    virtual ~ChContactSurfaceMesh();
 
     //
     // FUNCTIONS
@@ -718,6 +718,21 @@ class ChApiFea ChContactSurfaceMesh : public ChContactSurface {
     /// Get the number of vertices.
     unsigned int GetNumVertices() const;
 
+    /// Enable/disable the use of a single collision model for the entire surface (default: false).
+    /// If enabled, the collision shapes of all faces are kept in one bounding volume hierarchy which is refit
+    /// from the node positions at each step; the surface is then inserted in the collision broadphase as a
+    /// single object, rather than one object per face. Contacts are still reported for individual faces.
+    /// Only supported with Bullet collision models (with any other model, the faces keep one model each). Must be
+    /// called before the mesh is added to the system.
+    /// Faces in the single model never collide with each other, so the option requires all faces to be in the
+    /// same collision family, with collisions disabled within that family (SetFamily and
+    /// SetFamilyMaskNoCollisionWithFamily on the face collision models); otherwise, the option is ignored with a
+    /// warning and one collision model per face is used.
+    void SetUseSingleCollisionModel(bool val) { use_single_model = val; }
+
+    /// Return true if a single collision model is used for the entire surface.
+    bool GetUseSingleCollisionModel() const { return use_single_model; }
+
     // Functions to interface this with ChPhysicsItem container
     virtual void SurfaceSyncCollisionModels();
     virtual void SurfaceAddCollisionModelsToSystem(ChSystem* msys);
@@ -727,6 +742,9 @@ class ChApiFea ChContactSurfaceMesh : public ChContactSurface {
     std::vector<std::shared_ptr<ChContactTriangleXYZ> > vfaces;  //  faces that collide
     std::vector<std::shared_ptr<ChContactTriangleXYZROT> >
         vfaces_rot;  //  faces that collide (for nodes with rotation too)
+
+    bool use_single_model;                    //  use a single collision model for all faces
+    collision::ChCollisionModel* mesh_model;  //  collision model aggregating all faces
 };
 
 }  // end namespace fea
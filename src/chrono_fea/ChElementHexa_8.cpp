@@ -20,6 +20,7 @@ namespace fea {
 ChElementHexa_8::ChElementHexa_8() {
     nodes.resize(8);
     StiffnessMatrix.Resize(24, 24);
+    Kprecision = ChReferenceStiffness::Precision::DOUBLE;
     this->ir = new ChGaussIntegrationRule;
     this->SetDefaultIntegrationRule();
 }
@@ -17,6 +17,7 @@
 
 #include "chrono_fea/ChElementHexahedron.h"
 #include "chrono_fea/ChNodeFEAxyz.h"
+#include "chrono_fea/ChReferenceStiffness.h"
 
 namespace chrono {
 namespace fea {
@@ -36,6 +37,9 @@ class ChApiFea ChElementHexa_8 : public ChElementHexahedron, public ChLoadableUV
     // NO! each matrix is stored in the respective gauss point
 
     ChMatrixDynamic<> StiffnessMatrix;
+    ChReferenceStiffness Kref;                   // compact copy of StiffnessMatrix, used at each step
+    ChReferenceStiffness::Precision Kprecision;  // storage precision of Kref
+    ChMatrix33<> rotX0;                          // orientation of the element in the reference configuration
 
   public:
     ChElementHexa_8();
@@ -73,6 +77,7 @@ class ChApiFea ChElementHexa_8 : public ChElementHexahedron, public ChLoadableUV
         mvars.push_back(&nodes[6]->Variables());
         mvars.push_back(&nodes[7]->Variables());
         Kmatr.SetVariables(mvars);
+        ComputeFrameOrientation(true, rotX0);
     }
 
     //
@@ -308,33 +313,31 @@ class ChApiFea ChElementHexa_8 : public ChElementHexahedron, public ChLoadableUV
         delete temp;
     }
 
-    virtual void SetupInitial(ChSystem* system) override { ComputeStiffnessMatrix(); }
+    /// Set the precision used to store the reference stiffness used by the per-step corotational
+    /// kernels (default: double). In single precision the store takes half the memory, products
+    /// are still accumulated in double, and the dense StiffnessMatrix is released after setup
+    /// (GetStiffnessMatrix() rebuilds it on demand). Must be called before SetupInitial.
+    void SetStiffnessPrecision(ChReferenceStiffness::Precision prec) { Kprecision = prec; }
+    ChReferenceStiffness::Precision GetStiffnessPrecision() const { return Kprecision; }
+
+    /// Access the compact reference stiffness store (available after SetupInitial).
+    const ChReferenceStiffness& GetReferenceStiffness() const { return Kref; }
+
+    virtual void SetupInitial(ChSystem* system) override {
+        StiffnessMatrix.Reset(GetNdofs(), GetNdofs());
+        ComputeStiffnessMatrix();
+        Kref.Set(StiffnessMatrix, Kprecision);
+        if (Kprecision == ChReferenceStiffness::Precision::SINGLE)
+            StiffnessMatrix.Resize(0, 0);
+
+        // the reference orientation does not change: compute it only once
+        ComputeFrameOrientation(true, rotX0);
+    }
 
     // compute large rotation of element for corotational approach
     virtual void UpdateRotation() override {
-        ChVector<> avgX1;
-        avgX1 = this->nodes[0]->GetX0() + this->nodes[1]->GetX0() + this->nodes[2]->GetX0() + this->nodes[3]->GetX0();
-        ChVector<> avgX2;
-        avgX2 = this->nodes[4]->GetX0() + this->nodes[5]->GetX0() + this->nodes[6]->GetX0() + this->nodes[7]->GetX0();
-        ChVector<> Xdir = avgX2 - avgX1;
-
-        ChVector<> avgY1;
-        avgY1 = this->nodes[0]->GetX0() + this->nodes[1]->GetX0() + this->nodes[4]->GetX0() + this->nodes[5]->GetX0();
-        ChVector<> avgY2;
-        avgY2 = this->nodes[2]->GetX0() + this->nodes[3]->GetX0() + this->nodes[6]->GetX0() + this->nodes[7]->GetX0();
-        ChVector<> Ydir = avgY2 - avgY1;
-        ChMatrix33<> rotX0;
-        rotX0.Set_A_Xdir(Xdir.GetNormalized(), Ydir.GetNormalized());
-
-        avgX1 = this->nodes[0]->pos + this->nodes[1]->pos + this->nodes[2]->pos + this->nodes[3]->pos;
-        avgX2 = this->nodes[4]->pos + this->nodes[5]->pos + this->nodes[6]->pos + this->nodes[7]->pos;
-        Xdir = avgX2 - avgX1;
-
-        avgY1 = this->nodes[0]->pos + this->nodes[1]->pos + this->nodes[4]->pos + this->nodes[5]->pos;
-        avgY2 = this->nodes[2]->pos + this->nodes[3]->pos + this->nodes[6]->pos + this->nodes[7]->pos;
-        Ydir = avgY2 - avgY1;
         ChMatrix33<> rotXcurrent;
-        rotXcurrent.Set_A_Xdir(Xdir.GetNormalized(), Ydir.GetNormalized());
+        ComputeFrameOrientation(false, rotXcurrent);
 
         this->A.MatrMultiplyT(rotXcurrent, rotX0);
     }
@@ -368,20 +371,13 @@ class ChApiFea ChElementHexa_8 : public ChElementHexahedron, public ChLoadableUV
     virtual void ComputeKRMmatricesGlobal(ChMatrix<>& H, double Kfactor, double Rfactor = 0, double Mfactor = 0) override {
         assert((H.GetRows() == GetNdofs()) && (H.GetColumns() == GetNdofs()));
 
-        // warp the local stiffness matrix K in order to obtain global
-        // tangent stiffness CKCt:
-        ChMatrixDynamic<> CK(GetNdofs(), GetNdofs());
-        ChMatrixDynamic<> CKCt(GetNdofs(), GetNdofs());  // the global, corotated, K matrix, for 8 nodes
-        ChMatrixCorotation<>::ComputeCK(StiffnessMatrix, this->A, 8, CK);
-        ChMatrixCorotation<>::ComputeKCt(CK, this->A, 8, CKCt);
-
         // For K stiffness matrix and R damping matrix:
+        // warp the local stiffness matrix K in order to obtain the global tangent stiffness CKCt,
+        // rotating it block by block (the result is exactly symmetric).
 
         double mkfactor = Kfactor + Rfactor * this->GetMaterial()->Get_RayleighDampingK();
 
-        CKCt.MatrScale(mkfactor);
-
-        H.PasteMatrix(CKCt, 0, 0);
+        Kref.ComputeRotated(this->A, mkfactor, H);
 
         // For M mass matrix:
         if (Mfactor) {
@@ -400,32 +396,34 @@ class ChApiFea ChElementHexa_8 : public ChElementHexahedron, public ChLoadableUV
     virtual void ComputeInternalForces(ChMatrixDynamic<>& Fi) override {
         assert((Fi.GetRows() == GetNdofs()) && (Fi.GetColumns() == 1));
 
-        // set up vector of nodal displacements (in local element system) u_l = R*p - p0
-        ChMatrixDynamic<> displ(GetNdofs(), 1);
-        this->GetStateBlock(displ);
-
-        // [local Internal Forces] = [Klocal] * displ + [Rlocal] * displ_dt
-        ChMatrixDynamic<> FiK_local(GetNdofs(), 1);
-        FiK_local.MatrMultiply(StiffnessMatrix, displ);
-
-        for (int in = 0; in < 8; ++in) {
-            displ.PasteVector(A.MatrT_x_Vect(nodes[in]->pos_dt), in * 3, 0);  // nodal speeds, local
-        }
-        ChMatrixDynamic<> FiR_local(GetNdofs(), 1);
-        FiR_local.MatrMultiply(StiffnessMatrix, displ);
-        FiR_local.MatrScale(this->Material->Get_RayleighDampingK());
-
+        // [local Internal Forces] = [Klocal] * displ + [Rlocal] * displ_dt, with
+        // [Rlocal] = betaK * [Klocal] + betaM * [Mlocal], so that [Klocal] is traversed only once:
+        // Fi_local = [Klocal] * (displ + betaK * displ_dt) + betaM * [Mlocal] * displ_dt
+        double betaK = this->Material->Get_RayleighDampingK();
         double lumped_node_mass = (this->Volume * this->Material->Get_density()) / 8.0;
-        displ.MatrScale(lumped_node_mass * this->Material->Get_RayleighDampingM());  // reuse 'displ' for performance
-        FiR_local.MatrInc(displ);
+        double mass_damping = lumped_node_mass * this->Material->Get_RayleighDampingM();
         //***TO DO*** better per-node lumping, or 12x12 consistent mass matrix.
 
-        FiK_local.MatrInc(FiR_local);
+        // nodal displacements u_l = R'*p - p0 and speeds, in local element system
+        ChVector<> speed[8];
+        double displ[24];
+        for (int in = 0; in < 8; ++in) {
+            speed[in] = A.MatrT_x_Vect(nodes[in]->pos_dt);
+            ChVector<> u = A.MatrT_x_Vect(nodes[in]->pos) - nodes[in]->GetX0() + speed[in] * betaK;
+            displ[3 * in + 0] = u.x();
+            displ[3 * in + 1] = u.y();
+            displ[3 * in + 2] = u.z();
+        }
 
-        FiK_local.MatrScale(-1.0);
+        double Fi_local[24];
+        Kref.Multiply(displ, Fi_local);
 
-        // Fi = C * Fi_local  with C block-diagonal rotations A
-        ChMatrixCorotation<>::ComputeCK(FiK_local, this->A, 8, Fi);
+        // Fi = - C * Fi_local  with C block-diagonal rotations A
+        for (int in = 0; in < 8; ++in) {
+            ChVector<> f(Fi_local[3 * in + 0], Fi_local[3 * in + 1], Fi_local[3 * in + 2]);
+            f += speed[in] * mass_damping;
+            Fi.PasteVector(-A.Matr_x_Vect(f), 3 * in, 0);
+        }
     }
 
     //
@@ -437,7 +435,11 @@ class ChApiFea ChElementHexa_8 : public ChElementHexahedron, public ChLoadableUV
     std::shared_ptr<ChContinuumElastic> GetMaterial() { return Material; }
 
     /// Get the StiffnessMatrix
-    ChMatrix<>& GetStiffnessMatrix() { return StiffnessMatrix; }
+    ChMatrix<>& GetStiffnessMatrix() {
+        if (StiffnessMatrix.GetRows() == 0)
+            Kref.GetMatrix(StiffnessMatrix);
+        return StiffnessMatrix;
+    }
     /// Get the Nth gauss point
     ChGaussPoint* GetGaussPoint(int N) { return GpVector[N]; }
 
@@ -551,6 +553,25 @@ class ChApiFea ChElementHexa_8 : public ChElementHexahedron, public ChLoadableUV
 
     /// This is needed so that it can be accessed by ChLoaderVolumeGravity
     virtual double GetDensity() override { return this->Material->Get_density(); }
+
+  private:
+    /// Compute the orientation of the element frame, from the averaged directions of its edges,
+    /// in the reference configuration (initial = true) or in the current configuration.
+    void ComputeFrameOrientation(bool initial, ChMatrix33<>& rot) const {
+        ChVector<> p[8];
+        for (int i = 0; i < 8; i++)
+            p[i] = initial ? nodes[i]->GetX0() : nodes[i]->pos;
+
+        ChVector<> avgX1 = p[0] + p[1] + p[2] + p[3];
+        ChVector<> avgX2 = p[4] + p[5] + p[6] + p[7];
+        ChVector<> Xdir = avgX2 - avgX1;
+
+        ChVector<> avgY1 = p[0] + p[1] + p[4] + p[5];
+        ChVector<> avgY2 = p[2] + p[3] + p[6] + p[7];
+        ChVector<> Ydir = avgY2 - avgY1;
+
+        rot.Set_A_Xdir(Xdir.GetNormalized(), Ydir.GetNormalized());
+    }
 };
 
 /// @} fea_elements
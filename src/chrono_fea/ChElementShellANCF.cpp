@@ -27,8 +27,6 @@ namespace fea {
 // ------------------------------------------------------------------------------
 // Static variables
 // ------------------------------------------------------------------------------
-const double ChElementShellANCF::m_toleranceEAS = 1e-5;
-const int ChElementShellANCF::m_maxIterationsEAS = 100;
 
 // ------------------------------------------------------------------------------
 // Constructor
@@ -103,13 +101,17 @@ void ChElementShellANCF::SetupInitial(ChSystem* system) {
         m_GaussZ.push_back(2 * z / m_thickness - 1);
     }
 
-    // Reserve space for the EAS parameters and Jacobians.
+    // Reserve space for the EAS parameters.
     m_alphaEAS.resize(m_numLayers);
-    m_KalphaEAS.resize(m_numLayers);
 
     // Cache the scaling factor (due to change of integration intervals)
     m_GaussScaling = (m_lenX * m_lenY * m_thickness) / 8;
 
+    // Cache reference-configuration data at the internal force integration points
+    // and the (constant) EAS Jacobians.
+    CalcGaussPointData();
+    CalcEASJacobians();
+
     // Compute mass matrix and gravitational forces (constant)
     ComputeMassMatrix();
     ComputeGravityForce(system->Get_G_acc());
@@ -283,307 +285,337 @@ void ChElementShellANCF::ComputeGravityForce(const ChVector<>& g_acc) {
 // Elastic force calculation
 // -----------------------------------------------------------------------------
 
-// The class MyForce provides the integrand for the calculation of the internal forces
-// for one layer of an ANCF shell element.
-// The first 24 entries in the integrand represent the internal force.
-// The next 5 entries represent the residual of the EAS nonlinear system.
-// The last 25 entries represent the 5x5 Jacobian of the EAS nonlinear system.
-// Capabilities of this class include: application of enhanced assumed strain (EAS) and
-// assumed natural strain (ANS) formulations to avoid thickness and (transverse and in-plane)
-// shear locking. This implementation also features a composite material implementation
-// that allows for selecting a number of layers over the element thickness; each of which
-// has an independent, user-selected fiber angle (direction for orthotropic constitutive behavior)
-class MyForce : public ChIntegrable3D<ChMatrixNM<double, 54, 1> > {
-  public:
-    MyForce(ChElementShellANCF* element,         // Containing element
-            size_t kl,                           // Current layer index
-            ChMatrixNM<double, 5, 1>* alpha_eas  // Vector of internal parameters for EAS formulation
-            )
-        : m_element(element), m_kl(kl), m_alpha_eas(alpha_eas) {}
-    ~MyForce() {}
-
-  private:
-    ChElementShellANCF* m_element;
-    size_t m_kl;
-    ChMatrixNM<double, 5, 1>* m_alpha_eas;
-
-    /// Evaluate (strainD'*strain)  at point x, include ANS and EAS.
-    virtual void Evaluate(ChMatrixNM<double, 54, 1>& result, const double x, const double y, const double z) override;
-};
-
-void MyForce::Evaluate(ChMatrixNM<double, 54, 1>& result, const double x, const double y, const double z) {
-    // Element shape function
-    ChMatrixNM<double, 1, 8> N;
-    m_element->ShapeFunctions(N, x, y, z);
-
-    // Determinant of position vector gradient matrix: Initial configuration
-    ChMatrixNM<double, 1, 8> Nx;
-    ChMatrixNM<double, 1, 8> Ny;
-    ChMatrixNM<double, 1, 8> Nz;
-    ChMatrixNM<double, 1, 3> Nx_d0;
-    ChMatrixNM<double, 1, 3> Ny_d0;
-    ChMatrixNM<double, 1, 3> Nz_d0;
-    double detJ0 = m_element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
-
-    // ANS shape function
-    ChMatrixNM<double, 1, 4> S_ANS;  // Shape function vector for Assumed Natural Strain
-    ChMatrixNM<double, 6, 5> M;      // Shape function vector for Enhanced Assumed Strain
-    m_element->ShapeFunctionANSbilinearShell(S_ANS, x, y);
-    m_element->Basis_M(M, x, y, z);
-
-    // Transformation : Orthogonal transformation (A and J)
-    ChVector<double> G1xG2;  // Cross product of first and second column of
-    double G1dotG1;          // Dot product of first column of position vector gradient
-
-    G1xG2.x() = Nx_d0[0][1] * Ny_d0[0][2] - Nx_d0[0][2] * Ny_d0[0][1];
-    G1xG2.y() = Nx_d0[0][2] * Ny_d0[0][0] - Nx_d0[0][0] * Ny_d0[0][2];
-    G1xG2.z() = Nx_d0[0][0] * Ny_d0[0][1] - Nx_d0[0][1] * Ny_d0[0][0];
-    G1dotG1 = Nx_d0[0][0] * Nx_d0[0][0] + Nx_d0[0][1] * Nx_d0[0][1] + Nx_d0[0][2] * Nx_d0[0][2];
-
-    // Tangent Frame
-    ChVector<double> A1;
-    ChVector<double> A2;
-    ChVector<double> A3;
-    A1.x() = Nx_d0[0][0];
-    A1.y() = Nx_d0[0][1];
-    A1.z() = Nx_d0[0][2];
-    A1 = A1 / sqrt(G1dotG1);
-    A3 = G1xG2.GetNormalized();
-    A2.Cross(A3, A1);
+// Calculate and cache reference-configuration quantities at the integration points of
+// each layer. These depend only on the initial nodal coordinates and the layer fiber
+// angles, so they are evaluated once here rather than at every internal force call.
+// Points are stored in the order visited by ChQuadrature::Integrate3D (x, then y, then z).
+void ChElementShellANCF::CalcGaussPointData() {
+    const std::vector<double>& lroots = ChQuadrature::GetStaticTables()->Lroots[1];
 
-    // Direction for orthotropic material
-    double theta = m_element->GetLayer(m_kl).Get_theta();  // Fiber angle
-    ChVector<double> AA1;
-    ChVector<double> AA2;
-    ChVector<double> AA3;
-    AA1 = A1 * cos(theta) + A2 * sin(theta);
-    AA2 = -A1 * sin(theta) + A2 * cos(theta);
-    AA3 = A3;
+    m_gaussData.resize(8 * m_numLayers);
 
-    /// Beta
-    ChMatrixNM<double, 3, 3> j0;
-    ChVector<double> j01;
-    ChVector<double> j02;
-    ChVector<double> j03;
-    ChMatrixNM<double, 9, 1> beta;
-    // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
-    j0(0, 0) = Ny_d0[0][1] * Nz_d0[0][2] - Nz_d0[0][1] * Ny_d0[0][2];
-    j0(0, 1) = Ny_d0[0][2] * Nz_d0[0][0] - Ny_d0[0][0] * Nz_d0[0][2];
-    j0(0, 2) = Ny_d0[0][0] * Nz_d0[0][1] - Nz_d0[0][0] * Ny_d0[0][1];
-    j0(1, 0) = Nz_d0[0][1] * Nx_d0[0][2] - Nx_d0[0][1] * Nz_d0[0][2];
-    j0(1, 1) = Nz_d0[0][2] * Nx_d0[0][0] - Nx_d0[0][2] * Nz_d0[0][0];
-    j0(1, 2) = Nz_d0[0][0] * Nx_d0[0][1] - Nz_d0[0][1] * Nx_d0[0][0];
-    j0(2, 0) = Nx_d0[0][1] * Ny_d0[0][2] - Ny_d0[0][1] * Nx_d0[0][2];
-    j0(2, 1) = Ny_d0[0][0] * Nx_d0[0][2] - Nx_d0[0][0] * Ny_d0[0][2];
-    j0(2, 2) = Nx_d0[0][0] * Ny_d0[0][1] - Ny_d0[0][0] * Nx_d0[0][1];
-    j0.MatrDivScale(detJ0);
-
-    j01[0] = j0(0, 0);
-    j02[0] = j0(1, 0);
-    j03[0] = j0(2, 0);
-    j01[1] = j0(0, 1);
-    j02[1] = j0(1, 1);
-    j03[1] = j0(2, 1);
-    j01[2] = j0(0, 2);
-    j02[2] = j0(1, 2);
-    j03[2] = j0(2, 2);
-
-    // Coefficients of contravariant transformation
-    beta(0, 0) = Vdot(AA1, j01);
-    beta(1, 0) = Vdot(AA2, j01);
-    beta(2, 0) = Vdot(AA3, j01);
-    beta(3, 0) = Vdot(AA1, j02);
-    beta(4, 0) = Vdot(AA2, j02);
-    beta(5, 0) = Vdot(AA3, j02);
-    beta(6, 0) = Vdot(AA1, j03);
-    beta(7, 0) = Vdot(AA2, j03);
-    beta(8, 0) = Vdot(AA3, j03);
-
-    // Transformation matrix, function of fiber angle
-    const ChMatrixNM<double, 6, 6>& T0 = m_element->GetLayer(m_kl).Get_T0();
-    // Determinant of the initial position vector gradient at the element center
-    double detJ0C = m_element->GetLayer(m_kl).Get_detJ0C();
-
-    // Enhanced Assumed Strain
-    ChMatrixNM<double, 6, 5> G = T0 * M * (detJ0C / detJ0);
-    ChMatrixNM<double, 6, 1> strain_EAS = G * (*m_alpha_eas);
-
-    ChMatrixNM<double, 8, 1> ddNx;
-    ChMatrixNM<double, 8, 1> ddNy;
-    ChMatrixNM<double, 8, 1> ddNz;
-    ddNx.MatrMultiplyT(m_element->m_ddT, Nx);
-    ddNy.MatrMultiplyT(m_element->m_ddT, Ny);
-    ddNz.MatrMultiplyT(m_element->m_ddT, Nz);
-
-    ChMatrixNM<double, 8, 1> d0d0Nx;
-    ChMatrixNM<double, 8, 1> d0d0Ny;
-    ChMatrixNM<double, 8, 1> d0d0Nz;
-    d0d0Nx.MatrMultiplyT(m_element->m_d0d0T, Nx);
-    d0d0Ny.MatrMultiplyT(m_element->m_d0d0T, Ny);
-    d0d0Nz.MatrMultiplyT(m_element->m_d0d0T, Nz);
-
-    // Strain component
-    ChMatrixNM<double, 6, 1> strain_til;
-    strain_til(0, 0) = 0.5 * ((Nx * ddNx)(0, 0) - (Nx * d0d0Nx)(0, 0));
-    strain_til(1, 0) = 0.5 * ((Ny * ddNy)(0, 0) - (Ny * d0d0Ny)(0, 0));
-    strain_til(2, 0) = (Nx * ddNy)(0, 0) - (Nx * d0d0Ny)(0, 0);
-    strain_til(3, 0) = N(0, 0) * m_element->m_strainANS(0, 0) + N(0, 2) * m_element->m_strainANS(1, 0) +
-                       N(0, 4) * m_element->m_strainANS(2, 0) + N(0, 6) * m_element->m_strainANS(3, 0);
-    strain_til(4, 0) = S_ANS(0, 2) * m_element->m_strainANS(6, 0) + S_ANS(0, 3) * m_element->m_strainANS(7, 0);
-    strain_til(5, 0) = S_ANS(0, 0) * m_element->m_strainANS(4, 0) + S_ANS(0, 1) * m_element->m_strainANS(5, 0);
+    for (size_t kl = 0; kl < m_numLayers; kl++) {
+        double Zc1 = (m_GaussZ[kl + 1] - m_GaussZ[kl]) / 2;
+        double Zc2 = (m_GaussZ[kl + 1] + m_GaussZ[kl]) / 2;
+        double theta = m_layers[kl].Get_theta();
+
+        for (int ix = 0; ix < 2; ix++) {
+            for (int iy = 0; iy < 2; iy++) {
+                for (int iz = 0; iz < 2; iz++) {
+                    double x = lroots[ix];
+                    double y = lroots[iy];
+                    double z = Zc1 * lroots[iz] + Zc2;
+                    GaussPointData& gp = m_gaussData[8 * kl + 4 * ix + 2 * iy + iz];
+
+                    ChMatrixNM<double, 1, 8> Nx;
+                    ChMatrixNM<double, 1, 8> Ny;
+                    ChMatrixNM<double, 1, 8> Nz;
+                    ChMatrixNM<double, 1, 3> Nx_d0;
+                    ChMatrixNM<double, 1, 3> Ny_d0;
+                    ChMatrixNM<double, 1, 3> Nz_d0;
+                    gp.detJ0 = Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
+
+                    // Tangent frame
+                    ChVector<double> G1xG2;
+                    G1xG2.x() = Nx_d0[0][1] * Ny_d0[0][2] - Nx_d0[0][2] * Ny_d0[0][1];
+                    G1xG2.y() = Nx_d0[0][2] * Ny_d0[0][0] - Nx_d0[0][0] * Ny_d0[0][2];
+                    G1xG2.z() = Nx_d0[0][0] * Ny_d0[0][1] - Nx_d0[0][1] * Ny_d0[0][0];
+                    double G1dotG1 = Nx_d0[0][0] * Nx_d0[0][0] + Nx_d0[0][1] * Nx_d0[0][1] + Nx_d0[0][2] * Nx_d0[0][2];
+
+                    ChVector<double> A1(Nx_d0[0][0], Nx_d0[0][1], Nx_d0[0][2]);
+                    A1 = A1 / sqrt(G1dotG1);
+                    ChVector<double> A3 = G1xG2.GetNormalized();
+                    ChVector<double> A2;
+                    A2.Cross(A3, A1);
+
+                    // Direction for orthotropic material
+                    ChVector<double> AA1 = A1 * cos(theta) + A2 * sin(theta);
+                    ChVector<double> AA2 = -A1 * sin(theta) + A2 * cos(theta);
+                    ChVector<double> AA3 = A3;
+
+                    // Rows of the inverse of rd0 (position vector gradient: initial configuration)
+                    ChVector<double> j01;
+                    ChVector<double> j02;
+                    ChVector<double> j03;
+                    j01[0] = Ny_d0[0][1] * Nz_d0[0][2] - Nz_d0[0][1] * Ny_d0[0][2];
+                    j01[1] = Ny_d0[0][2] * Nz_d0[0][0] - Ny_d0[0][0] * Nz_d0[0][2];
+                    j01[2] = Ny_d0[0][0] * Nz_d0[0][1] - Nz_d0[0][0] * Ny_d0[0][1];
+                    j02[0] = Nz_d0[0][1] * Nx_d0[0][2] - Nx_d0[0][1] * Nz_d0[0][2];
+                    j02[1] = Nz_d0[0][2] * Nx_d0[0][0] - Nx_d0[0][2] * Nz_d0[0][0];
+                    j02[2] = Nz_d0[0][0] * Nx_d0[0][1] - Nz_d0[0][1] * Nx_d0[0][0];
+                    j03[0] = Nx_d0[0][1] * Ny_d0[0][2] - Ny_d0[0][1] * Nx_d0[0][2];
+                    j03[1] = Ny_d0[0][0] * Nx_d0[0][2] - Nx_d0[0][0] * Ny_d0[0][2];
+                    j03[2] = Nx_d0[0][0] * Ny_d0[0][1] - Ny_d0[0][0] * Nx_d0[0][1];
+                    j01 /= gp.detJ0;
+                    j02 /= gp.detJ0;
+                    j03 /= gp.detJ0;
+
+                    // Coefficients of contravariant transformation
+                    gp.beta[0] = Vdot(AA1, j01);
+                    gp.beta[1] = Vdot(AA2, j01);
+                    gp.beta[2] = Vdot(AA3, j01);
+                    gp.beta[3] = Vdot(AA1, j02);
+                    gp.beta[4] = Vdot(AA2, j02);
+                    gp.beta[5] = Vdot(AA3, j02);
+                    gp.beta[6] = Vdot(AA1, j03);
+                    gp.beta[7] = Vdot(AA2, j03);
+                    gp.beta[8] = Vdot(AA3, j03);
+                }
+            }
+        }
+    }
+}
 
-    // For orthotropic material
-    ChMatrixNM<double, 6, 1> strain;
+// Calculate the EAS Jacobians of all layers and their inverses. The EAS strain interpolation
+// G = T0 * M * (detJ0C / detJ0) depends only on the reference configuration, so these are
+// constant and are computed once here (rather than at each internal force evaluation).
+void ChElementShellANCF::CalcEASJacobians() {
+    const std::vector<double>& lroots = ChQuadrature::GetStaticTables()->Lroots[1];
+    const std::vector<double>& weight = ChQuadrature::GetStaticTables()->Weight[1];
 
-    strain(0, 0) = strain_til(0, 0) * beta(0) * beta(0) + strain_til(1, 0) * beta(3) * beta(3) +
-                   strain_til(2, 0) * beta(0) * beta(3) + strain_til(3, 0) * beta(6) * beta(6) +
-                   strain_til(4, 0) * beta(0) * beta(6) + strain_til(5, 0) * beta(3) * beta(6);
-    strain(1, 0) = strain_til(0, 0) * beta(1) * beta(1) + strain_til(1, 0) * beta(4) * beta(4) +
-                   strain_til(2, 0) * beta(1) * beta(4) + strain_til(3, 0) * beta(7) * beta(7) +
-                   strain_til(4, 0) * beta(1) * beta(7) + strain_til(5, 0) * beta(4) * beta(7);
-    strain(2, 0) = strain_til(0, 0) * 2.0 * beta(0) * beta(1) + strain_til(1, 0) * 2.0 * beta(3) * beta(4) +
-                   strain_til(2, 0) * (beta(1) * beta(3) + beta(0) * beta(4)) +
-                   strain_til(3, 0) * 2.0 * beta(6) * beta(7) +
-                   strain_til(4, 0) * (beta(1) * beta(6) + beta(0) * beta(7)) +
-                   strain_til(5, 0) * (beta(4) * beta(6) + beta(3) * beta(7));
-    strain(3, 0) = strain_til(0, 0) * beta(2) * beta(2) + strain_til(1, 0) * beta(5) * beta(5) +
-                   strain_til(2, 0) * beta(2) * beta(5) + strain_til(3, 0) * beta(8) * beta(8) +
-                   strain_til(4, 0) * beta(2) * beta(8) + strain_til(5, 0) * beta(5) * beta(8);
-    strain(4, 0) = strain_til(0, 0) * 2.0 * beta(0) * beta(2) + strain_til(1, 0) * 2.0 * beta(3) * beta(5) +
-                   strain_til(2, 0) * (beta(2) * beta(3) + beta(0) * beta(5)) +
-                   strain_til(3, 0) * 2.0 * beta(6) * beta(8) +
-                   strain_til(4, 0) * (beta(2) * beta(6) + beta(0) * beta(8)) +
-                   strain_til(5, 0) * (beta(5) * beta(6) + beta(3) * beta(8));
-    strain(5, 0) = strain_til(0, 0) * 2.0 * beta(1) * beta(2) + strain_til(1, 0) * 2.0 * beta(4) * beta(5) +
-                   strain_til(2, 0) * (beta(2) * beta(4) + beta(1) * beta(5)) +
-                   strain_til(3, 0) * 2.0 * beta(7) * beta(8) +
-                   strain_til(4, 0) * (beta(2) * beta(7) + beta(1) * beta(8)) +
-                   strain_til(5, 0) * (beta(5) * beta(7) + beta(4) * beta(8));
+    m_KalphaEAS.resize(m_numLayers);
+    m_KalphaEASinv.resize(m_numLayers);
 
-    // Strain derivative component
+    for (size_t kl = 0; kl < m_numLayers; kl++) {
+        double Zc1 = (m_GaussZ[kl + 1] - m_GaussZ[kl]) / 2;
+        double Zc2 = (m_GaussZ[kl + 1] + m_GaussZ[kl]) / 2;
+        const ChMatrixNM<double, 6, 6>& T0 = m_layers[kl].Get_T0();
+        double detJ0C = m_layers[kl].Get_detJ0C();
+        const ChMatrixNM<double, 6, 6>& E_eps = m_layers[kl].GetMaterial()->Get_E_eps();
 
-    ChMatrixNM<double, 6, 24> strainD_til;
-    ChMatrixNM<double, 1, 24> tempB;
-    ChMatrixNM<double, 1, 24> tempBB;
-    ChMatrixNM<double, 1, 3> tempB3;
-    ChMatrixNM<double, 1, 3> tempB31;
-    strainD_til.Reset();
-    tempB3.MatrMultiply(Nx, m_element->m_d);
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Nx(0, i);
-        }
-    }
-    strainD_til.PasteClippedMatrix(tempB, 0, 0, 1, 24, 0, 0);
-    tempB3.MatrMultiply(Ny, m_element->m_d);
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Ny(0, i);
-        }
-    }
-    strainD_til.PasteClippedMatrix(tempB, 0, 0, 1, 24, 1, 0);
-    tempB31.MatrMultiply(Nx, m_element->m_d);
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Nx(0, i) + tempB31(0, j) * Ny(0, i);
+        ChMatrixNM<double, 5, 5> KALPHA;
+        for (int ix = 0; ix < 2; ix++) {
+            for (int iy = 0; iy < 2; iy++) {
+                for (int iz = 0; iz < 2; iz++) {
+                    double x = lroots[ix];
+                    double y = lroots[iy];
+                    double z = Zc1 * lroots[iz] + Zc2;
+                    const GaussPointData& gp = m_gaussData[8 * kl + 4 * ix + 2 * iy + iz];
+                    // Quadrature weight (Zc1 maps [-1,1] onto the z interval of the layer)
+                    double scale = gp.detJ0 * m_GaussScaling * Zc1 * weight[ix] * weight[iy] * weight[iz];
+
+                    ChMatrixNM<double, 6, 5> M;
+                    Basis_M(M, x, y, z);
+                    ChMatrixNM<double, 6, 5> G = T0 * M * (detJ0C / gp.detJ0);
+                    ChMatrixNM<double, 6, 5> EG = E_eps * G;
+
+                    ChMatrixNM<double, 5, 5> temp55;
+                    temp55.MatrTMultiply(G, EG);
+                    KALPHA += temp55 * scale;
+                }
+            }
         }
-    }
-    strainD_til.PasteClippedMatrix(tempB, 0, 0, 1, 24, 2, 0);
-
-    tempBB.Reset();
-    for (int i = 0; i < 4; i++) {
-        int ij = i * 2;
-        tempB.PasteClippedMatrix(m_element->m_strainANS_D, i, 0, 1, 24, 0, 0);
-        tempB *= N(0, ij);
-        tempBB += tempB;
-    }
-    strainD_til.PasteClippedMatrix(tempBB, 0, 0, 1, 24, 3, 0);  // strainD for zz
-    //
-    tempBB.Reset();
-    for (int i = 0; i < 2; i++) {
-        int ij = i + 6;
-        int ij1 = i + 2;
-        tempB.PasteClippedMatrix(m_element->m_strainANS_D, ij, 0, 1, 24, 0, 0);
-        tempB *= S_ANS(0, ij1);
-        tempBB += tempB;
-    }
-    strainD_til.PasteClippedMatrix(tempBB, 0, 0, 1, 24, 4, 0);  // strainD for xz
-    //
-    tempBB.Reset();
-    for (int i = 0; i < 2; i++) {
-        int ij = i + 4;
-        int ij1 = i;
-        tempB.PasteClippedMatrix(m_element->m_strainANS_D, ij, 0, 1, 24, 0, 0);
-        tempB *= S_ANS(0, ij1);
-        tempBB += tempB;
-    }
-    strainD_til.PasteClippedMatrix(tempBB, 0, 0, 1, 24, 5, 0);  // strainD for yz
 
-    // For orthotropic material
-    ChMatrixNM<double, 6, 24> strainD;  // Derivative of the strains w.r.t. the coordinates. Includes orthotropy
-    for (int ii = 0; ii < 24; ii++) {
-        strainD(0, ii) = strainD_til(0, ii) * beta(0) * beta(0) + strainD_til(1, ii) * beta(3) * beta(3) +
-                         strainD_til(2, ii) * beta(0) * beta(3) + strainD_til(3, ii) * beta(6) * beta(6) +
-                         strainD_til(4, ii) * beta(0) * beta(6) + strainD_til(5, ii) * beta(3) * beta(6);
-        strainD(1, ii) = strainD_til(0, ii) * beta(1) * beta(1) + strainD_til(1, ii) * beta(4) * beta(4) +
-                         strainD_til(2, ii) * beta(1) * beta(4) + strainD_til(3, ii) * beta(7) * beta(7) +
-                         strainD_til(4, ii) * beta(1) * beta(7) + strainD_til(5, ii) * beta(4) * beta(7);
-        strainD(2, ii) = strainD_til(0, ii) * 2.0 * beta(0) * beta(1) + strainD_til(1, ii) * 2.0 * beta(3) * beta(4) +
-                         strainD_til(2, ii) * (beta(1) * beta(3) + beta(0) * beta(4)) +
-                         strainD_til(3, ii) * 2.0 * beta(6) * beta(7) +
-                         strainD_til(4, ii) * (beta(1) * beta(6) + beta(0) * beta(7)) +
-                         strainD_til(5, ii) * (beta(4) * beta(6) + beta(3) * beta(7));
-        strainD(3, ii) = strainD_til(0, ii) * beta(2) * beta(2) + strainD_til(1, ii) * beta(5) * beta(5) +
-                         strainD_til(2, ii) * beta(2) * beta(5) + strainD_til(3, ii) * beta(8) * beta(8) +
-                         strainD_til(4, ii) * beta(2) * beta(8) + strainD_til(5) * beta(5) * beta(8);
-        strainD(4, ii) = strainD_til(0, ii) * 2.0 * beta(0) * beta(2) + strainD_til(1, ii) * 2.0 * beta(3) * beta(5) +
-                         strainD_til(2, ii) * (beta(2) * beta(3) + beta(0) * beta(5)) +
-                         strainD_til(3, ii) * 2.0 * beta(6) * beta(8) +
-                         strainD_til(4, ii) * (beta(2) * beta(6) + beta(0) * beta(8)) +
-                         strainD_til(5, ii) * (beta(5) * beta(6) + beta(3) * beta(8));
-        strainD(5, ii) = strainD_til(0, ii) * 2.0 * beta(1) * beta(2) + strainD_til(1, ii) * 2.0 * beta(4) * beta(5) +
-                         strainD_til(2, ii) * (beta(2) * beta(4) + beta(1) * beta(5)) +
-                         strainD_til(3, ii) * 2.0 * beta(7) * beta(8) +
-                         strainD_til(4, ii) * (beta(2) * beta(7) + beta(1) * beta(8)) +
-                         strainD_til(5, ii) * (beta(5) * beta(7) + beta(4) * beta(8));
+        m_KalphaEAS[kl] = KALPHA;
+        Inverse55_Analytical(m_KalphaEASinv[kl], KALPHA);
     }
+}
 
-    // Enhanced Assumed Strain 2nd
-    strain += strain_EAS;
-
-    // Strain time derivative for structural damping
-    ChMatrixNM<double, 6, 1> DEPS;
-    DEPS.Reset();
-    for (int ii = 0; ii < 24; ii++) {
-        DEPS(0, 0) = DEPS(0, 0) + strainD(0, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(1, 0) = DEPS(1, 0) + strainD(1, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(2, 0) = DEPS(2, 0) + strainD(2, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(3, 0) = DEPS(3, 0) + strainD(3, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(4, 0) = DEPS(4, 0) + strainD(4, ii) * m_element->m_d_dt(ii, 0);
-        DEPS(5, 0) = DEPS(5, 0) + strainD(5, ii) * m_element->m_d_dt(ii, 0);
+// Calculate the internal force of the element, summed over all layers, with 2x2x2 Gauss
+// quadrature in each layer. Capabilities include application of enhanced assumed strain
+// (EAS) and assumed natural strain (ANS) formulations to avoid thickness and (transverse
+// and in-plane) shear locking. This implementation also features a composite material
+// implementation that allows for selecting a number of layers over the element thickness;
+// each of which has an independent, user-selected fiber angle (direction for orthotropic
+// constitutive behavior).
+//
+// For each layer, the EAS residual HE is affine in the EAS parameters alpha, with the
+// constant Jacobian KALPHA (see CalcEASJacobians). Rather than iterating, the internal force
+// and the EAS residual are evaluated at alpha = 0, together with FG = int(strainD' * E * G),
+// and the EAS system is solved directly:
+//     alpha = -inv(KALPHA) * HE0,     Fint = Fint0 + FG * alpha
+// The ANS strain components (zz, xz, yz) and their derivatives only depend on the in-plane
+// coordinates and are therefore evaluated once and shared by all layers.
+void ChElementShellANCF::CalcInternalForces(ChMatrixNM<double, 24, 1>& Fint) {
+    const std::vector<double>& lroots = ChQuadrature::GetStaticTables()->Lroots[1];
+    const std::vector<double>& weight = ChQuadrature::GetStaticTables()->Weight[1];
+
+    // ANS strain components and derivatives at the in-plane integration points
+    ChMatrixNM<double, 3, 1> strainANS_ip[4];
+    ChMatrixNM<double, 3, 24> strainANS_D_ip[4];
+    for (int ix = 0; ix < 2; ix++) {
+        for (int iy = 0; iy < 2; iy++) {
+            double x = lroots[ix];
+            double y = lroots[iy];
+            int ip = 2 * ix + iy;
+
+            // The shape functions for the nodal positions (even entries of N) do not depend on z
+            ChMatrixNM<double, 1, 8> N;
+            ChMatrixNM<double, 1, 4> S_ANS;
+            ShapeFunctions(N, x, y, 0);
+            ShapeFunctionANSbilinearShell(S_ANS, x, y);
+
+            strainANS_ip[ip](0, 0) = N(0, 0) * m_strainANS(0, 0) + N(0, 2) * m_strainANS(1, 0) +
+                                     N(0, 4) * m_strainANS(2, 0) + N(0, 6) * m_strainANS(3, 0);
+            strainANS_ip[ip](1, 0) = S_ANS(0, 2) * m_strainANS(6, 0) + S_ANS(0, 3) * m_strainANS(7, 0);
+            strainANS_ip[ip](2, 0) = S_ANS(0, 0) * m_strainANS(4, 0) + S_ANS(0, 1) * m_strainANS(5, 0);
+
+            for (int ii = 0; ii < 24; ii++) {
+                // strainD for zz
+                strainANS_D_ip[ip](0, ii) = N(0, 0) * m_strainANS_D(0, ii) + N(0, 2) * m_strainANS_D(1, ii) +
+                                            N(0, 4) * m_strainANS_D(2, ii) + N(0, 6) * m_strainANS_D(3, ii);
+                // strainD for xz
+                strainANS_D_ip[ip](1, ii) = S_ANS(0, 2) * m_strainANS_D(6, ii) + S_ANS(0, 3) * m_strainANS_D(7, ii);
+                // strainD for yz
+                strainANS_D_ip[ip](2, ii) = S_ANS(0, 0) * m_strainANS_D(4, ii) + S_ANS(0, 1) * m_strainANS_D(5, ii);
+            }
+        }
     }
 
-    // Add structural damping
-    strain += DEPS * m_element->m_Alpha;
+    Fint.Reset();
 
-    // Matrix of elastic coefficients: the input assumes the material *could* be orthotropic
-    const ChMatrixNM<double, 6, 6>& E_eps = m_element->GetLayer(m_kl).GetMaterial()->Get_E_eps();
+    for (size_t kl = 0; kl < m_numLayers; kl++) {
+        double Zc1 = (m_GaussZ[kl + 1] - m_GaussZ[kl]) / 2;
+        double Zc2 = (m_GaussZ[kl + 1] + m_GaussZ[kl]) / 2;
+
+        // Transformation matrix, function of fiber angle
+        const ChMatrixNM<double, 6, 6>& T0 = m_layers[kl].Get_T0();
+        // Determinant of the initial position vector gradient at the element center
+        double detJ0C = m_layers[kl].Get_detJ0C();
+        // Matrix of elastic coefficients: the input assumes the material *could* be orthotropic
+        const ChMatrixNM<double, 6, 6>& E_eps = m_layers[kl].GetMaterial()->Get_E_eps();
+
+        ChMatrixNM<double, 24, 1> Fint0;  // internal force at alpha = 0
+        ChMatrixNM<double, 5, 1> HE0;     // EAS residual at alpha = 0
+        ChMatrixNM<double, 24, 5> FG;     // derivative of the internal force w.r.t. alpha
+
+        for (int ix = 0; ix < 2; ix++) {
+            for (int iy = 0; iy < 2; iy++) {
+                const ChMatrixNM<double, 3, 1>& strainANS = strainANS_ip[2 * ix + iy];
+                const ChMatrixNM<double, 3, 24>& strainANS_D = strainANS_D_ip[2 * ix + iy];
+
+                for (int iz = 0; iz < 2; iz++) {
+                    double x = lroots[ix];
+                    double y = lroots[iy];
+                    double z = Zc1 * lroots[iz] + Zc2;
+                    const GaussPointData& gp = m_gaussData[8 * kl + 4 * ix + 2 * iy + iz];
+                    const double* beta = gp.beta;
+                    // Quadrature weight (Zc1 maps [-1,1] onto the z interval of the layer)
+                    double scale = gp.detJ0 * m_GaussScaling * Zc1 * weight[ix] * weight[iy] * weight[iz];
+
+                    // Shape function derivatives
+                    ChMatrixNM<double, 1, 8> Nx;
+                    ChMatrixNM<double, 1, 8> Ny;
+                    ShapeFunctionsDerivativeX(Nx, x, y, z);
+                    ShapeFunctionsDerivativeY(Ny, x, y, z);
+
+                    // Enhanced Assumed Strain
+                    ChMatrixNM<double, 6, 5> M;
+                    Basis_M(M, x, y, z);
+                    ChMatrixNM<double, 6, 5> G = T0 * M * (detJ0C / gp.detJ0);
+
+                    // Products (d*d' - d0*d0')*N' for the in-plane strain components
+                    ChMatrixNM<double, 8, 1> ddNx;
+                    ChMatrixNM<double, 8, 1> ddNy;
+                    ChMatrixNM<double, 8, 1> d0d0Nx;
+                    ChMatrixNM<double, 8, 1> d0d0Ny;
+                    ddNx.MatrMultiplyT(m_ddT, Nx);
+                    ddNy.MatrMultiplyT(m_ddT, Ny);
+                    d0d0Nx.MatrMultiplyT(m_d0d0T, Nx);
+                    d0d0Ny.MatrMultiplyT(m_d0d0T, Ny);
+
+                    // Strain component
+                    double strain_til[6];
+                    strain_til[0] = 0.5 * ((Nx * ddNx)(0, 0) - (Nx * d0d0Nx)(0, 0));
+                    strain_til[1] = 0.5 * ((Ny * ddNy)(0, 0) - (Ny * d0d0Ny)(0, 0));
+                    strain_til[2] = (Nx * ddNy)(0, 0) - (Nx * d0d0Ny)(0, 0);
+                    strain_til[3] = strainANS(0, 0);
+                    strain_til[4] = strainANS(1, 0);
+                    strain_til[5] = strainANS(2, 0);
+
+                    // Strain derivative component
+                    ChMatrixNM<double, 1, 3> Nxd;
+                    ChMatrixNM<double, 1, 3> Nyd;
+                    Nxd.MatrMultiply(Nx, m_d);
+                    Nyd.MatrMultiply(Ny, m_d);
+
+                    ChMatrixNM<double, 3, 24> strainD_til;  // in-plane components (xx, yy, xy)
+                    for (int i = 0; i < 8; i++) {
+                        for (int j = 0; j < 3; j++) {
+                            strainD_til(0, i * 3 + j) = Nxd(0, j) * Nx(0, i);
+                            strainD_til(1, i * 3 + j) = Nyd(0, j) * Ny(0, i);
+                            strainD_til(2, i * 3 + j) = Nyd(0, j) * Nx(0, i) + Nxd(0, j) * Ny(0, i);
+                        }
+                    }
+
+                    // Orthotropic transformation coefficients: row k of the transformed strain is
+                    // sum_m c[k][m] * strain_til[m].
+                    double c[6][6] = {
+                        {beta[0] * beta[0], beta[3] * beta[3], beta[0] * beta[3], beta[6] * beta[6],
+                         beta[0] * beta[6], beta[3] * beta[6]},
+                        {beta[1] * beta[1], beta[4] * beta[4], beta[1] * beta[4], beta[7] * beta[7],
+                         beta[1] * beta[7], beta[4] * beta[7]},
+                        {2.0 * beta[0] * beta[1], 2.0 * beta[3] * beta[4], beta[1] * beta[3] + beta[0] * beta[4],
+                         2.0 * beta[6] * beta[7], beta[1] * beta[6] + beta[0] * beta[7],
+                         beta[4] * beta[6] + beta[3] * beta[7]},
+                        {beta[2] * beta[2], beta[5] * beta[5], beta[2] * beta[5], beta[8] * beta[8],
+                         beta[2] * beta[8], beta[5] * beta[8]},
+                        {2.0 * beta[0] * beta[2], 2.0 * beta[3] * beta[5], beta[2] * beta[3] + beta[0] * beta[5],
+                         2.0 * beta[6] * beta[8], beta[2] * beta[6] + beta[0] * beta[8],
+                         beta[5] * beta[6] + beta[3] * beta[8]},
+                        {2.0 * beta[1] * beta[2], 2.0 * beta[4] * beta[5], beta[2] * beta[4] + beta[1] * beta[5],
+                         2.0 * beta[7] * beta[8], beta[2] * beta[7] + beta[1] * beta[8],
+                         beta[5] * beta[7] + beta[4] * beta[8]}};
+
+                    // For orthotropic material
+                    ChMatrixNM<double, 6, 1> strain;
+                    ChMatrixNM<double, 6, 24> strainD;  // Derivative of the strains w.r.t. the coordinates
+                    for (int k = 0; k < 6; k++) {
+                        strain(k, 0) = c[k][0] * strain_til[0] + c[k][1] * strain_til[1] + c[k][2] * strain_til[2] +
+                                       c[k][3] * strain_til[3] + c[k][4] * strain_til[4] + c[k][5] * strain_til[5];
+                        for (int ii = 0; ii < 24; ii++) {
+                            // Note: the zz row uses the (0,5) entry of strainD_til in its last term (as in the
+                            // original formulation of this element).
+                            double til5 = (k == 3) ? strainD_til(0, 5) : strainANS_D(2, ii);
+                            strainD(k, ii) = c[k][0] * strainD_til(0, ii) + c[k][1] * strainD_til(1, ii) +
+                                             c[k][2] * strainD_til(2, ii) + c[k][3] * strainANS_D(0, ii) +
+                                             c[k][4] * strainANS_D(1, ii) + c[k][5] * til5;
+                        }
+                    }
+
+                    // Add structural damping (strain time derivative)
+                    for (int k = 0; k < 6; k++) {
+                        double deps = 0;
+                        for (int ii = 0; ii < 24; ii++)
+                            deps += strainD(k, ii) * m_d_dt(ii, 0);
+                        strain(k, 0) += deps * m_Alpha;
+                    }
+
+                    // Stresses (without EAS contribution) and EAS stress projections
+                    ChMatrixNM<double, 6, 1> stress = E_eps * strain;
+                    ChMatrixNM<double, 6, 5> EG = E_eps * G;
+
+                    for (int ii = 0; ii < 24; ii++) {
+                        double f = 0;
+                        for (int k = 0; k < 6; k++)
+                            f += strainD(k, ii) * stress(k, 0);
+                        Fint0(ii, 0) += f * scale;
+                        for (int j = 0; j < 5; j++) {
+                            double a = 0;
+                            for (int k = 0; k < 6; k++)
+                                a += strainD(k, ii) * EG(k, j);
+                            FG(ii, j) += a * scale;
+                        }
+                    }
+                    for (int i = 0; i < 5; i++) {
+                        double h = 0;
+                        for (int k = 0; k < 6; k++)
+                            h += G(k, i) * stress(k, 0);
+                        HE0(i, 0) += h * scale;
+                    }
+                }
+            }
+        }
 
-    // Internal force calculation
-    ChMatrixNM<double, 24, 6> tempC;
-    tempC.MatrTMultiply(strainD, E_eps);
-    ChMatrixNM<double, 24, 1> Fint = (tempC * strain) * (detJ0 * m_element->m_GaussScaling);
+        // Solve the (linear) EAS system and include the EAS contribution to the internal force
+        ChMatrixNM<double, 5, 1> alphaEAS = m_KalphaEASinv[kl] * HE0;
+        alphaEAS.MatrNeg();
+        Fint += Fint0;
+        Fint += FG * alphaEAS;
 
-    // EAS terms
-    ChMatrixNM<double, 5, 6> temp56;
-    temp56.MatrTMultiply(G, E_eps);
-    ChMatrixNM<double, 5, 1> HE = (temp56 * strain) * (detJ0 * m_element->m_GaussScaling);  // EAS residual
-    ChMatrixNM<double, 5, 5> KALPHA = (temp56 * G) * (detJ0 * m_element->m_GaussScaling);   // EAS Jacobian
-
-    /// Total result vector
-    result.PasteClippedMatrix(Fint, 0, 0, 24, 1, 0, 0);
-    result.PasteClippedMatrix(HE, 0, 0, 5, 1, 24, 0);
-    result.PasteClippedMatrixToVector(KALPHA, 0, 0, 5, 5, 29);
+        // Cache alphaEAS for use in Jacobian calculation
+        m_alphaEAS[kl] = alphaEAS;
+    }
 }
 
 void ChElementShellANCF::ComputeInternalForces(ChMatrixDynamic<>& Fi) {
@@ -594,59 +626,12 @@ void ChElementShellANCF::ComputeInternalForces(ChMatrixDynamic<>& Fi) {
     // Assumed Natural Strain (ANS):  Calculate m_strainANS and m_strainANS_D
     CalcStrainANSbilinearShell();
 
-    Fi.Reset();
+    // Internal force (including EAS contributions)
+    ChMatrixNM<double, 24, 1> Finternal;
+    CalcInternalForces(Finternal);
 
-    for (size_t kl = 0; kl < m_numLayers; kl++) {
-        ChMatrixNM<double, 24, 1> Finternal;
-        ChMatrixNM<double, 5, 1> HE;
-        ChMatrixNM<double, 5, 5> KALPHA;
-
-        // Initial guess for EAS parameters
-        ChMatrixNM<double, 5, 1> alphaEAS = m_alphaEAS[kl];
-
-        // Newton loop for EAS
-        for (int count = 0; count < m_maxIterationsEAS; count++) {
-            ChMatrixNM<double, 54, 1> result;
-            MyForce formula(this, kl, &alphaEAS);
-            ChQuadrature::Integrate3D<ChMatrixNM<double, 54, 1> >(result,   // result of integration
-                                                                  formula,  // integrand formula
-                                                                  -1, 1,    // x limits
-                                                                  -1, 1,    // y limits
-                                                                  m_GaussZ[kl], m_GaussZ[kl + 1],  // z limits
-                                                                  2  // order of integration
-                                                                  );
-
-            // Extract vectors and matrices from result of integration
-            Finternal.PasteClippedMatrix(result, 0, 0, 24, 1, 0, 0);
-            HE.PasteClippedMatrix(result, 24, 0, 5, 1, 0, 0);
-            KALPHA.PasteClippedVectorToMatrix(result, 0, 0, 5, 5, 29);
-
-            // Check convergence (residual check)
-            double norm_HE = HE.NormTwo();
-            if (norm_HE < m_toleranceEAS)
-                break;
-
-            // Calculate increment (in place) and update EAS parameters
-            ChMatrixNM<int, 5, 1> INDX;
-            bool pivoting;
-            ChMatrixNM<double, 5, 5> KALPHA1 = KALPHA;
-            if (!LU_factor(KALPHA1, INDX, pivoting))
-                throw ChException("Singular matrix in LU factorization");
-            LU_solve(KALPHA1, INDX, HE);
-            alphaEAS = alphaEAS - HE;
-
-            if (count >= 2)
-                GetLog() << "  count " << count << "  NormHE " << norm_HE << "\n";
-        }
-
-        // Accumulate internal force
-        Fi -= Finternal;
-
-        // Cache alphaEAS and KALPHA for use in Jacobian calculation
-        m_alphaEAS[kl] = alphaEAS;
-        m_KalphaEAS[kl] = KALPHA;
-
-    }  // Layer Loop
+    Fi.Reset();
+    Fi -= Finternal;
 
     if (m_gravity_on) {
         Fi += m_GravForce;
@@ -1073,10 +1058,8 @@ void ChElementShellANCF::ComputeInternalJacobians(double Kfactor, double Rfactor
         GDEPSP.PasteClippedVectorToMatrix(result, 0, 0, 5, 24, 576);
 
         // Include EAS contribution to the stiffness component (hence scaled by Kfactor)
-        ChMatrixNM<double, 5, 5> KalphaEAS_inv;
-        Inverse55_Analytical(KalphaEAS_inv, m_KalphaEAS[kl]);
         ChMatrixNM<double, 24, 24> EAS;
-        EAS.MatrTMultiply(GDEPSP, KalphaEAS_inv * GDEPSP);
+        EAS.MatrTMultiply(GDEPSP, m_KalphaEASinv[kl] * GDEPSP);
 
         // Accumulate Jacobian
         m_JacobianMatrix += KTE - EAS * Kfactor;
@@ -114,7 +114,6 @@ class ChApiFea ChElementShellANCF : public ChElementShell, public ChLoadableUV,
         ChMatrixNM<double, 6, 6> m_T0;
 
         friend class ChElementShellANCF;
-        friend class MyForce;
         friend class MyJacobian;
     };
 
@@ -207,6 +206,12 @@ class ChApiFea ChElementShellANCF : public ChElementShell, public ChLoadableUV,
     ChVector<> EvaluateSectionStrains();
 
   private:
+    /// Reference-configuration data at an integration point of the internal force quadrature.
+    struct GaussPointData {
+        double beta[9];  ///< coefficients of the contravariant transformation (includes fiber orientation)
+        double detJ0;    ///< determinant of the initial position vector gradient
+    };
+
     std::vector<std::shared_ptr<ChNodeFEAxyzD> > m_nodes;  ///< element nodes
     std::vector<Layer> m_layers;                           ///< element layers
     size_t m_numLayers;                                    ///< number of layers for this element
@@ -229,9 +234,8 @@ class ChApiFea ChElementShellANCF : public ChElementShell, public ChLoadableUV,
     ChMatrixNM<double, 8, 24> m_strainANS_D;               ///< ANS strain derivatives
     std::vector<ChMatrixNM<double, 5, 1> > m_alphaEAS;     ///< EAS parameters (5 per layer)
     std::vector<ChMatrixNM<double, 5, 5> > m_KalphaEAS;    ///< EAS Jacobians (a 5x5 matrix per layer)
-
-    static const double m_toleranceEAS;   ///< tolerance for nonlinear EAS solver (on residual)
-    static const int m_maxIterationsEAS;  ///< maximum number of nonlinear EAS iterations
+    std::vector<ChMatrixNM<double, 5, 5> > m_KalphaEASinv; ///< inverses of the EAS Jacobians
+    std::vector<GaussPointData> m_gaussData;               ///< reference data (8 integration points per layer)
 
   public:
     // Interface to ChElementBase base class
@@ -330,6 +334,16 @@ class ChApiFea ChElementShellANCF : public ChElementShell, public ChLoadableUV,
                       ChMatrixNM<double, 1, 3>& Ny_d0,
                       ChMatrixNM<double, 1, 3>& Nz_d0);
 
+    // Calculate and cache the reference-configuration data at the integration points of each layer.
+    void CalcGaussPointData();
+
+    // Calculate the (constant) EAS Jacobians of all layers and their inverses.
+    void CalcEASJacobians();
+
+    // Evaluate the internal force, summed over all layers (EAS parameters are solved for
+    // and cached in m_alphaEAS).
+    void CalcInternalForces(ChMatrixNM<double, 24, 1>& Fint);
+
     // Calculate the current 8x3 matrix of nodal coordinates.
     void CalcCoordMatrix(ChMatrixNM<double, 8, 3>& d);
 
@@ -418,7 +432,6 @@ class ChApiFea ChElementShellANCF : public ChElementShell, public ChLoadableUV,
 
     friend class MyMass;
     friend class MyGravity;
-    friend class MyForce;
     friend class MyJacobian;
 };
 
@@ -21,6 +21,7 @@ ChElementTetra_4::ChElementTetra_4() {
     nodes.resize(4);
     this->MatrB.Resize(6, 12);
     this->StiffnessMatrix.Resize(12, 12);
+    this->Kprecision = ChReferenceStiffness::Precision::DOUBLE;
 }
 
 ChElementTetra_4::~ChElementTetra_4() {}
@@ -22,6 +22,7 @@
 #include "chrono_fea/ChNodeFEAxyz.h"
 #include "chrono_fea/ChNodeFEAxyzP.h"
 #include "chrono_fea/ChContinuumPoisson3D.h"
+#include "chrono_fea/ChReferenceStiffness.h"
 
 namespace chrono {
 namespace fea {
@@ -36,8 +37,10 @@ class ChApiFea ChElementTetra_4 : public ChElementTetrahedron, public ChLoadable
   protected:
     std::vector<std::shared_ptr<ChNodeFEAxyz> > nodes;
     std::shared_ptr<ChContinuumElastic> Material;
-    ChMatrixDynamic<> MatrB;            // matrix of shape function's partial derivatives
-    ChMatrixDynamic<> StiffnessMatrix;  // undeformed local stiffness matrix
+    ChMatrixDynamic<> MatrB;                     // matrix of shape function's partial derivatives
+    ChMatrixDynamic<> StiffnessMatrix;           // undeformed local stiffness matrix
+    ChReferenceStiffness Kref;                   // compact copy of StiffnessMatrix, used at each step
+    ChReferenceStiffness::Precision Kprecision;  // storage precision of Kref
 
     ChMatrixNM<double, 4, 4> mM;  // for speeding up corotational approach
 
@@ -194,42 +197,48 @@ class ChApiFea ChElementTetra_4 : public ChElementTetrahedron, public ChLoadable
                      << "\n";
     }
 
+    /// Set the precision used to store the reference stiffness used by the per-step corotational
+    /// kernels (default: double). In single precision the store takes half the memory, products
+    /// are still accumulated in double, and the dense StiffnessMatrix is released after setup
+    /// (GetStiffnessMatrix() rebuilds it on demand). Must be called before SetupInitial.
+    void SetStiffnessPrecision(ChReferenceStiffness::Precision prec) { Kprecision = prec; }
+    ChReferenceStiffness::Precision GetStiffnessPrecision() const { return Kprecision; }
+
+    /// Access the compact reference stiffness store (available after SetupInitial).
+    const ChReferenceStiffness& GetReferenceStiffness() const { return Kref; }
+
     /// set up the element's parameters and matrices
     virtual void SetupInitial(ChSystem* system) override {
         ComputeVolume();
+        StiffnessMatrix.Resize(12, 12);
         ComputeStiffnessMatrix();
+        Kref.Set(StiffnessMatrix, Kprecision);
+        if (Kprecision == ChReferenceStiffness::Precision::SINGLE)
+            StiffnessMatrix.Resize(0, 0);
     }
 
     /// compute large rotation of element for corotational approach
     virtual void UpdateRotation() override {
+        // F = P * mM (only upper-left 3x3 block!), with
         // P = [ p_0  p_1  p_2  p_3 ]
         //     [ 1    1    1    1   ]
-        ChMatrixNM<double, 4, 4> P;
-        P.PasteVector(nodes[0]->pos, 0, 0);
-        P.PasteVector(nodes[1]->pos, 0, 1);
-        P.PasteVector(nodes[2]->pos, 0, 2);
-        P.PasteVector(nodes[3]->pos, 0, 3);
-        P(3, 0) = 1.0;
-        P(3, 1) = 1.0;
-        P(3, 2) = 1.0;
-        P(3, 3) = 1.0;
-
+        const ChVector<>& p0 = nodes[0]->pos;
+        const ChVector<>& p1 = nodes[1]->pos;
+        const ChVector<>& p2 = nodes[2]->pos;
+        const ChVector<>& p3 = nodes[3]->pos;
         ChMatrix33<double> F;
-        // F=P*mM (only upper-left 3x3 block!)
-        double sum;
-        for (int colres = 0; colres < 3; ++colres)
-            for (int row = 0; row < 3; ++row) {
-                sum = 0;
-                for (int col = 0; col < 4; ++col)
-                    sum += (P(row, col)) * (mM(col, colres));
-                F(row, colres) = sum;
-            }
-        ChMatrix33<> S;
-        double det = ChPolarDecomposition<>::Compute(F, this->A, S, 1E-6);
+        for (int colres = 0; colres < 3; ++colres) {
+            double m0 = mM(0, colres);
+            double m1 = mM(1, colres);
+            double m2 = mM(2, colres);
+            double m3 = mM(3, colres);
+            F(0, colres) = p0.x() * m0 + p1.x() * m1 + p2.x() * m2 + p3.x() * m3;
+            F(1, colres) = p0.y() * m0 + p1.y() * m1 + p2.y() * m2 + p3.y() * m3;
+            F(2, colres) = p0.z() * m0 + p1.z() * m1 + p2.z() * m2 + p3.z() * m3;
+        }
+        double det = ChPolarDecomposition<>::ComputeRotation(F, this->A, 1E-6);
         if (det < 0)
             this->A.MatrScale(-1.0);
-
-        // GetLog() << "FEM rotation: \n" << A << "\n" ;
     }
 
     /// Sets H as the global stiffness matrix K, scaled  by Kfactor. Optionally, also
@@ -237,92 +246,13 @@ class ChApiFea ChElementTetra_4 : public ChElementTetrahedron, public ChLoadable
     virtual void ComputeKRMmatricesGlobal(ChMatrix<>& H, double Kfactor, double Rfactor = 0, double Mfactor = 0) override {
         assert((H.GetRows() == 12) && (H.GetColumns() == 12));
 
-        // warp the local stiffness matrix K in order to obtain global
-        // tangent stiffness CKCt:
-        ChMatrixDynamic<> CK(12, 12);
-        ChMatrixDynamic<> CKCt(12, 12);  // the global, corotated, K matrix
-        ChMatrixCorotation<>::ComputeCK(StiffnessMatrix, this->A, 4, CK);
-        ChMatrixCorotation<>::ComputeKCt(CK, this->A, 4, CKCt);
-        /*
-        // ***TEST***
-        ChMatrixDynamic<> testCKCt(12,12);
-        ChMatrixDynamic<> mC(12,12);
-        mC.PasteMatrix(this->A,0,0);
-        mC.PasteMatrix(this->A,3,3);
-        mC.PasteMatrix(this->A,6,6);
-        mC.PasteMatrix(this->A,9,9);
-        CK.MatrMultiply(mC,StiffnessMatrix);
-        testCKCt.MatrMultiplyT(CK,mC);
-        ChMatrixDynamic<> mdiff = testCKCt - CKCt;
-        double maxerr=0;
-        for (int row = 0; row < mdiff.GetRows()-1; ++row)
-            for (int col = 0; col < mdiff.GetColumns(); ++col)
-                if (fabs(mdiff(col,row)) > maxerr ) maxerr =  fabs(mdiff(col,row));
-        if (maxerr > 0)
-            GetLog() << " !!!corotation symmetry error!!!! "  << maxerr << "\n";
-        */
-
-        // ***TEST*** SYMMETRIZE TO AVOID ROUNDOFF ASYMMETRY
-        for (int row = 0; row < CKCt.GetRows() - 1; ++row)
-            for (int col = row + 1; col < CKCt.GetColumns(); ++col)
-                CKCt(row, col) = CKCt(col, row);
-
-        //***DEBUG***
-        double max_err = 0;
-        int err_r = -1;
-        int err_c = -1;
-        for (int row = 0; row < StiffnessMatrix.GetRows(); ++row)
-            for (int col = 0; col < StiffnessMatrix.GetColumns(); ++col) {
-                double diff = fabs(StiffnessMatrix.GetElement(row, col) - StiffnessMatrix.GetElement(col, row));
-                if (diff > max_err) {
-                    max_err = diff;
-                    err_r = row;
-                    err_c = col;
-                }
-            }
-        if (max_err > 1e-10)
-            GetLog() << "NONSYMMETRIC local stiffness matrix! err " << max_err << " at " << err_r << "," << err_c
-                     << "\n";
-        max_err = 0;
-        err_r = -1;
-        err_c = -1;
-        double maxval = 0;
-        for (int row = 0; row < CKCt.GetRows(); ++row)
-            for (int col = 0; col < CKCt.GetColumns(); ++col) {
-                double diff = fabs(CKCt.GetElement(row, col) - CKCt.GetElement(col, row));
-                if (diff > max_err) {
-                    max_err = diff;
-                    err_r = row;
-                    err_c = col;
-                }
-                if (CKCt.GetElement(row, col) > maxval)
-                    maxval = CKCt.GetElement(row, col);
-            }
-        if (max_err > 1e-10)
-            GetLog() << "NONSYMMETRIC corotated matrix! err " << max_err << " at " << err_r << "," << err_c
-                     << ",   maxval=" << maxval << "\n";
-
-        // DEBUG
-        /*
-        ChMatrixDynamic<> Ctest(12,12);
-        Ctest.PasteMatrix(A,0,0);
-        Ctest.PasteMatrix(A,3,3);
-        Ctest.PasteMatrix(A,6,6);
-        Ctest.PasteMatrix(A,9,9);
-        ChMatrixDynamic<> CKtest(12,12);
-        CKtest.MatrMultiply(Ctest,StiffnessMatrix);
-        ChMatrixDynamic<> CKCttest(12,12);
-        CKCttest.MatrMultiplyT(CKtest,Ctest);
-        GetLog() << "CKCt difference \n" << CKCt-CKCttest << "\n";
-        */
-
         // For K stiffness matrix and R damping matrix:
+        // warp the local stiffness matrix K in order to obtain the global tangent stiffness CKCt,
+        // rotating it block by block (the result is exactly symmetric).
 
         double mkfactor = Kfactor + Rfactor * this->GetMaterial()->Get_RayleighDampingK();
 
-        CKCt.MatrScale(mkfactor);
-
-        H.PasteMatrix(CKCt, 0, 0);
+        Kref.ComputeRotated(this->A, mkfactor, H);
 
         // For M mass matrix:
         if (Mfactor) {
@@ -341,33 +271,34 @@ class ChApiFea ChElementTetra_4 : public ChElementTetrahedron, public ChLoadable
     virtual void ComputeInternalForces(ChMatrixDynamic<>& Fi) override {
         assert((Fi.GetRows() == 12) && (Fi.GetColumns() == 1));
 
-        // set up vector of nodal displacements (in local element system) u_l = R*p - p0
-        ChMatrixDynamic<> displ(12, 1);
-        this->GetStateBlock(displ);  // nodal displacements, local
-
-        // [local Internal Forces] = [Klocal] * displ + [Rlocal] * displ_dt
-        ChMatrixDynamic<> FiK_local(12, 1);
-        FiK_local.MatrMultiply(StiffnessMatrix, displ);
-
-        displ.PasteVector(A.MatrT_x_Vect(nodes[0]->pos_dt), 0, 0);  // nodal speeds, local
-        displ.PasteVector(A.MatrT_x_Vect(nodes[1]->pos_dt), 3, 0);
-        displ.PasteVector(A.MatrT_x_Vect(nodes[2]->pos_dt), 6, 0);
-        displ.PasteVector(A.MatrT_x_Vect(nodes[3]->pos_dt), 9, 0);
-        ChMatrixDynamic<> FiR_local(12, 1);
-        FiR_local.MatrMultiply(StiffnessMatrix, displ);
-        FiR_local.MatrScale(this->Material->Get_RayleighDampingK());
-
+        // [local Internal Forces] = [Klocal] * displ + [Rlocal] * displ_dt, with
+        // [Rlocal] = betaK * [Klocal] + betaM * [Mlocal], so that [Klocal] is traversed only once:
+        // Fi_local = [Klocal] * (displ + betaK * displ_dt) + betaM * [Mlocal] * displ_dt
+        double betaK = this->Material->Get_RayleighDampingK();
         double lumped_node_mass = (this->GetVolume() * this->Material->Get_density()) / 4.0;
-        displ.MatrScale(lumped_node_mass * this->Material->Get_RayleighDampingM());  // reuse 'displ' for performance
-        FiR_local.MatrInc(displ);
+        double mass_damping = lumped_node_mass * this->Material->Get_RayleighDampingM();
         //***TO DO*** better per-node lumping, or 12x12 consistent mass matrix.
 
-        FiK_local.MatrInc(FiR_local);
+        // nodal displacements u_l = R'*p - p0 and speeds, in local element system
+        ChVector<> speed[4];
+        double displ[12];
+        for (int in = 0; in < 4; ++in) {
+            speed[in] = A.MatrT_x_Vect(nodes[in]->pos_dt);
+            ChVector<> u = A.MatrT_x_Vect(nodes[in]->pos) - nodes[in]->GetX0() + speed[in] * betaK;
+            displ[3 * in + 0] = u.x();
+            displ[3 * in + 1] = u.y();
+            displ[3 * in + 2] = u.z();
+        }
 
-        FiK_local.MatrScale(-1.0);
+        double Fi_local[12];
+        Kref.Multiply(displ, Fi_local);
 
-        // Fi = C * Fi_local  with C block-diagonal rotations A
-        ChMatrixCorotation<>::ComputeCK(FiK_local, this->A, 4, Fi);
+        // Fi = - C * Fi_local  with C block-diagonal rotations A
+        for (int in = 0; in < 4; ++in) {
+            ChVector<> f(Fi_local[3 * in + 0], Fi_local[3 * in + 1], Fi_local[3 * in + 2]);
+            f += speed[in] * mass_damping;
+            Fi.PasteVector(-A.Matr_x_Vect(f), 3 * in, 0);
+        }
     }
 
     //
@@ -380,7 +311,11 @@ class ChApiFea ChElementTetra_4 : public ChElementTetrahedron, public ChLoadable
 
     /// Get the partial derivatives matrix MatrB and the StiffnessMatrix
     ChMatrix<>& GetMatrB() { return MatrB; }
-    ChMatrix<>& GetStiffnessMatrix() { return StiffnessMatrix; }
+    ChMatrix<>& GetStiffnessMatrix() {
+        if (StiffnessMatrix.GetRows() == 0)
+            Kref.GetMatrix(StiffnessMatrix);
+        return StiffnessMatrix;
+    }
 
     /// Returns the strain tensor (note that the tetrahedron 4 nodes is a linear
     /// element, thus the strain is constant in the entire volume).
@@ -13,11 +13,15 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChLoad.h"
@@ -27,6 +31,8 @@
 #include "chrono_fea/ChElementTetra_4.h"
 #include "chrono_fea/ChMesh.h"
 #include "chrono_fea/ChNodeFEAxyz.h"
+#include "chrono_fea/ChNodeFEAxyzP.h"
+#include "chrono_fea/ChNodeFEAxyzrot.h"
 
 using namespace std;
 
@@ -46,11 +52,18 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
     automatic_gravity_load = other.automatic_gravity_load;
     num_points_gravity = other.num_points_gravity;
 
+    jacobian_reuse_tol = other.jacobian_reuse_tol;
+    node_ordering = other.node_ordering;
+    nelem_KRMload_evaluated = 0;
+    nelem_KRMload_reused = 0;
+
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
 }
 
 void ChMesh::SetupInitial() {
+    ReorderNodes(node_ordering);
+
     n_dofs = 0;
     n_dofs_w = 0;
 
@@ -66,6 +79,8 @@ void ChMesh::SetupInitial() {
         //    - precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    jacobian_cache.clear();
 }
 
 void ChMesh::Relax() {
@@ -89,17 +104,284 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> m_node) {
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
     velements.push_back(m_elem);
+    jacobian_cache.clear();
 }
 
 void ChMesh::ClearElements() {
     velements.clear();
     vcontactsurfaces.clear();
+    jacobian_cache.clear();
 }
 
 void ChMesh::ClearNodes() {
     velements.clear();
     vnodes.clear();
     vcontactsurfaces.clear();
+    jacobian_cache.clear();
+}
+
+void ChMesh::SetJacobianReuseTolerance(double tolerance) {
+    jacobian_reuse_tol = tolerance;
+    jacobian_cache.clear();
+}
+
+// Get the position of a node, if it has one.
+static bool GetNodePosition(const std::shared_ptr<ChNodeFEAbase>& node, ChVector<>& pos) {
+    if (auto node_xyz = std::dynamic_pointer_cast<ChNodeFEAxyz>(node)) {
+        pos = node_xyz->GetPos();
+        return true;
+    }
+    if (auto node_xyzrot = std::dynamic_pointer_cast<ChNodeFEAxyzrot>(node)) {
+        pos = node_xyzrot->GetPos();
+        return true;
+    }
+    if (auto node_xyzP = std::dynamic_pointer_cast<ChNodeFEAxyzP>(node)) {
+        pos = node_xyzP->GetPos();
+        return true;
+    }
+    return false;
+}
+
+// Spread the lower 21 bits of the argument so that there are two zero bits between consecutive bits.
+static uint64_t SpreadBits3(uint64_t v) {
+    v &= 0x1fffff;
+    v = (v | (v << 32)) & 0x1f00000000ffff;
+    v = (v | (v << 16)) & 0x1f0000ff0000ff;
+    v = (v | (v << 8)) & 0x100f00f00f00f00f;
+    v = (v | (v << 4)) & 0x10c30c30c30c30c3;
+    v = (v | (v << 2)) & 0x1249249249249249;
+    return v;
+}
+
+// Reverse Cuthill-McKee ordering of the graph with given adjacency lists.
+// Each connected component is traversed breadth-first, starting from a pseudo-peripheral node and visiting
+// neighbors by increasing degree. Returns the permutation (new position -> old index).
+static std::vector<int> ReverseCuthillMcKee(const std::vector<std::vector<int>>& adj) {
+    int n = (int)adj.size();
+    std::vector<int> perm;
+    perm.reserve(n);
+
+    std::vector<int> by_degree(n);
+    for (int i = 0; i < n; i++)
+        by_degree[i] = i;
+    std::stable_sort(by_degree.begin(), by_degree.end(),
+                     [&adj](int a, int b) { return adj[a].size() < adj[b].size(); });
+
+    std::vector<bool> visited(n, false);
+    std::vector<int> level(n, -1);
+    std::vector<int> touched;
+
+    // Breadth-first level structure rooted at 'root'. Return the depth and the last-level node of minimum degree.
+    auto level_structure = [&](int root, int& last) {
+        touched.clear();
+        touched.push_back(root);
+        level[root] = 0;
+        int depth = 0;
+        last = root;
+        for (size_t k = 0; k < touched.size(); k++) {
+            int i = touched[k];
+            if (level[i] > depth || (level[i] == depth && adj[i].size() < adj[last].size())) {
+                depth = level[i];
+                last = i;
+            }
+            for (auto j : adj[i]) {
+                if (level[j] < 0) {
+                    level[j] = level[i] + 1;
+                    touched.push_back(j);
+                }
+            }
+        }
+        for (auto i : touched)
+            level[i] = -1;
+        return depth;
+    };
+
+    for (auto start : by_degree) {
+        if (visited[start])
+            continue;
+
+        // Find a pseudo-peripheral node (George-Liu).
+        int root = start;
+        int last;
+        int depth = level_structure(root, last);
+        for (int iter = 0; iter < 10 && last != root; iter++) {
+            int candidate_last;
+            int candidate_depth = level_structure(last, candidate_last);
+            if (candidate_depth <= depth)
+                break;
+            root = last;
+            last = candidate_last;
+            depth = candidate_depth;
+        }
+
+        // Cuthill-McKee traversal of this component.
+        size_t first = perm.size();
+        perm.push_back(root);
+        visited[root] = true;
+        for (size_t k = first; k < perm.size(); k++) {
+            int i = perm[k];
+            size_t next = perm.size();
+            for (auto j : adj[i]) {
+                if (!visited[j]) {
+                    visited[j] = true;
+                    perm.push_back(j);
+                }
+            }
+            std::stable_sort(perm.begin() + next, perm.end(),
+                             [&adj](int a, int b) { return adj[a].size() < adj[b].size(); });
+        }
+    }
+
+    std::reverse(perm.begin(), perm.end());
+    return perm;
+}
+
+void ChMesh::ReorderNodes(NodeOrdering ordering) {
+    if (ordering == NodeOrdering::NONE || vnodes.empty())
+        return;
+
+    int nnodes = (int)vnodes.size();
+    int nelements = (int)velements.size();
+
+    // Element connectivity, in terms of current node indices (nodes not in this mesh are ignored).
+    std::unordered_map<ChNodeFEAbase*, int> node_index;
+    for (int i = 0; i < nnodes; i++)
+        node_index[vnodes[i].get()] = i;
+
+    std::vector<std::vector<int>> elem_nodes(nelements);
+    for (int ie = 0; ie < nelements; ie++) {
+        for (int k = 0; k < velements[ie]->GetNnodes(); k++) {
+            auto it = node_index.find(velements[ie]->GetNodeN(k).get());
+            if (it != node_index.end())
+                elem_nodes[ie].push_back(it->second);
+        }
+    }
+
+    // Node permutation (new position -> old index).
+    std::vector<int> perm;
+
+    switch (ordering) {
+        case NodeOrdering::REVERSE_CUTHILL_MCKEE: {
+            std::vector<std::vector<int>> adj(nnodes);
+            for (const auto& nodes : elem_nodes) {
+                for (auto a : nodes)
+                    for (auto b : nodes)
+                        if (a != b)
+                            adj[a].push_back(b);
+            }
+            for (auto& list : adj) {
+                std::sort(list.begin(), list.end());
+                list.erase(std::unique(list.begin(), list.end()), list.end());
+            }
+            perm = ReverseCuthillMcKee(adj);
+            break;
+        }
+        case NodeOrdering::MORTON: {
+            // Quantize node positions over their bounding box; nodes without a position are placed last.
+            std::vector<ChVector<>> pos(nnodes);
+            std::vector<bool> has_pos(nnodes);
+            ChVector<> pmin(1e30), pmax(-1e30);
+            for (int i = 0; i < nnodes; i++) {
+                has_pos[i] = GetNodePosition(vnodes[i], pos[i]);
+                if (has_pos[i]) {
+                    pmin = ChVector<>(std::min(pmin.x(), pos[i].x()), std::min(pmin.y(), pos[i].y()),
+                                      std::min(pmin.z(), pos[i].z()));
+                    pmax = ChVector<>(std::max(pmax.x(), pos[i].x()), std::max(pmax.y(), pos[i].y()),
+                                      std::max(pmax.z(), pos[i].z()));
+                }
+            }
+            ChVector<> ext = pmax - pmin;
+            double scale = (ext.LengthInf() > 0) ? ((1 << 21) - 1) / ext.LengthInf() : 0;
+
+            std::vector<uint64_t> keys(nnodes, ~uint64_t(0));
+            for (int i = 0; i < nnodes; i++) {
+                if (!has_pos[i])
+                    continue;
+                ChVector<> q = (pos[i] - pmin) * scale;
+                keys[i] = SpreadBits3((uint64_t)q.x()) | (SpreadBits3((uint64_t)q.y()) << 1) |
+                          (SpreadBits3((uint64_t)q.z()) << 2);
+            }
+
+            perm.resize(nnodes);
+            for (int i = 0; i < nnodes; i++)
+                perm[i] = i;
+            std::stable_sort(perm.begin(), perm.end(), [&keys](int a, int b) { return keys[a] < keys[b]; });
+            break;
+        }
+        default:
+            return;
+    }
+
+    // Reorder nodes and reset their indices.
+    std::vector<int> new_index(nnodes);
+    std::vector<std::shared_ptr<ChNodeFEAbase>> new_nodes(nnodes);
+    for (int i = 0; i < nnodes; i++) {
+        new_nodes[i] = vnodes[perm[i]];
+        new_nodes[i]->SetIndex(i + 1);
+        new_index[perm[i]] = i;
+    }
+    vnodes.swap(new_nodes);
+
+    // Sort elements by the smallest new index of their nodes.
+    std::vector<int> elem_key(nelements, nnodes);
+    for (int ie = 0; ie < nelements; ie++) {
+        for (auto i : elem_nodes[ie])
+            elem_key[ie] = std::min(elem_key[ie], new_index[i]);
+    }
+    std::vector<int> elem_perm(nelements);
+    for (int ie = 0; ie < nelements; ie++)
+        elem_perm[ie] = ie;
+    std::stable_sort(elem_perm.begin(), elem_perm.end(),
+                     [&elem_key](int a, int b) { return elem_key[a] < elem_key[b]; });
+
+    std::vector<std::shared_ptr<ChElementBase>> new_elements(nelements);
+    for (int ie = 0; ie < nelements; ie++)
+        new_elements[ie] = velements[elem_perm[ie]];
+    velements.swap(new_elements);
+
+    jacobian_cache.clear();
+}
+
+double ChMesh::ComputeStableTimestep() {
+    int nelements = (int)velements.size();
+    std::vector<double> dt_elem(nelements, std::numeric_limits<double>::infinity());
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (int ie = 0; ie < nelements; ie++) {
+        int ndofs = velements[ie]->GetNdofs();
+        ChMatrixDynamic<> K(ndofs, ndofs);
+        ChMatrixDynamic<> M(ndofs, ndofs);
+        velements[ie]->ComputeKRMmatricesGlobal(K, 1.0, 0, 0);
+        velements[ie]->ComputeMmatrixGlobal(M);
+
+        double omega2 = 0;
+        for (int i = 0; i < ndofs; i++) {
+            double m = 0;
+            double k = 0;
+            for (int j = 0; j < ndofs; j++) {
+                m += M(i, j);
+                k += std::abs(K(i, j));
+            }
+            if (m > 0)
+                omega2 = std::max(omega2, k / m);
+            else if (k > 0)
+                omega2 = std::numeric_limits<double>::infinity();  // stiff massless row
+        }
+        if (omega2 > 0)
+            dt_elem[ie] = 2 / std::sqrt(omega2);
+    }
+
+    double dt = std::numeric_limits<double>::infinity();
+    int nmassless = 0;
+    for (int ie = 0; ie < nelements; ie++) {
+        dt = std::min(dt, dt_elem[ie]);
+        if (dt_elem[ie] == 0)
+            nmassless++;
+    }
+    if (nmassless > 0)
+        GetLog() << "WARNING: ChMesh::ComputeStableTimestep: " << nmassless
+                 << " elements with stiff massless degrees of freedom, no stable explicit step.\n";
+    return dt;
 }
 
 void ChMesh::AddContactSurface(std::shared_ptr<ChContactSurface> m_surf) {
@@ -366,9 +648,52 @@ void ChMesh::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
 
 void ChMesh::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
     timer_KRMload.start();
+
+    int nelements = (int)velements.size();
+
+    if (jacobian_reuse_tol <= 0) {
 #pragma omp parallel for
-    for (int ie = 0; ie < velements.size(); ie++)
-        velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+        for (int ie = 0; ie < nelements; ie++)
+            velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+        nelem_KRMload_evaluated += nelements;
+    } else {
+        // Reuse the element matrices (still loaded in the KRM blocks of the elements) for all elements
+        // whose state did not change significantly since their last evaluation.
+        if (jacobian_cache.size() != velements.size()) {
+            jacobian_cache.clear();
+            jacobian_cache.resize(velements.size());
+        }
+
+        int nreused = 0;
+#pragma omp parallel for reduction(+ : nreused)
+        for (int ie = 0; ie < nelements; ie++) {
+            JacobianCacheEntry& cache = jacobian_cache[ie];
+            ChMatrixDynamic<> state;
+            velements[ie]->GetStateBlock(state);
+
+            if (cache.valid && cache.Kfactor == Kfactor && cache.Rfactor == Rfactor && cache.Mfactor == Mfactor &&
+                cache.state.GetRows() == state.GetRows()) {
+                double change = 0;
+                for (int i = 0; i < state.GetRows(); i++)
+                    change = std::max(change, std::abs(state(i) - cache.state(i)));
+                if (change <= jacobian_reuse_tol) {
+                    nreused++;
+                    continue;
+                }
+            }
+
+            velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+            cache.state = state;
+            cache.Kfactor = Kfactor;
+            cache.Rfactor = Rfactor;
+            cache.Mfactor = Mfactor;
+            cache.valid = true;
+        }
+
+        nelem_KRMload_evaluated += nelements - nreused;
+        nelem_KRMload_reused += nreused;
+    }
+
     timer_KRMload.stop();
     ncalls_KRMload++;
 }
@@ -37,6 +37,13 @@ namespace fea {
 /// Class which defines a mesh of finite elements of class ChElementBase,
 /// between nodes of class ChNodeFEAbase.
 class ChApiFea ChMesh : public ChIndexedNodes {
+  public:
+    /// Node ordering strategies (see SetNodeOrdering).
+    enum class NodeOrdering {
+        NONE,                   ///< keep the insertion order of nodes and elements
+        REVERSE_CUTHILL_MCKEE,  ///< reverse Cuthill-McKee ordering of the node connectivity graph
+        MORTON                  ///< Morton (Z-order) space-filling curve through the node positions
+    };
 
   private:
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
@@ -56,6 +63,23 @@ class ChApiFea ChMesh : public ChIndexedNodes {
     int ncalls_internal_forces;
     int ncalls_KRMload;
 
+    /// Data cached for the reuse of an element Jacobian.
+    struct JacobianCacheEntry {
+        ChMatrixDynamic<> state;  ///< element state at the last Jacobian evaluation
+        double Kfactor;           ///< K factor used at the last Jacobian evaluation
+        double Rfactor;           ///< R factor used at the last Jacobian evaluation
+        double Mfactor;           ///< M factor used at the last Jacobian evaluation
+        bool valid;               ///< true if the element Jacobian was evaluated at least once
+        JacobianCacheEntry() : Kfactor(0), Rfactor(0), Mfactor(0), valid(false) {}
+    };
+
+    double jacobian_reuse_tol;                       ///< state change threshold for Jacobian reuse (0: no reuse)
+    std::vector<JacobianCacheEntry> jacobian_cache;  ///< per-element Jacobian cache data
+    int nelem_KRMload_evaluated;                     ///< number of element Jacobian evaluations
+    int nelem_KRMload_reused;                        ///< number of reused element Jacobians
+
+    NodeOrdering node_ordering;  ///< node reordering applied at initial setup
+
   public:
     ChMesh()
         : n_dofs(0),
@@ -63,7 +87,11 @@ class ChApiFea ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          jacobian_reuse_tol(0),
+          nelem_KRMload_evaluated(0),
+          nelem_KRMload_reused(0),
+          node_ordering(NodeOrdering::NONE) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -103,11 +131,51 @@ class ChApiFea ChMesh : public ChIndexedNodes {
     void ResetCounters() {
         ncalls_internal_forces = 0;
         ncalls_KRMload = 0;
+        nelem_KRMload_evaluated = 0;
+        nelem_KRMload_reused = 0;
     }
     /// Get cumulative number of calls to internal forces evaluation.
     int GetNumCallsInternalForces() { return ncalls_internal_forces; }
     /// Get cumulative number of calls to load Jacobian information.
     int GetNumCallsJacobianLoad() { return ncalls_KRMload; }
+    /// Get cumulative number of element Jacobian evaluations (over all calls to load Jacobian information).
+    int GetNumElementJacobianEvaluations() { return nelem_KRMload_evaluated; }
+    /// Get cumulative number of element Jacobians that were reused instead of being evaluated.
+    int GetNumElementJacobianReuses() { return nelem_KRMload_reused; }
+
+    /// Enable reuse of element Jacobians (combination of stiffness, damping, and mass matrices) when loading
+    /// Jacobian information. An element Jacobian is re-evaluated only if the change in the element state
+    /// (max-norm of the difference of nodal coordinates since its last evaluation) exceeds the given tolerance,
+    /// or if the K, R, M factors changed. Otherwise, the previously computed element matrix is used as is.
+    /// This lags stiffness updates in regions with small deformation increments (mostly linear behavior) and may
+    /// increase the number of Newton iterations; a value of 0 (default) disables Jacobian reuse.
+    void SetJacobianReuseTolerance(double tolerance);
+
+    /// Set the ordering of nodes (and elements) applied at the initial setup (default: NodeOrdering::NONE).
+    /// Nodes are stored in insertion order, which determines their offsets in the system state. Reordering them
+    /// with REVERSE_CUTHILL_MCKEE reduces the bandwidth of the assembled matrices (and the fill-in of direct
+    /// solvers); MORTON groups nodes that are close in space. In both cases, elements are then sorted by the
+    /// smallest index of their nodes, so that element loops access contiguous portions of the state.
+    /// Note that node indices (as used in GetNode) change after reordering.
+    void SetNodeOrdering(NodeOrdering ordering) { node_ordering = ordering; }
+
+    /// Get the node ordering applied at the initial setup.
+    NodeOrdering GetNodeOrdering() const { return node_ordering; }
+
+    /// Reorder the nodes and elements of this mesh using the specified strategy (see SetNodeOrdering).
+    /// This is done automatically at the initial setup; it can be called explicitly, e.g. before creating
+    /// constraints or loads that refer to nodes by index.
+    void ReorderNodes(NodeOrdering ordering);
+
+    /// Estimate the critical time step for explicit integration of this mesh (e.g. with the central difference
+    /// timestepper). For each element, the largest natural frequency is bounded by max_i(sum_j |K_ij| / m_i),
+    /// with K the element stiffness matrix and m_i the row sums of the element mass matrix, and the element
+    /// critical step is 2/omega_max. Since the maximum frequency of the assembled mesh does not exceed the
+    /// largest element frequency, the smallest element step is a conservative estimate for the entire mesh.
+    /// Elements are processed in parallel. Returns infinity if no element has stiffness. Returns 0 (with a
+    /// warning) if some element has a stiff degree of freedom with no lumped mass, since no explicit step is
+    /// stable in that case (the central difference timestepper rejects such a mesh).
+    double ComputeStableTimestep();
 
     /// Reset timers for internal force and Jacobian evaluations.
     void ResetTimers() {
@@ -20,6 +20,19 @@
 #include <string>
 #include <algorithm>
 #include <functional>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if !(defined(_WIN32) || defined(__WIN32__))
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChObject.h"
@@ -36,14 +49,285 @@ using namespace std;
 namespace chrono {
 namespace fea {
 
-void ChMeshFileLoader::FromTetGenFile(std::shared_ptr<ChMesh> mesh,
-                                      const char* filename_node,
-                                      const char* filename_ele,
-                                      std::shared_ptr<ChContinuumMaterial> my_material,
-                                      ChVector<> pos_transform,
-                                      ChMatrix33<> rot_transform) {
+// -----------------------------------------------------------------------------
+// Raw mesh data and binary mesh cache
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Mesh data as parsed from a text mesh file, in the coordinates (and with the node numbering) of the source file.
+// All supported formats describe elements with 4 nodes (tetrahedrons or quadrilaterals).
+struct MeshFileData {
+    std::vector<double> nodes;                ///< node coordinates (3 per node)
+    std::vector<int> elements;                ///< element connectivity (4 1-based node IDs per element)
+    std::vector<int> element_tags;            ///< element material tags (one per element)
+    std::vector<std::vector<int>> node_sets;  ///< node sets (1-based node IDs)
+    std::vector<int> boundary_edges;          ///< boundary edges (2 1-based node IDs and a tag per edge)
+
+    int GetNumNodes() const { return (int)(nodes.size() / 3); }
+    int GetNumElements() const { return (int)(elements.size() / 4); }
+
+    // Check that all node references are in range.
+    bool CheckConnectivity() const {
+        int nnodes = GetNumNodes();
+        for (auto id : elements)
+            if (id < 1 || id > nnodes)
+                return false;
+        for (const auto& set : node_sets)
+            for (auto id : set)
+                if (id < 1 || id > nnodes)
+                    return false;
+        return true;
+    }
+};
+
+enum class MeshFileType : uint32_t { TETGEN = 1, ABAQUS = 2, GMF = 3 };
+
+const uint32_t cache_magic = 0x434d4843;  // "CHMC"
+const uint32_t cache_version = 1;
+
+bool cache_enabled = false;
+std::string cache_directory;
+
+// Identification of a source file, used to invalidate a cache file when the source changes.
+struct SourceStamp {
+    std::string name;
+    int64_t size;
+    int64_t mtime;
+};
+
+// Read-only view of a cache file. The file is memory-mapped where supported, otherwise read in a single block.
+class MappedFile {
+  public:
+    MappedFile(const std::string& filename) : m_data(nullptr), m_size(0) {
+#if defined(_WIN32) || defined(__WIN32__)
+        std::ifstream fin(filename, std::ios::binary | std::ios::ate);
+        if (!fin.good())
+            return;
+        m_buffer.resize((size_t)fin.tellg());
+        fin.seekg(0);
+        if (m_buffer.empty() || !fin.read(m_buffer.data(), m_buffer.size()))
+            return;
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+#else
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* addr = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                m_data = static_cast<const char*>(addr);
+                m_size = (size_t)st.st_size;
+            }
+        }
+        close(fd);
+#endif
+    }
+
+    ~MappedFile() {
+#if !(defined(_WIN32) || defined(__WIN32__))
+        if (m_data)
+            munmap(const_cast<char*>(m_data), m_size);
+#endif
+    }
+
+    const char* GetData() const { return m_data; }
+    size_t GetSize() const { return m_size; }
+
+  private:
+    const char* m_data;
+    size_t m_size;
+#if defined(_WIN32) || defined(__WIN32__)
+    std::vector<char> m_buffer;
+#endif
+};
+
+// Bounds-checked sequential reader over a memory block.
+class CacheReader {
+  public:
+    CacheReader(const char* data, size_t size) : m_data(data), m_size(size), m_pos(0), m_ok(data != nullptr) {}
+
+    bool IsOk() const { return m_ok; }
+    bool AtEnd() const { return m_pos == m_size; }
+
+    template <typename T>
+    T Read() {
+        T val = T();
+        ReadArray(&val, 1);
+        return val;
+    }
+
+    template <typename T>
+    void ReadArray(T* dest, size_t n) {
+        if (!m_ok || n > (m_size - m_pos) / sizeof(T)) {
+            m_ok = false;
+            return;
+        }
+        if (n > 0)
+            std::memcpy(dest, m_data + m_pos, n * sizeof(T));
+        m_pos += n * sizeof(T);
+    }
+
+    template <typename T>
+    void ReadVector(std::vector<T>& v) {
+        uint64_t n = Read<uint64_t>();
+        if (!m_ok || n > (m_size - m_pos) / sizeof(T)) {
+            m_ok = false;
+            return;
+        }
+        v.resize((size_t)n);
+        ReadArray(v.data(), (size_t)n);
+    }
+
+  private:
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos;
+    bool m_ok;
+};
+
+template <typename T>
+void WriteValue(std::ofstream& fout, const T& val) {
+    fout.write(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+
+template <typename T>
+void WriteVector(std::ofstream& fout, const std::vector<T>& v) {
+    WriteValue(fout, (uint64_t)v.size());
+    if (!v.empty())
+        fout.write(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+}
+
+// Binary cache for the data parsed from a given set of source mesh files.
+class MeshFileCache {
+  public:
+    MeshFileCache(MeshFileType type, const std::vector<const char*>& sources) : m_type(type), m_active(false) {
+        if (!cache_enabled)
+            return;
+        for (auto source : sources) {
+            struct stat st;
+            if (stat(source, &st) != 0)
+                return;
+            SourceStamp stamp;
+            stamp.name = source;
+            stamp.size = (int64_t)st.st_size;
+            stamp.mtime = (int64_t)st.st_mtime;
+            m_stamps.push_back(stamp);
+        }
+
+        // By default, the cache file is placed next to the first source file.
+        std::string first(sources[0]);
+        if (cache_directory.empty()) {
+            m_filename = first + ".chcache";
+        } else {
+            std::string::size_type sep = first.find_last_of("/\\");
+            std::string base = (sep == std::string::npos) ? first : first.substr(sep + 1);
+            std::stringstream ss;
+            ss << cache_directory << "/" << base << "." << std::hex << std::hash<std::string>()(first) << ".chcache";
+            m_filename = ss.str();
+        }
+
+        m_active = true;
+    }
+
+    // Load the mesh data from the cache file.
+    // Return false if caching is disabled, or if the cache file is missing, invalid, or out of date.
+    bool Load(MeshFileData& data) const {
+        if (!m_active)
+            return false;
+
+        MappedFile file(m_filename);
+        CacheReader reader(file.GetData(), file.GetSize());
+
+        if (reader.Read<uint32_t>() != cache_magic || reader.Read<uint32_t>() != cache_version ||
+            reader.Read<uint32_t>() != (uint32_t)m_type || reader.Read<uint32_t>() != (uint32_t)m_stamps.size())
+            return false;
+        for (const auto& stamp : m_stamps) {
+            std::vector<char> name;
+            reader.ReadVector(name);
+            if (std::string(name.begin(), name.end()) != stamp.name || reader.Read<int64_t>() != stamp.size ||
+                reader.Read<int64_t>() != stamp.mtime)
+                return false;
+        }
+
+        reader.ReadVector(data.nodes);
+        reader.ReadVector(data.elements);
+        reader.ReadVector(data.element_tags);
+        data.node_sets.resize((size_t)std::min<uint64_t>(reader.Read<uint64_t>(), file.GetSize()));
+        for (auto& set : data.node_sets)
+            reader.ReadVector(set);
+        reader.ReadVector(data.boundary_edges);
+
+        bool ok = reader.IsOk() && reader.Read<uint32_t>() == cache_magic && reader.AtEnd() &&
+                  data.nodes.size() % 3 == 0 && data.elements.size() % 4 == 0 &&
+                  data.element_tags.size() == data.elements.size() / 4 && data.boundary_edges.size() % 3 == 0 &&
+                  data.CheckConnectivity();
+        if (!ok)
+            data = MeshFileData();
+        return ok;
+    }
+
+    // Save the mesh data to the cache file.
+    // The file is first written under a temporary name and then renamed, so that concurrent readers never see a
+    // partially written cache. Failure to write the cache is not an error.
+    void Save(const MeshFileData& data) const {
+        if (!m_active)
+            return;
+
+        std::random_device rd;
+        std::string tmp_filename = m_filename + ".tmp" + std::to_string(rd());
+
+        {
+            std::ofstream fout(tmp_filename, std::ios::binary);
+            if (!fout.good())
+                return;
+
+            WriteValue(fout, cache_magic);
+            WriteValue(fout, cache_version);
+            WriteValue(fout, (uint32_t)m_type);
+            WriteValue(fout, (uint32_t)m_stamps.size());
+            for (const auto& stamp : m_stamps) {
+                WriteVector(fout, std::vector<char>(stamp.name.begin(), stamp.name.end()));
+                WriteValue(fout, stamp.size);
+                WriteValue(fout, stamp.mtime);
+            }
+
+            WriteVector(fout, data.nodes);
+            WriteVector(fout, data.elements);
+            WriteVector(fout, data.element_tags);
+            WriteValue(fout, (uint64_t)data.node_sets.size());
+            for (const auto& set : data.node_sets)
+                WriteVector(fout, set);
+            WriteVector(fout, data.boundary_edges);
+            WriteValue(fout, cache_magic);
+
+            if (!fout.good()) {
+                fout.close();
+                std::remove(tmp_filename.c_str());
+                return;
+            }
+        }
+
+        std::remove(m_filename.c_str());
+        if (std::rename(tmp_filename.c_str(), m_filename.c_str()) != 0)
+            std::remove(tmp_filename.c_str());
+    }
+
+  private:
+    MeshFileType m_type;
+    std::vector<SourceStamp> m_stamps;
+    std::string m_filename;
+    bool m_active;
+};
+
+// -----------------------------------------------------------------------------
+// Text file parsers
+// -----------------------------------------------------------------------------
+
+void ParseTetGenFile(const char* filename_node, const char* filename_ele, MeshFileData& data) {
     int totnodes = 0;
-    int nodes_offset = mesh->GetNnodes();
     int added_nodes = 0;
 
     // Load .node TetGen file
@@ -81,6 +365,7 @@ void ChMeshFileLoader::FromTetGenFile(std::shared_ptr<ChMesh> mesh,
                 parse_header = false;
                 parse_nodes = true;
                 totnodes = nnodes;
+                data.nodes.reserve(3 * nnodes);
                 continue;
             }
 
@@ -101,18 +386,9 @@ void ChMeshFileLoader::FromTetGenFile(std::shared_ptr<ChMesh> mesh,
                     throw ChException("ERROR in TetGen .node file, in parsing x,y,z coordinates of node: \n" + line +
                                       "\n");
 
-                ChVector<> node_position(x, y, z);
-                node_position = rot_transform * node_position;  // rotate/scale, if needed
-                node_position = pos_transform + node_position;  // move, if needed
-
-                if (std::dynamic_pointer_cast<ChContinuumElastic>(my_material)) {
-                    auto mnode = std::make_shared<ChNodeFEAxyz>(node_position);
-                    mesh->AddNode(mnode);
-                } else if (std::dynamic_pointer_cast<ChContinuumPoisson3D>(my_material)) {
-                    auto mnode = std::make_shared<ChNodeFEAxyzP>(node_position);
-                    mesh->AddNode(mnode);
-                } else
-                    throw ChException("ERROR in TetGen generation. Material type not supported. \n");
+                data.nodes.push_back(x);
+                data.nodes.push_back(y);
+                data.nodes.push_back(z);
             }
 
         }  // end while
@@ -126,7 +402,7 @@ void ChMeshFileLoader::FromTetGenFile(std::shared_ptr<ChMesh> mesh,
 
         ifstream fin(filename_ele);
         if (!fin.good())
-            throw ChException("ERROR opening TetGen .node file: " + std::string(filename_node) + "\n");
+            throw ChException("ERROR opening TetGen .ele file: " + std::string(filename_ele) + "\n");
 
         int ntets, nnodespertet, nattrs = 0;
 
@@ -148,63 +424,43 @@ void ChMeshFileLoader::FromTetGenFile(std::shared_ptr<ChMesh> mesh,
                     throw ChException("ERROR in TetGen .ele file. Only tets with 0 attrs supported: \n" + line + "\n");
                 parse_header = false;
                 parse_tet = true;
+                data.elements.reserve(4 * ntets);
+                data.element_tags.reserve(ntets);
                 continue;
             }
 
             int idtet = 0;
-            int n1, n2, n3, n4;
+            int n1 = 0, n2 = 0, n3 = 0, n4 = 0;
 
             if (parse_tet) {
                 stringstream(line) >> idtet >> n1 >> n2 >> n3 >> n4;
                 if (idtet <= 0 || idtet > ntets)
                     throw ChException("ERROR in TetGen .node file. Tetrahedron ID not in range: \n" + line + "\n");
-                if (n1 > totnodes)
+                if (n1 < 1 || n1 > totnodes)
                     throw ChException("ERROR in TetGen .node file, ID of 1st node is out of range: \n" + line + "\n");
-                if (n2 > totnodes)
+                if (n2 < 1 || n2 > totnodes)
                     throw ChException("ERROR in TetGen .node file, ID of 2nd node is out of range: \n" + line + "\n");
-                if (n3 > totnodes)
+                if (n3 < 1 || n3 > totnodes)
                     throw ChException("ERROR in TetGen .node file, ID of 3rd node is out of range: \n" + line + "\n");
-                if (n4 > totnodes)
+                if (n4 < 1 || n4 > totnodes)
                     throw ChException("ERROR in TetGen .node file, ID of 4th node is out of range: \n" + line + "\n");
-                if (std::dynamic_pointer_cast<ChContinuumElastic>(my_material)) {
-                    auto mel = std::make_shared<ChElementTetra_4>();
-                    mel->SetNodes(std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh->GetNode(nodes_offset + n1 - 1)),
-                                  std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh->GetNode(nodes_offset + n3 - 1)),
-                                  std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh->GetNode(nodes_offset + n2 - 1)),
-                                  std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh->GetNode(nodes_offset + n4 - 1)));
-                    mel->SetMaterial(std::static_pointer_cast<ChContinuumElastic>(my_material));
-                    mesh->AddElement(mel);
-                } else if (std::dynamic_pointer_cast<ChContinuumPoisson3D>(my_material)) {
-                    auto mel = std::make_shared<ChElementTetra_4_P>();
-                    mel->SetNodes(std::dynamic_pointer_cast<ChNodeFEAxyzP>(mesh->GetNode(nodes_offset + n1 - 1)),
-                                  std::dynamic_pointer_cast<ChNodeFEAxyzP>(mesh->GetNode(nodes_offset + n3 - 1)),
-                                  std::dynamic_pointer_cast<ChNodeFEAxyzP>(mesh->GetNode(nodes_offset + n2 - 1)),
-                                  std::dynamic_pointer_cast<ChNodeFEAxyzP>(mesh->GetNode(nodes_offset + n4 - 1)));
-                    mel->SetMaterial(std::static_pointer_cast<ChContinuumPoisson3D>(my_material));
-                    mesh->AddElement(mel);
-                } else
-                    throw ChException("ERROR in TetGen generation. Material type not supported. \n");
+
+                data.elements.push_back(n1);
+                data.elements.push_back(n2);
+                data.elements.push_back(n3);
+                data.elements.push_back(n4);
+                data.element_tags.push_back(0);
             }
 
         }  // end while
 
     }  // end .ele file
-}
 
-void ChMeshFileLoader::FromAbaqusFile(std::shared_ptr<ChMesh> mesh,
-                                      const char* filename,
-                                      std::shared_ptr<ChContinuumMaterial> my_material,
-                                      std::vector<std::vector<std::shared_ptr<ChNodeFEAbase>>>& node_sets,
-                                      ChVector<> pos_transform,
-                                      ChMatrix33<> rot_transform,
-                                      bool discard_unused_nodes) {
-    node_sets.resize(0);
-
-    std::vector<std::shared_ptr<ChNodeFEAbase>> parsed_nodes;
-    std::vector<bool> parsed_nodes_used;
+    if (!data.CheckConnectivity())
+        throw ChException("ERROR in TetGen .ele file, node ID out of range: " + std::string(filename_ele) + "\n");
+}
 
-    int totnodes = 0;
-    unsigned int nodes_offset = mesh->GetNnodes();
+void ParseAbaqusFile(const char* filename, MeshFileData& data) {
     int added_nodes = 0;
     int added_elements = 0;
 
@@ -220,10 +476,6 @@ void ChMeshFileLoader::FromAbaqusFile(std::shared_ptr<ChMesh> mesh,
     if (!fin.good())
         throw ChException("ERROR opening Abaqus .inp file: " + std::string(filename) + "\n");
 
-    int nnodes = 0;
-    int ndims = 0;
-    int nattrs = 0;
-
     string line;
     while (getline(fin, line)) {
         // trims white space from the beginning of the string
@@ -277,8 +529,7 @@ void ChMeshFileLoader::FromAbaqusFile(std::shared_ptr<ChMesh> mesh,
                     string s_node_set = line.substr(nse + 5, ncom - (nse + 5));
                     GetLog() << "Parsing: nodeset: " << s_node_set << "\n";
 
-                    std::vector<std::shared_ptr<ChNodeFEAbase>> empty_set;
-                    node_sets.push_back(empty_set);
+                    data.node_sets.push_back(std::vector<int>());
                 }
                 e_parse_section = E_PARSE_NODESET;
             }
@@ -315,20 +566,9 @@ void ChMeshFileLoader::FromAbaqusFile(std::shared_ptr<ChMesh> mesh,
             if (x == -10e30 || y == -10e30 || z == -10e30)
                 throw ChException("ERROR in in .inp file, in parsing x,y,z coordinates of node: \n" + line + "\n");
 
-            ChVector<> node_position(x, y, z);
-            node_position = rot_transform * node_position;  // rotate/scale, if needed
-            node_position = pos_transform + node_position;  // move, if needed
-
-            if (std::dynamic_pointer_cast<ChContinuumElastic>(my_material)) {
-                auto mnode = std::make_shared<ChNodeFEAxyz>(node_position);
-                parsed_nodes.push_back(mnode);
-                parsed_nodes_used.push_back(false);
-            } else if (std::dynamic_pointer_cast<ChContinuumPoisson3D>(my_material)) {
-                auto mnode = std::make_shared<ChNodeFEAxyzP>(ChVector<>(x, y, z));
-                parsed_nodes.push_back(mnode);
-                parsed_nodes_used.push_back(false);
-            } else
-                throw ChException("ERROR in .inp generation. Material type not supported. \n");
+            data.nodes.push_back(x);
+            data.nodes.push_back(y);
+            data.nodes.push_back(z);
         }
 
         if (e_parse_section == E_PARSE_TETS_10 || e_parse_section == E_PARSE_TETS_4) {
@@ -344,60 +584,21 @@ void ChMeshFileLoader::FromAbaqusFile(std::shared_ptr<ChMesh> mesh,
                 ++ntoken;
             }
             ++added_elements;
-            if (e_parse_section == E_PARSE_TETS_10) {
-                if (ntoken != 11)
-                    throw ChException("ERROR in .inp file, tetrahedrons require ID and 10 node IDs, see line:\n" + line +
-                                      "\n");
-                idelem = (int)tokenvals[0];
-                if (idelem != added_elements)
-                    throw ChException("ERROR in .inp file. Element IDs must be sequential (1 2 3 ..): \n" + line +
-                                      "\n");
-                for (int in = 0; in < 10; ++in)
-                    if (tokenvals[in + 1] == -10e30)
-                        throw ChException("ERROR in in .inp file, in parsing IDs of tetrahedron: \n" + line + "\n");
-            } else if (e_parse_section == E_PARSE_TETS_4) {
-                if (ntoken != 5)
-                    throw ChException("ERROR in .inp file, tetrahedrons require ID and 10 node IDs, see line:\n" + line +
-                                      "\n");
-                idelem = (int)tokenvals[0];
-                if (idelem != added_elements)
-                    throw ChException("ERROR in .inp file. Element IDs must be sequential (1 2 3 ..): \n" + line +
-                                      "\n");
-                for (int in = 0; in < 4; ++in)
-                    if (tokenvals[in + 1] == -10e30)
-                        throw ChException("ERROR in in .inp file, in parsing IDs of tetrahedron: \n" + line + "\n");
-            }
-            if (std::dynamic_pointer_cast<ChContinuumElastic>(my_material)) {
-                auto mel = std::make_shared<ChElementTetra_4>();
-                mel->SetNodes(std::static_pointer_cast<ChNodeFEAxyz>(parsed_nodes[tokenvals[4] - 1]),
-                              std::static_pointer_cast<ChNodeFEAxyz>(parsed_nodes[tokenvals[2] - 1]),
-                              std::static_pointer_cast<ChNodeFEAxyz>(parsed_nodes[tokenvals[3] - 1]),
-                              std::static_pointer_cast<ChNodeFEAxyz>(parsed_nodes[tokenvals[1] - 1]));
-                mel->SetMaterial(std::static_pointer_cast<ChContinuumElastic>(my_material));
-                mesh->AddElement(mel);
-                parsed_nodes_used[tokenvals[1] - 1] = true;
-                parsed_nodes_used[tokenvals[2] - 1] = true;
-                parsed_nodes_used[tokenvals[3] - 1] = true;
-                parsed_nodes_used[tokenvals[4] - 1] = true;
-            } else if (std::dynamic_pointer_cast<ChContinuumPoisson3D>(my_material)) {
-                auto mel = std::make_shared<ChElementTetra_4_P>();
-                mel->SetNodes(std::static_pointer_cast<ChNodeFEAxyzP>(parsed_nodes[tokenvals[1] - 1]),
-                              std::static_pointer_cast<ChNodeFEAxyzP>(parsed_nodes[tokenvals[2] - 1]),
-                              std::static_pointer_cast<ChNodeFEAxyzP>(parsed_nodes[tokenvals[3] - 1]),
-                              std::static_pointer_cast<ChNodeFEAxyzP>(parsed_nodes[tokenvals[4] - 1]));
-                mel->SetMaterial(std::static_pointer_cast<ChContinuumPoisson3D>(my_material));
-                mesh->AddElement(mel);
-                parsed_nodes_used[tokenvals[1] - 1] = true;
-                parsed_nodes_used[tokenvals[2] - 1] = true;
-                parsed_nodes_used[tokenvals[3] - 1] = true;
-                parsed_nodes_used[tokenvals[4] - 1] = true;
-            } else
-                throw ChException("ERROR in TetGen generation. Material type not supported. \n");
+            int nnodes_elem = (e_parse_section == E_PARSE_TETS_10) ? 10 : 4;
+            if (ntoken != nnodes_elem + 1)
+                throw ChException("ERROR in .inp file, tetrahedrons require ID and " + std::to_string(nnodes_elem) +
+                                  " node IDs, see line:\n" + line + "\n");
+            idelem = (int)tokenvals[0];
+            if (idelem != added_elements)
+                throw ChException("ERROR in .inp file. Element IDs must be sequential (1 2 3 ..): \n" + line + "\n");
+
+            // Only the corner nodes are used (midside nodes of 10-node tetrahedrons are discarded).
+            for (int in = 0; in < 4; ++in)
+                data.elements.push_back((int)tokenvals[in + 1]);
+            data.element_tags.push_back(0);
         }
 
         if (e_parse_section == E_PARSE_NODESET) {
-            int idelem = 0;
-
             unsigned int tokenvals[100];
             int ntoken = 0;
 
@@ -411,50 +612,20 @@ void ChMeshFileLoader::FromAbaqusFile(std::shared_ptr<ChMesh> mesh,
 
             for (int nt = 0; nt < ntoken; ++nt) {
                 int idnode = (int)tokenvals[nt];
-                if (idnode > 0) {
-                    node_sets.back().push_back(std::dynamic_pointer_cast<ChNodeFEAbase>(parsed_nodes[idnode - 1]));
-                    parsed_nodes_used[idnode - 1] = true;
-                }
+                if (idnode > 0)
+                    data.node_sets.back().push_back(idnode);
             }
         }
 
     }  // end while
 
-    // Add nodes to the mesh (only those effectively used for elements or node sets)
-    for (unsigned int i = 0; i < parsed_nodes.size(); ++i) {
-        if (parsed_nodes_used[i] == true)
-            mesh->AddNode(parsed_nodes[i]);
-    }
+    if (!data.CheckConnectivity())
+        throw ChException("ERROR in .inp file, node ID out of range in elements or node sets: " +
+                          std::string(filename) + "\n");
 }
 
-void ChMeshFileLoader::ANCFShellFromGMFFile(std::shared_ptr<ChMesh> mesh,
-                                            const char* filename,
-                                            std::shared_ptr<ChMaterialShellANCF> my_material,
-                                            std::vector<double>& node_ave_area,
-                                            std::vector<int>& Boundary_nodes,
-                                            ChVector<> pos_transform,
-                                            ChMatrix33<> rot_transform,
-                                            double scaleFactor,
-                                            bool printNodes,
-                                            bool printElements) {
-    int added_nodes = 0;
-    int added_elements = 0;
-    double dx, dy;
-    int nodes_offset = mesh->GetNnodes();
-    printf("Current number of nodes in mesh is %d \n", nodes_offset);
-    ChMatrixDynamic<double> nodesXYZ(1, 4);
-    ChMatrixDynamic<int> NumBEdges(1, 3);  // To store boundary nodes
-    ChMatrixNM<double, 1, 6> BoundingBox;  // (xmin xmax ymin ymax zmin zmax) bounding box of the mesh
-    std::vector<ChVector<>> Normals;       // To store the normal vectors
-    std::vector<int> num_Normals;
-    ChVector<double> pos1, pos2, pos3, pos4;                  // Position of nodes in each element
-    ChVector<double> vec1, vec2, vec3;                        // intermediate vectors for calculation of normals
-    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodesVector;  // To store intermediate nodes
-    std::vector<std::vector<int>> elementsVector;             // nodes of each element
-    std::vector<std::vector<double>> elementsdxdy;            // dx, dy of elements
-
+void ParseGMFFile(const char* filename, MeshFileData& data) {
     int TotalNumNodes, TotalNumElements, TottalNumBEdges;
-    BoundingBox.FillElem(0);
 
     ifstream fin(filename);
     if (!fin.good())
@@ -466,7 +637,7 @@ void ChMeshFileLoader::ANCFShellFromGMFFile(std::shared_ptr<ChMesh> mesh,
         line.erase(line.begin(), find_if(line.begin(), line.end(), not1(ptr_fun<int, int>(isspace))));
 
         if (line[0] == 0)
-            continue;  // skip empty linesnodes_offset
+            continue;  // skip empty lines
         if (line.find("Vertices") == 0) {
             getline(fin, line);
             TotalNumNodes = atoi(line.c_str());
@@ -474,55 +645,26 @@ void ChMeshFileLoader::ANCFShellFromGMFFile(std::shared_ptr<ChMesh> mesh,
             GetLog() << "Parsing information from \"Vertices\" \n";
             cout << "Reading nodal information ..." << endl;
             getline(fin, line);
-            Normals.resize(TotalNumNodes);
-            node_ave_area.resize(nodes_offset + TotalNumNodes);
-            num_Normals.resize(TotalNumNodes);
+            data.nodes.reserve(3 * TotalNumNodes);
             for (int inode = 0; inode < TotalNumNodes; inode++) {
-                double loc_x, loc_y, loc_z;
-                double dir_x, dir_y, dir_z;
-
+                double tokenvals[20];
                 int ntoken = 0;
                 string token;
                 std::istringstream ss(line);
                 while (std::getline(ss, token, ' ') && ntoken < 20) {
                     std::istringstream stoken(token);
-                    stoken >> nodesXYZ(0, ntoken);
-                    nodesXYZ(0, ntoken) *= scaleFactor;
+                    stoken >> tokenvals[ntoken];
                     ++ntoken;
                 }
 
-                loc_x = nodesXYZ(0, 0);
-                loc_y = nodesXYZ(0, 1);
-                loc_z = nodesXYZ(0, 2);
-                dir_x = 1.0;
-                dir_y = 1.0;
-                dir_z = 1.0;
-
-                ChVector<> node_position(loc_x, loc_y, loc_z);
-                node_position = rot_transform * node_position;  // rotate/scale, if needed
-                node_position = pos_transform + node_position;  // move, if needed
-                auto node = std::make_shared<ChNodeFEAxyzD>(node_position, ChVector<>(dir_x, dir_y, dir_z));
-                nodesVector.push_back(node);
-
-                if (loc_x < BoundingBox(0, 0) || added_nodes == 0)
-                    BoundingBox(0, 0) = loc_x;
-                if (loc_x > BoundingBox(0, 1) || added_nodes == 0)
-                    BoundingBox(0, 1) = loc_x;
-                if (loc_y < BoundingBox(0, 2) || added_nodes == 0)
-                    BoundingBox(0, 2) = loc_y;
-                if (loc_y > BoundingBox(0, 3) || added_nodes == 0)
-                    BoundingBox(0, 3) = loc_y;
-
-                if (loc_z < BoundingBox(0, 4) || added_nodes == 0)
-                    BoundingBox(0, 4) = loc_z;
-                if (loc_z > BoundingBox(0, 5) || added_nodes == 0)
-                    BoundingBox(0, 5) = loc_z;
-                ++added_nodes;
-
                 if (ntoken != 4)
                     throw ChException("ERROR in .mesh file, Quadrilaterals require 4 node IDs, see line:\n" + line +
                                       "\n");
 
+                data.nodes.push_back(tokenvals[0]);
+                data.nodes.push_back(tokenvals[1]);
+                data.nodes.push_back(tokenvals[2]);
+
                 getline(fin, line);
             }
         }
@@ -536,18 +678,21 @@ void ChMeshFileLoader::ANCFShellFromGMFFile(std::shared_ptr<ChMesh> mesh,
             getline(fin, line);
 
             for (int edge = 0; edge < TottalNumBEdges; edge++) {
+                int tokenvals[20];
                 int ntoken = 0;
                 string token;
                 std::istringstream ss(line);
                 while (std::getline(ss, token, ' ') && ntoken < 20) {
                     std::istringstream stoken(token);
-                    stoken >> NumBEdges(0, ntoken);
+                    stoken >> tokenvals[ntoken];
                     ++ntoken;
                 }
 
                 if (ntoken != 3)
                     throw ChException("ERROR in .mesh file, Edges require 3 node IDs, see line:\n" + line + "\n");
 
+                data.boundary_edges.insert(data.boundary_edges.end(), tokenvals, tokenvals + 3);
+
                 getline(fin, line);
             }
         }
@@ -561,67 +706,282 @@ void ChMeshFileLoader::ANCFShellFromGMFFile(std::shared_ptr<ChMesh> mesh,
             GetLog() << "Parsing nodeset from \"Quadrilaterals\" \n";
             getline(fin, line);
             cout << "Reading elemental information ..." << endl;
+            data.elements.reserve(4 * TotalNumElements);
+            data.element_tags.reserve(TotalNumElements);
 
             for (int ele = 0; ele < TotalNumElements; ele++) {
+                int tokenvals[20];
                 int ntoken = 0;
                 string token;
                 std::istringstream ss(line);
-                elementsVector.resize(ele + 1);
-                elementsVector[ele].resize(5);
-                elementsdxdy.resize(ele + 1);
-                elementsdxdy[ele].resize(2);
                 while (std::getline(ss, token, ' ') && ntoken < 20) {
                     std::istringstream stoken(token);
-                    stoken >> elementsVector[ele][ntoken];
+                    stoken >> tokenvals[ntoken];
                     ++ntoken;
                 }
 
-                // Calculating the true surface normals based on the nodal information
-                pos1 = nodesVector[elementsVector[ele][0] - 1]->GetPos();
-                pos2 = nodesVector[elementsVector[ele][1] - 1]->GetPos();
-                pos4 = nodesVector[elementsVector[ele][2] - 1]->GetPos();
-                pos3 = nodesVector[elementsVector[ele][3] - 1]->GetPos();
-
-                // For the first node
-                vec1 = (pos1 - pos2);
-                vec2 = (pos1 - pos3);
-                Normals[elementsVector[ele][0] - 1] += vec1 % vec2;
-                num_Normals[elementsVector[ele][0] - 1]++;
-                // For the second node
-                vec1 = (pos2 - pos4);
-                vec2 = (pos2 - pos1);
-                Normals[elementsVector[ele][1] - 1] += vec1 % vec2;
-                num_Normals[elementsVector[ele][1] - 1]++;
-                // For the third node
-                vec1 = (pos3 - pos1);
-                vec2 = (pos3 - pos4);
-                Normals[elementsVector[ele][2] - 1] += vec1 % vec2;
-                num_Normals[elementsVector[ele][2] - 1]++;
-                // For the forth node
-                vec1 = (pos4 - pos3);
-                vec2 = (pos4 - pos2);
-                Normals[elementsVector[ele][3] - 1] += vec1 % vec2;
-                num_Normals[elementsVector[ele][3] - 1]++;
-
-                vec1 = pos1 - pos2;
-                vec2 = pos3 - pos4;
-                dx = (vec1.Length() + vec2.Length()) / 2;
-                vec1 = pos1 - pos3;
-                vec2 = pos2 - pos4;
-                dy = (vec1.Length() + vec2.Length()) / 2;
-
-                // Set element dimensions
-                elementsdxdy[ele][0] = dx;
-                elementsdxdy[ele][1] = dy;
-                ++added_elements;
                 if (ntoken != 5)
                     throw ChException("ERROR in .mesh file, Quadrilaterals require 4 node IDs, see line:\n" + line +
                                       "\n");
+
+                data.elements.insert(data.elements.end(), tokenvals, tokenvals + 4);
+                data.element_tags.push_back(tokenvals[4]);
+
                 getline(fin, line);
             }
         }
     }
 
+    if (!data.CheckConnectivity())
+        throw ChException("ERROR in .mesh file, node ID out of range in Quadrilaterals: " + std::string(filename) +
+                          "\n");
+}
+
+}  // end anonymous namespace
+
+// -----------------------------------------------------------------------------
+
+void ChMeshFileLoader::SetBinaryCache(bool enable, const std::string& directory) {
+    cache_enabled = enable;
+    cache_directory = directory;
+}
+
+bool ChMeshFileLoader::IsBinaryCacheEnabled() {
+    return cache_enabled;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChMeshFileLoader::FromTetGenFile(std::shared_ptr<ChMesh> mesh,
+                                      const char* filename_node,
+                                      const char* filename_ele,
+                                      std::shared_ptr<ChContinuumMaterial> my_material,
+                                      ChVector<> pos_transform,
+                                      ChMatrix33<> rot_transform) {
+    MeshFileData data;
+    MeshFileCache cache(MeshFileType::TETGEN, {filename_node, filename_ele});
+    if (!cache.Load(data)) {
+        ParseTetGenFile(filename_node, filename_ele, data);
+        cache.Save(data);
+    }
+
+    bool elastic = (std::dynamic_pointer_cast<ChContinuumElastic>(my_material) != nullptr);
+    bool poisson = (std::dynamic_pointer_cast<ChContinuumPoisson3D>(my_material) != nullptr);
+    if (!elastic && !poisson)
+        throw ChException("ERROR in TetGen generation. Material type not supported. \n");
+
+    int nodes_offset = mesh->GetNnodes();
+
+    for (int in = 0; in < data.GetNumNodes(); ++in) {
+        ChVector<> node_position(data.nodes[3 * in + 0], data.nodes[3 * in + 1], data.nodes[3 * in + 2]);
+        node_position = rot_transform * node_position;  // rotate/scale, if needed
+        node_position = pos_transform + node_position;  // move, if needed
+
+        if (elastic)
+            mesh->AddNode(std::make_shared<ChNodeFEAxyz>(node_position));
+        else
+            mesh->AddNode(std::make_shared<ChNodeFEAxyzP>(node_position));
+    }
+
+    for (int ie = 0; ie < data.GetNumElements(); ++ie) {
+        const int* n = &data.elements[4 * ie];
+        if (elastic) {
+            auto mel = std::make_shared<ChElementTetra_4>();
+            mel->SetNodes(std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh->GetNode(nodes_offset + n[0] - 1)),
+                          std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh->GetNode(nodes_offset + n[2] - 1)),
+                          std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh->GetNode(nodes_offset + n[1] - 1)),
+                          std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh->GetNode(nodes_offset + n[3] - 1)));
+            mel->SetMaterial(std::static_pointer_cast<ChContinuumElastic>(my_material));
+            mesh->AddElement(mel);
+        } else {
+            auto mel = std::make_shared<ChElementTetra_4_P>();
+            mel->SetNodes(std::dynamic_pointer_cast<ChNodeFEAxyzP>(mesh->GetNode(nodes_offset + n[0] - 1)),
+                          std::dynamic_pointer_cast<ChNodeFEAxyzP>(mesh->GetNode(nodes_offset + n[2] - 1)),
+                          std::dynamic_pointer_cast<ChNodeFEAxyzP>(mesh->GetNode(nodes_offset + n[1] - 1)),
+                          std::dynamic_pointer_cast<ChNodeFEAxyzP>(mesh->GetNode(nodes_offset + n[3] - 1)));
+            mel->SetMaterial(std::static_pointer_cast<ChContinuumPoisson3D>(my_material));
+            mesh->AddElement(mel);
+        }
+    }
+}
+
+void ChMeshFileLoader::FromAbaqusFile(std::shared_ptr<ChMesh> mesh,
+                                      const char* filename,
+                                      std::shared_ptr<ChContinuumMaterial> my_material,
+                                      std::vector<std::vector<std::shared_ptr<ChNodeFEAbase>>>& node_sets,
+                                      ChVector<> pos_transform,
+                                      ChMatrix33<> rot_transform,
+                                      bool discard_unused_nodes) {
+    MeshFileData data;
+    MeshFileCache cache(MeshFileType::ABAQUS, {filename});
+    if (!cache.Load(data)) {
+        ParseAbaqusFile(filename, data);
+        cache.Save(data);
+    }
+
+    bool elastic = (std::dynamic_pointer_cast<ChContinuumElastic>(my_material) != nullptr);
+    bool poisson = (std::dynamic_pointer_cast<ChContinuumPoisson3D>(my_material) != nullptr);
+    if (!elastic && !poisson)
+        throw ChException("ERROR in .inp generation. Material type not supported. \n");
+
+    std::vector<std::shared_ptr<ChNodeFEAbase>> parsed_nodes;
+    std::vector<bool> parsed_nodes_used(data.GetNumNodes(), false);
+    parsed_nodes.reserve(data.GetNumNodes());
+
+    for (int in = 0; in < data.GetNumNodes(); ++in) {
+        ChVector<> node_position(data.nodes[3 * in + 0], data.nodes[3 * in + 1], data.nodes[3 * in + 2]);
+        if (elastic) {
+            node_position = rot_transform * node_position;  // rotate/scale, if needed
+            node_position = pos_transform + node_position;  // move, if needed
+            parsed_nodes.push_back(std::make_shared<ChNodeFEAxyz>(node_position));
+        } else {
+            parsed_nodes.push_back(std::make_shared<ChNodeFEAxyzP>(node_position));
+        }
+    }
+
+    for (int ie = 0; ie < data.GetNumElements(); ++ie) {
+        const int* n = &data.elements[4 * ie];
+        if (elastic) {
+            auto mel = std::make_shared<ChElementTetra_4>();
+            mel->SetNodes(std::static_pointer_cast<ChNodeFEAxyz>(parsed_nodes[n[3] - 1]),
+                          std::static_pointer_cast<ChNodeFEAxyz>(parsed_nodes[n[1] - 1]),
+                          std::static_pointer_cast<ChNodeFEAxyz>(parsed_nodes[n[2] - 1]),
+                          std::static_pointer_cast<ChNodeFEAxyz>(parsed_nodes[n[0] - 1]));
+            mel->SetMaterial(std::static_pointer_cast<ChContinuumElastic>(my_material));
+            mesh->AddElement(mel);
+        } else {
+            auto mel = std::make_shared<ChElementTetra_4_P>();
+            mel->SetNodes(std::static_pointer_cast<ChNodeFEAxyzP>(parsed_nodes[n[0] - 1]),
+                          std::static_pointer_cast<ChNodeFEAxyzP>(parsed_nodes[n[1] - 1]),
+                          std::static_pointer_cast<ChNodeFEAxyzP>(parsed_nodes[n[2] - 1]),
+                          std::static_pointer_cast<ChNodeFEAxyzP>(parsed_nodes[n[3] - 1]));
+            mel->SetMaterial(std::static_pointer_cast<ChContinuumPoisson3D>(my_material));
+            mesh->AddElement(mel);
+        }
+        for (int k = 0; k < 4; ++k)
+            parsed_nodes_used[n[k] - 1] = true;
+    }
+
+    node_sets.resize(0);
+    for (const auto& set : data.node_sets) {
+        node_sets.push_back(std::vector<std::shared_ptr<ChNodeFEAbase>>());
+        for (auto idnode : set) {
+            node_sets.back().push_back(parsed_nodes[idnode - 1]);
+            parsed_nodes_used[idnode - 1] = true;
+        }
+    }
+
+    // Add nodes to the mesh (only those effectively used for elements or node sets)
+    for (unsigned int i = 0; i < parsed_nodes.size(); ++i) {
+        if (parsed_nodes_used[i] == true)
+            mesh->AddNode(parsed_nodes[i]);
+    }
+}
+
+void ChMeshFileLoader::ANCFShellFromGMFFile(std::shared_ptr<ChMesh> mesh,
+                                            const char* filename,
+                                            std::shared_ptr<ChMaterialShellANCF> my_material,
+                                            std::vector<double>& node_ave_area,
+                                            std::vector<int>& Boundary_nodes,
+                                            ChVector<> pos_transform,
+                                            ChMatrix33<> rot_transform,
+                                            double scaleFactor,
+                                            bool printNodes,
+                                            bool printElements) {
+    MeshFileData data;
+    MeshFileCache cache(MeshFileType::GMF, {filename});
+    if (!cache.Load(data)) {
+        ParseGMFFile(filename, data);
+        cache.Save(data);
+    }
+
+    double dx, dy;
+    int nodes_offset = mesh->GetNnodes();
+    printf("Current number of nodes in mesh is %d \n", nodes_offset);
+    ChMatrixNM<double, 1, 6> BoundingBox;  // (xmin xmax ymin ymax zmin zmax) bounding box of the mesh
+    std::vector<ChVector<>> Normals;       // To store the normal vectors
+    std::vector<int> num_Normals;
+    ChVector<double> pos1, pos2, pos3, pos4;  // Position of nodes in each element
+    ChVector<double> vec1, vec2, vec3;        // intermediate vectors for calculation of normals
+    std::vector<ChVector<>> nodesVector;      // To store intermediate node positions
+
+    int TotalNumNodes = data.GetNumNodes();
+    int TotalNumElements = data.GetNumElements();
+    BoundingBox.FillElem(0);
+
+    Normals.resize(TotalNumNodes);
+    node_ave_area.resize(nodes_offset + TotalNumNodes);
+    num_Normals.resize(TotalNumNodes);
+    nodesVector.reserve(TotalNumNodes);
+
+    for (int inode = 0; inode < TotalNumNodes; inode++) {
+        double loc_x = data.nodes[3 * inode + 0] * scaleFactor;
+        double loc_y = data.nodes[3 * inode + 1] * scaleFactor;
+        double loc_z = data.nodes[3 * inode + 2] * scaleFactor;
+
+        ChVector<> node_position(loc_x, loc_y, loc_z);
+        node_position = rot_transform * node_position;  // rotate/scale, if needed
+        node_position = pos_transform + node_position;  // move, if needed
+        nodesVector.push_back(node_position);
+
+        if (loc_x < BoundingBox(0, 0) || inode == 0)
+            BoundingBox(0, 0) = loc_x;
+        if (loc_x > BoundingBox(0, 1) || inode == 0)
+            BoundingBox(0, 1) = loc_x;
+        if (loc_y < BoundingBox(0, 2) || inode == 0)
+            BoundingBox(0, 2) = loc_y;
+        if (loc_y > BoundingBox(0, 3) || inode == 0)
+            BoundingBox(0, 3) = loc_y;
+
+        if (loc_z < BoundingBox(0, 4) || inode == 0)
+            BoundingBox(0, 4) = loc_z;
+        if (loc_z > BoundingBox(0, 5) || inode == 0)
+            BoundingBox(0, 5) = loc_z;
+    }
+
+    std::vector<std::vector<double>> elementsdxdy(TotalNumElements, std::vector<double>(2));  // dx, dy of elements
+    for (int ele = 0; ele < TotalNumElements; ele++) {
+        const int* elementNodes = &data.elements[4 * ele];
+
+        // Calculating the true surface normals based on the nodal information
+        pos1 = nodesVector[elementNodes[0] - 1];
+        pos2 = nodesVector[elementNodes[1] - 1];
+        pos4 = nodesVector[elementNodes[2] - 1];
+        pos3 = nodesVector[elementNodes[3] - 1];
+
+        // For the first node
+        vec1 = (pos1 - pos2);
+        vec2 = (pos1 - pos3);
+        Normals[elementNodes[0] - 1] += vec1 % vec2;
+        num_Normals[elementNodes[0] - 1]++;
+        // For the second node
+        vec1 = (pos2 - pos4);
+        vec2 = (pos2 - pos1);
+        Normals[elementNodes[1] - 1] += vec1 % vec2;
+        num_Normals[elementNodes[1] - 1]++;
+        // For the third node
+        vec1 = (pos3 - pos1);
+        vec2 = (pos3 - pos4);
+        Normals[elementNodes[2] - 1] += vec1 % vec2;
+        num_Normals[elementNodes[2] - 1]++;
+        // For the forth node
+        vec1 = (pos4 - pos3);
+        vec2 = (pos4 - pos2);
+        Normals[elementNodes[3] - 1] += vec1 % vec2;
+        num_Normals[elementNodes[3] - 1]++;
+
+        vec1 = pos1 - pos2;
+        vec2 = pos3 - pos4;
+        dx = (vec1.Length() + vec2.Length()) / 2;
+        vec1 = pos1 - pos3;
+        vec2 = pos2 - pos4;
+        dy = (vec1.Length() + vec2.Length()) / 2;
+
+        // Set element dimensions
+        elementsdxdy[ele][0] = dx;
+        elementsdxdy[ele][1] = dy;
+    }
+
     printf("Mesh Bounding box is x [%f %f %f %f %f %f]\n", BoundingBox(0, 0), BoundingBox(0, 1), BoundingBox(0, 2),
            BoundingBox(0, 3), BoundingBox(0, 4), BoundingBox(0, 5));
 
@@ -636,7 +996,7 @@ void ChMeshFileLoader::ANCFShellFromGMFFile(std::shared_ptr<ChMesh> mesh,
             Boundary_nodes.push_back(nodes_offset + inode);
         node_normal.Normalize();
 
-        ChVector<> node_position = nodesVector[inode]->GetPos();
+        ChVector<> node_position = nodesVector[inode];
         auto node = std::make_shared<ChNodeFEAxyzD>(node_position, node_normal);
         node->SetMass(0);
         // Add node to mesh
@@ -647,12 +1007,12 @@ void ChMeshFileLoader::ANCFShellFromGMFFile(std::shared_ptr<ChMesh> mesh,
     }
     GetLog() << "-----------------------------------------------------------\n";
     for (int ielem = 0; ielem < 0 + TotalNumElements; ielem++) {
+        const int* elementNodes = &data.elements[4 * ielem];
         auto element = std::make_shared<ChElementShellANCF>();
-        element->SetNodes(
-            std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(nodes_offset + elementsVector[ielem][0] - 1)),
-            std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(nodes_offset + elementsVector[ielem][1] - 1)),
-            std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(nodes_offset + elementsVector[ielem][2] - 1)),
-            std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(nodes_offset + elementsVector[ielem][3] - 1)));
+        element->SetNodes(std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(nodes_offset + elementNodes[0] - 1)),
+                          std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(nodes_offset + elementNodes[1] - 1)),
+                          std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(nodes_offset + elementNodes[2] - 1)),
+                          std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(nodes_offset + elementNodes[3] - 1)));
         dx = elementsdxdy[ielem][0];
         dy = elementsdxdy[ielem][1];
         element->SetDimensions(dx, dy);
@@ -661,7 +1021,7 @@ void ChMeshFileLoader::ANCFShellFromGMFFile(std::shared_ptr<ChMesh> mesh,
         if (printElements) {
             cout << ielem << " ";
             for (int i = 0; i < 4; i++)
-                cout << elementsVector[ielem][i] << " ";
+                cout << elementNodes[i] << " ";
             cout << endl;
         }
     }
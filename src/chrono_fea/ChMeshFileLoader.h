@@ -29,6 +29,18 @@ namespace fea {
 /// Collection of mesh file loader utilities.
 class ChApiFea ChMeshFileLoader {
   public:
+    /// Enable or disable the binary mesh cache (default: disabled).
+    /// When enabled, the data parsed from a text mesh file (node coordinates, element connectivity and tags, node
+    /// sets, boundary edges) is saved in a compact binary file the first time that source is imported. Subsequent
+    /// imports of the same source memory-map the binary file instead of parsing the text file. A cache file is
+    /// automatically rebuilt if the size or modification time of any of its source files changes.
+    /// Cache files are placed in the specified directory or, if empty, next to the (first) source file, with the
+    /// extension ".chcache". The cached data does not depend on the material or the import transform.
+    static void SetBinaryCache(bool enable, const std::string& directory = "");
+
+    /// Return true if the binary mesh cache is enabled.
+    static bool IsBinaryCacheEnabled();
+
     /// Load tetrahedrons from .node and .ele files as saved by TetGen.
     /// The file format for .node (with point# starting from 1) is:
     ///   [# of points] [dimension (only 3)] [# of attributes (only 0)] [markers (only 0)]
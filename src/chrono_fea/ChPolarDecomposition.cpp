@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono_fea/ChPolarDecomposition.h"
 
 namespace chrono {
@@ -108,5 +110,61 @@ double PolarDecomposition::Compute(const double* M, double* Q, double* S, double
     return (det);
 }
 
+// Input: M (3x3 mtx)
+// Output: Q (3x3 rotation mtx)
+double PolarDecomposition::ComputeRotation(const double* M, double* Q, double tolerance) {
+    // Mk = M^T
+    double Mk[9] = {M[0], M[3], M[6], M[1], M[4], M[7], M[2], M[5], M[8]};
+
+    double M_oneNorm = oneNorm(Mk);
+    double M_infNorm = infNorm(Mk);
+    double E_oneNorm;
+    double det;
+
+    do {
+        // adjugate transpose: rows are the cross products of the rows of Mk
+        double MadjTk[9] = {Mk[4] * Mk[8] - Mk[5] * Mk[7], Mk[5] * Mk[6] - Mk[3] * Mk[8],
+                            Mk[3] * Mk[7] - Mk[4] * Mk[6], Mk[7] * Mk[2] - Mk[8] * Mk[1],
+                            Mk[8] * Mk[0] - Mk[6] * Mk[2], Mk[6] * Mk[1] - Mk[7] * Mk[0],
+                            Mk[1] * Mk[5] - Mk[2] * Mk[4], Mk[2] * Mk[3] - Mk[0] * Mk[5],
+                            Mk[0] * Mk[4] - Mk[1] * Mk[3]};
+
+        det = Mk[0] * MadjTk[0] + Mk[1] * MadjTk[1] + Mk[2] * MadjTk[2];
+        if (det == 0.0) {
+            printf("Warning (polarDecomposition) : zero determinant encountered.\n");
+            break;
+        }
+
+        double gamma = sqrt(sqrt((oneNorm(MadjTk) * infNorm(MadjTk)) / (M_oneNorm * M_infNorm)) / fabs(det));
+        double g1 = gamma * 0.5;
+        double g2 = 0.5 / (gamma * det);
+
+        // Ek = Mk_old - Mk_new, accumulated directly into its column sums for the one-norm
+        double Ecol[3] = {0, 0, 0};
+        for (int i = 0; i < 9; i++) {
+            double Mnew = g1 * Mk[i] + g2 * MadjTk[i];
+            Ecol[i % 3] += fabs(Mk[i] - Mnew);
+            Mk[i] = Mnew;
+        }
+
+        E_oneNorm = std::max(Ecol[0], std::max(Ecol[1], Ecol[2]));
+        M_oneNorm = oneNorm(Mk);
+        M_infNorm = infNorm(Mk);
+    } while (E_oneNorm > M_oneNorm * tolerance);
+
+    // Q = Mk^T
+    Q[0] = Mk[0];
+    Q[1] = Mk[3];
+    Q[2] = Mk[6];
+    Q[3] = Mk[1];
+    Q[4] = Mk[4];
+    Q[5] = Mk[7];
+    Q[6] = Mk[2];
+    Q[7] = Mk[5];
+    Q[8] = Mk[8];
+
+    return (det);
+}
+
 }  // end namespace fea
 }  // end namespace chrono
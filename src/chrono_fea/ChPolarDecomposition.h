@@ -67,6 +67,11 @@ class PolarDecomposition {
     // All matrices are row-major
     static double Compute(const double* M, double* Q, double* S, double tolerance = 1E-6);
 
+    // Computes only the orthogonal factor Q of the Polar Decomposition M = Q * S.
+    // Same iteration as Compute(), but with unrolled 3x3 kernels and without forming S.
+    // Returns det(Q), which can be 1 or -1.
+    static double ComputeRotation(const double* M, double* Q, double tolerance = 1E-6);
+
   protected:
     // one-norm of a 3 x 3 matrix
     static double oneNorm(const double* A);
@@ -107,6 +112,17 @@ class ChApiFea ChPolarDecomposition {
     ) {
         return PolarDecomposition::Compute(M.GetAddress(), Q.GetAddress(), S.GetAddress());
     }
+
+    // Computes only the orthogonal factor Q of the polar decomposition M = Q * S.
+    // This is faster than Compute() when the symmetric factor is not needed,
+    // as in the case of corotational elements.
+    //   return value: det(Q) that can be -1 or +1.
+    static double ComputeRotation(const ChMatrix33<Real>& M,  ///< a 3x3 input matrix to decompose
+                                  ChMatrix33<Real>& Q,        ///< resulting 3x3 orthogonal output matrix
+                                  double tolerance = 1e-6     ///< tolerance of the computation
+    ) {
+        return PolarDecomposition::ComputeRotation(M.GetAddress(), Q.GetAddress(), tolerance);
+    }
 };
 
 }  // end namespace fea
@@ -0,0 +1,139 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include <cassert>
+
+#include "chrono_fea/ChReferenceStiffness.h"
+
+namespace chrono {
+namespace fea {
+
+// -----------------------------------------------------------------------------
+// Kernels, templated on the storage type. The blocks K_IJ (I <= J) are stored
+// consecutively, each as 9 row-major entries. All arithmetic is in double.
+// -----------------------------------------------------------------------------
+
+template <typename T>
+static void MultiplyBlocks(const T* K, int nblocks, const double* u, double* f) {
+    for (int i = 0; i < 3 * nblocks; i++)
+        f[i] = 0;
+
+    for (int I = 0; I < nblocks; I++) {
+        const double* uI = u + 3 * I;
+        double* fI = f + 3 * I;
+        for (int J = I; J < nblocks; J++, K += 9) {
+            const double* uJ = u + 3 * J;
+            double b[9];
+            for (int k = 0; k < 9; k++)
+                b[k] = static_cast<double>(K[k]);
+
+            // f_I += K_IJ * u_J
+            fI[0] += b[0] * uJ[0] + b[1] * uJ[1] + b[2] * uJ[2];
+            fI[1] += b[3] * uJ[0] + b[4] * uJ[1] + b[5] * uJ[2];
+            fI[2] += b[6] * uJ[0] + b[7] * uJ[1] + b[8] * uJ[2];
+
+            // f_J += K_IJ' * u_I  (lower blocks, by symmetry)
+            if (J != I) {
+                double* fJ = f + 3 * J;
+                fJ[0] += b[0] * uI[0] + b[3] * uI[1] + b[6] * uI[2];
+                fJ[1] += b[1] * uI[0] + b[4] * uI[1] + b[7] * uI[2];
+                fJ[2] += b[2] * uI[0] + b[5] * uI[1] + b[8] * uI[2];
+            }
+        }
+    }
+}
+
+template <typename T>
+static void RotateBlocks(const T* K, int nblocks, const double* r, double scale, ChMatrix<>& H) {
+    for (int I = 0; I < nblocks; I++) {
+        for (int J = I; J < nblocks; J++, K += 9) {
+            // tmp = K_IJ * R'
+            double tmp[9];
+            for (int a = 0; a < 3; a++) {
+                double k0 = static_cast<double>(K[3 * a + 0]);
+                double k1 = static_cast<double>(K[3 * a + 1]);
+                double k2 = static_cast<double>(K[3 * a + 2]);
+                for (int c = 0; c < 3; c++)
+                    tmp[3 * a + c] = k0 * r[3 * c + 0] + k1 * r[3 * c + 1] + k2 * r[3 * c + 2];
+            }
+            // B = scale * R * tmp, written in the (I,J) block and, transposed, in the (J,I) block
+            for (int row = 0; row < 3; row++) {
+                for (int c = (I == J ? row : 0); c < 3; c++) {
+                    double val =
+                        scale * (r[3 * row + 0] * tmp[c] + r[3 * row + 1] * tmp[3 + c] + r[3 * row + 2] * tmp[6 + c]);
+                    H(3 * I + row, 3 * J + c) = val;
+                    H(3 * J + c, 3 * I + row) = val;
+                }
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChReferenceStiffness::Set(const ChMatrix<>& K, Precision prec) {
+    assert(K.GetRows() == K.GetColumns() && K.GetRows() % 3 == 0);
+
+    nblocks = K.GetRows() / 3;
+    precision = prec;
+
+    std::vector<double> blocks;
+    blocks.reserve(9 * nblocks * (nblocks + 1) / 2);
+    for (int I = 0; I < nblocks; I++)
+        for (int J = I; J < nblocks; J++)
+            for (int a = 0; a < 3; a++)
+                for (int b = 0; b < 3; b++)
+                    blocks.push_back(0.5 * (K(3 * I + a, 3 * J + b) + K(3 * J + b, 3 * I + a)));
+
+    if (precision == Precision::SINGLE) {
+        Kf.assign(blocks.begin(), blocks.end());
+        Kf.shrink_to_fit();
+        Kd.clear();
+        Kd.shrink_to_fit();
+    } else {
+        Kd.swap(blocks);
+        Kf.clear();
+        Kf.shrink_to_fit();
+    }
+}
+
+void ChReferenceStiffness::GetMatrix(ChMatrixDynamic<>& K) const {
+    ChMatrix33<> identity(1);
+    K.Reset(3 * nblocks, 3 * nblocks);
+    ComputeRotated(identity, 1.0, K);
+}
+
+void ChReferenceStiffness::Multiply(const double* u, double* f) const {
+    if (precision == Precision::SINGLE)
+        MultiplyBlocks(Kf.data(), nblocks, u, f);
+    else
+        MultiplyBlocks(Kd.data(), nblocks, u, f);
+}
+
+void ChReferenceStiffness::ComputeRotated(const ChMatrix33<>& R, double scale, ChMatrix<>& H) const {
+    assert(H.GetRows() >= 3 * nblocks && H.GetColumns() >= 3 * nblocks);
+
+    double r[9];
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            r[3 * i + j] = R(i, j);
+
+    if (precision == Precision::SINGLE)
+        RotateBlocks(Kf.data(), nblocks, r, scale, H);
+    else
+        RotateBlocks(Kd.data(), nblocks, r, scale, H);
+}
+
+}  // end namespace fea
+}  // end namespace chrono
@@ -0,0 +1,84 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CHREFERENCESTIFFNESS_H
+#define CHREFERENCESTIFFNESS_H
+
+#include <vector>
+
+#include "chrono/core/ChMatrixDynamic.h"
+#include "chrono/core/ChMatrix33.h"
+#include "chrono_fea/ChApiFEA.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_math
+/// @{
+
+/// Compact store for the undeformed (reference) stiffness matrix of a corotational element.
+/// The symmetric matrix is stored as the upper-triangular sequence of its 3x3 node blocks,
+/// either in double or in single precision. Products with the stored matrix always accumulate
+/// in double precision, so that single precision storage only affects the stiffness values
+/// themselves (relative error ~1e-7), while halving the memory traffic of the per-step kernels.
+class ChApiFea ChReferenceStiffness {
+  public:
+    /// Precision used to store the matrix entries.
+    enum class Precision {
+        DOUBLE,  ///< store entries as double
+        SINGLE   ///< store entries as float (accumulation is still in double)
+    };
+
+    ChReferenceStiffness() : nblocks(0), precision(Precision::DOUBLE) {}
+
+    /// Build the store from a square matrix K of size 3*n, with n the number of nodes.
+    /// The matrix is symmetrized, i.e. entries are averaged with their transposed counterparts.
+    void Set(const ChMatrix<>& K, Precision prec);
+
+    /// Return true if the store was initialized.
+    bool IsSet() const { return nblocks > 0; }
+
+    /// Get the number of 3x3 node blocks on the diagonal.
+    int GetNblocks() const { return nblocks; }
+
+    /// Get the storage precision.
+    Precision GetPrecision() const { return precision; }
+
+    /// Get the memory used by the stored entries, in bytes.
+    size_t GetMemorySize() const { return Kd.size() * sizeof(double) + Kf.size() * sizeof(float); }
+
+    /// Expand the stored matrix into the dense matrix K (resized as needed).
+    void GetMatrix(ChMatrixDynamic<>& K) const;
+
+    /// Compute f = K * u, with u and f vectors of length 3*n.
+    void Multiply(const double* u, double* f) const;
+
+    /// Compute the corotated matrix H = scale * C * K * C', with C the block-diagonal matrix
+    /// having the rotation R as 3x3 diagonal blocks. The result is written in the upper-left
+    /// 3n x 3n block of H and is exactly symmetric.
+    void ComputeRotated(const ChMatrix33<>& R, double scale, ChMatrix<>& H) const;
+
+  private:
+    int nblocks;             ///< number of nodes (3x3 diagonal blocks)
+    Precision precision;     ///< storage precision
+    std::vector<double> Kd;  ///< upper blocks, row-major, when stored in double precision
+    std::vector<float> Kf;   ///< upper blocks, row-major, when stored in single precision
+};
+
+/// @} fea_math
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
@@ -57,15 +57,18 @@ ChParallelDataManager::ChParallelDataManager()
     broadphase = new ChCBroadphase;
     narrowphase = new ChCNarrowphaseDispatch;
     aabb_generator = new ChCAABBGenerator;
+    raycast = new ChCRaycast;
     broadphase->data_manager = this;
     narrowphase->data_manager = this;
     aabb_generator->data_manager = this;
+    raycast->data_manager = this;
 }
 
 ChParallelDataManager::~ChParallelDataManager() {
     delete narrowphase;
     delete broadphase;
     delete aabb_generator;
+    delete raycast;
 }
 
 int ChParallelDataManager::OutputBlazeVector(DynamicVector<real> src, std::string filename) {
@@ -23,6 +23,8 @@
 
 #include <memory>
 
+#include "chrono/collision/ChCSignedDistanceField.h"
+
 // Chrono::Parallel headers
 #include "chrono_parallel/ChTimerParallel.h"
 #include "chrono_parallel/ChParallelDefines.h"
@@ -71,6 +73,7 @@ namespace collision {
 class ChCBroadphase;           // forward declaration
 class ChCNarrowphaseDispatch;  // forward declaration
 class ChCAABBGenerator;        // forward declaration
+class ChCRaycast;              // forward declaration
 }
 
 #if BLAZE_MAJOR_VERSION == 2
@@ -219,6 +222,16 @@ struct shape_container {
     custom_vector<real3> convex_rigid;
     custom_vector<int> tetrahedron_rigid;
 
+    custom_vector<real3> mesh_vertices;   ///< Vertices of triangle mesh shapes (in the body frame)
+    custom_vector<vec3> mesh_triangles;   ///< Vertex indices of mesh triangles
+    custom_vector<int> mesh_flags;        ///< Active edges (bits 0-2) and vertices (bits 3-5) of mesh triangles
+    custom_vector<real3> mesh_bvh_min;    ///< Lower corner of mesh BVH nodes (in the body frame)
+    custom_vector<real3> mesh_bvh_max;    ///< Upper corner of mesh BVH nodes (in the body frame)
+    custom_vector<vec2> mesh_bvh_node;    ///< Mesh BVH nodes: (second child, 0) or (first triangle, count) for leaves
+
+    /// Signed distance fields (shared with the collision models, expressed in the shape frame)
+    std::vector<std::shared_ptr<collision::ChSignedDistanceField>> sdf_rigid;
+
     custom_vector<real3> triangle_global;
     custom_vector<real3> obj_data_A_global;
     custom_vector<quaternion> obj_data_R_global;
@@ -235,6 +248,7 @@ struct host_container {
     custom_vector<real3> aabb_max_tet;  ///< List of bounding boxes maximum point for tets
 
     custom_vector<long long> contact_pairs;  ///< Contact pairs (encoded in a single long log)
+    custom_vector<vec2> contact_triangles;   ///< Mesh triangles of contact pairs (-1 for non-mesh shapes)
 
     // Contact data
     custom_vector<real3> norm_rigid_rigid;
@@ -401,6 +415,13 @@ struct host_container {
     custom_vector<uint> bin_aabb_number;
     custom_vector<uint> bin_start_index;
     custom_vector<uint> bin_num_contact;
+
+    // AABB tree of the rigid shapes, built by the sweep and prune broadphase (which has no grid).
+    // Complete binary tree with the root at index 1, the children of node i at 2i and 2i+1, and
+    // the shapes at the leaves n..2n-1, in the order of their AABBs along the longest scene axis.
+    custom_vector<uint> shape_tree_shapes;  ///< shapes at the leaves of the tree
+    custom_vector<real3> shape_tree_min;    ///< minimum point of the node AABBs
+    custom_vector<real3> shape_tree_max;    ///< maximum point of the node AABBs
 };
 
 /// Global data manager for Chrono::Parallel.
@@ -425,6 +446,7 @@ class CH_PARALLEL_API ChParallelDataManager {
     collision::ChCBroadphase* broadphase;
     collision::ChCNarrowphaseDispatch* narrowphase;
     collision::ChCAABBGenerator* aabb_generator;
+    collision::ChCRaycast* raycast;
 
     // These pointers are used to compute the mass matrix instead of filling a
     // a temporary data structure
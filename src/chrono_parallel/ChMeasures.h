@@ -43,6 +43,7 @@ class collision_measures {
         global_origin = real3(0);
         bin_size = real3(0);
         number_of_contacts_possible = 0;
+        number_of_pairs_culled = 0;
         number_of_bins_active = 0;
         number_of_bin_intersections = 0;
 
@@ -60,6 +61,12 @@ class collision_measures {
         mpm_min_bounding_point = real3(0);
         mpm_max_bounding_point = real3(0);
         mpm_bins_per_axis = vec3(0);
+
+        number_of_contacts_active = 0;
+        max_bin_shapes = 0;
+        max_bin_pairs = 0;
+        broadphase_memory = 0;
+        contact_memory = 0;
     }
     real3 min_bounding_point;          ///< The minimal global bounding point
     real3 max_bounding_point;          ///< The maximum global bounding point
@@ -69,6 +76,7 @@ class collision_measures {
     uint number_of_bins_active;        ///< Number of active bins (containing 1+ AABBs)
     uint number_of_bin_intersections;  ///< Number of AABB bin intersections
     uint number_of_contacts_possible;  ///< Number of contacts possible from broadphase
+    uint number_of_pairs_culled;       ///< Number of candidate pairs rejected by the bounding sphere test
 
     real3 rigid_min_bounding_point;
     real3 rigid_max_bounding_point;
@@ -87,6 +95,19 @@ class collision_measures {
     real3 mpm_min_bounding_point;
     real3 mpm_max_bounding_point;
     vec3 mpm_bins_per_axis;
+
+    // Statistics (only collected if the collect_statistics collision setting is enabled).
+    // The histograms have power-of-two buckets: bucket 0 counts the bins with no shapes (or pairs),
+    // bucket k > 0 the bins with 2^(k-1) to 2^k - 1 shapes (or pairs).
+    uint number_of_contacts_active;             ///< Number of rigid contacts found by the narrowphase
+    uint max_bin_shapes;                        ///< Largest number of shapes in an active bin
+    uint max_bin_pairs;                         ///< Largest number of candidate pairs found in an active bin
+    std::vector<uint> bin_shapes_histogram;     ///< Histogram of the number of shapes per active bin
+    std::vector<uint> bin_pairs_histogram;      ///< Histogram of the number of candidate pairs per active bin
+    std::vector<vec3> contacts_possible_types;  ///< Candidate pairs per pair of shape types (type1, type2, count)
+    std::vector<vec3> contacts_active_types;    ///< Rigid contacts per pair of shape types (type1, type2, count)
+    size_t broadphase_memory;                   ///< Memory (in bytes) allocated for the broadphase bin arrays
+    size_t contact_memory;                      ///< Memory (in bytes) allocated for the rigid contact arrays
 };
 
 /// Solver measures.
@@ -130,6 +130,12 @@ enum class CollisionSystemType {
     COLLSYS_BULLET_PARALLEL  ///< Bullet-based collision system
 };
 
+/// Enumeration of broad-phase collision methods.
+enum class BroadPhaseType {
+    BROADPHASE_GRID,  ///< uniform grid, rebuilt at each step
+    BROADPHASE_SAP    ///< incremental sweep and prune
+};
+
 /// Enumeration of narrow-phase collision methods.
 enum class NarrowPhaseType {
     NARROWPHASE_MPR,        ///< Minkovski Portal Refinement
@@ -52,9 +52,15 @@ class collision_settings {
         // NOTE!!! this really depends on the architecture that you run on and how
         // many cores you are using.
         bins_per_axis = vec3(20, 20, 20);
+        broadphase_algorithm = BroadPhaseType::BROADPHASE_GRID;
         narrowphase_algorithm = NarrowPhaseType::NARROWPHASE_HYBRID_MPR;
+        mpr_batching = true;
         grid_density = 5;
         fixed_bins = true;
+        contact_reduction = false;
+        max_reduced_contacts = 4;
+        reduction_angle_tolerance = 0.1;
+        collect_statistics = false;
     }
 
     real3 min_bounding_point, max_bounding_point;
@@ -78,13 +84,41 @@ class collision_settings {
     /// the broadphase stage the extents of the simulation are computed and then
     /// sliced according to the variable.
     vec3 bins_per_axis;
+    /// Broadphase algorithm for the rigid shapes. The default uniform grid is rebuilt at each step and
+    /// its resolution (bins_per_axis, or grid_density if fixed_bins is false) must be tuned to the scene.
+    /// The sweep and prune broadphase keeps the AABB bounds sorted along the three axes from one step to
+    /// the next, together with the set of overlapping pairs, which is updated from the swaps made while
+    /// sorting. Its cost is nearly linear when the shapes move little between steps, and it does not
+    /// depend on the distribution of shape sizes. It is used only for rigid shapes: the grid is still
+    /// used if the system contains fluid particles or FEA tetrahedra.
+    BroadPhaseType broadphase_algorithm;
     /// There are multiple narrowphase algorithms implemented in the collision
     /// detection code. The narrowphase_algorithm parameter can be used to change
     /// the type of narrowphase used at runtime.
     NarrowPhaseType narrowphase_algorithm;
+    /// With the MPR and hybrid MPR narrowphases, process the candidate pairs sorted by shape types and
+    /// reject the pairs whose bounding spheres are separated before calling the narrowphase.
+    /// This only affects performance: the contacts are the same either way.
+    bool mpr_batching;
     real grid_density;
     /// Use fixed number of bins instead of tuning them.
     bool fixed_bins;
+    /// Reduce the rigid contacts after the narrowphase. The contacts between two bodies are clustered by
+    /// normal direction and each cluster with more than max_reduced_contacts contacts is replaced by a
+    /// subset of its contacts: the deepest one and those spanning the largest support polygon.
+    /// This is useful for flat contacts with triangle meshes, where each triangle yields its own contact.
+    /// Only used with NSC systems; it is ignored for SMC, where the penalty forces of the dropped contacts
+    /// would be lost.
+    bool contact_reduction;
+    /// Maximum number of contacts kept per cluster when contact reduction is enabled (at least 3).
+    int max_reduced_contacts;
+    /// Maximum angle (in radians) between the normals of contacts in the same cluster.
+    real reduction_angle_tolerance;
+    /// Collect statistics on the broadphase and narrowphase at each step (bin occupancy, candidate pairs and
+    /// contacts per pair of shape types, memory of the contact arrays). These are stored in the collision
+    /// measures and can be written with ChSystemParallel::WriteCollisionStatistics. They are only collected
+    /// by the default (parallel) collision system.
+    bool collect_statistics;
 };
 
 /// Chrono::Parallel solver_settings.
@@ -182,6 +182,23 @@ void ChCAABBGenerator::GenerateAABB() {
 
                 ComputeAABBTriangle(A, B, C, temp_min, temp_max);
 
+            } else if (type == MESH) {
+                // Bounding box of the mesh BVH root, expressed in the body frame
+                const real3& bvh_min = data_manager->shape_data.mesh_bvh_min[start];
+                const real3& bvh_max = data_manager->shape_data.mesh_bvh_max[start];
+                real3 B = (bvh_max - bvh_min) * 0.5;
+                real3 L = (bvh_max + bvh_min) * 0.5;
+                ComputeAABBBox(B + collision_envelope, L, position, rotation, body_rot[id], temp_min, temp_max);
+
+            } else if (type == SDF) {
+                // Bounding box of the distance field, expressed in the shape frame
+                ChVector<> bbmin, bbmax;
+                data_manager->shape_data.sdf_rigid[start]->GetBoundingBox(bbmin, bbmax);
+                real3 B = real3(bbmax.x() - bbmin.x(), bbmax.y() - bbmin.y(), bbmax.z() - bbmin.z()) * 0.5;
+                real3 L = real3(bbmax.x() + bbmin.x(), bbmax.y() + bbmin.y(), bbmax.z() + bbmin.z()) * 0.5;
+                L = local_pos + Rotate(L, local_rot);
+                ComputeAABBBox(B + collision_envelope, L, position, rotation, body_rot[id], temp_min, temp_max);
+
             } else {
                 continue;
             }
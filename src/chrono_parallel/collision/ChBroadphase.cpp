@@ -240,7 +240,15 @@ ChCBroadphase::ChCBroadphase() {
 // let user define their own narrow-phase collision detection
 void ChCBroadphase::DispatchRigid() {
     if (data_manager->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        // The rigid-fluid and rigid-tet contacts use the grid of the rigid shapes.
+        if (data_manager->settings.collision.broadphase_algorithm == BroadPhaseType::BROADPHASE_SAP &&
+            data_manager->num_fluid_bodies == 0 && data_manager->num_fea_tets == 0) {
+            SweepAndPrune();
+        } else {
+            data_manager->host_data.shape_tree_shapes.clear();
+            OneLevelBroadphase();
+        }
+        MeshBroadphase();
         data_manager->num_rigid_contacts = data_manager->measures.collision.number_of_contacts_possible;
     }
     return;
@@ -341,5 +349,229 @@ void ChCBroadphase::OneLevelBroadphase() {
     LOG(TRACE) << "Number of unique collisions: " << number_of_contacts_possible;
 }
 
+// Position of an AABB bound (2 * shape for the lower bound, 2 * shape + 1 for the upper bound) along an axis.
+static inline real f_SAP_Bound(uint bound,
+                               int axis,
+                               const custom_vector<real3>& aabb_min,
+                               const custom_vector<real3>& aabb_max) {
+    return (bound & 1) ? aabb_max[bound >> 1][axis] : aabb_min[bound >> 1][axis];
+}
+
+// Order of the AABB bounds along an axis. On ties, lower bounds come first (so that touching AABBs overlap,
+// as in overlap()) and the shape index decides between bounds of the same kind.
+static inline bool f_SAP_Less(uint a,
+                              uint b,
+                              int axis,
+                              const custom_vector<real3>& aabb_min,
+                              const custom_vector<real3>& aabb_max) {
+    real va = f_SAP_Bound(a, axis, aabb_min, aabb_max);
+    real vb = f_SAP_Bound(b, axis, aabb_min, aabb_max);
+    if (va != vb)
+        return va < vb;
+    if ((a & 1) != (b & 1))
+        return (a & 1) < (b & 1);
+    return a < b;
+}
+
+static inline long long f_SAP_Pair(uint shapeA, uint shapeB) {
+    return ((long long)std::min(shapeA, shapeB) << 32) | (long long)std::max(shapeA, shapeB);
+}
+
+void ChCBroadphase::SweepAndPrune() {
+    LOG(TRACE) << "ChCBroadphase::SweepAndPrune()";
+    const custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
+    const custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+    const custom_vector<short2>& fam_data = data_manager->shape_data.fam_rigid;
+    const custom_vector<char>& obj_active = data_manager->host_data.active_rigid;
+    const custom_vector<char>& obj_collide = data_manager->host_data.collide_rigid;
+    const custom_vector<uint>& obj_data_id = data_manager->shape_data.id_rigid;
+    custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+
+    const uint num_shapes = data_manager->num_rigid_shapes;
+    uint& number_of_contacts_possible = data_manager->measures.collision.number_of_contacts_possible;
+
+    // No grid is built (ray casts use the AABB tree of the shapes instead).
+    data_manager->measures.collision.number_of_bins_active = 0;
+    data_manager->measures.collision.number_of_bin_intersections = 0;
+
+    if (sap_bounds[0].size() != 2 * num_shapes) {
+        // Sort the AABB bounds along each axis, then collect the overlapping pairs with a sweep along x.
+        for (int axis = 0; axis < 3; axis++) {
+            sap_bounds[axis].resize(2 * num_shapes);
+            Thrust_Sequence(sap_bounds[axis]);
+            std::sort(sap_bounds[axis].begin(), sap_bounds[axis].end(),
+                      [&](uint a, uint b) { return f_SAP_Less(a, b, axis, aabb_min, aabb_max); });
+        }
+        sap_pairs.clear();
+        std::vector<uint> open;
+        for (uint bound : sap_bounds[0]) {
+            uint shapeA = bound >> 1;
+            if (bound & 1) {
+                open.erase(std::find(open.begin(), open.end(), shapeA));
+                continue;
+            }
+            for (uint shapeB : open) {
+                if (overlap(aabb_min[shapeA], aabb_max[shapeA], aabb_min[shapeB], aabb_max[shapeB]))
+                    sap_pairs.insert(f_SAP_Pair(shapeA, shapeB));
+            }
+            open.push_back(shapeA);
+        }
+    } else {
+        // Repair the order of the bounds along each axis with an insertion sort, which is nearly linear when the
+        // shapes moved little. A lower bound moving below an upper bound starts an overlap along this axis (the
+        // pair is added if the AABBs now overlap), and an upper bound moving below a lower bound ends it.
+        for (int axis = 0; axis < 3; axis++) {
+            custom_vector<uint>& bounds = sap_bounds[axis];
+            for (size_t i = 1; i < bounds.size(); i++) {
+                uint bound = bounds[i];
+                size_t j = i;
+                while (j > 0 && f_SAP_Less(bound, bounds[j - 1], axis, aabb_min, aabb_max)) {
+                    uint other = bounds[j - 1];
+                    uint shapeA = bound >> 1;
+                    uint shapeB = other >> 1;
+                    if (!(bound & 1) && (other & 1)) {
+                        if (overlap(aabb_min[shapeA], aabb_max[shapeA], aabb_min[shapeB], aabb_max[shapeB]))
+                            sap_pairs.insert(f_SAP_Pair(shapeA, shapeB));
+                    } else if ((bound & 1) && !(other & 1)) {
+                        sap_pairs.erase(f_SAP_Pair(shapeA, shapeB));
+                    }
+                    bounds[j] = other;
+                    j--;
+                }
+                bounds[j] = bound;
+            }
+        }
+    }
+
+    // Filter the overlapping pairs as in the grid broadphase, and sort them so that their order does not depend
+    // on the history of the pair set.
+    contact_pairs.clear();
+    for (long long pair : sap_pairs) {
+        uint bodyA = obj_data_id[pair >> 32];
+        uint bodyB = obj_data_id[pair & 0xffffffff];
+        if (bodyA == UINT_MAX || bodyB == UINT_MAX || bodyA == bodyB)
+            continue;
+        if (obj_collide[bodyA] == 0 || obj_collide[bodyB] == 0)
+            continue;
+        if (!obj_active[bodyA] && !obj_active[bodyB])
+            continue;
+        if (!collide(fam_data[pair >> 32], fam_data[pair & 0xffffffff]))
+            continue;
+        contact_pairs.push_back(pair);
+    }
+    Thrust_Sort(contact_pairs);
+    number_of_contacts_possible = (uint)contact_pairs.size();
+    LOG(TRACE) << "Number of possible collisions: " << number_of_contacts_possible;
+
+    BuildShapeTree();
+}
+
+void ChCBroadphase::BuildShapeTree() {
+    const custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
+    const custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+    const custom_vector<char>& obj_collide = data_manager->host_data.collide_rigid;
+    const custom_vector<uint>& obj_data_id = data_manager->shape_data.id_rigid;
+    custom_vector<uint>& tree_shapes = data_manager->host_data.shape_tree_shapes;
+    custom_vector<real3>& tree_min = data_manager->host_data.shape_tree_min;
+    custom_vector<real3>& tree_max = data_manager->host_data.shape_tree_max;
+
+    // Leaves in the order of the lower bounds along the longest axis of the scene, so that the nodes group
+    // neighboring shapes.
+    real3 extent = data_manager->measures.collision.max_bounding_point -
+                   data_manager->measures.collision.min_bounding_point;
+    int axis = (extent.x >= extent.y) ? (extent.x >= extent.z ? 0 : 2) : (extent.y >= extent.z ? 1 : 2);
+
+    tree_shapes.clear();
+    for (uint bound : sap_bounds[axis]) {
+        uint shape = bound >> 1;
+        if ((bound & 1) || obj_data_id[shape] == UINT_MAX || obj_collide[obj_data_id[shape]] == 0)
+            continue;
+        tree_shapes.push_back(shape);
+    }
+
+    const uint num_leaves = (uint)tree_shapes.size();
+    tree_min.resize(2 * num_leaves);
+    tree_max.resize(2 * num_leaves);
+    for (uint k = 0; k < num_leaves; k++) {
+        tree_min[num_leaves + k] = aabb_min[tree_shapes[k]];
+        tree_max[num_leaves + k] = aabb_max[tree_shapes[k]];
+    }
+    for (int node = (int)num_leaves - 1; node > 0; node--) {
+        tree_min[node] = Min(tree_min[2 * node], tree_min[2 * node + 1]);
+        tree_max[node] = Max(tree_max[2 * node], tree_max[2 * node + 1]);
+    }
+}
+
+void ChCBroadphase::MeshBroadphase() {
+    LOG(TRACE) << "ChCBroadphase::MeshBroadphase()";
+    const shape_container& shape_data = data_manager->shape_data;
+    const custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
+    const custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+    const custom_vector<real3>& body_pos = data_manager->host_data.pos_rigid;
+    const custom_vector<quaternion>& body_rot = data_manager->host_data.rot_rigid;
+    const real3& global_origin = data_manager->measures.collision.global_origin;
+    const real envelope = data_manager->settings.collision.collision_envelope;
+    custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+    custom_vector<vec2>& contact_triangles = data_manager->host_data.contact_triangles;
+
+    uint& number_of_contacts_possible = data_manager->measures.collision.number_of_contacts_possible;
+    const uint num_pairs = number_of_contacts_possible;
+
+    // Without meshes, there are no triangle candidates.
+    if (shape_data.mesh_triangles.size() == 0) {
+        contact_triangles.resize(num_pairs);
+        Thrust_Fill(contact_triangles, vec2(-1, -1));
+        return;
+    }
+
+    // Count the candidates of each pair (1 for pairs without meshes).
+    custom_vector<uint> num_candidates(num_pairs + 1);
+    num_candidates[num_pairs] = 0;
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_pairs; index++) {
+        vec2 pair = I2(int(contact_pairs[index] >> 32), int(contact_pairs[index] & 0xffffffff));
+        if (shape_data.typ_rigid[pair.x] != MESH && shape_data.typ_rigid[pair.y] != MESH) {
+            num_candidates[index] = 1;
+            continue;
+        }
+        uint count = 0;
+        f_Mesh_Pair_Query(pair, global_origin, envelope, shape_data, aabb_min, aabb_max, body_pos, body_rot,
+                          [&](int ta, int tb) { count++; });
+        num_candidates[index] = count;
+    }
+
+    Thrust_Exclusive_Scan(num_candidates);
+    uint total = num_candidates.back();
+
+    // Store the candidates, keeping the shape pair and recording the triangles.
+    custom_vector<long long> candidate_pairs(total);
+    custom_vector<vec2> candidate_triangles(total);
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_pairs; index++) {
+        long long p = contact_pairs[index];
+        uint offset = num_candidates[index];
+        vec2 pair = I2(int(p >> 32), int(p & 0xffffffff));
+        if (shape_data.typ_rigid[pair.x] != MESH && shape_data.typ_rigid[pair.y] != MESH) {
+            candidate_pairs[offset] = p;
+            candidate_triangles[offset] = vec2(-1, -1);
+            continue;
+        }
+        uint count = 0;
+        f_Mesh_Pair_Query(pair, global_origin, envelope, shape_data, aabb_min, aabb_max, body_pos, body_rot,
+                          [&](int ta, int tb) {
+                              candidate_pairs[offset + count] = p;
+                              candidate_triangles[offset + count] = vec2(ta, tb);
+                              count++;
+                          });
+    }
+
+    contact_pairs.swap(candidate_pairs);
+    contact_triangles.swap(candidate_triangles);
+    number_of_contacts_possible = total;
+    LOG(TRACE) << "Number of possible collisions (with mesh triangles): " << number_of_contacts_possible;
+}
+
 } // end namespace collision
 } // end namespace chrono
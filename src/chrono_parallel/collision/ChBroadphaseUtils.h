@@ -413,6 +413,104 @@ static inline void f_Store_AABB_AABB_Intersection(const uint index,
     }
 }
 
+// TRIANGLE MESH FUNCTIONS =================================================================================
+
+/// Express an AABB (given in the global frame) in the frame of a mesh body, as an AABB inflated by
+/// the specified margin.
+static inline void f_Mesh_Local_AABB(const real3& Amin,
+                                     const real3& Amax,
+                                     const real3& pos,
+                                     const quaternion& rot,
+                                     const real margin,
+                                     real3& Lmin,
+                                     real3& Lmax) {
+    real3 center = TransformParentToLocal(pos, rot, (Amin + Amax) * 0.5);
+    real3 half = AbsRotate(Inv(rot), (Amax - Amin) * 0.5) + margin;
+    Lmin = center - half;
+    Lmax = center + half;
+}
+
+/// Traverse the BVH of a triangle mesh shape and invoke the callback for each triangle whose bounding
+/// box overlaps the given AABB (expressed in the mesh body frame).
+template <typename Callback>
+static inline void f_Mesh_Query(const int root,
+                                const real3& Amin,
+                                const real3& Amax,
+                                const shape_container& shape_data,
+                                Callback callback) {
+    int stack[64];
+    int top = 0;
+    stack[top++] = root;
+    while (top > 0) {
+        int node = stack[--top];
+        if (!overlap(Amin, Amax, shape_data.mesh_bvh_min[node], shape_data.mesh_bvh_max[node]))
+            continue;
+        vec2 data = shape_data.mesh_bvh_node[node];
+        if (data.y == 0) {
+            // Internal node: the first child immediately follows its parent.
+            stack[top++] = data.x;
+            stack[top++] = node + 1;
+            continue;
+        }
+        for (int t = data.x; t < data.x + data.y; t++) {
+            const vec3& tri = shape_data.mesh_triangles[t];
+            const real3& A = shape_data.mesh_vertices[tri[0]];
+            const real3& B = shape_data.mesh_vertices[tri[1]];
+            const real3& C = shape_data.mesh_vertices[tri[2]];
+            if (overlap(Amin, Amax, Min(Min(A, B), C), Max(Max(A, B), C)))
+                callback(t);
+        }
+    }
+}
+
+/// Find the candidate triangles for a pair of shapes, at least one of which is a triangle mesh.
+/// The shape AABBs are assumed to be offset by the global origin. The callback is invoked with the
+/// candidate triangle of each shape (-1 if that shape is not a mesh).
+template <typename Callback>
+static void f_Mesh_Pair_Query(const vec2& pair,
+                              const real3& global_origin,
+                              const real envelope,
+                              const shape_container& shape_data,
+                              const custom_vector<real3>& aabb_min,
+                              const custom_vector<real3>& aabb_max,
+                              const custom_vector<real3>& body_pos,
+                              const custom_vector<quaternion>& body_rot,
+                              Callback callback) {
+    bool meshA = shape_data.typ_rigid[pair.x] == MESH;
+    bool meshB = shape_data.typ_rigid[pair.y] == MESH;
+    int mesh = meshA ? pair.x : pair.y;
+    int other = meshA ? pair.y : pair.x;
+    const real3& pos = body_pos[shape_data.id_rigid[mesh]];
+    const quaternion& rot = body_rot[shape_data.id_rigid[mesh]];
+
+    real3 Lmin, Lmax;
+    f_Mesh_Local_AABB(aabb_min[other] + global_origin, aabb_max[other] + global_origin, pos, rot, envelope, Lmin,
+                      Lmax);
+
+    if (!(meshA && meshB)) {
+        f_Mesh_Query(shape_data.start_rigid[mesh], Lmin, Lmax, shape_data, [&](int t) {
+            if (meshA)
+                callback(t, -1);
+            else
+                callback(-1, t);
+        });
+        return;
+    }
+
+    // Mesh-mesh pair: query the second mesh with each candidate triangle of the first one.
+    const real3& posB = body_pos[shape_data.id_rigid[pair.y]];
+    const quaternion& rotB = body_rot[shape_data.id_rigid[pair.y]];
+    f_Mesh_Query(shape_data.start_rigid[pair.x], Lmin, Lmax, shape_data, [&](int ta) {
+        const vec3& tri = shape_data.mesh_triangles[ta];
+        real3 A = TransformLocalToParent(pos, rot, shape_data.mesh_vertices[tri[0]]);
+        real3 B = TransformLocalToParent(pos, rot, shape_data.mesh_vertices[tri[1]]);
+        real3 C = TransformLocalToParent(pos, rot, shape_data.mesh_vertices[tri[2]]);
+        real3 Tmin, Tmax;
+        f_Mesh_Local_AABB(Min(Min(A, B), C), Max(Max(A, B), C), posB, rotB, 2 * envelope, Tmin, Tmax);
+        f_Mesh_Query(shape_data.start_rigid[pair.y], Tmin, Tmax, shape_data, [&](int tb) { callback(ta, tb); });
+    });
+}
+
 /// @} parallel_colision
 
 } // end namespace collision
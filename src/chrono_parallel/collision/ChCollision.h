@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include "chrono/collision/ChCCollisionModel.h"
 
 #include "chrono_parallel/math/ChParallelMath.h"
@@ -47,15 +49,25 @@ class CH_PARALLEL_API ChCBroadphase {
     ChCBroadphase();
     void DispatchRigid();
     void OneLevelBroadphase();
+    /// Second level of the broadphase: expand the candidate pairs involving triangle mesh shapes
+    /// into (shape, triangle) candidates, using the static BVH of each mesh.
+    void MeshBroadphase();
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
     void RigidBoundingBox();
     void FluidBoundingBox();
     void TetBoundingBox();
+    /// Incremental sweep and prune broadphase for the rigid shapes (alternative to OneLevelBroadphase).
+    void SweepAndPrune();
     ChParallelDataManager* data_manager;
 
   private:
+    /// Build the AABB tree of the rigid shapes used by the ray casts when no grid is built.
+    void BuildShapeTree();
+
+    custom_vector<uint> sap_bounds[3];        ///< AABB bounds sorted along each axis (2 * shape, +1 if upper)
+    std::unordered_set<long long> sap_pairs;  ///< shape pairs with overlapping AABBs, kept from step to step
 };
 
 /// Class for performing narrow-phase collision detection.
@@ -75,6 +87,10 @@ class CH_PARALLEL_API ChCNarrowphaseDispatch {
     /// but it does not have to be transformed per contact pair, now it is
     /// transformed once per shape.
     void PreprocessLocalToParent();
+    /// Sort the potential contacts by the types of their shapes, so that pairs of the same type are
+    /// processed consecutively by the narrowphase (see dispatch_order). Used if the mpr_batching
+    /// collision setting is enabled.
+    void PreprocessDispatchOrder();
 
     // For each contact pair decide what to do.
     void DispatchRigid();
@@ -136,7 +152,17 @@ class CH_PARALLEL_API ChCNarrowphaseDispatch {
     void DispatchR();
     void DispatchHybridMPR();
     void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
-    void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
+    void Dispatch_Finalize(uint icoll,
+                           uint ID_A,
+                           uint ID_B,
+                           int nC,
+                           const ConvexShape* shapeA,
+                           const ConvexShape* shapeB);
+    /// Remove the rigid contacts not flagged as active.
+    void RemoveInactiveRigidContacts();
+    /// Reduce the rigid contacts between each pair of bodies to a bounded representative set
+    /// (see collision_settings::contact_reduction).
+    void ReduceRigidContacts();
     ChParallelDataManager* data_manager;
 
   private:
@@ -168,6 +194,75 @@ class CH_PARALLEL_API ChCNarrowphaseDispatch {
     custom_vector<uint> t_bin_number_out;
     custom_vector<uint> t_bin_fluid_number;
     custom_vector<uint> t_bin_start_index;
+
+    custom_vector<float> bounding_radius;  ///< radius of the bounding sphere of each shape (-1 if none)
+    custom_vector<int> dispatch_keys;      ///< shape type pair of each potential contact (sorted)
+    custom_vector<uint> dispatch_order;    ///< potential contacts, sorted by shape type pair
+    custom_vector<long long> slot_pairs;   ///< shape pair of each contact slot
+    custom_vector<vec2> slot_triangles;    ///< mesh triangles of each contact slot
+
+    custom_vector<long long> reduce_keys;   ///< body pair of each contact (sorted)
+    custom_vector<uint> reduce_index;       ///< contact indices, sorted by body pair
+    custom_vector<long long> reduce_pairs;  ///< distinct body pairs
+    custom_vector<uint> reduce_start;       ///< start of the contacts of each body pair in reduce_index
+};
+
+/// Class for ray and sphere casts against the rigid collision shapes.
+/// Casts use the broadphase grid, or the AABB tree of the shapes with the sweep and prune broadphase (and the
+/// BVH of triangle mesh shapes), and are therefore valid only after a call to the collision detection. Casts only read the collision data and can be issued concurrently.
+class CH_PARALLEL_API ChCRaycast {
+  public:
+    ChCRaycast();
+
+    /// Cast a sphere with given radius (a ray, if the radius is zero) along the segment [from, to],
+    /// against all shapes (if body < 0) or against the shapes of the specified body.
+    /// If there is a hit, return the closest one: the fraction along the segment, the hit point on the
+    /// shape surface, the surface normal (pointing towards the ray origin) and the index of the hit shape.
+    bool Cast(const real3& from,
+              const real3& to,
+              real radius,
+              int body,
+              real& fraction,
+              real3& point,
+              real3& normal,
+              int& shape) const;
+
+    /// Cast a sphere with given radius along the segment [from, to], for the continuous collision detection
+    /// of the specified body: the shapes of that body, the shapes it cannot collide with (as specified by
+    /// its collision family group and mask) and the surfaces the sphere moves away from are ignored.
+    bool Sweep(const real3& from,
+               const real3& to,
+               real radius,
+               int body,
+               short2 family,
+               real& fraction,
+               real3& point,
+               real3& normal,
+               int& shape) const;
+
+    /// Cast a sphere with given radius (a ray, if the radius is zero) along the segment [from, to],
+    /// against the specified shape. If there is a hit, return the fraction, the point and the normal.
+    bool CastShape(int shape,
+                   const real3& from,
+                   const real3& to,
+                   real radius,
+                   real& fraction,
+                   real3& point,
+                   real3& normal) const;
+
+    ChParallelDataManager* data_manager;
+
+  private:
+    bool CastFiltered(const real3& from,
+                      const real3& to,
+                      real radius,
+                      int body,
+                      int ignore,
+                      short2 family,
+                      real& fraction,
+                      real3& point,
+                      real3& normal,
+                      int& shape) const;
 };
 
 /// @} parallel_colision
@@ -16,6 +16,9 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <map>
+
 #include "chrono_parallel/collision/ChCollisionModelParallel.h"
 
 #include "chrono/physics/ChBody.h"
@@ -39,6 +42,8 @@ int ChCollisionModelParallel::ClearModel() {
     }
 
     local_convex_data.clear();
+    local_mesh_data.clear();
+    local_sdf_data.clear();
     mData.clear();
     nObjects = 0;
     family_group = 1;
@@ -313,6 +318,154 @@ bool ChCollisionModelParallel::AddBarrel(double Y_low,
     return false;
 }
 
+// Maximum number of triangles in a leaf of a mesh BVH.
+static const int mesh_leaf_size = 4;
+
+// Lexicographic comparison of vertex positions (used for welding mesh vertices).
+struct VertexLess {
+    bool operator()(const real3& a, const real3& b) const {
+        if (a.x != b.x)
+            return a.x < b.x;
+        if (a.y != b.y)
+            return a.y < b.y;
+        return a.z < b.z;
+    }
+};
+
+// Mark the active edges and vertices of the mesh triangles.
+// An edge is active if it is a boundary edge, it is shared by more than two triangles, or the two
+// triangles sharing it form a convex angle. A vertex is active if any of its edges is active.
+static void ComputeMeshFlags(MeshModel& mesh) {
+    int num_triangles = (int)mesh.triangles.size();
+
+    // Sort the triangle edges by their (ordered) vertex indices.
+    std::vector<std::pair<long long, int> > edges(3 * num_triangles);
+    for (int i = 0; i < num_triangles; i++) {
+        for (int k = 0; k < 3; k++) {
+            long long v0 = mesh.triangles[i][k];
+            long long v1 = mesh.triangles[i][(k + 1) % 3];
+            long long key = v0 < v1 ? (v0 << 32 | v1) : (v1 << 32 | v0);
+            edges[3 * i + k] = std::make_pair(key, 3 * i + k);
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+
+    std::vector<char> vertex_active(mesh.vertices.size(), 0);
+    mesh.flags.assign(num_triangles, 0);
+
+    size_t start = 0;
+    while (start < edges.size()) {
+        size_t end = start + 1;
+        while (end < edges.size() && edges[end].first == edges[start].first)
+            end++;
+
+        bool active = true;
+        if (end - start == 2) {
+            int i1 = edges[start].second / 3;
+            int k1 = edges[start].second % 3;
+            int i2 = edges[start + 1].second / 3;
+            int k2 = edges[start + 1].second % 3;
+            const vec3& t1 = mesh.triangles[i1];
+            const vec3& t2 = mesh.triangles[i2];
+            // Normal of the first triangle and vertex of the second triangle opposite to the edge
+            const real3& A = mesh.vertices[t1[0]];
+            real3 n = Cross(mesh.vertices[t1[1]] - A, mesh.vertices[t1[2]] - A);
+            real3 d = mesh.vertices[t2[(k2 + 2) % 3]] - mesh.vertices[t1[k1]];
+            real len = Length(n) * Length(d);
+            // The edge is convex if the opposite vertex is below the plane of the first triangle.
+            // Edges of triangles with inconsistent winding (traversing the edge in the same direction)
+            // are conservatively left active.
+            bool consistent = t1[k1] == t2[(k2 + 1) % 3];
+            active = !consistent || len == 0 || Dot(n, d) < -1e-3 * len;
+        }
+
+        for (size_t e = start; e < end; e++) {
+            int i = edges[e].second / 3;
+            int k = edges[e].second % 3;
+            if (active) {
+                mesh.flags[i] |= (1 << k);
+                vertex_active[mesh.triangles[i][k]] = 1;
+                vertex_active[mesh.triangles[i][(k + 1) % 3]] = 1;
+            }
+        }
+        start = end;
+    }
+
+    for (int i = 0; i < num_triangles; i++) {
+        for (int k = 0; k < 3; k++) {
+            if (vertex_active[mesh.triangles[i][k]])
+                mesh.flags[i] |= (1 << (3 + k));
+        }
+    }
+}
+
+// Recursively build the BVH node for the triangles order[first, first+count), splitting at the median
+// centroid along the largest axis. Nodes are stored in depth-first order (the first child of an internal
+// node immediately follows it). Returns the index of the new node.
+static int BuildMeshNode(MeshModel& mesh,
+                         std::vector<int>& order,
+                         const std::vector<real3>& centers,
+                         int first,
+                         int count) {
+    real3 bmin(C_LARGE_REAL), bmax(-C_LARGE_REAL);
+    real3 cmin(C_LARGE_REAL), cmax(-C_LARGE_REAL);
+    for (int i = first; i < first + count; i++) {
+        const vec3& tri = mesh.triangles[order[i]];
+        for (int k = 0; k < 3; k++) {
+            bmin = Min(bmin, mesh.vertices[tri[k]]);
+            bmax = Max(bmax, mesh.vertices[tri[k]]);
+        }
+        cmin = Min(cmin, centers[order[i]]);
+        cmax = Max(cmax, centers[order[i]]);
+    }
+
+    int node = (int)mesh.nodes.size();
+    mesh.node_min.push_back(bmin);
+    mesh.node_max.push_back(bmax);
+    mesh.nodes.push_back(vec2(first, count));
+
+    real3 extent = cmax - cmin;
+    int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z ? 1 : 2);
+    if (count <= mesh_leaf_size || extent[axis] <= 0)
+        return node;
+
+    int mid = first + count / 2;
+    std::nth_element(order.begin() + first, order.begin() + mid, order.begin() + first + count,
+                     [&](int a, int b) { return centers[a][axis] < centers[b][axis]; });
+    BuildMeshNode(mesh, order, centers, first, mid - first);
+    int second = BuildMeshNode(mesh, order, centers, mid, first + count - mid);
+    mesh.nodes[node] = vec2(second, 0);
+
+    return node;
+}
+
+// Build the BVH of a mesh and reorder its triangles (and flags) so that each leaf references a
+// contiguous range of triangles.
+static void BuildMeshBVH(MeshModel& mesh) {
+    int num_triangles = (int)mesh.triangles.size();
+    std::vector<int> order(num_triangles);
+    std::vector<real3> centers(num_triangles);
+    for (int i = 0; i < num_triangles; i++) {
+        const vec3& tri = mesh.triangles[i];
+        order[i] = i;
+        centers[i] = (mesh.vertices[tri[0]] + mesh.vertices[tri[1]] + mesh.vertices[tri[2]]) / 3.0;
+    }
+
+    mesh.nodes.clear();
+    mesh.node_min.clear();
+    mesh.node_max.clear();
+    BuildMeshNode(mesh, order, centers, 0, num_triangles);
+
+    std::vector<vec3> triangles(num_triangles);
+    std::vector<int> flags(num_triangles);
+    for (int i = 0; i < num_triangles; i++) {
+        triangles[i] = mesh.triangles[order[i]];
+        flags[i] = mesh.flags[order[i]];
+    }
+    mesh.triangles.swap(triangles);
+    mesh.flags.swap(flags);
+}
+
 /// Add a triangle mesh to this model
 bool ChCollisionModelParallel::AddTriangleMesh(const geometry::ChTriangleMesh& trimesh,
                                                bool is_static,
@@ -320,23 +473,95 @@ bool ChCollisionModelParallel::AddTriangleMesh(const geometry::ChTriangleMesh& t
                                                const ChVector<>& pos,
                                                const ChMatrix33<>& rot,
                                                double sphereswept_thickness) {
+    if (trimesh.getNumTriangles() == 0)
+        return false;
+
+    ChFrame<> frame;
+    TransformToCOG(GetBody(), pos, rot, frame);
+
+    // A convex mesh is represented by independent triangle shapes.
+    if (is_convex) {
+        const ChVector<>& position = frame.GetPos();
+        const ChQuaternion<>& rotation = frame.GetRot();
+
+        nObjects += trimesh.getNumTriangles();
+        ConvexModel tData;
+        for (int i = 0; i < trimesh.getNumTriangles(); i++) {
+            geometry::ChTriangle temptri = trimesh.getTriangle(i);
+            tData.A = real3(temptri.p1.x() + position.x(), temptri.p1.y() + position.y(),
+                            temptri.p1.z() + position.z());
+            tData.B = real3(temptri.p2.x() + position.x(), temptri.p2.y() + position.y(),
+                            temptri.p2.z() + position.z());
+            tData.C = real3(temptri.p3.x() + position.x(), temptri.p3.y() + position.y(),
+                            temptri.p3.z() + position.z());
+            tData.R = quaternion(rotation.e0(), rotation.e1(), rotation.e2(), rotation.e3());
+            tData.type = TRIANGLEMESH;
+
+            mData.push_back(tData);
+        }
+
+        return true;
+    }
+
+    // Weld coincident vertices and express them in the body centroidal frame.
+    MeshModel mesh;
+    std::map<real3, int, VertexLess> vertex_map;
+    for (int i = 0; i < trimesh.getNumTriangles(); i++) {
+        geometry::ChTriangle temptri = trimesh.getTriangle(i);
+        const ChVector<>* points[3] = {&temptri.p1, &temptri.p2, &temptri.p3};
+        vec3 tri;
+        for (int k = 0; k < 3; k++) {
+            ChVector<> p = frame.TransformPointLocalToParent(*points[k]);
+            real3 v(p.x(), p.y(), p.z());
+            auto it = vertex_map.find(v);
+            if (it == vertex_map.end()) {
+                it = vertex_map.insert(std::make_pair(v, (int)mesh.vertices.size())).first;
+                mesh.vertices.push_back(v);
+            }
+            tri[k] = it->second;
+        }
+        mesh.triangles.push_back(tri);
+    }
+
+    ComputeMeshFlags(mesh);
+    BuildMeshBVH(mesh);
+
+    nObjects++;
+    ConvexModel tData;
+    tData.A = real3(0, 0, 0);
+    tData.B = real3((chrono::real)local_mesh_data.size(), (chrono::real)mesh.triangles.size(), 0);
+    tData.C = real3(0, 0, 0);
+    tData.R = quaternion(1, 0, 0, 0);
+    tData.type = MESH;
+    mData.push_back(tData);
+
+    local_mesh_data.push_back(mesh);
+
+    return true;
+}
+
+/// Add a signed distance field to this model
+bool ChCollisionModelParallel::AddSignedDistanceField(std::shared_ptr<ChSignedDistanceField> sdf,
+                                                      const ChVector<>& pos,
+                                                      const ChMatrix33<>& rot) {
+    if (!sdf || sdf->GetNumBlocks() == 0)
+        return false;
+
     ChFrame<> frame;
     TransformToCOG(GetBody(), pos, rot, frame);
     const ChVector<>& position = frame.GetPos();
     const ChQuaternion<>& rotation = frame.GetRot();
 
-    nObjects += trimesh.getNumTriangles();
+    nObjects++;
     ConvexModel tData;
-    for (int i = 0; i < trimesh.getNumTriangles(); i++) {
-        geometry::ChTriangle temptri = trimesh.getTriangle(i);
-        tData.A = real3(temptri.p1.x() + position.x(), temptri.p1.y() + position.y(), temptri.p1.z() + position.z());
-        tData.B = real3(temptri.p2.x() + position.x(), temptri.p2.y() + position.y(), temptri.p2.z() + position.z());
-        tData.C = real3(temptri.p3.x() + position.x(), temptri.p3.y() + position.y(), temptri.p3.z() + position.z());
-        tData.R = quaternion(rotation.e0(), rotation.e1(), rotation.e2(), rotation.e3());
-        tData.type = TRIANGLEMESH;
+    tData.A = real3(position.x(), position.y(), position.z());
+    tData.B = real3((chrono::real)local_sdf_data.size(), 0, 0);
+    tData.C = real3(0, 0, 0);
+    tData.R = quaternion(rotation.e0(), rotation.e1(), rotation.e2(), rotation.e3());
+    tData.type = SDF;
+    mData.push_back(tData);
 
-        mData.push_back(tData);
-    }
+    local_sdf_data.push_back(sdf);
 
     return true;
 }
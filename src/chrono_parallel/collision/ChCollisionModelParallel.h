@@ -17,6 +17,7 @@
 #pragma once
 
 #include "chrono/collision/ChCCollisionModel.h"
+#include "chrono/collision/ChCSignedDistanceField.h"
 
 #include "chrono_parallel/ChApiParallel.h"
 #include "chrono_parallel/ChParallelDefines.h"
@@ -46,6 +47,19 @@ struct ConvexModel {
         : type(t), A(a), B(b), C(c), R(r), convex(con) {}
 };
 
+/// Class to encapsulate description of a triangle mesh collision shape.
+/// The triangles are stored with a static bounding volume hierarchy (in the body frame), built when
+/// the mesh is added to the collision model, and with flags marking which of their edges and vertices
+/// are active (i.e. not internal to a flat or concave region of the mesh).
+struct MeshModel {
+    std::vector<real3> vertices;   ///< mesh vertices (welded), in the body centroidal frame
+    std::vector<vec3> triangles;   ///< vertex indices of each triangle, in BVH leaf order
+    std::vector<int> flags;        ///< active edges (bits 0-2) and vertices (bits 3-5) of each triangle
+    std::vector<real3> node_min;   ///< lower corner of each BVH node
+    std::vector<real3> node_max;   ///< upper corner of each BVH node
+    std::vector<vec2> nodes;       ///< BVH nodes: (second child, 0) or (first triangle, count) for leaves
+};
+
 /// Class for geometric model for collision detection.
 /// A rigid body that interacts through contact must have a collision model.
 class CH_PARALLEL_API ChCollisionModelParallel : public ChCollisionModel {
@@ -152,6 +166,10 @@ class CH_PARALLEL_API ChCollisionModelParallel : public ChCollisionModel {
     /// Add a triangle mesh to this model, passing a triangle mesh (do not delete the triangle mesh
     /// until the collision model, because depending on the implementation of inherited ChCollisionModel
     /// classes, maybe the triangle is referenced via a striding interface or just copied)
+    /// A non-convex mesh is added as a single collision shape: the broadphase works with the bounding box
+    /// of the whole mesh and the candidate triangles are then found through a static BVH.
+    /// Contacts on edges and vertices internal to flat or concave regions of the mesh are discarded.
+    /// If is_convex is true, each triangle is added as a separate collision shape instead.
     /// Note: if possible, in sake of high performance, avoid triangle meshes and prefer simplified
     /// representations as compounds of convex shapes of boxes/spheres/etc type.
     virtual bool AddTriangleMesh(
@@ -163,6 +181,13 @@ class CH_PARALLEL_API ChCollisionModelParallel : public ChCollisionModel {
         double sphereswept_thickness = 0.0          ///< optional: outward sphereswept layer (when supported)
         ) override;
 
+    /// Add a signed distance field to this model (see ChCollisionModel::AddSignedDistanceField).
+    /// The field is shared, not copied. Only spheres and boxes collide with it: spheres at their center,
+    /// boxes at their vertices.
+    virtual bool AddSignedDistanceField(std::shared_ptr<ChSignedDistanceField> sdf,
+                                        const ChVector<>& pos = ChVector<>(),
+                                        const ChMatrix33<>& rot = ChMatrix33<>(1)) override;
+
     /// Add a barrel-like shape to this model (main axis on Y direction), for collision purposes.
     /// The barrel shape is made by lathing an arc of an ellipse around the vertical Y axis.
     /// The center of the ellipse is on Y=0 level, and it is ofsetted by R_offset from
@@ -200,6 +225,8 @@ class CH_PARALLEL_API ChCollisionModelParallel : public ChCollisionModel {
 
     std::vector<ConvexModel> mData;
     std::vector<real3> local_convex_data;
+    std::vector<MeshModel> local_mesh_data;
+    std::vector<std::shared_ptr<ChSignedDistanceField>> local_sdf_data;
 
   protected:
     ChBody* mbody;
@@ -17,6 +17,9 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <map>
+
 #include "chrono_parallel/collision/ChCollisionSystemParallel.h"
 #include "chrono_parallel/collision/ChCollision.h"
 
@@ -96,6 +99,41 @@ void ChCollisionSystemParallel::Add(ChCollisionModel* model) {
                     data_manager->shape_data.triangle_rigid.push_back(obB);
                     data_manager->shape_data.triangle_rigid.push_back(obC);
                     break;
+                case chrono::collision::MESH: {
+                    // Insert the mesh data, offsetting the vertex, triangle and node indices.
+                    // The shape references the root of the mesh BVH.
+                    const MeshModel& mesh = pmodel->local_mesh_data[(int)obB.x];
+                    shape_container& shape_data = data_manager->shape_data;
+                    int vertex_offset = (int)shape_data.mesh_vertices.size();
+                    int triangle_offset = (int)shape_data.mesh_triangles.size();
+                    int node_offset = (int)shape_data.mesh_bvh_node.size();
+                    shape_data.mesh_vertices.insert(shape_data.mesh_vertices.end(), mesh.vertices.begin(),
+                                                    mesh.vertices.end());
+                    for (size_t i = 0; i < mesh.triangles.size(); i++) {
+                        const vec3& tri = mesh.triangles[i];
+                        shape_data.mesh_triangles.push_back(
+                            vec3(tri[0] + vertex_offset, tri[1] + vertex_offset, tri[2] + vertex_offset));
+                    }
+                    shape_data.mesh_flags.insert(shape_data.mesh_flags.end(), mesh.flags.begin(), mesh.flags.end());
+                    shape_data.mesh_bvh_min.insert(shape_data.mesh_bvh_min.end(), mesh.node_min.begin(),
+                                                   mesh.node_min.end());
+                    shape_data.mesh_bvh_max.insert(shape_data.mesh_bvh_max.end(), mesh.node_max.begin(),
+                                                   mesh.node_max.end());
+                    for (size_t i = 0; i < mesh.nodes.size(); i++) {
+                        const vec2& node = mesh.nodes[i];
+                        if (node.y > 0)
+                            shape_data.mesh_bvh_node.push_back(vec2(node.x + triangle_offset, node.y));
+                        else
+                            shape_data.mesh_bvh_node.push_back(vec2(node.x + node_offset, 0));
+                    }
+                    start = node_offset;
+                    length = (int)mesh.triangles.size();
+                    break;
+                }
+                case chrono::collision::SDF:
+                    start = (int)data_manager->shape_data.sdf_rigid.size();
+                    data_manager->shape_data.sdf_rigid.push_back(pmodel->local_sdf_data[(int)obB.x]);
+                    break;
             }
 
             data_manager->shape_data.ObA_rigid.push_back(obA);
@@ -228,6 +266,10 @@ void ChCollisionSystemParallel::Run() {
 
     data_manager->system_timer.stop("collision_broad");
 
+    if (data_manager->settings.collision.collect_statistics) {
+        ComputeBroadphaseStatistics();
+    }
+
     data_manager->system_timer.start("collision_narrow");
     if (data_manager->num_fluid_bodies != 0) {
         data_manager->narrowphase->DispatchFluid();
@@ -246,6 +288,94 @@ void ChCollisionSystemParallel::Run() {
     }
 
     data_manager->system_timer.stop("collision_narrow");
+
+    if (data_manager->settings.collision.collect_statistics) {
+        ComputeNarrowphaseStatistics();
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Statistics
+// -----------------------------------------------------------------------------
+
+// Add a value to a histogram with power-of-two buckets (bucket 0 for the value 0, bucket k > 0 for the
+// values from 2^(k-1) to 2^k - 1).
+static void AddToHistogram(std::vector<uint>& histogram, uint value) {
+    uint bucket = 0;
+    while (value >> bucket)
+        bucket++;
+    if (histogram.size() <= bucket)
+        histogram.resize(bucket + 1, 0);
+    histogram[bucket]++;
+}
+
+// Count the given shape pairs per pair of shape types (the smaller type first).
+static void CountByShapeTypes(const custom_vector<long long>& pairs,
+                              uint num_pairs,
+                              const custom_vector<int>& types,
+                              std::vector<vec3>& counts) {
+    std::map<std::pair<int, int>, int> type_counts;
+    num_pairs = std::min(num_pairs, (uint)pairs.size());
+    for (uint i = 0; i < num_pairs; i++) {
+        int type1 = types[int(pairs[i] >> 32)];
+        int type2 = types[int(pairs[i] & 0xffffffff)];
+        type_counts[std::make_pair(std::min(type1, type2), std::max(type1, type2))]++;
+    }
+
+    counts.clear();
+    for (auto it = type_counts.begin(); it != type_counts.end(); ++it) {
+        counts.push_back(vec3(it->first.first, it->first.second, it->second));
+    }
+}
+
+// Memory allocated for the given array.
+template <typename T>
+static size_t ArrayMemory(const custom_vector<T>& array) {
+    return array.capacity() * sizeof(T);
+}
+
+void ChCollisionSystemParallel::ComputeBroadphaseStatistics() {
+    collision_measures& measures = data_manager->measures.collision;
+    const host_container& host_data = data_manager->host_data;
+
+    // Number of shapes and of candidate pairs in each active bin (both arrays hold exclusive scans).
+    measures.max_bin_shapes = 0;
+    measures.max_bin_pairs = 0;
+    measures.bin_shapes_histogram.clear();
+    measures.bin_pairs_histogram.clear();
+    for (uint i = 0; i < measures.number_of_bins_active; i++) {
+        uint num_shapes = host_data.bin_start_index[i + 1] - host_data.bin_start_index[i];
+        uint num_pairs = host_data.bin_num_contact[i + 1] - host_data.bin_num_contact[i];
+        measures.max_bin_shapes = std::max(measures.max_bin_shapes, num_shapes);
+        measures.max_bin_pairs = std::max(measures.max_bin_pairs, num_pairs);
+        AddToHistogram(measures.bin_shapes_histogram, num_shapes);
+        AddToHistogram(measures.bin_pairs_histogram, num_pairs);
+    }
+
+    CountByShapeTypes(host_data.contact_pairs, measures.number_of_contacts_possible, data_manager->shape_data.typ_rigid,
+                      measures.contacts_possible_types);
+
+    measures.broadphase_memory = ArrayMemory(host_data.bin_intersections) + ArrayMemory(host_data.bin_number) +
+                                 ArrayMemory(host_data.bin_number_out) + ArrayMemory(host_data.bin_aabb_number) +
+                                 ArrayMemory(host_data.bin_start_index) + ArrayMemory(host_data.bin_num_contact) +
+                                 ArrayMemory(host_data.contact_pairs);
+}
+
+void ChCollisionSystemParallel::ComputeNarrowphaseStatistics() {
+    collision_measures& measures = data_manager->measures.collision;
+    const host_container& host_data = data_manager->host_data;
+
+    // The narrowphase records the shape pair of each contact slot and compacts it with the contacts, so that
+    // the list of shape pairs holds one entry per rigid contact (a pair with several contacts appears once
+    // for each of them).
+    measures.number_of_contacts_active = data_manager->num_rigid_contacts;
+    CountByShapeTypes(host_data.contact_pairs, measures.number_of_contacts_active, data_manager->shape_data.typ_rigid,
+                      measures.contacts_active_types);
+
+    measures.contact_memory = ArrayMemory(host_data.norm_rigid_rigid) + ArrayMemory(host_data.cpta_rigid_rigid) +
+                              ArrayMemory(host_data.cptb_rigid_rigid) + ArrayMemory(host_data.dpth_rigid_rigid) +
+                              ArrayMemory(host_data.erad_rigid_rigid) + ArrayMemory(host_data.bids_rigid_rigid) +
+                              ArrayMemory(host_data.contact_triangles);
 }
 
 void ChCollisionSystemParallel::GetOverlappingAABB(custom_vector<char>& active_id, real3 Amin, real3 Amax) {
@@ -274,5 +404,95 @@ std::vector<vec2> ChCollisionSystemParallel::GetOverlappingPairs() {
     return pairs;
 }
 
+// -----------------------------------------------------------------------------
+// Ray and sphere casts
+// -----------------------------------------------------------------------------
+
+// Copy the hit returned by a cast in the ray-hit result.
+static bool SetRayhitResult(ChParallelDataManager* data_manager,
+                            real fraction,
+                            const real3& point,
+                            const real3& normal,
+                            int shape,
+                            ChCollisionSystem::ChRayhitResult& mresult) {
+    uint id = data_manager->shape_data.id_rigid[shape];
+    mresult.hitModel = (*data_manager->body_list)[id]->GetCollisionModel().get();
+    mresult.abs_hitPoint.Set(point.x, point.y, point.z);
+    mresult.abs_hitNormal.Set(normal.x, normal.y, normal.z);
+    mresult.dist_factor = fraction;
+    return true;
+}
+
+// Cast a sphere (a ray, if the radius is zero) against all bodies (body < 0) or the specified body.
+static bool CastSphere(ChParallelDataManager* data_manager,
+                       const ChVector<>& from,
+                       const ChVector<>& to,
+                       double radius,
+                       int body,
+                       ChCollisionSystem::ChRayhitResult& mresult) {
+    real fraction;
+    real3 point, normal;
+    int shape;
+    mresult.hit = data_manager->raycast->Cast(real3(from.x(), from.y(), from.z()), real3(to.x(), to.y(), to.z()),
+                                              radius, body, fraction, point, normal, shape);
+    if (!mresult.hit)
+        return false;
+    return SetRayhitResult(data_manager, fraction, point, normal, shape, mresult);
+}
+
+bool ChCollisionSystemParallel::RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& mresult) const {
+    return CastSphere(data_manager, from, to, 0, -1, mresult);
+}
+
+bool ChCollisionSystemParallel::RayHit(const ChVector<>& from,
+                                       const ChVector<>& to,
+                                       ChCollisionModel* model,
+                                       ChRayhitResult& mresult) const {
+    int body = static_cast<ChCollisionModelParallel*>(model)->GetBody()->GetId();
+    return CastSphere(data_manager, from, to, 0, body, mresult);
+}
+
+bool ChCollisionSystemParallel::SphereCast(const ChVector<>& from,
+                                           const ChVector<>& to,
+                                           double radius,
+                                           ChRayhitResult& mresult) const {
+    return CastSphere(data_manager, from, to, radius, -1, mresult);
+}
+
+bool ChCollisionSystemParallel::SweepSphere(ChCollisionModel* model,
+                                            const ChVector<>& from,
+                                            const ChVector<>& to,
+                                            double radius,
+                                            ChRayhitResult& mresult) const {
+    int body = static_cast<ChCollisionModelParallel*>(model)->GetBody()->GetId();
+    short2 family = S2(model->GetFamilyGroup(), model->GetFamilyMask());
+    real fraction;
+    real3 point, normal;
+    int shape;
+    mresult.hit = data_manager->raycast->Sweep(real3(from.x(), from.y(), from.z()), real3(to.x(), to.y(), to.z()),
+                                               radius, body, family, fraction, point, normal, shape);
+    if (!mresult.hit)
+        return false;
+    return SetRayhitResult(data_manager, fraction, point, normal, shape, mresult);
+}
+
+void ChCollisionSystemParallel::BatchRayHit(const std::vector<ChVector<>>& from,
+                                            const std::vector<ChVector<>>& to,
+                                            std::vector<ChRayhitResult>& results) const {
+    BatchSphereCast(from, to, 0, results);
+}
+
+void ChCollisionSystemParallel::BatchSphereCast(const std::vector<ChVector<>>& from,
+                                                const std::vector<ChVector<>>& to,
+                                                double radius,
+                                                std::vector<ChRayhitResult>& results) const {
+    int num_rays = (int)std::min(from.size(), to.size());
+    results.resize(num_rays);
+#pragma omp parallel for schedule(dynamic, 64)
+    for (int i = 0; i < num_rays; i++) {
+        CastSphere(data_manager, from[i], to[i], radius, -1, results[i]);
+    }
+}
+
 }  // end namespace collision
 }  // end namespace chrono
@@ -86,19 +86,38 @@ class CH_PARALLEL_API ChCollisionSystemParallel : public ChCollisionSystem {
     virtual void ReportProximities(ChProximityContainer* mproximitycontainer) {}
 
     /// Perform a ray-hit test with all collision models.
-    /// Currently not implemented.
-    virtual bool RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& mresult) const override {
-        return false;
-    }
+    /// The test uses the broadphase grid and is therefore valid only after a call to Run().
+    virtual bool RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& mresult) const override;
 
     /// Perform a ray-hit test with the specified collision model.
-    /// Currently not implemented.
     virtual bool RayHit(const ChVector<>& from,
                         const ChVector<>& to,
                         ChCollisionModel* model,
-                        ChRayhitResult& mresult) const override {
-        return false;
-    }
+                        ChRayhitResult& mresult) const override;
+
+    /// Perform a sphere-cast test with all collision models.
+    virtual bool SphereCast(const ChVector<>& from,
+                            const ChVector<>& to,
+                            double radius,
+                            ChRayhitResult& mresult) const override;
+
+    /// Perform a sphere-cast test for the continuous collision detection of the given model.
+    virtual bool SweepSphere(ChCollisionModel* model,
+                             const ChVector<>& from,
+                             const ChVector<>& to,
+                             double radius,
+                             ChRayhitResult& mresult) const override;
+
+    /// Perform a batch of ray-hit tests with all collision models, in parallel.
+    virtual void BatchRayHit(const std::vector<ChVector<>>& from,
+                             const std::vector<ChVector<>>& to,
+                             std::vector<ChRayhitResult>& results) const override;
+
+    /// Perform a batch of sphere-cast tests with all collision models, in parallel.
+    virtual void BatchSphereCast(const std::vector<ChVector<>>& from,
+                                 const std::vector<ChVector<>>& to,
+                                 double radius,
+                                 std::vector<ChRayhitResult>& results) const override;
 
     std::vector<vec2> GetOverlappingPairs();
     void GetOverlappingAABB(custom_vector<char>& active_id, real3 Amin, real3 Amax);
@@ -117,6 +136,11 @@ class CH_PARALLEL_API ChCollisionSystemParallel : public ChCollisionSystem {
     }
 
   private:
+    /// Collect the statistics on the bins and candidate pairs produced by the broadphase.
+    void ComputeBroadphaseStatistics();
+    /// Collect the statistics on the contacts produced by the narrowphase.
+    void ComputeNarrowphaseStatistics();
+
     ChParallelDataManager* data_manager;
     custom_vector<char> body_active;
     friend class chrono::ChSystemParallel;
@@ -43,26 +43,43 @@ class ConvexBase {
     virtual const real2 Capsule() const { return real2(0); }
     virtual const uvec4 TetIndex() const { return _make_uvec4(0, 0, 0, 0); }
     virtual const real3* TetNodes() const { return 0; }
+    virtual const ChSignedDistanceField* SDF() const { return 0; }
 };
 
 /// Convex contact shape.
+/// For a triangle mesh shape, the contact shape is one of the mesh triangles (see SetTriangle).
 class ConvexShape : public ConvexBase {
   public:
-    ConvexShape() {}
-    ConvexShape(int i, shape_container* d) : index(i), data(d) {}
+    ConvexShape() : triangle(-1) {}
+    ConvexShape(int i, shape_container* d) : index(i), data(d), triangle(-1) {}
     virtual ~ConvexShape() {}
-    virtual const int Type() const { return data->typ_rigid[index]; }
+    virtual const int Type() const { return triangle < 0 ? data->typ_rigid[index] : TRIANGLEMESH; }
     virtual const real3 A() const { return data->obj_data_A_global[index]; }
     virtual const quaternion R() const { return data->obj_data_R_global[index]; }
     virtual const int Size() const { return data->length_rigid[index]; }
     virtual const real3* Convex() const { return &data->convex_rigid[start()]; }
-    virtual const real3* Triangles() const { return &data->triangle_global[start()]; }
+    virtual const real3* Triangles() const { return triangle < 0 ? &data->triangle_global[start()] : &tri[0]; }
     virtual const real Radius() const { return data->sphere_rigid[start()]; }
     virtual const real3 Box() const { return data->box_like_rigid[start()]; }
     virtual const real4 Rbox() const { return data->rbox_like_rigid[start()]; }
     virtual const real2 Capsule() const { return data->capsule_rigid[start()]; }
+    virtual const ChSignedDistanceField* SDF() const { return data->sdf_rigid[start()].get(); }
+
+    /// Select the mesh triangle used as contact shape (-1 for none), given the body position and rotation.
+    void SetTriangle(int t, const real3& pos, const quaternion& rot) {
+        triangle = t;
+        if (t < 0)
+            return;
+        const vec3& ind = data->mesh_triangles[t];
+        tri[0] = TransformLocalToParent(pos, rot, data->mesh_vertices[ind[0]]);
+        tri[1] = TransformLocalToParent(pos, rot, data->mesh_vertices[ind[1]]);
+        tri[2] = TransformLocalToParent(pos, rot, data->mesh_vertices[ind[2]]);
+    }
+
     int index;
     shape_container* data;  // pointer to convex data;
+    int triangle;           ///< mesh triangle (MESH shapes only, -1 otherwise)
+    real3 tri[3];           ///< vertices of the mesh triangle, in the global frame
   private:
     virtual const inline int start() const { return data->start_rigid[index]; }
 };
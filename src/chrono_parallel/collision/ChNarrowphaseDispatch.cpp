@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <vector>
 
 #include "chrono/collision/ChCCollisionModel.h"
 
@@ -28,6 +29,8 @@
 
 #include <thrust/remove.h>
 #include <thrust/sort.h>
+#include <thrust/sequence.h>
+#include <thrust/reduce.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/count.h>
 #include <thrust/iterator/constant_iterator.h>
@@ -76,8 +79,8 @@ void ChCNarrowphaseDispatch::ProcessRigids() {
 }
 
 void ChCNarrowphaseDispatch::PreprocessCount() {
-    // MPR always reports at most one contact per pair.
-    if (narrowphase_algorithm == NarrowPhaseType::NARROWPHASE_MPR) {
+    // MPR always reports at most one contact per pair (pairs with signed distance fields excepted).
+    if (narrowphase_algorithm == NarrowPhaseType::NARROWPHASE_MPR && data_manager->shape_data.sdf_rigid.empty()) {
         thrust::fill(contact_index.begin(), contact_index.end(), 1);
         return;
     }
@@ -87,6 +90,11 @@ void ChCNarrowphaseDispatch::PreprocessCount() {
     //   - an interaction involving a sphere can produce at most one contact
     //   - an interaction involving a capsule can produce up to two contacts
     //   - a box-box interaction can produce up to 8 contacts
+    // Pairs with signed distance fields are processed with NarrowphaseR under every
+    // algorithm (including pure MPR), so they keep their own count:
+    //   - a box-SDF interaction can produce up to 8 contacts (one per box vertex)
+    // The shape pairs and triangle indices are recorded per contact slot in
+    // Dispatch_Finalize, so multi-contact pairs never index past the pair arrays.
 
     // shape type (per shape)
     const shape_type* obj_data_T = data_manager->shape_data.typ_rigid.data();
@@ -101,7 +109,11 @@ void ChCNarrowphaseDispatch::PreprocessCount() {
         shape_type type2 = obj_data_T[pair.y];
 
         // Set the maximum number of possible contacts for this particular pair
-        if (type1 == SPHERE || type2 == SPHERE) {
+        if (type1 == SDF || type2 == SDF) {
+            contact_index[index] = (type1 == BOX || type2 == BOX) ? 8 : 1;
+        } else if (narrowphase_algorithm == NarrowPhaseType::NARROWPHASE_MPR) {
+            contact_index[index] = 1;
+        } else if (type1 == SPHERE || type2 == SPHERE) {
             contact_index[index] = 1;
         } else if (type1 == CAPSULE || type2 == CAPSULE) {
             contact_index[index] = 2;
@@ -129,6 +141,7 @@ void ChCNarrowphaseDispatch::PreprocessLocalToParent() {
 
     data_manager->shape_data.obj_data_R_global.resize(num_shapes);
     data_manager->shape_data.triangle_global.resize(data_manager->shape_data.triangle_rigid.size());
+    bounding_radius.resize(num_shapes);
 
 #pragma omp parallel for
     for (int index = 0; index < (signed)num_shapes; index++) {
@@ -153,7 +166,108 @@ void ChCNarrowphaseDispatch::PreprocessLocalToParent() {
                 TransformLocalToParent(pos, rot, data_manager->shape_data.triangle_rigid[start + 2]);
         }
         data_manager->shape_data.obj_data_R_global[index] = Mult(rot, obj_data_R[index]);
+
+        // Radius of a sphere bounding the shape, centered at the shape position.
+        int start = data_manager->shape_data.start_rigid[index];
+        switch (T) {
+            case SPHERE:
+                bounding_radius[index] = (float)data_manager->shape_data.sphere_rigid[start];
+                break;
+            case ELLIPSOID:
+            case BOX:
+            case CYLINDER:
+                bounding_radius[index] = (float)Length(data_manager->shape_data.box_like_rigid[start]);
+                break;
+            case CAPSULE: {
+                const real2& capsule = data_manager->shape_data.capsule_rigid[start];
+                bounding_radius[index] = (float)(capsule.x + capsule.y);
+                break;
+            }
+            case ROUNDEDBOX:
+            case ROUNDEDCYL: {
+                const real4& rbox = data_manager->shape_data.rbox_like_rigid[start];
+                bounding_radius[index] = (float)(Length(real3(rbox.x, rbox.y, rbox.z)) + rbox.w);
+                break;
+            }
+            default:
+                bounding_radius[index] = -1;
+                break;
+        }
+    }
+}
+
+void ChCNarrowphaseDispatch::PreprocessDispatchOrder() {
+    const custom_vector<int>& obj_data_T = data_manager->shape_data.typ_rigid;
+    const custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+
+    dispatch_keys.resize(num_potential_rigid_contacts);
+    dispatch_order.resize(num_potential_rigid_contacts);
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+        vec2 pair = I2(int(contact_pairs[index] >> 32), int(contact_pairs[index] & 0xffffffff));
+        dispatch_keys[index] = obj_data_T[pair.x] * 32 + obj_data_T[pair.y];
+    }
+    Thrust_Sequence(dispatch_order);
+
+    // The sort is stable, so that the pairs of each type keep the broadphase order.
+    thrust::stable_sort_by_key(THRUST_PAR dispatch_keys.begin(), dispatch_keys.end(), dispatch_order.begin());
+}
+
+// Conservative single-precision rejection test for a pair of shapes: return true if the bounding spheres
+// of the two shapes (if any) are farther apart than the given separation. The relative tolerance covers
+// the rounding errors of the single-precision computation, so that no pair within the separation distance
+// is rejected.
+static inline bool BoundingSpheresSeparated(const real3& posA,
+                                            float radA,
+                                            const real3& posB,
+                                            float radB,
+                                            float separation) {
+    if (radA < 0 || radB < 0)
+        return false;
+    float dx = (float)(posA.x - posB.x);
+    float dy = (float)(posA.y - posB.y);
+    float dz = (float)(posA.z - posB.z);
+    float r = radA + radB + separation;
+    return dx * dx + dy * dy + dz * dz > 1.0001f * r * r;
+}
+
+// Tolerances used to identify contacts on the edges and vertices of mesh triangles.
+static const real mesh_normal_tolerance = 1e-4;       // deviation of the contact normal from the face normal
+static const real mesh_barycentric_tolerance = 1e-4;  // barycentric coordinates considered zero
+
+// Check whether a contact on a mesh triangle is generated by an internal feature of the mesh.
+// A contact whose normal is not aligned with the triangle normal is attributed to the closest edge or
+// vertex of the triangle; if that feature is internal (shared with a coplanar or concave neighbor),
+// the contact is discarded, as the neighboring triangle provides the proper face contact.
+static bool MeshContactInternal(const ConvexShape* shape, const real3& pt, const real3& norm) {
+    if (shape->triangle < 0)
+        return false;
+    int flags = shape->data->mesh_flags[shape->triangle];
+    if (flags == 63)
+        return false;
+
+    const real3* tri = shape->Triangles();
+    real3 n = Cross(tri[1] - tri[0], tri[2] - tri[0]);
+    real len = Length(n);
+    if (len == 0 || Abs(Dot(n, norm)) >= (1 - mesh_normal_tolerance) * len)
+        return false;
+
+    real3 res, barycentric;
+    SnapeToFaceBary(tri[0], tri[1], tri[2], pt, res, barycentric);
+    bool zero[3] = {barycentric.x <= mesh_barycentric_tolerance, barycentric.y <= mesh_barycentric_tolerance,
+                    barycentric.z <= mesh_barycentric_tolerance};
+    int num_zero = zero[0] + zero[1] + zero[2];
+    if (num_zero == 0)
+        return false;
+    if (num_zero == 1) {
+        // Edge opposite to vertex k, i.e. from vertex k+1 to vertex k+2
+        int k = zero[0] ? 0 : (zero[1] ? 1 : 2);
+        return (flags & (1 << ((k + 1) % 3))) == 0;
     }
+    // Vertex k (the only one with non-zero barycentric coordinate)
+    int k = !zero[0] ? 0 : (!zero[1] ? 1 : 2);
+    return (flags & (1 << (3 + k))) == 0;
 }
 
 void ChCNarrowphaseDispatch::Dispatch_Init(uint index,
@@ -179,17 +293,36 @@ void ChCNarrowphaseDispatch::Dispatch_Init(uint index,
     shapeA->data = &data_manager->shape_data;
     shapeB->data = &data_manager->shape_data;
 
+    // Select the candidate triangles of mesh shapes
+    const vec2& triangles = data_manager->host_data.contact_triangles[index];
+    shapeA->SetTriangle(triangles.x, data_manager->host_data.pos_rigid[ID_A], data_manager->host_data.rot_rigid[ID_A]);
+    shapeB->SetTriangle(triangles.y, data_manager->host_data.pos_rigid[ID_B], data_manager->host_data.rot_rigid[ID_B]);
+
     //// TODO: what is the best way to dispatch this?
     icoll = contact_index[index];
 }
 
-void ChCNarrowphaseDispatch::Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC) {
+void ChCNarrowphaseDispatch::Dispatch_Finalize(uint icoll,
+                                               uint ID_A,
+                                               uint ID_B,
+                                               int nC,
+                                               const ConvexShape* shapeA,
+                                               const ConvexShape* shapeB) {
     custom_vector<vec2>& body_ids = data_manager->host_data.bids_rigid_rigid;
+    const custom_vector<real3>& norm = data_manager->host_data.norm_rigid_rigid;
+    const custom_vector<real3>& ptA = data_manager->host_data.cpta_rigid_rigid;
+    const custom_vector<real3>& ptB = data_manager->host_data.cptb_rigid_rigid;
 
-    // Mark the active contacts and set their body IDs
+    // Mark the active contacts and set their body IDs, shape pair and mesh triangles
     for (int i = 0; i < nC; i++) {
+        // Skip contacts on internal edges and vertices of triangle meshes
+        if (MeshContactInternal(shapeA, ptA[icoll + i], norm[icoll + i]) ||
+            MeshContactInternal(shapeB, ptB[icoll + i], norm[icoll + i]))
+            continue;
         contact_rigid_active[icoll + i] = true;
         body_ids[icoll + i] = I2(ID_A, ID_B);
+        slot_pairs[icoll + i] = ((long long)shapeA->index << 32) | (long long)shapeB->index;
+        slot_triangles[icoll + i] = I2(shapeA->triangle, shapeB->triangle);
     }
 }
 
@@ -203,19 +336,44 @@ void ChCNarrowphaseDispatch::DispatchMPR() {
     ConvexShape shapeA;
     ConvexShape shapeB;
 
-#pragma omp parallel for private(shapeA, shapeB)
-    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+    const real3* obj_data_A = data_manager->shape_data.obj_data_A_global.data();
+    const float* radius = bounding_radius.data();
+    const float separation = (float)(2 * collision_envelope);
+    const bool pretest = data_manager->settings.collision.mpr_batching;
+    uint num_culled = 0;
+
+#pragma omp parallel for private(shapeA, shapeB) reduction(+ : num_culled)
+    for (int k = 0; k < (signed)num_potential_rigid_contacts; k++) {
+        uint index = dispatch_order[k];
         uint ID_A, ID_B, icoll;
 
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
+        if (pretest && BoundingSpheresSeparated(obj_data_A[shapeA.index], radius[shapeA.index],
+                                                obj_data_A[shapeB.index], radius[shapeB.index], separation)) {
+            num_culled++;
+            continue;
+        }
+
+        // Signed distance fields have no support function: always use NarrowphaseR.
+        if (shapeA.Type() == SDF || shapeB.Type() == SDF) {
+            int nC;
+            if (RCollision(&shapeA, &shapeB, 2 * collision_envelope, &norm[icoll], &ptA[icoll], &ptB[icoll],
+                           &contactDepth[icoll], &effective_radius[icoll], nC)) {
+                Dispatch_Finalize(icoll, ID_A, ID_B, nC, &shapeA, &shapeB);
+            }
+            continue;
+        }
+
         if (MPRCollision(&shapeA, &shapeB, collision_envelope, norm[icoll], ptA[icoll], ptB[icoll],
                          contactDepth[icoll])) {
             effective_radius[icoll] = edge_radius;
             // The number of contacts reported by MPR is always 1.
-            Dispatch_Finalize(icoll, ID_A, ID_B, 1);
+            Dispatch_Finalize(icoll, ID_A, ID_B, 1, &shapeA, &shapeB);
         }
     }
+
+    data_manager->measures.collision.number_of_pairs_culled = num_culled;
 }
 
 void ChCNarrowphaseDispatch::DispatchR() {
@@ -238,7 +396,7 @@ void ChCNarrowphaseDispatch::DispatchR() {
 
         if (RCollision(&shapeA, &shapeB, 2 * collision_envelope, &norm[icoll], &ptA[icoll], &ptB[icoll],
                        &contactDepth[icoll], &effective_radius[icoll], nC)) {
-            Dispatch_Finalize(icoll, ID_A, ID_B, nC);
+            Dispatch_Finalize(icoll, ID_A, ID_B, nC, &shapeA, &shapeB);
         }
     }
 }
@@ -253,25 +411,40 @@ void ChCNarrowphaseDispatch::DispatchHybridMPR() {
     ConvexShape shapeA;
     ConvexShape shapeB;
 
-#pragma omp parallel for private(shapeA, shapeB)
-    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+    const real3* obj_data_A = data_manager->shape_data.obj_data_A_global.data();
+    const float* radius = bounding_radius.data();
+    const float separation = (float)(2 * collision_envelope);
+    const bool pretest = data_manager->settings.collision.mpr_batching;
+    uint num_culled = 0;
+
+#pragma omp parallel for private(shapeA, shapeB) reduction(+ : num_culled)
+    for (int k = 0; k < (signed)num_potential_rigid_contacts; k++) {
+        uint index = dispatch_order[k];
         uint ID_A, ID_B, icoll;
 
         int nC;
 
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
+        if (pretest && BoundingSpheresSeparated(obj_data_A[shapeA.index], radius[shapeA.index],
+                                                obj_data_A[shapeB.index], radius[shapeB.index], separation)) {
+            num_culled++;
+            continue;
+        }
+
         if (RCollision(&shapeA, &shapeB, 2 * collision_envelope, &norm[icoll], &ptA[icoll], &ptB[icoll],
                        &contactDepth[icoll], &effective_radius[icoll], nC)) {
-            Dispatch_Finalize(icoll, ID_A, ID_B, nC);
+            Dispatch_Finalize(icoll, ID_A, ID_B, nC, &shapeA, &shapeB);
         } else if (MPRCollision(&shapeA, &shapeB, collision_envelope, norm[icoll], ptA[icoll], ptB[icoll],
                                 contactDepth[icoll])) {
             effective_radius[icoll] = edge_radius;
-            Dispatch_Finalize(icoll, ID_A, ID_B, 1);
+            Dispatch_Finalize(icoll, ID_A, ID_B, 1, &shapeA, &shapeB);
         }
         // delete shapeA;
         // delete shapeB;
     }
+
+    data_manager->measures.collision.number_of_pairs_culled = num_culled;
 }
 
 void ChCNarrowphaseDispatch::DispatchRigid() {
@@ -283,6 +456,7 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
     custom_vector<real>& erad_data = data_manager->host_data.erad_rigid_rigid;
     custom_vector<vec2>& bids_data = data_manager->host_data.bids_rigid_rigid;
     custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+    custom_vector<vec2>& contact_triangles = data_manager->host_data.contact_triangles;
     uint& num_rigid_contacts = data_manager->num_rigid_contacts;
     // Set maximum possible number of contacts for each potential collision
     // (depending on the narrowphase algorithm and on the types of shapes in
@@ -303,11 +477,26 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
     erad_data.resize(num_potentialContacts);
     bids_data.resize(num_potentialContacts);
 
+    // The shape pair and mesh triangles are recorded per contact slot (a pair may produce several contacts).
+    slot_pairs.resize(num_potentialContacts);
+    slot_triangles.resize(num_potentialContacts);
+
     // These flags will keep track of which collision pairs are actually active
     // (as decided by the narrowphase algorithm).
     contact_rigid_active.resize(num_potentialContacts);
     thrust::fill(contact_rigid_active.begin(), contact_rigid_active.end(), false);
 
+    // The MPR kernels process the potential contacts sorted by shape types (or in the broadphase order).
+    data_manager->measures.collision.number_of_pairs_culled = 0;
+    if (narrowphase_algorithm != NarrowPhaseType::NARROWPHASE_R) {
+        if (data_manager->settings.collision.mpr_batching) {
+            PreprocessDispatchOrder();
+        } else {
+            dispatch_order.resize(num_potential_rigid_contacts);
+            Thrust_Sequence(dispatch_order);
+        }
+    }
+
     switch (narrowphase_algorithm) {
         case NarrowPhaseType::NARROWPHASE_MPR:
             DispatchMPR();
@@ -320,15 +509,42 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
             break;
     }
 
+    // From now on, the lists of shape pairs and mesh triangles hold one entry per contact slot.
+    contact_pairs.swap(slot_pairs);
+    contact_triangles.swap(slot_triangles);
+
+    RemoveInactiveRigidContacts();
+
+    // Contact reduction only applies to NSC: SMC forces scale with the number of contacts.
+    if (data_manager->settings.collision.contact_reduction &&
+        data_manager->settings.system_type == SystemType::SYSTEM_NSC) {
+        ReduceRigidContacts();
+    }
+
+    LOG(TRACE) << "ChCNarrowphaseDispatch::DispatchRigid() E " << num_rigid_contacts;
+}
+
+void ChCNarrowphaseDispatch::RemoveInactiveRigidContacts() {
+    custom_vector<real3>& norm_data = data_manager->host_data.norm_rigid_rigid;
+    custom_vector<real3>& cpta_data = data_manager->host_data.cpta_rigid_rigid;
+    custom_vector<real3>& cptb_data = data_manager->host_data.cptb_rigid_rigid;
+    custom_vector<real>& dpth_data = data_manager->host_data.dpth_rigid_rigid;
+    custom_vector<real>& erad_data = data_manager->host_data.erad_rigid_rigid;
+    custom_vector<vec2>& bids_data = data_manager->host_data.bids_rigid_rigid;
+    custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+    custom_vector<vec2>& contact_triangles = data_manager->host_data.contact_triangles;
+    uint& num_rigid_contacts = data_manager->num_rigid_contacts;
+
     num_rigid_contacts = (uint)Thrust_Count(contact_rigid_active, 1);
     // Remove elements corresponding to inactive contacts. We do this in one step,
     // using zip iterators and removing all entries for which contact_active is 'false'.
     thrust::remove_if(
         thrust::make_zip_iterator(thrust::make_tuple(norm_data.begin(), cpta_data.begin(), cptb_data.begin(),
                                                      dpth_data.begin(), erad_data.begin(), bids_data.begin(),
-                                                     contact_pairs.begin())),
+                                                     contact_pairs.begin(), contact_triangles.begin())),
         thrust::make_zip_iterator(thrust::make_tuple(norm_data.end(), cpta_data.end(), cptb_data.end(), dpth_data.end(),
-                                                     erad_data.end(), bids_data.end(), contact_pairs.end())),
+                                                     erad_data.end(), bids_data.end(), contact_pairs.end(),
+                                                     contact_triangles.end())),
         contact_rigid_active.begin(), thrust::logical_not<bool>());
 
     // Resize all lists so that we don't access invalid contacts
@@ -339,7 +555,163 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
     erad_data.resize(num_rigid_contacts);
     bids_data.resize(num_rigid_contacts);
     contact_pairs.resize(num_rigid_contacts);
-    LOG(TRACE) << "ChCNarrowphaseDispatch::DispatchRigid() E " << num_rigid_contacts;
+    contact_triangles.resize(num_rigid_contacts);
+}
+
+// Reduce the contacts of one cluster (contacts between the same two bodies, with similar normals) to at
+// most 'max_contacts' contacts, by flagging the others as inactive. The contacts are selected in the
+// plane orthogonal to the cluster normal: the deepest contact, the contact farthest from it, the contact
+// maximizing the area of the triangle with the first two, then (farthest point sampling) the contacts
+// farthest from those already selected.
+static void ReduceContactCluster(const std::vector<uint>& cluster,
+                                 const real3& normal,
+                                 int max_contacts,
+                                 const real3* cpta,
+                                 const real3* cptb,
+                                 const real* depth,
+                                 char* active) {
+    int num = (int)cluster.size();
+    std::vector<real3> pts(num);
+    std::vector<bool> selected(num, false);
+
+    // Contact points, projected onto the plane orthogonal to the cluster normal.
+    for (int k = 0; k < num; k++) {
+        real3 p = (cpta[cluster[k]] + cptb[cluster[k]]) * real(0.5);
+        pts[k] = p - Dot(p, normal) * normal;
+    }
+
+    // Deepest contact (depth is negative for penetration).
+    int s0 = 0;
+    for (int k = 1; k < num; k++) {
+        if (depth[cluster[k]] < depth[cluster[s0]])
+            s0 = k;
+    }
+    selected[s0] = true;
+
+    // Contact farthest from the first one.
+    int s1 = -1;
+    real best = -1;
+    for (int k = 0; k < num; k++) {
+        real d = Length2(pts[k] - pts[s0]);
+        if (!selected[k] && d > best) {
+            best = d;
+            s1 = k;
+        }
+    }
+    selected[s1] = true;
+
+    // Contact maximizing the area of the triangle with the first two.
+    int s2 = -1;
+    best = -1;
+    for (int k = 0; k < num; k++) {
+        real a = Abs(Dot(Cross(pts[s1] - pts[s0], pts[k] - pts[s0]), normal));
+        if (!selected[k] && a > best) {
+            best = a;
+            s2 = k;
+        }
+    }
+    selected[s2] = true;
+
+    // Remaining contacts, by farthest point sampling.
+    std::vector<real> dist(num);
+    for (int k = 0; k < num; k++) {
+        dist[k] = Min(Min(Length2(pts[k] - pts[s0]), Length2(pts[k] - pts[s1])), Length2(pts[k] - pts[s2]));
+    }
+    for (int n = 3; n < max_contacts; n++) {
+        int sn = -1;
+        best = -1;
+        for (int k = 0; k < num; k++) {
+            if (!selected[k] && dist[k] > best) {
+                best = dist[k];
+                sn = k;
+            }
+        }
+        selected[sn] = true;
+        for (int k = 0; k < num; k++) {
+            dist[k] = Min(dist[k], Length2(pts[k] - pts[sn]));
+        }
+    }
+
+    for (int k = 0; k < num; k++) {
+        if (!selected[k])
+            active[cluster[k]] = false;
+    }
+}
+
+void ChCNarrowphaseDispatch::ReduceRigidContacts() {
+    LOG(TRACE) << "ChCNarrowphaseDispatch::ReduceRigidContacts() S";
+    const custom_vector<real3>& norm_data = data_manager->host_data.norm_rigid_rigid;
+    const custom_vector<real3>& cpta_data = data_manager->host_data.cpta_rigid_rigid;
+    const custom_vector<real3>& cptb_data = data_manager->host_data.cptb_rigid_rigid;
+    const custom_vector<real>& dpth_data = data_manager->host_data.dpth_rigid_rigid;
+    const custom_vector<vec2>& bids_data = data_manager->host_data.bids_rigid_rigid;
+    uint num_contacts = data_manager->num_rigid_contacts;
+
+    int max_contacts = std::max(data_manager->settings.collision.max_reduced_contacts, 3);
+    real cos_tol = Cos(data_manager->settings.collision.reduction_angle_tolerance);
+
+    if (num_contacts <= (uint)max_contacts)
+        return;
+
+    // Sort the contacts by body pair. The sort is stable, so that the contacts of a pair are always
+    // processed in the order in which the narrowphase produced them and the selection is deterministic.
+    reduce_keys.resize(num_contacts);
+    reduce_index.resize(num_contacts);
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_contacts; index++) {
+        const vec2& bids = bids_data[index];
+        reduce_keys[index] = ((long long)std::min(bids.x, bids.y) << 32) | (long long)(uint)std::max(bids.x, bids.y);
+    }
+    Thrust_Sequence(reduce_index);
+    thrust::stable_sort_by_key(THRUST_PAR reduce_keys.begin(), reduce_keys.end(), reduce_index.begin());
+
+    // Find the range of contacts of each body pair.
+    reduce_pairs.resize(num_contacts);
+    reduce_start.resize(num_contacts + 1);
+    uint num_pairs = (uint)(Run_Length_Encode(reduce_keys, reduce_pairs, reduce_start));
+    reduce_start.resize(num_pairs + 1);
+    reduce_start[num_pairs] = 0;
+    Thrust_Exclusive_Scan(reduce_start);
+
+    contact_rigid_active.resize(num_contacts);
+    thrust::fill(contact_rigid_active.begin(), contact_rigid_active.end(), true);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int ipair = 0; ipair < (signed)num_pairs; ipair++) {
+        uint start = reduce_start[ipair];
+        uint count = reduce_start[ipair + 1] - start;
+        if (count <= (uint)max_contacts)
+            continue;
+
+        // Cluster the contacts of this pair by normal direction (normals oriented from the body with
+        // the smaller identifier to the other one).
+        std::vector<std::vector<uint>> clusters;
+        std::vector<real3> normals;
+        for (uint k = start; k < start + count; k++) {
+            uint index = reduce_index[k];
+            real3 normal = norm_data[index];
+            if (bids_data[index].x > bids_data[index].y)
+                normal = -normal;
+            size_t ic = 0;
+            while (ic < clusters.size() && Dot(normal, normals[ic]) < cos_tol)
+                ic++;
+            if (ic == clusters.size()) {
+                clusters.push_back(std::vector<uint>());
+                normals.push_back(normal);
+            }
+            clusters[ic].push_back(index);
+        }
+
+        for (size_t ic = 0; ic < clusters.size(); ic++) {
+            if (clusters[ic].size() > (size_t)max_contacts) {
+                ReduceContactCluster(clusters[ic], normals[ic], max_contacts, cpta_data.data(), cptb_data.data(),
+                                     dpth_data.data(), contact_rigid_active.data());
+            }
+        }
+    }
+
+    RemoveInactiveRigidContacts();
+    LOG(TRACE) << "ChCNarrowphaseDispatch::ReduceRigidContacts() E " << data_manager->num_rigid_contacts;
 }
 
 void ChCNarrowphaseDispatch::DispatchRigidFluid() {
@@ -660,7 +1032,9 @@ void ChCNarrowphaseDispatch::RigidSphereContact(const real sphere_radius,
                         real3 Amax = data_manager->host_data.aabb_max[shape_id_a];
                         // if the sphere and the rigid body appear in the same bin more than once, dont count
                         if (current_bin(Amin, Amax, Bmin, Bmax, inv_bin_size, bins_per_axis, bin_number) == true) {
-                            if (overlap(Amin, Amax, Bmin, Bmax) && collide(family, fam_data[shape_id_a])) {
+                            // Triangle meshes do not collide with fluid and FEA nodes
+                            if (overlap(Amin, Amax, Bmin, Bmax) && collide(family, fam_data[shape_id_a]) &&
+                                data_manager->shape_data.typ_rigid[shape_id_a] != MESH) {
                                 ConvexShape* shapeA = new ConvexShape(shape_id_a, &data_manager->shape_data);
                                 real3 ptA, ptB, norm;
                                 real depth, erad = 0;
@@ -812,6 +1186,10 @@ void ChCNarrowphaseDispatch::RigidTetContact(custom_vector<real3>& norm_rigid_te
                     }
                     if (!collide(family, fam_data[shape_id_a]))
                         continue;
+                    // Triangle meshes and distance fields do not collide with FEA tetrahedra
+                    if (data_manager->shape_data.typ_rigid[shape_id_a] == MESH ||
+                        data_manager->shape_data.typ_rigid[shape_id_a] == SDF)
+                        continue;
                     ConvexShape* shapeA = new ConvexShape(shape_id_a, &data_manager->shape_data);
 
                     real3 ptA, ptB, norm;
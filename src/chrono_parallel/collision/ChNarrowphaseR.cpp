@@ -41,6 +41,16 @@ namespace collision {
 // This function returns true if it was able to determine the collision state
 // for the given pair of shapes and false if the shape types are not supported.
 
+// The analytic ellipsoid functions return -1 for configurations they cannot resolve. In that
+// case, report no contact and let the caller fall back on another algorithm (if any).
+static inline bool ResolvedR(int& nC) {
+    if (nC < 0) {
+        nC = 0;
+        return false;
+    }
+    return true;
+}
+
 bool RCollision(const ConvexBase* shapeA,  // first candidate shape
                 const ConvexBase* shapeB,  // second candidate shape
                 real separation,           // maximum separation
@@ -190,6 +200,93 @@ bool RCollision(const ConvexBase* shapeA,  // first candidate shape
         return true;
     }
 
+    if (shapeA->Type() == ELLIPSOID && shapeB->Type() == SPHERE) {
+        nC = ellipsoid_sphere(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->A(), shapeB->Radius(), separation,
+                              *ct_norm, *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad);
+        return ResolvedR(nC);
+    }
+
+    if (shapeA->Type() == SPHERE && shapeB->Type() == ELLIPSOID) {
+        nC = ellipsoid_sphere(shapeB->A(), shapeB->R(), shapeB->Box(), shapeA->A(), shapeA->Radius(), separation,
+                              *ct_norm, *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad);
+        if (nC == 1)
+            *ct_norm = -(*ct_norm);
+        return ResolvedR(nC);
+    }
+
+    if (shapeA->Type() == BOX && shapeB->Type() == ELLIPSOID) {
+        nC = box_ellipsoid(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->A(), shapeB->R(), shapeB->Box(),
+                           separation, *ct_norm, *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad);
+        return ResolvedR(nC);
+    }
+
+    if (shapeA->Type() == ELLIPSOID && shapeB->Type() == BOX) {
+        nC = box_ellipsoid(shapeB->A(), shapeB->R(), shapeB->Box(), shapeA->A(), shapeA->R(), shapeA->Box(),
+                           separation, *ct_norm, *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad);
+        if (nC == 1)
+            *ct_norm = -(*ct_norm);
+        return ResolvedR(nC);
+    }
+
+    if (shapeA->Type() == TRIANGLEMESH && shapeB->Type() == ELLIPSOID) {
+        nC = face_ellipsoid(shapeA->Triangles()[0], shapeA->Triangles()[1], shapeA->Triangles()[2], shapeB->A(),
+                            shapeB->R(), shapeB->Box(), separation, *ct_norm, *ct_depth, *ct_pt1, *ct_pt2,
+                            *ct_eff_rad);
+        return ResolvedR(nC);
+    }
+
+    if (shapeA->Type() == ELLIPSOID && shapeB->Type() == TRIANGLEMESH) {
+        nC = face_ellipsoid(shapeB->Triangles()[0], shapeB->Triangles()[1], shapeB->Triangles()[2], shapeA->A(),
+                            shapeA->R(), shapeA->Box(), separation, *ct_norm, *ct_depth, *ct_pt2, *ct_pt1,
+                            *ct_eff_rad);
+        if (nC == 1)
+            *ct_norm = -(*ct_norm);
+        return ResolvedR(nC);
+    }
+
+    if (shapeA->Type() == ELLIPSOID && shapeB->Type() == ELLIPSOID) {
+        nC = ellipsoid_ellipsoid(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->A(), shapeB->R(), shapeB->Box(),
+                                 separation, *ct_norm, *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad);
+        return ResolvedR(nC);
+    }
+
+    if (shapeA->Type() == SDF && shapeB->Type() == SPHERE) {
+        if (sdf_sphere(shapeA->SDF(), shapeA->A(), shapeA->R(), shapeB->A(), shapeB->Radius(), separation, *ct_norm,
+                       *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad)) {
+            nC = 1;
+        }
+        return true;
+    }
+
+    if (shapeA->Type() == SPHERE && shapeB->Type() == SDF) {
+        if (sdf_sphere(shapeB->SDF(), shapeB->A(), shapeB->R(), shapeA->A(), shapeA->Radius(), separation, *ct_norm,
+                       *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad)) {
+            *ct_norm = -(*ct_norm);
+            nC = 1;
+        }
+        return true;
+    }
+
+    if (shapeA->Type() == SDF && shapeB->Type() == BOX) {
+        nC = sdf_box(shapeA->SDF(), shapeA->A(), shapeA->R(), shapeB->A(), shapeB->R(), shapeB->Box(), separation,
+                     ct_norm, ct_depth, ct_pt1, ct_pt2, ct_eff_rad);
+        return true;
+    }
+
+    if (shapeA->Type() == BOX && shapeB->Type() == SDF) {
+        nC = sdf_box(shapeB->SDF(), shapeB->A(), shapeB->R(), shapeA->A(), shapeA->R(), shapeA->Box(), separation,
+                     ct_norm, ct_depth, ct_pt2, ct_pt1, ct_eff_rad);
+        for (int i = 0; i < nC; i++) {
+            *(ct_norm + i) = -(*(ct_norm + i));
+        }
+        return true;
+    }
+
+    // Other shapes do not collide with signed distance fields (these cannot be processed by MPR either)
+    if (shapeA->Type() == SDF || shapeB->Type() == SDF) {
+        return true;
+    }
+
     if (shapeA->Type() == BOX && shapeB->Type() == BOX) {
         nC = box_box(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->A(), shapeB->R(), shapeB->Box(), ct_norm,
                      ct_depth, ct_pt1, ct_pt2, ct_eff_rad);
@@ -604,6 +701,290 @@ bool face_sphere(const real3& A1,
     return true;
 }
 
+// =============================================================================
+//              ELLIPSOID - SPHERE
+
+// Ellipsoid-sphere narrow phase collision detection.
+// In:  ellipsoid at position pos1, with orientation rot1, and semi-axes hdims1
+//      sphere centered at pos2 and with radius2
+// Returns the number of contacts (0 or 1), or -1 if the sphere center is inside
+// the ellipsoid (in which case the closest point problem is not solved here).
+
+int ellipsoid_sphere(const real3& pos1,
+                     const quaternion& rot1,
+                     const real3& hdims1,
+                     const real3& pos2,
+                     const real& radius2,
+                     const real& separation,
+                     real3& norm,
+                     real& depth,
+                     real3& pt1,
+                     real3& pt2,
+                     real& eff_radius) {
+    // Express the sphere position in the frame of the ellipsoid.
+    real3 spherePos = TransformParentToLocal(pos1, rot1, pos2);
+
+    // Quick rejection, based on the largest semi-axis.
+    real radius2_s = radius2 + separation;
+    real hmax = Max(hdims1.x, Max(hdims1.y, hdims1.z));
+    if (Dot(spherePos, spherePos) >= (hmax + radius2_s) * (hmax + radius2_s))
+        return 0;
+
+    // Snap the sphere position to the surface of the ellipsoid.
+    real3 ellipsoidPos = spherePos;
+    if (!snap_to_ellipsoid(hdims1, ellipsoidPos))
+        return -1;
+
+    // If the distance from the sphere center to the closest point is larger
+    // than the sphere radius plus the separation value, there is no contact.
+    real3 delta = spherePos - ellipsoidPos;
+    real dist2 = Dot(delta, delta);
+
+    if (dist2 >= radius2_s * radius2_s)
+        return 0;
+    if (dist2 <= 1e-12f)
+        return -1;
+
+    // Generate contact information
+    real dist = Sqrt(dist2);
+    real radius1 = ellipsoid_curvature_radius(hdims1, ellipsoidPos);
+    depth = dist - radius2;
+    norm = Rotate(delta / dist, rot1);
+    pt1 = TransformLocalToParent(pos1, rot1, ellipsoidPos);
+    pt2 = pos2 - norm * radius2;
+    eff_radius = radius1 * radius2 / (radius1 + radius2);
+
+    return 1;
+}
+
+// =============================================================================
+//              BOX - ELLIPSOID
+
+// Box-ellipsoid narrow phase collision detection.
+// In:  box at position pos1, with orientation rot1, and half-dimensions hdims1
+//      ellipsoid at position pos2, with orientation rot2, and semi-axes hdims2
+// Only face interactions are resolved: the ellipsoid center must be in the
+// region of a box face and the ellipsoid point farthest in the direction of the
+// face normal must project inside that face. Returns the number of contacts
+// (0 or 1), or -1 for all other configurations.
+
+int box_ellipsoid(const real3& pos1,
+                  const quaternion& rot1,
+                  const real3& hdims1,
+                  const real3& pos2,
+                  const quaternion& rot2,
+                  const real3& hdims2,
+                  const real& separation,
+                  real3& norm,
+                  real& depth,
+                  real3& pt1,
+                  real3& pt2,
+                  real& eff_radius) {
+    // Express the ellipsoid position and orientation in the frame of the box.
+    real3 pos = TransformParentToLocal(pos1, rot1, pos2);
+    quaternion rot = Mult(Inv(rot1), rot2);
+
+    // Find the box face in whose region the ellipsoid center lies.
+    real3 center = pos;
+    uint code = snap_to_box(hdims1, center);
+    if ((code != 1) & (code != 2) & (code != 4))
+        return -1;
+
+    int axis = code >> 1;
+    real3 faceNorm(0);
+    faceNorm[axis] = (pos[axis] > 0) ? 1 : -1;
+
+    // Find the ellipsoid point deepest in the face direction. Since the box lies
+    // entirely behind the face plane, its signed distance to that plane is the
+    // distance between the two shapes if it projects inside the face.
+    real3 ellLoc = ellipsoid_farthest_point(hdims2, RotateT(-faceNorm, rot));
+    real3 ellPos = pos + Rotate(ellLoc, rot);
+    real dist = Dot(ellPos, faceNorm) - hdims1[axis];
+
+    if (dist >= separation)
+        return 0;
+
+    real3 facePos = ellPos;
+    facePos[axis] = faceNorm[axis] * hdims1[axis];
+    if (snap_to_box(hdims1, facePos) != 0)
+        return -1;
+
+    // Generate contact information
+    depth = dist;
+    norm = Rotate(faceNorm, rot1);
+    pt1 = TransformLocalToParent(pos1, rot1, facePos);
+    pt2 = TransformLocalToParent(pos1, rot1, ellPos);
+    eff_radius = ellipsoid_curvature_radius(hdims2, ellLoc);
+
+    return 1;
+}
+
+// =============================================================================
+//              FACE - ELLIPSOID
+
+// Face-ellipsoid narrow phase collision detection.
+// In:  triangular face defined by points A1, B1, C1
+//      ellipsoid at position pos2, with orientation rot2, and semi-axes hdims2
+// Only face interactions are resolved: the ellipsoid point farthest in the
+// direction of the face normal must project inside the face. Returns the number
+// of contacts (0 or 1), or -1 for edge and vertex interactions.
+
+int face_ellipsoid(const real3& A1,
+                   const real3& B1,
+                   const real3& C1,
+                   const real3& pos2,
+                   const quaternion& rot2,
+                   const real3& hdims2,
+                   const real& separation,
+                   real3& norm,
+                   real& depth,
+                   real3& pt1,
+                   real3& pt2,
+                   real& eff_radius) {
+    // Calculate face normal.
+    real3 nrm1 = face_normal(A1, B1, C1);
+
+    // If the ellipsoid center is below the face plane, there is no contact.
+    if (Dot(pos2 - A1, nrm1) <= 0)
+        return 0;
+
+    // Find the ellipsoid point deepest in the face direction and its signed
+    // height above the face plane.
+    real3 ellLoc = ellipsoid_farthest_point(hdims2, RotateT(-nrm1, rot2));
+    real3 ellPos = TransformLocalToParent(pos2, rot2, ellLoc);
+    real h = Dot(ellPos - A1, nrm1);
+
+    if (h >= separation)
+        return 0;
+
+    // The projection of the deepest point must be inside the face.
+    real3 faceLoc;
+    if (snap_to_face(A1, B1, C1, ellPos - h * nrm1, faceLoc))
+        return -1;
+
+    // Generate contact information
+    norm = nrm1;
+    depth = h;
+    pt1 = faceLoc;
+    pt2 = ellPos;
+    eff_radius = ellipsoid_curvature_radius(hdims2, ellLoc);
+
+    return 1;
+}
+
+// =============================================================================
+//              ELLIPSOID - ELLIPSOID
+
+// Ellipsoid-ellipsoid narrow phase collision detection.
+// In:  ellipsoid at position pos1, with orientation rot1, and semi-axes hdims1
+//      ellipsoid at position pos2, with orientation rot2, and semi-axes hdims2
+// The signed distance between two convex shapes is the maximum over all unit
+// directions n of f(n) = n.(pos2 - pos1) - h1(n) - h2(-n), where h1 and h2 are
+// their support functions (for an ellipsoid, h(n) = |D R^T n|, with D the
+// diagonal matrix of semi-axes). This maximum is found with Newton iterations on
+// the unit sphere, started from the direction between the two centers; the
+// contact points are then the support points of the two ellipsoids along n.
+// Returns the number of contacts (0 or 1), or -1 if the centers coincide or the
+// iterations do not converge.
+
+int ellipsoid_ellipsoid(const real3& pos1,
+                        const quaternion& rot1,
+                        const real3& hdims1,
+                        const real3& pos2,
+                        const quaternion& rot2,
+                        const real3& hdims2,
+                        const real& separation,
+                        real3& norm,
+                        real& depth,
+                        real3& pt1,
+                        real3& pt2,
+                        real& eff_radius) {
+    real3 delta = pos2 - pos1;
+    real dist = Length(delta);
+
+    // Quick rejection, based on the largest semi-axes.
+    real hmax1 = Max(hdims1.x, Max(hdims1.y, hdims1.z));
+    real hmax2 = Max(hdims2.x, Max(hdims2.y, hdims2.z));
+    if (dist >= hmax1 + hmax2 + separation)
+        return 0;
+    if (dist < 1e-10)
+        return -1;
+
+    const real3 a2_1 = hdims1 * hdims1;
+    const real3 a2_2 = hdims2 * hdims2;
+
+    // Product of the Hessian of the support function h(n) = |D R^T n| with the vector w,
+    // given h(n) and its gradient S n / h(n), with S = R D^2 R^T.
+    auto hessian = [](const quaternion& rot, const real3& a2, real h, const real3& Sn, const real3& w) {
+        return Rotate(a2 * RotateT(w, rot), rot) / h - Sn * (Dot(Sn, w) / (h * h * h));
+    };
+
+    real3 n = delta / dist;
+    for (int iter = 0; iter < 30; iter++) {
+        real3 loc1 = RotateT(n, rot1);
+        real3 loc2 = RotateT(n, rot2);
+        real h1 = Length(hdims1 * loc1);
+        real h2 = Length(hdims2 * loc2);
+        real3 Sn1 = Rotate(a2_1 * loc1, rot1);
+        real3 Sn2 = Rotate(a2_2 * loc2, rot2);
+
+        // Gradient of f and its components in the plane tangent to the unit sphere at n.
+        real3 grad = delta - Sn1 / h1 - Sn2 / h2;
+        real f = Dot(n, grad);
+        real3 u = Cross(n, Abs(n.x) < real(0.6) ? real3(1, 0, 0) : real3(0, 1, 0));
+        u = u / Length(u);
+        real3 v = Cross(n, u);
+        real gu = Dot(u, grad);
+        real gv = Dot(v, grad);
+
+        if (Sqrt(gu * gu + gv * gv) <= 1e-12 * (h1 + h2)) {
+            if (f >= separation)
+                return 0;
+
+            // Generate contact information
+            real3 ellLoc1 = a2_1 * loc1 / h1;
+            real3 ellLoc2 = -a2_2 * loc2 / h2;
+            real radius1 = ellipsoid_curvature_radius(hdims1, ellLoc1);
+            real radius2 = ellipsoid_curvature_radius(hdims2, ellLoc2);
+            norm = n;
+            depth = f;
+            pt1 = pos1 + Sn1 / h1;
+            pt2 = pos2 - Sn2 / h2;
+            eff_radius = radius1 * radius2 / (radius1 + radius2);
+            return 1;
+        }
+
+        // Hessian of f on the unit sphere, in the (u, v) basis. Away from a maximum, where it may not be
+        // negative definite, fall back on a gradient step.
+        real3 Hu = -(hessian(rot1, a2_1, h1, Sn1, u) + hessian(rot2, a2_2, h2, Sn2, u));
+        real3 Hv = -(hessian(rot1, a2_1, h1, Sn1, v) + hessian(rot2, a2_2, h2, Sn2, v));
+        real huu = Dot(u, Hu) - f;
+        real hvv = Dot(v, Hv) - f;
+        real huv = Dot(u, Hv);
+        real det = huu * hvv - huv * huv;
+        if (!(huu < 0 && det > 0)) {
+            real m = Abs(huu) + Abs(hvv) + Abs(huv) + 1e-6 * (h1 + h2);
+            huu = -m;
+            hvv = -m;
+            huv = 0;
+            det = m * m;
+        }
+
+        // Newton step, limited to half a radian.
+        real du = (huv * gv - hvv * gu) / det;
+        real dv = (huv * gu - huu * gv) / det;
+        real step = Sqrt(du * du + dv * dv);
+        if (step > real(0.5)) {
+            du *= real(0.5) / step;
+            dv *= real(0.5) / step;
+        }
+        n = n + du * u + dv * v;
+        n = n / Length(n);
+    }
+
+    return -1;
+}
+
 // =============================================================================
 //              CAPSULE - CAPSULE
 
@@ -878,6 +1259,83 @@ int box_capsule(const real3& pos1,
     return j;
 }
 
+// =============================================================================
+//              SDF - SPHERE
+
+// Signed distance field - sphere narrow phase collision detection.
+// In:  distance field with frame at position pos1 and orientation rot1
+//      sphere centered at pos2 with radius2
+
+bool sdf_sphere(const ChSignedDistanceField* sdf1,
+                const real3& pos1,
+                const quaternion& rot1,
+                const real3& pos2,
+                const real& radius2,
+                const real& separation,
+                real3& norm,
+                real& depth,
+                real3& pt1,
+                real3& pt2,
+                real& eff_radius) {
+    // Evaluate the field (and its gradient) at the sphere center, expressed in the field frame.
+    real3 spherePos = TransformParentToLocal(pos1, rot1, pos2);
+    ChVector<> gradient;
+    real dist = (real)sdf1->GetDistance(ChVector<>(spherePos.x, spherePos.y, spherePos.z), &gradient);
+
+    // If the sphere center is farther than the sphere radius plus the separation value, there is no
+    // contact. Also ignore contact if the gradient vanishes (center outside the sampled region).
+    real grad_len = (real)gradient.Length();
+    if (dist >= radius2 + separation || grad_len < 1e-12)
+        return false;
+
+    // Generate contact information
+    norm = Rotate(real3(gradient.x(), gradient.y(), gradient.z()) / grad_len, rot1);
+    depth = dist - radius2;
+    pt1 = pos2 - norm * dist;
+    pt2 = pos2 - norm * radius2;
+    eff_radius = radius2;
+
+    return true;
+}
+
+// =============================================================================
+//              SDF - BOX
+
+// Signed distance field - box narrow phase collision detection.
+// In:  distance field with frame at position pos1 and orientation rot1
+//      box at position pos2, with orientation rot2, and half-dimensions hdims2
+
+int sdf_box(const ChSignedDistanceField* sdf1,
+            const real3& pos1,
+            const quaternion& rot1,
+            const real3& pos2,
+            const quaternion& rot2,
+            const real3& hdims2,
+            const real& separation,
+            real3* norm,
+            real* depth,
+            real3* pt1,
+            real3* pt2,
+            real* eff_radius) {
+    int nC = 0;
+
+    // Test each box vertex as a sphere of zero radius.
+    for (int i = 0; i < 8; i++) {
+        real3 corner((i & 1) ? hdims2.x : -hdims2.x,  //
+                     (i & 2) ? hdims2.y : -hdims2.y,  //
+                     (i & 4) ? hdims2.z : -hdims2.z);
+        real3 vertex = TransformLocalToParent(pos2, rot2, corner);
+        real radius = 0;
+        if (sdf_sphere(sdf1, pos1, rot1, vertex, radius, separation, norm[nC], depth[nC], pt1[nC], pt2[nC],
+                       eff_radius[nC])) {
+            eff_radius[nC] = edge_radius;
+            nC++;
+        }
+    }
+
+    return nC;
+}
+
 // =============================================================================
 //              BOX - BOX
 
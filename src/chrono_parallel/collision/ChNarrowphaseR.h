@@ -17,17 +17,23 @@
 // each pair of collision shapes. Only a subset of collision shapes and of
 // pair-wise interactions are currently supported:
 //
-//          |  sphere   box   rbox   capsule   cylinder   rcyl   trimesh
-// ---------+----------------------------------------------------------
-// sphere   |    Y       Y      Y       Y         Y        Y        Y
-// box      |           WIP     N       Y         N        N        N
-// rbox     |                   N       N         N        N        N
-// capsule  |                           Y         N        N        N
-// cylinder |                                     N        N        N
-// rcyl     |                                              N        N
-// trimesh  |                                                       N
+//          |  sphere   box   rbox   capsule   cylinder   rcyl   trimesh   sdf   ellipsoid
+// ---------+--------------------------------------------------------------------------------
+// sphere   |    Y       Y      Y       Y         Y        Y        Y       Y        Y*
+// box      |           WIP     N       Y         N        N        N       Y        Y*
+// rbox     |                   N       N         N        N        N       N        N
+// capsule  |                           Y         N        N        N       N        N
+// cylinder |                                     N        N        N       N        N
+// rcyl     |                                              N        N       N        N
+// trimesh  |                                                       N       N        Y*
+// sdf      |                                                               N        N
+// ellipsoid|                                                                        Y*
 //
 // Note that some pairs may return more than one contact (e.g., box-box).
+// Pairs marked with * are only resolved in the most common configurations (a
+// sphere center outside the ellipsoid, an ellipsoid resting on a box or mesh
+// face, ellipsoids with distinct centers for which the iterations converge);
+// for the other configurations, RCollision returns false.
 //
 // =============================================================================
 
@@ -138,6 +144,65 @@ bool face_sphere(const real3& A1,
                  real3& pt2,
                  real& eff_radius);
 
+/// Analytical ellipsoid vs. sphere collision function.
+/// Returns -1 if the sphere center is inside the ellipsoid.
+int ellipsoid_sphere(const real3& pos1,
+                     const quaternion& rot1,
+                     const real3& hdims1,
+                     const real3& pos2,
+                     const real& radius2,
+                     const real& separation,
+                     real3& norm,
+                     real& depth,
+                     real3& pt1,
+                     real3& pt2,
+                     real& eff_radius);
+
+/// Analytical box vs. ellipsoid collision function (face interactions only).
+/// Returns -1 if the ellipsoid does not interact with a box face.
+int box_ellipsoid(const real3& pos1,
+                  const quaternion& rot1,
+                  const real3& hdims1,
+                  const real3& pos2,
+                  const quaternion& rot2,
+                  const real3& hdims2,
+                  const real& separation,
+                  real3& norm,
+                  real& depth,
+                  real3& pt1,
+                  real3& pt2,
+                  real& eff_radius);
+
+/// Analytical triangle face vs. ellipsoid collision function (face interactions only).
+/// Returns -1 if the ellipsoid interacts with an edge or vertex of the face.
+int face_ellipsoid(const real3& A1,
+                   const real3& B1,
+                   const real3& C1,
+                   const real3& pos2,
+                   const quaternion& rot2,
+                   const real3& hdims2,
+                   const real& separation,
+                   real3& norm,
+                   real& depth,
+                   real3& pt1,
+                   real3& pt2,
+                   real& eff_radius);
+
+/// Ellipsoid vs. ellipsoid collision function (Newton iterations on the support functions).
+/// Returns -1 if the centers coincide or the iterations do not converge.
+int ellipsoid_ellipsoid(const real3& pos1,
+                        const quaternion& rot1,
+                        const real3& hdims1,
+                        const real3& pos2,
+                        const quaternion& rot2,
+                        const real3& hdims2,
+                        const real& separation,
+                        real3& norm,
+                        real& depth,
+                        real3& pt1,
+                        real3& pt2,
+                        real& eff_radius);
+
 /// Analytical capsule vs. capsule collision function.
 int capsule_capsule(const real3& pos1,
                     const quaternion& rot1,
@@ -182,6 +247,35 @@ int box_box(const real3& pos1,
             real3* pt2,
             real* eff_radius);
 
+/// Signed distance field vs. sphere collision function.
+/// The field is evaluated at the sphere center.
+bool sdf_sphere(const ChSignedDistanceField* sdf1,
+                const real3& pos1,
+                const quaternion& rot1,
+                const real3& pos2,
+                const real& radius2,
+                const real& separation,
+                real3& norm,
+                real& depth,
+                real3& pt1,
+                real3& pt2,
+                real& eff_radius);
+
+/// Signed distance field vs. box collision function.
+/// The field is evaluated at the box vertices (up to 8 contacts).
+int sdf_box(const ChSignedDistanceField* sdf1,
+            const real3& pos1,
+            const quaternion& rot1,
+            const real3& pos2,
+            const quaternion& rot2,
+            const real3& hdims2,
+            const real& separation,
+            real3* norm,
+            real* depth,
+            real3* pt1,
+            real3* pt2,
+            real* eff_radius);
+
 /// Dispatcher for analytic collision functions.
 CH_PARALLEL_API
 bool RCollision(const ConvexBase* shapeA,  ///< first candidate shape
@@ -179,6 +179,53 @@ uint snap_to_box(const real3& hdims, real3& loc) {
     return code;
 }
 
+/// This utility function snaps the specified location to the closest point on
+/// the surface of an ellipsoid with given semi-axes. The in/out location is
+/// assumed to be specified in the frame of the ellipsoid (centered at the origin
+/// and aligned with its semi-axes). This function returns 'false' (and leaves the
+/// location unchanged) if the location is inside the ellipsoid.
+/// The closest point is x_i = a_i^2 y_i / (t + a_i^2), where t > 0 is the root of
+/// f(t) = sum_i (a_i y_i / (t + a_i^2))^2 - 1. Since f is convex and decreasing,
+/// Newton iterations started at t = 0 converge monotonically to this root.
+bool snap_to_ellipsoid(const real3& hdims, real3& loc) {
+    real3 a2 = hdims * hdims;
+    real3 y2 = loc * loc;
+
+    if (y2.x / a2.x + y2.y / a2.y + y2.z / a2.z <= 1)
+        return false;
+
+    real t = 0;
+    for (int i = 0; i < 30; i++) {
+        real3 d = real3(1 / (t + a2.x), 1 / (t + a2.y), 1 / (t + a2.z));
+        real3 r = a2 * y2 * d * d;
+        real f = r.x + r.y + r.z - 1;
+        if (f < 10 * C_EPSILON)
+            break;
+        real df = -2 * (r.x * d.x + r.y * d.y + r.z * d.z);
+        t -= f / df;
+    }
+
+    loc = a2 * loc / (real3(t) + a2);
+    return true;
+}
+
+/// This utility function returns the point on an ellipsoid with given semi-axes
+/// that is farthest in the direction 'dir', which is assumed to be given in the
+/// frame of the ellipsoid.
+real3 ellipsoid_farthest_point(const real3& hdims, const real3& dir) {
+    real3 w = hdims * dir;
+    return hdims * w / Length(w);
+}
+
+/// This utility function returns the radius of the sphere with the same Gaussian
+/// curvature as the ellipsoid with given semi-axes, at the specified point on its
+/// surface (given in the frame of the ellipsoid).
+real ellipsoid_curvature_radius(const real3& hdims, const real3& loc) {
+    real3 a2 = hdims * hdims;
+    real3 g = loc / a2;
+    return hdims.x * hdims.y * hdims.z * Dot(g, g);
+}
+
 /// This utility function returns the corner of a box of given dimensions that
 /// if farthest in the direction 'dir', which is assumed to be given in the frame of the box.
 real3 box_farthest_corner(const real3& hdims, const real3& dir) {
@@ -0,0 +1,570 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Ray and sphere casts against the rigid collision shapes, using the grid of
+// the broadphase. Convex shapes are processed with the GJK ray cast algorithm
+// (G. van den Bergen, "Ray casting against general convex objects with
+// application to continuous collision detection", 2004), triangle meshes with
+// their BVH, and signed distance fields by sphere tracing.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+#include "chrono/collision/ChCSignedDistanceField.h"
+
+#include "chrono_parallel/collision/ChCollision.h"
+#include "chrono_parallel/collision/ChBroadphaseUtils.h"
+#include "chrono_parallel/collision/ChDataStructures.h"
+#include "chrono_parallel/collision/ChNarrowphaseUtils.h"
+
+namespace chrono {
+namespace collision {
+
+// -----------------------------------------------------------------------------
+// Closest point to the origin on a simplex (GJK sub-algorithm).
+// The simplex vertices y[i] = x - p[i] are reduced to the vertices of the feature containing the
+// closest point; the support points p[i] are kept in sync.
+// -----------------------------------------------------------------------------
+
+static void KeepVertices(real3* y, real3* p, int& n, int i, int j = -1, int k = -1) {
+    real3 ty[3] = {y[i], j >= 0 ? y[j] : real3(0), k >= 0 ? y[k] : real3(0)};
+    real3 tp[3] = {p[i], j >= 0 ? p[j] : real3(0), k >= 0 ? p[k] : real3(0)};
+    n = (j < 0) ? 1 : (k < 0 ? 2 : 3);
+    for (int m = 0; m < n; m++) {
+        y[m] = ty[m];
+        p[m] = tp[m];
+    }
+}
+
+static real3 ClosestOnSegment(real3* y, real3* p, int& n) {
+    real3 ab = y[1] - y[0];
+    real t = -Dot(y[0], ab);
+    if (t <= 0) {
+        KeepVertices(y, p, n, 0);
+        return y[0];
+    }
+    real denom = Dot(ab, ab);
+    if (t >= denom) {
+        KeepVertices(y, p, n, 1);
+        return y[0];
+    }
+    return y[0] + (t / denom) * ab;
+}
+
+static real3 ClosestOnTriangle(real3* y, real3* p, int& n) {
+    const real3 a = y[0];
+    const real3 b = y[1];
+    const real3 c = y[2];
+    real3 ab = b - a;
+    real3 ac = c - a;
+
+    // Vertex region A
+    real d1 = -Dot(ab, a);
+    real d2 = -Dot(ac, a);
+    if (d1 <= 0 && d2 <= 0) {
+        KeepVertices(y, p, n, 0);
+        return a;
+    }
+
+    // Vertex region B
+    real d3 = -Dot(ab, b);
+    real d4 = -Dot(ac, b);
+    if (d3 >= 0 && d4 <= d3) {
+        KeepVertices(y, p, n, 1);
+        return b;
+    }
+
+    // Edge region AB
+    real vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        real v = d1 / (d1 - d3);
+        KeepVertices(y, p, n, 0, 1);
+        return a + v * ab;
+    }
+
+    // Vertex region C
+    real d5 = -Dot(ab, c);
+    real d6 = -Dot(ac, c);
+    if (d6 >= 0 && d5 <= d6) {
+        KeepVertices(y, p, n, 2);
+        return c;
+    }
+
+    // Edge region AC
+    real vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        real w = d2 / (d2 - d6);
+        KeepVertices(y, p, n, 0, 2);
+        return a + w * ac;
+    }
+
+    // Edge region BC
+    real va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+        real w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        KeepVertices(y, p, n, 1, 2);
+        return b + w * (c - b);
+    }
+
+    // Face region
+    real denom = 1 / (va + vb + vc);
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+static real3 ClosestOnTetrahedron(real3* y, real3* p, int& n) {
+    static const int faces[4][4] = {{0, 1, 2, 3}, {0, 3, 1, 2}, {0, 2, 3, 1}, {1, 3, 2, 0}};
+
+    real3 best(0);
+    real best_dist = C_LARGE_REAL;
+    real3 best_y[3], best_p[3];
+    int best_n = 0;
+    bool inside = true;
+
+    for (int f = 0; f < 4; f++) {
+        const int* v = faces[f];
+        // Skip the faces whose plane does not separate the origin from the opposite vertex.
+        real3 normal = Cross(y[v[1]] - y[v[0]], y[v[2]] - y[v[0]]);
+        real side_origin = -Dot(normal, y[v[0]]);
+        real side_vertex = Dot(normal, y[v[3]] - y[v[0]]);
+        if (side_origin * side_vertex > 0)
+            continue;
+        inside = false;
+
+        real3 fy[3] = {y[v[0]], y[v[1]], y[v[2]]};
+        real3 fp[3] = {p[v[0]], p[v[1]], p[v[2]]};
+        int fn = 3;
+        real3 q = ClosestOnTriangle(fy, fp, fn);
+        real dist = Dot(q, q);
+        if (dist < best_dist) {
+            best_dist = dist;
+            best = q;
+            best_n = fn;
+            for (int m = 0; m < fn; m++) {
+                best_y[m] = fy[m];
+                best_p[m] = fp[m];
+            }
+        }
+    }
+
+    // The origin is inside the tetrahedron.
+    if (inside)
+        return real3(0);
+
+    n = best_n;
+    for (int m = 0; m < n; m++) {
+        y[m] = best_y[m];
+        p[m] = best_p[m];
+    }
+    return best;
+}
+
+static real3 ClosestOnSimplex(real3* y, real3* p, int& n) {
+    switch (n) {
+        case 1:
+            return y[0];
+        case 2:
+            return ClosestOnSegment(y, p, n);
+        case 3:
+            return ClosestOnTriangle(y, p, n);
+        default:
+            return ClosestOnTetrahedron(y, p, n);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// GJK ray cast of a sphere (radius 0 for a ray) against a convex shape, i.e. a ray cast against the
+// shape inflated by the sphere radius. On a hit, return the fraction of the segment at the time of
+// impact and the (unnormalized) surface normal; the normal is zero if the start point is inside.
+// -----------------------------------------------------------------------------
+
+static bool GJKRaycast(const ConvexBase* shape,
+                       const real3& from,
+                       const real3& to,
+                       real radius,
+                       real& fraction,
+                       real3& normal) {
+    const int max_iterations = 64;
+    const real3 r = to - from;
+
+    real lambda = 0;
+    real3 x = from;
+    normal = real3(0);
+
+    real3 y[4], p[4];
+    int n = 0;
+    real3 v = x - TransformSupportVert(shape, real3(1, 0, 0), radius);
+    real scale2 = Dot(v, v);
+
+    for (int iter = 0; iter < max_iterations; iter++) {
+        // The current point is on the (inflated) shape surface, within tolerance.
+        real v2 = Dot(v, v);
+        if (v2 <= 1e-12 * scale2 || v2 <= 1e-20) {
+            fraction = lambda;
+            return true;
+        }
+
+        real3 support = TransformSupportVert(shape, v / Sqrt(v2), radius);
+        real3 w = x - support;
+        real vw = Dot(v, w);
+        if (vw > 0) {
+            // Advance the current point to the support plane (or report no hit if moving away from it).
+            real vr = Dot(v, r);
+            if (vr >= 0)
+                return false;
+            lambda -= vw / vr;
+            if (lambda > 1)
+                return false;
+            x = from + lambda * r;
+            normal = v;
+        }
+        scale2 = Max(scale2, Dot(w, w));
+
+        // Rebuild the simplex for the current point, add the new support point, and find the point of
+        // the simplex closest to the origin (zero if the origin is inside a tetrahedron).
+        for (int m = 0; m < n; m++)
+            y[m] = x - p[m];
+        y[n] = x - support;
+        p[n] = support;
+        n++;
+        v = ClosestOnSimplex(y, p, n);
+    }
+
+    // No convergence within the maximum number of iterations.
+    if (Dot(v, v) > 1e-8 * scale2)
+        return false;
+
+    fraction = lambda;
+    return true;
+}
+
+// Intersect the segment from + t*(to-from), t in [t0,t1], with an AABB; shrink [t0,t1] to the overlap.
+static bool SegmentAABB(const real3& from, const real3& dir, const real3& bmin, const real3& bmax, real& t0, real& t1) {
+    for (int i = 0; i < 3; i++) {
+        if (Abs(dir[i]) < 1e-30) {
+            if (from[i] < bmin[i] || from[i] > bmax[i])
+                return false;
+            continue;
+        }
+        real inv = 1 / dir[i];
+        real ta = (bmin[i] - from[i]) * inv;
+        real tb = (bmax[i] - from[i]) * inv;
+        if (ta > tb)
+            std::swap(ta, tb);
+        t0 = Max(t0, ta);
+        t1 = Min(t1, tb);
+        if (t0 > t1)
+            return false;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+ChCRaycast::ChCRaycast() : data_manager(0) {}
+
+bool ChCRaycast::CastShape(int shape,
+                           const real3& from,
+                           const real3& to,
+                           real radius,
+                           real& fraction,
+                           real3& point,
+                           real3& normal) const {
+    shape_container& shape_data = data_manager->shape_data;
+    const real3 dir = to - from;
+    const int type = shape_data.typ_rigid[shape];
+
+    switch (type) {
+        case MESH: {
+            // Traverse the mesh BVH with the segment expressed in the body frame.
+            uint body = shape_data.id_rigid[shape];
+            const real3& pos = data_manager->host_data.pos_rigid[body];
+            const quaternion& rot = data_manager->host_data.rot_rigid[body];
+            real3 lfrom = TransformParentToLocal(pos, rot, from);
+            real3 ldir = TransformParentToLocal(pos, rot, to) - lfrom;
+
+            ConvexShape tri_shape(shape, &shape_data);
+            bool hit = false;
+            int stack[64];
+            int top = 0;
+            stack[top++] = shape_data.start_rigid[shape];
+            while (top > 0) {
+                int node = stack[--top];
+                real t0 = 0;
+                real t1 = hit ? fraction : 1;
+                if (!SegmentAABB(lfrom, ldir, shape_data.mesh_bvh_min[node] - radius,
+                                 shape_data.mesh_bvh_max[node] + radius, t0, t1))
+                    continue;
+                vec2 data = shape_data.mesh_bvh_node[node];
+                if (data.y == 0) {
+                    stack[top++] = data.x;
+                    stack[top++] = node + 1;
+                    continue;
+                }
+                for (int t = data.x; t < data.x + data.y; t++) {
+                    tri_shape.SetTriangle(t, pos, rot);
+                    real t_fraction;
+                    real3 t_normal;
+                    if (GJKRaycast(&tri_shape, from, to, radius, t_fraction, t_normal) &&
+                        (!hit || t_fraction < fraction)) {
+                        hit = true;
+                        fraction = t_fraction;
+                        normal = t_normal;
+                    }
+                }
+            }
+            if (!hit)
+                return false;
+            break;
+        }
+        case SDF: {
+            // Sphere tracing: the field is a lower bound of the distance outside the sampled blocks.
+            const ChSignedDistanceField* sdf = shape_data.sdf_rigid[shape_data.start_rigid[shape]].get();
+            const real3& pos = shape_data.obj_data_A_global[shape];
+            const quaternion& rot = shape_data.obj_data_R_global[shape];
+            real len = Length(dir);
+            if (len == 0)
+                return false;
+            real tol = 1e-3 * sdf->GetSpacing();
+            real t = 0;
+            bool hit = false;
+            for (int iter = 0; iter < 256 && t <= len; iter++) {
+                real3 q = TransformParentToLocal(pos, rot, from + (t / len) * dir);
+                ChVector<> gradient;
+                real d = (real)sdf->GetDistance(ChVector<>(q.x, q.y, q.z), &gradient) - radius;
+                if (d < tol) {
+                    hit = gradient.Length2() > 0;
+                    normal = Rotate(real3(gradient.x(), gradient.y(), gradient.z()), rot);
+                    break;
+                }
+                t += d;
+            }
+            if (!hit || t > len)
+                return false;
+            fraction = t / len;
+            break;
+        }
+        case TETRAHEDRON:
+            return false;
+        default: {
+            ConvexShape convex(shape, &shape_data);
+            if (!GJKRaycast(&convex, from, to, radius, fraction, normal))
+                return false;
+            break;
+        }
+    }
+
+    // A segment starting inside the shape is reported with a normal opposite to the segment direction.
+    if (IsZero(normal))
+        normal = -dir;
+    normal = Normalize(normal);
+    point = from + fraction * dir - radius * normal;
+    return true;
+}
+
+bool ChCRaycast::Cast(const real3& from,
+                      const real3& to,
+                      real radius,
+                      int body,
+                      real& fraction,
+                      real3& point,
+                      real3& normal,
+                      int& shape) const {
+    return CastFiltered(from, to, radius, body, -1, short2(), fraction, point, normal, shape);
+}
+
+bool ChCRaycast::Sweep(const real3& from,
+                       const real3& to,
+                       real radius,
+                       int body,
+                       short2 family,
+                       real& fraction,
+                       real3& point,
+                       real3& normal,
+                       int& shape) const {
+    return CastFiltered(from, to, radius, -1, body, family, fraction, point, normal, shape);
+}
+
+bool ChCRaycast::CastFiltered(const real3& from,
+                              const real3& to,
+                              real radius,
+                              int body,
+                              int ignore,
+                              short2 family,
+                              real& fraction,
+                              real3& point,
+                              real3& normal,
+                              int& shape) const {
+    const shape_container& shape_data = data_manager->shape_data;
+    const custom_vector<char>& collide = data_manager->host_data.collide_rigid;
+    const int num_shapes = data_manager->num_rigid_shapes;
+
+    shape = -1;
+    fraction = 1;
+
+    // Test a shape and keep the closest hit.
+    auto test = [&](int s) {
+        uint id = shape_data.id_rigid[s];
+        if (id == UINT_MAX || collide[id] == 0)
+            return;
+        // Sweeps skip the swept body and the shapes it cannot collide with.
+        if (ignore >= 0 && (id == (uint)ignore || !((family.y & shape_data.fam_rigid[s].x) &&
+                                                    (shape_data.fam_rigid[s].y & family.x))))
+            return;
+        real s_fraction;
+        real3 s_point, s_normal;
+        if (!CastShape(s, from, to, radius, s_fraction, s_point, s_normal))
+            return;
+        // Sweeps ignore the surfaces the sphere moves away from (or along).
+        if (ignore >= 0 && Dot(s_normal, to - from) >= 0)
+            return;
+        if (shape < 0 || s_fraction < fraction) {
+            shape = s;
+            fraction = s_fraction;
+            point = s_point;
+            normal = s_normal;
+        }
+    };
+
+    // Queries restricted to one body test all its shapes.
+    if (body >= 0) {
+        for (int s = 0; s < num_shapes; s++) {
+            if (shape_data.id_rigid[s] == (uint)body)
+                test(s);
+        }
+        return shape >= 0;
+    }
+
+    const uint num_bins = data_manager->measures.collision.number_of_bins_active;
+    if (num_shapes == 0)
+        return false;
+
+    const custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
+    const custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+
+    // Without a broadphase grid (sweep and prune broadphase), traverse the AABB tree of the shapes, skipping
+    // the nodes beyond the closest hit found so far.
+    if (num_bins == 0) {
+        const custom_vector<uint>& tree_shapes = data_manager->host_data.shape_tree_shapes;
+        const custom_vector<real3>& tree_min = data_manager->host_data.shape_tree_min;
+        const custom_vector<real3>& tree_max = data_manager->host_data.shape_tree_max;
+        const int num_leaves = (int)tree_shapes.size();
+        if (num_leaves == 0)
+            return false;
+
+        const real3 start = from - data_manager->measures.collision.global_origin;
+        const real3 dir = to - from;
+        int stack[64];
+        int top = 0;
+        stack[top++] = 1;
+        while (top > 0) {
+            int node = stack[--top];
+            real t0 = 0;
+            real t1 = shape >= 0 ? fraction : 1;
+            if (!SegmentAABB(start, dir, tree_min[node] - radius, tree_max[node] + radius, t0, t1))
+                continue;
+            if (node >= num_leaves) {
+                test(tree_shapes[node - num_leaves]);
+                continue;
+            }
+            stack[top++] = 2 * node + 1;
+            stack[top++] = 2 * node;
+        }
+        return shape >= 0;
+    }
+    const custom_vector<uint>& bin_number_out = data_manager->host_data.bin_number_out;
+    const custom_vector<uint>& bin_aabb_number = data_manager->host_data.bin_aabb_number;
+    const custom_vector<uint>& bin_start_index = data_manager->host_data.bin_start_index;
+    const vec3& bins_per_axis = data_manager->settings.collision.bins_per_axis;
+    const real3& bin_size = data_manager->measures.collision.bin_size;
+    const real3& global_origin = data_manager->measures.collision.global_origin;
+    const real3 grid_max = data_manager->measures.collision.max_bounding_point - global_origin;
+
+    // Express the segment in the grid frame and clip it to the grid (inflated by the sphere radius).
+    const real3 start = from - global_origin;
+    const real3 dir = to - from;
+    real t_min = 0;
+    real t_max = 1;
+    if (!SegmentAABB(start, dir, real3(-radius), grid_max + radius, t_min, t_max))
+        return false;
+
+    // Shapes overlapping a bin within the sphere radius from the visited bin are also tested.
+    const vec3 range(int(Ceil(radius / bin_size.x)), int(Ceil(radius / bin_size.y)), int(Ceil(radius / bin_size.z)));
+    std::vector<int> tested;
+
+    // 3D digital differential analyzer over the grid bins, from the clipped start point.
+    real3 entry = start + t_min * dir;
+    vec3 cell, step;
+    real3 t_next, t_delta;
+    for (int i = 0; i < 3; i++) {
+        cell[i] = std::min(std::max(int(Floor(entry[i] / bin_size[i])), 0), bins_per_axis[i] - 1);
+        if (dir[i] > 0) {
+            step[i] = 1;
+            t_next[i] = ((cell[i] + 1) * bin_size[i] - start[i]) / dir[i];
+            t_delta[i] = bin_size[i] / dir[i];
+        } else if (dir[i] < 0) {
+            step[i] = -1;
+            t_next[i] = (cell[i] * bin_size[i] - start[i]) / dir[i];
+            t_delta[i] = -bin_size[i] / dir[i];
+        } else {
+            step[i] = 0;
+            t_next[i] = C_LARGE_REAL;
+            t_delta[i] = C_LARGE_REAL;
+        }
+    }
+
+    real t_cell = t_min;
+    while (t_cell <= t_max && (shape < 0 || t_cell <= fraction)) {
+        // Test the shapes in the bins around the current one.
+        vec3 lo(std::max(cell.x - range.x, 0), std::max(cell.y - range.y, 0), std::max(cell.z - range.z, 0));
+        vec3 hi(std::min(cell.x + range.x, bins_per_axis.x - 1), std::min(cell.y + range.y, bins_per_axis.y - 1),
+                std::min(cell.z + range.z, bins_per_axis.z - 1));
+        for (int k = lo.z; k <= hi.z; k++) {
+            for (int j = lo.y; j <= hi.y; j++) {
+                for (int i = lo.x; i <= hi.x; i++) {
+                    uint hash = Hash_Index(vec3(i, j, k), bins_per_axis);
+                    auto it = std::lower_bound(bin_number_out.begin(), bin_number_out.begin() + num_bins, hash);
+                    if (it == bin_number_out.begin() + num_bins || *it != hash)
+                        continue;
+                    uint b = (uint)(it - bin_number_out.begin());
+                    for (uint a = bin_start_index[b]; a < bin_start_index[b + 1]; a++) {
+                        int s = bin_aabb_number[a];
+                        if (std::find(tested.begin(), tested.end(), s) != tested.end())
+                            continue;
+                        tested.push_back(s);
+                        real t0 = 0;
+                        real t1 = 1;
+                        if (SegmentAABB(start, dir, aabb_min[s] - radius, aabb_max[s] + radius, t0, t1))
+                            test(s);
+                    }
+                }
+            }
+        }
+
+        // Advance to the next bin along the segment.
+        int axis = (t_next.x < t_next.y) ? (t_next.x < t_next.z ? 0 : 2) : (t_next.y < t_next.z ? 1 : 2);
+        t_cell = t_next[axis];
+        t_next[axis] += t_delta[axis];
+        cell[axis] += step[axis];
+        if (cell[axis] < 0 || cell[axis] >= bins_per_axis[axis])
+            break;
+    }
+
+    return shape >= 0;
+}
+
+}  // end namespace collision
+}  // end namespace chrono
@@ -110,6 +110,11 @@ bool ChSystemParallel::Integrate_Y() {
     data_manager->system_timer.stop("update");
 
     data_manager->system_timer.start("collision");
+    // Cache the positions of the bodies which need continuous collision detection at the end of the step.
+    for (int i = 0; i < bodylist.size(); i++) {
+        if (bodylist[i]->GetContinuousCollision())
+            bodylist[i]->SynchronizeLastCollPos();
+    }
     collision_system->Run();
     collision_system->ReportContacts(this->contact_container.get());
 
@@ -171,6 +176,13 @@ bool ChSystemParallel::Integrate_Y() {
         }
     }
 
+    // Prevent the bodies flagged for continuous collision detection from tunneling.
+    ComputeContinuousCollisions();
+    for (int i = 0; i < bodylist.size(); i++) {
+        if (bodylist[i]->GetContinuousCollision())
+            pos_pointer[i] = real3(bodylist[i]->GetPos().x(), bodylist[i]->GetPos().y(), bodylist[i]->GetPos().z());
+    }
+
     ////#pragma omp parallel for
     for (int i = 0; i < (signed)data_manager->num_shafts; i++) {
         if (!data_manager->host_data.shaft_active[i])
@@ -745,6 +757,36 @@ void ChSystemParallel::PrintStepStats() {
     data_manager->system_timer.PrintReport();
 }
 
+void ChSystemParallel::WriteCollisionStatistics(std::ostream& os, bool header) {
+    const collision_measures& measures = data_manager->measures.collision;
+
+    if (header)
+        os << "time,quantity,index,value\n";
+
+    auto write = [&](const char* quantity, const std::string& index, double value) {
+        os << ChTime << "," << quantity << "," << index << "," << value << "\n";
+    };
+
+    write("time_broadphase", "", data_manager->system_timer.GetTime("collision_broad"));
+    write("time_narrowphase", "", data_manager->system_timer.GetTime("collision_narrow"));
+    write("bins_active", "", measures.number_of_bins_active);
+    write("bin_intersections", "", measures.number_of_bin_intersections);
+    write("contacts_possible", "", measures.number_of_contacts_possible);
+    write("contacts_active", "", measures.number_of_contacts_active);
+    write("max_bin_shapes", "", measures.max_bin_shapes);
+    write("max_bin_pairs", "", measures.max_bin_pairs);
+    write("broadphase_memory", "", (double)measures.broadphase_memory);
+    write("contact_memory", "", (double)measures.contact_memory);
+    for (size_t i = 0; i < measures.bin_shapes_histogram.size(); i++)
+        write("bin_shapes_histogram", std::to_string(i), measures.bin_shapes_histogram[i]);
+    for (size_t i = 0; i < measures.bin_pairs_histogram.size(); i++)
+        write("bin_pairs_histogram", std::to_string(i), measures.bin_pairs_histogram[i]);
+    for (const vec3& count : measures.contacts_possible_types)
+        write("contacts_possible_types", std::to_string(count.x) + "-" + std::to_string(count.y), count.z);
+    for (const vec3& count : measures.contacts_active_types)
+        write("contacts_active_types", std::to_string(count.x) + "-" + std::to_string(count.y), count.z);
+}
+
 unsigned int ChSystemParallel::GetNumBodies() {
     return data_manager->num_rigid_bodies + data_manager->num_fluid_bodies;
 }
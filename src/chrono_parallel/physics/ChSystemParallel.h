@@ -83,6 +83,13 @@ class CH_PARALLEL_API ChSystemParallel : public ChSystem {
     void SetMaterialCompositionStrategy(std::unique_ptr<ChMaterialCompositionStrategy<real>>&& strategy);
 
     virtual void PrintStepStats();
+
+    /// Write the collision statistics of the last step, in CSV format (time,quantity,index,value), one line
+    /// per quantity and per histogram bucket or pair of shape types (index "type1-type2"). If requested, a
+    /// header line is written first. The statistics must be enabled with the collect_statistics collision
+    /// setting; the time spent in the broadphase and narrowphase is always reported.
+    void WriteCollisionStatistics(std::ostream& os, bool header = false);
+
     unsigned int GetNumBodies();
     unsigned int GetNumShafts();
     unsigned int GetNumContacts();
@@ -519,6 +519,8 @@ void ChIterativeSolverParallelSMC::ProcessContacts() {
         Thrust_Fill(shear_touch, false);
 #pragma omp parallel for
         for (int i = 0; i < (signed)data_manager->num_rigid_contacts; i++) {
+            // Contacts with any triangle of a mesh shape share the shear history of that shape, so that the
+            // history is kept as a body slides across triangles.
             vec2 pair = I2(int(data_manager->host_data.contact_pairs[i] >> 32),
                            int(data_manager->host_data.contact_pairs[i] & 0xffffffff));
             shape_pairs[i] = pair;
@@ -17,9 +17,13 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cmath>
 
 #include "chrono/ChConfig.h"
 
+#include "chrono/core/ChTimer.h"
+#include "chrono/parallel/ChOpenMP.h"
+
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChSystemSMC.h"
 
@@ -38,7 +42,14 @@ namespace vehicle {
 // Specify default step size and solver parameters.
 // -----------------------------------------------------------------------------
 ChVehicle::ChVehicle(const std::string& name, ChMaterialSurface::ContactMethod contact_method)
-    : m_name(name), m_ownsSystem(true), m_stepsize(1e-3), m_output(false), m_output_db(nullptr), m_next_output_time(0), m_output_frame(0) {
+    : m_name(name),
+      m_ownsSystem(true),
+      m_stepsize(1e-3),
+      m_output(false),
+      m_output_db(nullptr),
+      m_next_output_time(0),
+      m_output_frame(0),
+      m_rt_enabled(false) {
     m_system = (contact_method == ChMaterialSurface::NSC) ? static_cast<ChSystem*>(new ChSystemNSC)
                                                           : static_cast<ChSystem*>(new ChSystemSMC);
 
@@ -56,6 +67,8 @@ ChVehicle::ChVehicle(const std::string& name, ChMaterialSurface::ContactMethod c
         default:
             break;
     }
+
+    ResetRealtimeStats();
 }
 
 // -----------------------------------------------------------------------------
@@ -69,7 +82,10 @@ ChVehicle::ChVehicle(const std::string& name, ChSystem* system)
       m_output(false),
       m_output_db(nullptr),
       m_next_output_time(0),
-      m_output_frame(0) {}
+      m_output_frame(0),
+      m_rt_enabled(false) {
+    ResetRealtimeStats();
+}
 
 // -----------------------------------------------------------------------------
 // Destructor for ChVehicle
@@ -116,12 +132,104 @@ void ChVehicle::Advance(double step) {
         m_output_frame++;
     }
 
+    if (!m_rt_enabled) {
+        double t = 0;
+        while (t < step) {
+            double h = std::min<>(m_stepsize, step - t);
+            m_system->DoStepDynamics(h);
+            t += h;
+        }
+        return;
+    }
+
+    // Real-time mode: measure the wall-clock time of each phase, accumulated over all integration steps.
+    ChTimer<double> timer;
+    timer.start();
+
+    m_rt_stats.time_collision = 0;
+    m_rt_stats.time_setup = 0;
+    m_rt_stats.time_solver = 0;
+    m_rt_stats.time_update = 0;
+    m_rt_stats.solver_iterations = m_system->GetMaxItersSolverSpeed();
+
     double t = 0;
     while (t < step) {
         double h = std::min<>(m_stepsize, step - t);
         m_system->DoStepDynamics(h);
+        m_rt_stats.time_collision += m_system->GetTimerCollisionBroad() + m_system->GetTimerCollisionNarrow();
+        m_rt_stats.time_setup += m_system->GetTimerSetup();
+        m_rt_stats.time_solver += m_system->GetTimerSolver();
+        m_rt_stats.time_update += m_system->GetTimerUpdate();
         t += h;
     }
+
+    timer.stop();
+    m_rt_stats.time = timer.GetTimeSeconds();
+    m_rt_stats.max_time = std::max(m_rt_stats.max_time, m_rt_stats.time);
+    m_rt_stats.num_advance++;
+    if (m_rt_stats.time > m_rt_budget)
+        m_rt_stats.num_overruns++;
+
+    AdaptSolverIterations();
+}
+
+// -----------------------------------------------------------------------------
+// Real-time stepping mode.
+// -----------------------------------------------------------------------------
+void ChVehicle::EnableRealtime(bool val, double budget, int min_iterations) {
+    if (val && !m_rt_enabled) {
+        // Cache the nominal solver iteration counts.
+        m_rt_max_speed = m_system->GetMaxItersSolverSpeed();
+        m_rt_max_stab = m_system->GetMaxItersSolverStab();
+    } else if (!val && m_rt_enabled) {
+        // Restore the nominal solver iteration counts.
+        m_system->SetMaxItersSolverSpeed(m_rt_max_speed);
+        m_system->SetMaxItersSolverStab(m_rt_max_stab);
+    }
+
+    m_rt_enabled = val;
+    m_rt_budget = budget;
+    m_rt_min_iterations = min_iterations;
+    ResetRealtimeStats();
+}
+
+void ChVehicle::ResetRealtimeStats() {
+    m_rt_stats.num_advance = 0;
+    m_rt_stats.num_overruns = 0;
+    m_rt_stats.max_time = 0;
+    m_rt_stats.time = 0;
+    m_rt_stats.time_collision = 0;
+    m_rt_stats.time_setup = 0;
+    m_rt_stats.time_solver = 0;
+    m_rt_stats.time_update = 0;
+    m_rt_stats.solver_iterations = m_system->GetMaxItersSolverSpeed();
+}
+
+bool ChVehicle::PinThreads(int first_proc) {
+    return CHOMPfunctions::PinThreads(first_proc);
+}
+
+// Select the solver iteration count so that the solver phase fits in what remains of the budget (with a 10%
+// safety margin) after all other phases, assuming the solver cost is proportional to the number of iterations.
+// Increases are limited to 25% per call to avoid oscillations caused by timing noise.
+void ChVehicle::AdaptSolverIterations() {
+    int iters = m_system->GetMaxItersSolverSpeed();
+    int new_iters = m_rt_max_speed;
+
+    if (m_rt_stats.time_solver > 0 && iters > 0) {
+        double time_per_iter = m_rt_stats.time_solver / iters;
+        double available = 0.9 * m_rt_budget - (m_rt_stats.time - m_rt_stats.time_solver);
+        new_iters = (int)std::floor(available / time_per_iter);
+        new_iters = std::min(new_iters, (int)std::ceil(1.25 * iters));
+    }
+
+    new_iters = ChClamp(new_iters, m_rt_min_iterations, m_rt_max_speed);
+    if (new_iters == iters)
+        return;
+
+    m_system->SetMaxItersSolverSpeed(new_iters);
+    m_system->SetMaxItersSolverStab(
+        std::max(m_rt_min_iterations, (int)((double)m_rt_max_stab * new_iters / m_rt_max_speed)));
 }
 
 // -----------------------------------------------------------------------------
@@ -35,6 +35,20 @@ namespace vehicle {
 /// @addtogroup vehicle
 /// @{
 
+/// Statistics collected in the real-time stepping mode of a vehicle system.
+/// All times are wall-clock times in seconds and refer to the last call to ChVehicle::Advance.
+struct RealtimeStats {
+    int num_advance;        ///< number of calls to Advance
+    int num_overruns;       ///< number of calls to Advance that exceeded the time budget
+    double max_time;        ///< maximum time of a call to Advance
+    double time;            ///< total time
+    double time_collision;  ///< time for collision detection (broad and narrow phase)
+    double time_setup;      ///< time for solver setup
+    double time_solver;     ///< time for the solver (excluding setup)
+    double time_update;     ///< time for system updates
+    int solver_iterations;  ///< maximum number of solver iterations used
+};
+
 /// Base class for chrono vehicle systems.
 /// The reference frame for a vehicle follows the ISO standard: Z-axis up, X-axis
 /// pointing forward, and Y-axis towards the left of the vehicle.
@@ -144,6 +158,31 @@ class CH_VEHICLE_API ChVehicle {
     /// Advance the state of this vehicle by the specified time step.
     virtual void Advance(double step);
 
+    /// Enable/disable the real-time stepping mode (default: disabled).
+    /// In this mode, each call to Advance is expected to complete within the specified wall-clock budget.
+    /// The time spent in each phase of the step is measured and the maximum number of iterations of the
+    /// iterative solver is adapted (between 'min_iterations' and the values set in the underlying system when
+    /// this function is called) so that subsequent calls meet the budget. Calls exceeding the budget are
+    /// reported as overruns in the real-time statistics.
+    void EnableRealtime(bool val,               ///< [in] enable/disable real-time mode
+                        double budget = 1e-3,   ///< [in] wall-clock time budget for one call to Advance [s]
+                        int min_iterations = 5  ///< [in] minimum number of solver iterations
+                        );
+
+    /// Return true if the real-time stepping mode is enabled.
+    bool IsRealtime() const { return m_rt_enabled; }
+
+    /// Get the real-time stepping statistics.
+    const RealtimeStats& GetRealtimeStats() const { return m_rt_stats; }
+
+    /// Reset the real-time stepping statistics.
+    void ResetRealtimeStats();
+
+    /// Pin the worker threads (and the calling thread) to consecutive processors from the affinity mask of the
+    /// process, starting with the processor of index 'first_proc' in that mask.
+    /// Only available on Linux; returns false if pinning is not supported or failed.
+    bool PinThreads(int first_proc = 0);
+
     /// Set the integration step size for the vehicle system.
     void SetStepsize(double val) { m_stepsize = val; }
 
@@ -197,6 +236,17 @@ class CH_VEHICLE_API ChVehicle {
     std::shared_ptr<ChChassis> m_chassis;  ///< handle to the chassis subsystem
 
     double m_stepsize;  ///< integration step-size for the vehicle system
+
+  private:
+    /// Adapt the solver iteration counts based on the timing of the last call to Advance.
+    void AdaptSolverIterations();
+
+    bool m_rt_enabled;         ///< real-time stepping mode enabled?
+    double m_rt_budget;        ///< wall-clock time budget for one call to Advance
+    int m_rt_min_iterations;   ///< minimum number of solver iterations
+    int m_rt_max_speed;        ///< nominal maximum number of solver iterations (speed)
+    int m_rt_max_stab;         ///< nominal maximum number of solver iterations (stabilization)
+    RealtimeStats m_rt_stats;  ///< real-time stepping statistics
 };
 
 /// @} vehicle
@@ -37,8 +37,11 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
+#include <limits>
+#include <random>
 
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/physics/ChMaterialSurfaceNSC.h"
@@ -131,6 +134,10 @@ void GranularTerrain::EnableMovingPatch(std::shared_ptr<ChBody> body,
     m_shift_distance = shift_distance;
     m_init_part_vel = init_vel;
 
+    // Discard any relocation template built for a previous shift distance.  The template is regenerated at
+    // initialization or, if the terrain was already initialized, at the first patch relocation.
+    m_reloc_template.clear();
+
     // Enable moving patch
     m_moving_patch = true;
 }
@@ -451,6 +458,13 @@ void GranularTerrain::Initialize(const ChVector<>& center,
         m_ground->AddAsset(box);
     }
 
+    // If enabled, precompute the relocation template for the moving patch, sized for the expected number of
+    // particles in a relocated chunk.
+    if (m_moving_patch) {
+        m_reloc_template.clear();
+        ExtendRelocationTemplate((size_t)(m_num_particles * (m_shift_distance / m_length)));
+    }
+
     // Register the custom collision callback for boundary conditions.
     auto cb = new BoundaryContact(this);
     m_ground->GetSystem()->RegisterCustomCollisionCallback(cb);
@@ -473,34 +487,30 @@ void GranularTerrain::Synchronize(double time) {
     // Shift rear boundary.
     m_rear += m_shift_distance;
 
-    // Count particles that must be relocated.
-    unsigned int num_moved_particles = 0;
+    // Collect particles that must be relocated (single pass over the system body list).
+    m_reloc_bodies.clear();
     auto bodylist = m_ground->GetSystem()->Get_bodylist();
     for (auto body : *bodylist) {
         if (body->GetIdentifier() > m_start_id && body->GetPos().x() - m_radius < m_rear) {
-            num_moved_particles++;
+            m_reloc_bodies.push_back(body.get());
         }
     }
-
-    // Create a Poisson Disk sampler and generate points in layers within the relocation volume.
-    std::vector<ChVector<>> new_points;
-    double r = safety_factor * m_radius;
-    utils::PDSampler<> sampler(2 * r);
-    ChVector<> layer_hdims(m_shift_distance / 2 - r, m_width / 2 - r, 0);
-    ChVector<> layer_center(m_front + m_shift_distance / 2, (m_left + m_right) / 2, m_bottom + offset_factor * r);
-    while (new_points.size() < num_moved_particles) {
-        auto points = sampler.SampleBox(layer_center, layer_hdims);
-        new_points.insert(new_points.end(), points.begin(), points.end());
-        layer_center.z() += 2 * r;
-    }
-
-    // Relocate particles at their new locations.
-    size_t ip = 0;
-    for (auto body : *bodylist) {
-        if (body->GetIdentifier() > m_start_id && body->GetPos().x() - m_radius < m_rear) {
-            body->SetPos(new_points[ip++]);
-            body->SetPos_dt(m_init_part_vel);
-        }
+    size_t num_moved_particles = m_reloc_bodies.size();
+
+    // Make sure the relocation template has enough points (no-op in steady state).
+    ExtendRelocationTemplate(num_moved_particles);
+
+    // Relocate particles at their new locations, given by the template translated to the front boundary.
+    // Reset the particle velocities and clear any accelerations left over from the previous step, so that
+    // recycled particles carry no stale state into the next contact solve.
+    ChVector<> offset(m_front, (m_left + m_right) / 2, m_bottom);
+    for (size_t ip = 0; ip < num_moved_particles; ip++) {
+        auto body = m_reloc_bodies[ip];
+        body->SetPos(offset + m_reloc_template[ip]);
+        body->SetPos_dt(m_init_part_vel);
+        body->SetWvel_loc(ChVector<>(0, 0, 0));
+        body->SetPos_dtdt(ChVector<>(0, 0, 0));
+        body->SetRot_dtdt(QNULL);
     }
 
     // Shift front boundary.
@@ -515,6 +525,66 @@ void GranularTerrain::Synchronize(double time) {
     }
 }
 
+// Extend the settled (packed-bed) template of the relocation volume until it has at least the requested number of
+// points.  Points are expressed relative to the center of the front-bottom edge of the relocation volume.
+// The bed is built by gravitational deposition: each new particle is dropped vertically at the lowest of several
+// random (x,y) locations and comes to rest on the first particle it touches (or on the floor, placed
+// offset_factor * r above the bottom boundary as for the initial particles).  New points therefore rest on the
+// template built so far, without overlap, and the template can be extended on demand.
+void GranularTerrain::ExtendRelocationTemplate(size_t num_points) {
+    if (m_reloc_template.size() >= num_points)
+        return;
+
+    const int num_candidates = 10;  // number of drop locations tried for each particle
+
+    double r = safety_factor * m_radius;
+    double r2 = 4 * r * r;
+    double floor = offset_factor * r;
+
+    // Horizontal grid (cell size 2r) of the template points.  A dropped particle can only rest on points in the
+    // 3x3 block of cells around its drop location.
+    double cell = 2 * r;
+    int nx = std::max(1, (int)std::ceil(m_shift_distance / cell));
+    int ny = std::max(1, (int)std::ceil(m_width / cell));
+    std::vector<std::vector<size_t>> grid(nx * ny);
+    auto cell_x = [&](double x) { return ChClamp((int)(x / cell), 0, nx - 1); };
+    auto cell_y = [&](double y) { return ChClamp((int)((y + m_width / 2) / cell), 0, ny - 1); };
+    for (size_t i = 0; i < m_reloc_template.size(); i++)
+        grid[cell_x(m_reloc_template[i].x()) * ny + cell_y(m_reloc_template[i].y())].push_back(i);
+
+    // Deterministic sequence of drop locations (seeded by the current template size).
+    std::mt19937 generator((unsigned int)m_reloc_template.size());
+    std::uniform_real_distribution<double> dist_x(r, m_shift_distance - r);
+    std::uniform_real_distribution<double> dist_y(-m_width / 2 + r, m_width / 2 - r);
+
+    while (m_reloc_template.size() < num_points) {
+        ChVector<> best(0, 0, std::numeric_limits<double>::max());
+        for (int k = 0; k < num_candidates; k++) {
+            ChVector<> p(dist_x(generator), dist_y(generator), floor);
+            int ix = cell_x(p.x());
+            int iy = cell_y(p.y());
+            for (int jx = std::max(ix - 1, 0); jx <= std::min(ix + 1, nx - 1); jx++) {
+                for (int jy = std::max(iy - 1, 0); jy <= std::min(iy + 1, ny - 1); jy++) {
+                    for (auto j : grid[jx * ny + jy]) {
+                        const ChVector<>& q = m_reloc_template[j];
+                        double d2 = (p.x() - q.x()) * (p.x() - q.x()) + (p.y() - q.y()) * (p.y() - q.y());
+                        if (d2 < r2)
+                            p.z() = std::max(p.z(), q.z() + std::sqrt(r2 - d2));
+                    }
+                }
+            }
+            if (p.z() < best.z())
+                best = p;
+        }
+        grid[cell_x(best.x()) * ny + cell_y(best.y())].push_back(m_reloc_template.size());
+        m_reloc_template.push_back(best);
+    }
+
+    if (m_verbose) {
+        std::cout << "Relocation template: " << m_reloc_template.size() << " points" << std::endl;
+    }
+}
+
 double GranularTerrain::GetHeight(double x, double y) const {
     auto bodylist = m_ground->GetSystem()->Get_bodylist();
     double highest = m_bottom;
@@ -28,6 +28,8 @@
 #ifndef GRANULAR_TERRAIN_H
 #define GRANULAR_TERRAIN_H
 
+#include <vector>
+
 #include "chrono/assets/ChColorAsset.h"
 #include "chrono/physics/ChBody.h"
 
@@ -101,6 +103,12 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
                             );
 
     /// Enable moving patch and set parameters.
+    /// When the patch is moved, particles behind the rear boundary are recycled at the front of the patch, at
+    /// locations taken from a settled packed-bed template of the relocation volume, in which each particle rests on
+    /// the particles below it (or on the bottom boundary).  This template is generated only once (at
+    /// initialization, or at the first relocation if this function is called after Initialize) and extended on
+    /// demand, so that relocation cost is linear in the number of moved particles.  Recycled particles are given
+    /// the specified initial velocity and carry no contact history.
     void EnableMovingPatch(std::shared_ptr<ChBody> body,              ///< monitored body
                            double buffer_distance,                    ///< look-ahead distance
                            double shift_distance,                     ///< chunk size of relocated particles
@@ -192,6 +200,9 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
     virtual float GetCoefficientFriction(double x, double y) const override;
 
   private:
+    /// Extend the relocation template so that it contains at least the specified number of points.
+    void ExtendRelocationTemplate(size_t num_points);
+
     unsigned int m_min_num_particles;  ///< requested minimum number of particles
     unsigned int m_num_particles;      ///< actual number of particles
     int m_start_id;                    ///< start body identifier for particles
@@ -215,6 +226,8 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
     double m_buffer_distance;        ///< minimum distance to front boundary
     double m_shift_distance;         ///< size (X direction) of relocated volume
     ChVector<> m_init_part_vel;      ///< initial particle velocity
+    std::vector<ChVector<>> m_reloc_template;  ///< particle locations in relocation volume (relative to front-bottom)
+    std::vector<ChBody*> m_reloc_bodies;       ///< scratch list of particles to be relocated
 
     // Rough surface (ground-fixed spheres)
     bool m_rough_surface;  ///< rough surface feature enabled?
@@ -584,6 +584,10 @@ void SCMDeformableSoil::ComputeInternalForces() {
     };
     std::unordered_map<int, HitRecord> hits;
 
+    std::vector<int> ray_vertices;
+    std::vector<ChVector<>> ray_from;
+    std::vector<ChVector<>> ray_to;
+
     for (int i = 0; i < vertices.size(); ++i) {
         // Initialize SCM quantities at current vertex
         p_sigma[i] = 0;
@@ -601,15 +605,23 @@ void SCMDeformableSoil::ComputeInternalForces() {
             }
         }
 
-        // Perform ray casting from current vertex
-        collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
+        // Collect the ray from current vertex
         ChVector<> to = vertices[i] + N * test_high_offset;
         ChVector<> from = to - N * test_low_offset;
-        this->GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-        m_num_ray_casts++;
+        ray_vertices.push_back(i);
+        ray_from.push_back(from);
+        ray_to.push_back(to);
+    }
+
+    // Perform ray casting for all collected vertices at once
+    std::vector<collision::ChCollisionSystem::ChRayhitResult> mrayhit_results;
+    this->GetSystem()->GetCollisionSystem()->BatchRayHit(ray_from, ray_to, mrayhit_results);
+    m_num_ray_casts += ray_vertices.size();
+    for (size_t k = 0; k < ray_vertices.size(); ++k) {
+        const auto& mrayhit_result = mrayhit_results[k];
         if (mrayhit_result.hit) {
             HitRecord record = { mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1 };
-            hits.insert(std::make_pair(i, record));
+            hits.insert(std::make_pair(ray_vertices[k], record));
         }
     }
 
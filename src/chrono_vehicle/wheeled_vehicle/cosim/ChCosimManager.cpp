@@ -25,12 +25,24 @@ namespace chrono {
 namespace vehicle {
 
 ChCosimManager::ChCosimManager(int num_tires)
-    : m_num_tires(num_tires), m_vehicle_node(NULL), m_terrain_node(NULL), m_tire_node(NULL), m_verbose(false) {}
+    : m_num_tires(num_tires),
+      m_vehicle_node(NULL),
+      m_terrain_node(NULL),
+      m_tire_node(NULL),
+      m_buffer(NULL),
+      m_verbose(false),
+      m_shared(false),
+      m_pipelined(false) {}
 
 ChCosimManager::~ChCosimManager() {
+    // Collect the last contact forces still in flight, if any.
+    if (m_tire_node)
+        m_tire_node->Flush();
+
     delete m_vehicle_node;
     delete m_terrain_node;
     delete m_tire_node;
+    delete m_buffer;
 
     MPI_Finalize();
 }
@@ -54,15 +66,18 @@ bool ChCosimManager::Initialize() {
     // Create and initialize the different cosimulation nodes
     if (m_rank == VEHICLE_NODE_RANK) {
         SetAsVehicleNode();
-        m_vehicle_node = new ChCosimVehicleNode(m_rank, GetVehicle(), GetPowertrain(), GetDriver());
-        m_vehicle_node->SetStepsize(GetVehicleStepsize());
-        m_vehicle_node->Initialize(GetVehicleInitialPosition());
-        if (m_num_tires != 2 * m_vehicle_node->GetNumberAxles()) {
+        // Check the number of tires before any communication with the other nodes.  At this point, the tire and
+        // terrain nodes are already blocked waiting for data from this node, so abort the entire job.
+        if (m_num_tires != 2 * GetVehicle()->GetNumberAxles()) {
             std::cout << "ERROR:  Incorrect number of tires!" << std::endl;
             std::cout << "  Provided: " << m_num_tires << std::endl;
-            std::cout << "  Required: " << 2 * m_vehicle_node->GetNumberAxles() << std::endl;
+            std::cout << "  Required: " << 2 * GetVehicle()->GetNumberAxles() << std::endl;
+            Abort();
             return false;
         }
+        m_vehicle_node = new ChCosimVehicleNode(m_rank, GetVehicle(), GetPowertrain(), GetDriver());
+        m_vehicle_node->SetStepsize(GetVehicleStepsize());
+        m_vehicle_node->Initialize(GetVehicleInitialPosition());
         if (m_verbose) {
             std::cout << "VEHICLE NODE created.  rank = " << m_rank << std::endl;
         }
@@ -86,6 +101,25 @@ bool ChCosimManager::Initialize() {
         }
     }
 
+    // If requested and possible, create the shared-memory exchange buffer (collective over all nodes).
+    if (m_shared) {
+        if (ChCosimSharedBuffer::IsSingleHost(MPI_COMM_WORLD)) {
+            unsigned int num_vert = m_tire_node ? m_tire_node->m_num_vert : 0;
+            unsigned int num_tri = m_tire_node ? m_tire_node->m_num_tri : 0;
+            m_buffer = new ChCosimSharedBuffer(MPI_COMM_WORLD, num_vert, num_tri);
+            if (m_tire_node)
+                m_tire_node->InitializeShared(m_buffer, m_pipelined);
+            if (m_terrain_node)
+                m_terrain_node->m_buffer = m_buffer;
+            if (m_verbose && m_rank == VEHICLE_NODE_RANK) {
+                std::cout << "Using shared-memory transport for tire-terrain data";
+                std::cout << (m_pipelined ? " (pipelined)." : ".") << std::endl;
+            }
+        } else if (m_rank == VEHICLE_NODE_RANK) {
+            std::cout << "WARNING:  Cosimulation nodes not on the same host; shared memory disabled." << std::endl;
+        }
+    }
+
     return true;
 }
 
@@ -24,6 +24,7 @@
 
 #include "chrono_vehicle/ChApiVehicle.h"
 #include "chrono_vehicle/ChSubsysDefs.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimSharedBuffer.h"
 #include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimVehicleNode.h"
 #include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimTireNode.h"
 #include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimTerrainNode.h"
@@ -61,7 +62,18 @@ class CH_VEHICLE_API ChCosimManager {
                                    const std::vector<ChVector<>>& vert_pos,
                                    const std::vector<ChVector<>>& vert_vel,
                                    const std::vector<ChVector<int>>& triangles) = 0;
-    virtual void OnSendTireForces(int which, std::vector<ChVector<>>& vert_forces, std::vector<int> vert_indeces) = 0;
+    /// Process tire mesh data received through the shared-memory transport.
+    /// The arrays are views directly into the shared exchange buffer and are valid only during this call; the
+    /// data must be consumed in place (or copied by the implementation if it must outlive the call). The triangles
+    /// are written only once, when the transport is set up, and are the same at every call.
+    /// Invoked instead of OnReceiveTireData only if the shared-memory transport is active.
+    virtual void OnReceiveTireDataShared(int which,
+                                         unsigned int num_vert,
+                                         const ChVector<>* vert_pos,
+                                         const ChVector<>* vert_vel,
+                                         unsigned int num_tri,
+                                         const ChVector<int>* triangles) = 0;
+    virtual void OnSendTireForces(int which, std::vector<ChVector<>>& vert_forces, std::vector<int>& vert_indeces) = 0;
     virtual void OnAdvanceTerrain() {}
 
     // Functions invoked only on a TIRE node
@@ -74,6 +86,19 @@ class CH_VEHICLE_API ChCosimManager {
 
     void SetVerbose(bool val) { m_verbose = val; }
 
+    /// Enable/disable the shared-memory transport for tire-terrain data exchange (default: false).
+    /// Must be called before Initialize. If enabled but the nodes do not all run on the same host,
+    /// the manager falls back to MPI message passing.  With the shared-memory transport, the terrain
+    /// node processes tires in the order in which their data becomes available.
+    void EnableSharedMemory(bool val) { m_shared = val; }
+
+    /// Enable/disable pipelined tire-terrain exchange (default: false).
+    /// Only used with the shared-memory transport.  If enabled, a tire node publishes its mesh state and advances
+    /// without waiting for the terrain node, applying the contact forces computed from its state at the previous
+    /// synchronization time.  Tire and terrain nodes therefore advance concurrently, at the cost of a one-step lag
+    /// in the tire contact forces (an explicit, staggered coupling).
+    void EnablePipelining(bool val) { m_pipelined = val; }
+
     bool Initialize();
     void Abort();
 
@@ -84,7 +109,10 @@ class CH_VEHICLE_API ChCosimManager {
     int m_rank;
     int m_num_tires;
     bool m_verbose;
+    bool m_shared;
+    bool m_pipelined;
 
+    ChCosimSharedBuffer* m_buffer;
     ChCosimVehicleNode* m_vehicle_node;
     ChCosimTerrainNode* m_terrain_node;
     ChCosimTireNode* m_tire_node;
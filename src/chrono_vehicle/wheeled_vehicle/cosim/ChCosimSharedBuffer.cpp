@@ -0,0 +1,132 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Shared-memory exchange buffer for tire-terrain cosimulation data.
+//
+// =============================================================================
+
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimSharedBuffer.h"
+
+namespace chrono {
+namespace vehicle {
+
+// Segment layout (all arrays 8-byte aligned):
+//   header:        unsigned int[4] = {num_vert, num_tri, num_forces, unused}
+//   vert_pos:      ChVector<>[num_vert]
+//   vert_vel:      ChVector<>[num_vert]
+//   vert_forces:   ChVector<>[num_vert]
+//   triangles:     ChVector<int>[num_tri]
+//   vert_indices:  int[num_vert]
+static const MPI_Aint header_size = 4 * sizeof(unsigned int);
+
+static MPI_Aint Align8(MPI_Aint size) {
+    return (size + 7) & ~MPI_Aint(7);
+}
+
+MPI_Aint ChCosimSharedBuffer::GetSegmentSize(unsigned int num_vert, unsigned int num_tri) {
+    if (num_vert == 0)
+        return 0;
+    return header_size + 3 * num_vert * sizeof(ChVector<>) + Align8(num_tri * sizeof(ChVector<int>)) +
+           Align8(num_vert * sizeof(int));
+}
+
+bool ChCosimSharedBuffer::IsSingleHost(MPI_Comm comm) {
+    int rank;
+    int size;
+    int local_size;
+    MPI_Comm local_comm;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &local_comm);
+    MPI_Comm_size(local_comm, &local_size);
+    MPI_Comm_free(&local_comm);
+
+    // All ranks must agree (a rank may see a full host-local communicator while another does not).
+    int single = (local_size == size) ? 1 : 0;
+    int all_single;
+    MPI_Allreduce(&single, &all_single, 1, MPI_INT, MPI_MIN, comm);
+    return all_single == 1;
+}
+
+ChCosimSharedBuffer::ChCosimSharedBuffer(MPI_Comm comm, unsigned int num_vert, unsigned int num_tri) {
+    // Use the rank in 'comm' as key, so that ranks in the host-local communicator match the input ranks.
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &m_comm);
+
+    // Collectively allocate the window (each rank contributes its own segment, possibly empty).
+    void* base;
+    MPI_Win_allocate_shared(GetSegmentSize(num_vert, num_tri), 8, MPI_INFO_NULL, m_comm, &base, &m_win);
+
+    // Initialize the segment header.
+    if (num_vert > 0) {
+        unsigned int* header = static_cast<unsigned int*>(base);
+        header[0] = num_vert;
+        header[1] = num_tri;
+        header[2] = 0;
+        header[3] = 0;
+    }
+
+    // Open a passive target epoch for the lifetime of the window.
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, m_win);
+    MPI_Win_sync(m_win);
+    MPI_Barrier(m_comm);
+}
+
+ChCosimSharedBuffer::~ChCosimSharedBuffer() {
+    MPI_Win_unlock_all(m_win);
+    MPI_Win_free(&m_win);
+    MPI_Comm_free(&m_comm);
+}
+
+ChCosimSharedBuffer::Segment ChCosimSharedBuffer::GetSegment(int rank) const {
+    MPI_Aint size;
+    int disp_unit;
+    char* base;
+    MPI_Win_shared_query(m_win, rank, &size, &disp_unit, &base);
+
+    Segment segment;
+    if (size == 0) {
+        segment.num_vert = 0;
+        segment.num_tri = 0;
+        segment.num_forces = nullptr;
+        segment.vert_pos = nullptr;
+        segment.vert_vel = nullptr;
+        segment.vert_forces = nullptr;
+        segment.triangles = nullptr;
+        segment.vert_indices = nullptr;
+        return segment;
+    }
+
+    unsigned int* header = reinterpret_cast<unsigned int*>(base);
+    segment.num_vert = header[0];
+    segment.num_tri = header[1];
+    segment.num_forces = &header[2];
+
+    char* ptr = base + header_size;
+    segment.vert_pos = reinterpret_cast<ChVector<>*>(ptr);
+    ptr += segment.num_vert * sizeof(ChVector<>);
+    segment.vert_vel = reinterpret_cast<ChVector<>*>(ptr);
+    ptr += segment.num_vert * sizeof(ChVector<>);
+    segment.vert_forces = reinterpret_cast<ChVector<>*>(ptr);
+    ptr += segment.num_vert * sizeof(ChVector<>);
+    segment.triangles = reinterpret_cast<ChVector<int>*>(ptr);
+    ptr += Align8(segment.num_tri * sizeof(ChVector<int>));
+    segment.vert_indices = reinterpret_cast<int*>(ptr);
+
+    return segment;
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,78 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Shared-memory exchange buffer for tire-terrain cosimulation data.
+// Used when all cosimulation nodes run on the same host, in which case the
+// tire mesh states and the terrain contact forces are exchanged through an
+// MPI-3 shared memory window instead of being packed into MPI messages.
+//
+// =============================================================================
+
+#ifndef CH_COSIM_SHARED_BUFFER_H
+#define CH_COSIM_SHARED_BUFFER_H
+
+#include "mpi.h"
+
+#include "chrono/core/ChVector.h"
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// Shared-memory exchange buffer between the tire nodes and the terrain node.
+/// Each tire node owns one segment of the window, holding the contact mesh vertex states (written by the tire
+/// node) and the vertex contact forces (written by the terrain node).  Any node on the host can obtain direct
+/// (zero-copy) views into any segment.  Access to a segment is ordered through (empty) notification messages,
+/// preceded and followed by a call to Sync().
+class CH_VEHICLE_API ChCosimSharedBuffer {
+  public:
+    /// Views into the segment associated with one tire.
+    struct Segment {
+        unsigned int num_vert;     ///< number of contact mesh vertices
+        unsigned int num_tri;      ///< number of contact mesh triangles
+        unsigned int* num_forces;  ///< number of vertex forces currently stored
+        ChVector<>* vert_pos;      ///< vertex positions [num_vert]
+        ChVector<>* vert_vel;      ///< vertex velocities [num_vert]
+        ChVector<int>* triangles;  ///< triangle vertex indices [num_tri]
+        ChVector<>* vert_forces;   ///< vertex forces [num_vert]
+        int* vert_indices;         ///< indices of vertices with non-zero force [num_vert]
+    };
+
+    /// Check whether all ranks in the given communicator run on the same host.
+    static bool IsSingleHost(MPI_Comm comm);
+
+    /// Allocate the shared window (collective over all ranks in 'comm').
+    /// A tire node passes the size of its contact mesh; all other nodes pass zeros.
+    ChCosimSharedBuffer(MPI_Comm comm, unsigned int num_vert, unsigned int num_tri);
+
+    ~ChCosimSharedBuffer();
+
+    /// Get the segment owned by the specified rank.
+    Segment GetSegment(int rank) const;
+
+    /// Synchronize the private and public copies of the window.
+    /// Must be called before notifying a peer of new data and after receiving such a notification.
+    void Sync() { MPI_Win_sync(m_win); }
+
+  private:
+    static MPI_Aint GetSegmentSize(unsigned int num_vert, unsigned int num_tri);
+
+    MPI_Comm m_comm;  ///< host-local communicator (same rank ordering as the input communicator)
+    MPI_Win m_win;    ///< shared memory window
+};
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
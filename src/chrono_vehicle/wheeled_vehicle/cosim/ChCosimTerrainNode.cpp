@@ -17,6 +17,7 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cassert>
 
 #include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimManager.h"
 #include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimTerrainNode.h"
@@ -25,7 +26,7 @@ namespace chrono {
 namespace vehicle {
 
 ChCosimTerrainNode::ChCosimTerrainNode(int rank, ChSystem* system, ChTerrain* terrain, int num_tires)
-    : ChCosimNode(rank, system), m_terrain(terrain), m_num_tires(num_tires) {}
+    : ChCosimNode(rank, system), m_terrain(terrain), m_num_tires(num_tires), m_buffer(NULL) {}
 
 void ChCosimTerrainNode::Initialize() {
     // Receive contact specification from tire nodes
@@ -44,58 +45,102 @@ void ChCosimTerrainNode::Initialize() {
 }
 
 void ChCosimTerrainNode::Synchronize(double time) {
-    for (int it = 0; it < m_num_tires; it++) {
-        // Receive tire mesh vertex locations and velocities from the tire node
-        MPI_Status status;
-        unsigned int num_vert = m_num_vertices[it];
-        unsigned int num_tri = m_num_triangles[it];
-        double* vert_data = new double[2 * 3 * num_vert];
-        int* tri_data = new int[3 * num_tri];
-        MPI_Recv(vert_data, 2 * 3 * num_vert, MPI_DOUBLE, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD, &status);
-        MPI_Recv(tri_data, 3 * num_tri, MPI_INT, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD, &status);
-
-        // Unpack received data
-        std::vector<ChVector<>> vert_pos;
-        std::vector<ChVector<>> vert_vel;
-        std::vector<ChVector<int>> triangles;
-        for (unsigned int i = 0; i < num_vert; i++) {
-            vert_pos.push_back(ChVector<>(vert_data[3 * i + 0], vert_data[3 * i + 1], vert_data[3 * i + 2]));
-            vert_vel.push_back(ChVector<>(vert_data[3 * num_vert + 3 * i + 0], vert_data[3 * num_vert + 3 * i + 1],
-                                          vert_data[3 * num_vert + 3 * i + 2]));
+    if (m_buffer) {
+        // Post receives for the notifications from all tire nodes and process tires in the order in which
+        // their data becomes available.
+        std::vector<MPI_Request> requests(m_num_tires);
+        for (int it = 0; it < m_num_tires; it++) {
+            MPI_Irecv(NULL, 0, MPI_BYTE, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD, &requests[it]);
         }
-        for (unsigned int i = 0; i < num_tri; i++) {
-            triangles.push_back(ChVector<int>(tri_data[3 * i + 0], tri_data[3 * i + 1], tri_data[3 * i + 2]));
+        for (int i = 0; i < m_num_tires; i++) {
+            int it;
+            MPI_Waitany(m_num_tires, requests.data(), &it, MPI_STATUS_IGNORE);
+            ExchangeShared(it);
         }
-
-        delete[] vert_data;
-        delete[] tri_data;
-
-        // Let derived class process received data
-        m_manager->OnReceiveTireData(it, vert_pos, vert_vel, triangles);
-
-        // Let derived class produce tire contact forces
-        std::vector<ChVector<>> vert_forces;
-        std::vector<int> vert_indeces;
-        m_manager->OnSendTireForces(it, vert_forces, vert_indeces);
-        num_vert = (unsigned int)vert_indeces.size();
-
-        // Send vertex indeces and forces to the tire node
-        //// TODO: use custom derived MPI types?
-        double* force_data = new double[3 * num_vert];
-        for (unsigned int i = 0; i < num_vert; i++) {
-            force_data[3 * i + 0] = vert_forces[i].x;
-            force_data[3 * i + 1] = vert_forces[i].y;
-            force_data[3 * i + 2] = vert_forces[i].z;
+    } else {
+        for (int it = 0; it < m_num_tires; it++) {
+            ExchangeMessage(it);
         }
-        MPI_Send(vert_indeces.data(), num_vert, MPI_INT, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD);
-        MPI_Send(force_data, 3 * num_vert, MPI_DOUBLE, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD);
-
-        delete[] force_data;
     }
 
     m_terrain->Synchronize(time);
 }
 
+// Exchange data with the specified tire node through MPI messages.
+void ChCosimTerrainNode::ExchangeMessage(int which) {
+    // Receive tire mesh vertex locations and velocities from the tire node
+    MPI_Status status;
+    unsigned int num_vert = m_num_vertices[which];
+    unsigned int num_tri = m_num_triangles[which];
+    double* vert_data = new double[2 * 3 * num_vert];
+    int* tri_data = new int[3 * num_tri];
+    MPI_Recv(vert_data, 2 * 3 * num_vert, MPI_DOUBLE, TIRE_NODE_RANK(which), which, MPI_COMM_WORLD, &status);
+    MPI_Recv(tri_data, 3 * num_tri, MPI_INT, TIRE_NODE_RANK(which), which, MPI_COMM_WORLD, &status);
+
+    // Unpack received data
+    std::vector<ChVector<>> vert_pos;
+    std::vector<ChVector<>> vert_vel;
+    std::vector<ChVector<int>> triangles;
+    for (unsigned int i = 0; i < num_vert; i++) {
+        vert_pos.push_back(ChVector<>(vert_data[3 * i + 0], vert_data[3 * i + 1], vert_data[3 * i + 2]));
+        vert_vel.push_back(ChVector<>(vert_data[3 * num_vert + 3 * i + 0], vert_data[3 * num_vert + 3 * i + 1],
+                                      vert_data[3 * num_vert + 3 * i + 2]));
+    }
+    for (unsigned int i = 0; i < num_tri; i++) {
+        triangles.push_back(ChVector<int>(tri_data[3 * i + 0], tri_data[3 * i + 1], tri_data[3 * i + 2]));
+    }
+
+    delete[] vert_data;
+    delete[] tri_data;
+
+    // Let derived class process received data
+    m_manager->OnReceiveTireData(which, vert_pos, vert_vel, triangles);
+
+    // Let derived class produce tire contact forces
+    std::vector<ChVector<>> vert_forces;
+    std::vector<int> vert_indeces;
+    m_manager->OnSendTireForces(which, vert_forces, vert_indeces);
+    num_vert = (unsigned int)vert_indeces.size();
+
+    // Send vertex indeces and forces to the tire node
+    //// TODO: use custom derived MPI types?
+    double* force_data = new double[3 * num_vert];
+    for (unsigned int i = 0; i < num_vert; i++) {
+        force_data[3 * i + 0] = vert_forces[i].x();
+        force_data[3 * i + 1] = vert_forces[i].y();
+        force_data[3 * i + 2] = vert_forces[i].z();
+    }
+    MPI_Send(vert_indeces.data(), num_vert, MPI_INT, TIRE_NODE_RANK(which), which, MPI_COMM_WORLD);
+    MPI_Send(force_data, 3 * num_vert, MPI_DOUBLE, TIRE_NODE_RANK(which), which, MPI_COMM_WORLD);
+
+    delete[] force_data;
+}
+
+// Exchange data with the specified tire node through the shared-memory buffer.
+// The tire node has already published its mesh state (and notified this node).
+void ChCosimTerrainNode::ExchangeShared(int which) {
+    ChCosimSharedBuffer::Segment segment = m_buffer->GetSegment(TIRE_NODE_RANK(which));
+    m_buffer->Sync();
+
+    // Let derived class process received data (directly from the shared segment)
+    m_manager->OnReceiveTireDataShared(which, segment.num_vert, segment.vert_pos, segment.vert_vel, segment.num_tri,
+                                       segment.triangles);
+
+    // Let derived class produce tire contact forces
+    std::vector<ChVector<>> vert_forces;
+    std::vector<int> vert_indeces;
+    m_manager->OnSendTireForces(which, vert_forces, vert_indeces);
+    unsigned int num_vert = (unsigned int)vert_indeces.size();
+    assert(num_vert <= segment.num_vert);
+
+    // Write vertex indeces and forces in the shared segment, then publish and notify the tire node
+    std::copy(vert_forces.begin(), vert_forces.begin() + num_vert, segment.vert_forces);
+    std::copy(vert_indeces.begin(), vert_indeces.end(), segment.vert_indices);
+    *segment.num_forces = num_vert;
+    m_buffer->Sync();
+    MPI_Send(NULL, 0, MPI_BYTE, TIRE_NODE_RANK(which), which, MPI_COMM_WORLD);
+}
+
 void ChCosimTerrainNode::Advance(double step) {
     double t = 0;
     while (t < step) {
@@ -26,6 +26,7 @@
 #include "chrono_vehicle/ChApiVehicle.h"
 #include "chrono_vehicle/ChTerrain.h"
 #include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimNode.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimSharedBuffer.h"
 
 namespace chrono {
 namespace vehicle {
@@ -41,11 +42,15 @@ class CH_VEHICLE_API ChCosimTerrainNode : public ChCosimNode {
     void Advance(double step);
 
   private:
+    void ExchangeMessage(int which);
+    void ExchangeShared(int which);
+
     ChCosimManager* m_manager;                  // back-pointer to the cosimulation manager
     ChTerrain* m_terrain;                       // underlying terrain object
     int m_num_tires;                            // number of tires
     std::vector<unsigned int> m_num_vertices;   // number of contact vertices received from each tire
     std::vector<unsigned int> m_num_triangles;  // number of contact triangles received from each tire
+    ChCosimSharedBuffer* m_buffer;              // shared-memory exchange buffer (NULL if using message passing)
 
     friend class ChCosimManager;
 };
@@ -17,6 +17,7 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cassert>
 #include <cstdio>
 #include <vector>
 
@@ -28,7 +29,10 @@ namespace chrono {
 namespace vehicle {
 
 ChCosimTireNode::ChCosimTireNode(int rank, ChSystem* system, ChDeformableTire* tire, WheelID id)
-    : ChCosimNode(rank, system), m_tire(tire), m_id(id) {}
+    : ChCosimNode(rank, system), m_tire(tire), m_id(id), m_num_vert(0), m_num_tri(0),
+      m_buffer(NULL),
+      m_pipelined(false),
+      m_pending(false) {}
 
 void ChCosimTireNode::Initialize() {
     // Ghost wheel body (driven kinematically through messages from vehicle node)
@@ -67,10 +71,12 @@ void ChCosimTireNode::Initialize() {
     m_tire->GetLoadContainer()->Add(m_contact_load);
 
     // Send contact specification to terrain node
+    m_num_vert = contact_surface->GetNumVertices();
+    m_num_tri = contact_surface->GetNumTriangles();
     {
         unsigned int props[2];
-        props[0] = contact_surface->GetNumVertices();
-        props[1] = contact_surface->GetNumTriangles();
+        props[0] = m_num_vert;
+        props[1] = m_num_tri;
         MPI_Send(props, 2, MPI_UNSIGNED, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
         if (m_verbose) {
             printf("Tire node %d. Send to %d props = %d %d\n", m_rank, TERRAIN_NODE_RANK, props[0], props[1]);
@@ -80,17 +86,17 @@ void ChCosimTireNode::Initialize() {
 
 void ChCosimTireNode::Synchronize(double time) {
     // Send tire force to the vehicle node
-    TireForce tire_force = m_tire->GetTireForce(true);
+    TerrainForce tire_force = m_tire->ReportTireForce(m_terrain.get());
     double bufTF[9];
-    bufTF[0] = tire_force.force.x;
-    bufTF[1] = tire_force.force.y;
-    bufTF[2] = tire_force.force.z;
-    bufTF[3] = tire_force.moment.x;
-    bufTF[4] = tire_force.moment.y;
-    bufTF[5] = tire_force.moment.z;
-    bufTF[6] = tire_force.point.x;
-    bufTF[7] = tire_force.point.y;
-    bufTF[8] = tire_force.point.z;
+    bufTF[0] = tire_force.force.x();
+    bufTF[1] = tire_force.force.y();
+    bufTF[2] = tire_force.force.z();
+    bufTF[3] = tire_force.moment.x();
+    bufTF[4] = tire_force.moment.y();
+    bufTF[5] = tire_force.moment.z();
+    bufTF[6] = tire_force.point.x();
+    bufTF[7] = tire_force.point.y();
+    bufTF[8] = tire_force.point.z();
     MPI_Send(bufTF, 9, MPI_DOUBLE, VEHICLE_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
 
     // Receive wheel state from the vehicle node
@@ -104,32 +110,74 @@ void ChCosimTireNode::Synchronize(double time) {
     wheel_state.ang_vel = ChVector<>(bufWS[10], bufWS[11], bufWS[12]);
     wheel_state.omega = bufWS[13];
 
+    // Exchange tire mesh vertex states and terrain contact forces with the terrain node
+    if (m_buffer)
+        ExchangeShared();
+    else
+        ExchangeMessage();
+
+    // Apply forces to the mesh vertices
+    m_contact_load->InputSimpleForces(m_vert_forces, m_vert_indices);
+
+    // Synchronize the ghost wheel and the tire
+    m_wheel->SetPos(wheel_state.pos);
+    m_wheel->SetRot(wheel_state.rot);
+    m_wheel->SetPos_dt(wheel_state.lin_vel);
+    m_wheel->SetWvel_par(wheel_state.ang_vel);
+
+    m_tire->Synchronize(time, wheel_state, *m_terrain);
+}
+
+// Set up the shared-memory transport.
+// The contact mesh connectivity does not change, so the triangles are written into this node's segment only
+// once here, together with the list of vertex nodes (in the vertex order used by OutputSimpleMesh and
+// InputSimpleForces) from which the vertex states are later written directly into the segment.
+void ChCosimTireNode::InitializeShared(ChCosimSharedBuffer* buffer, bool pipelined) {
+    m_buffer = buffer;
+    m_pipelined = pipelined;
+
+    ChCosimSharedBuffer::Segment segment = m_buffer->GetSegment(m_rank);
+
+    m_contact_load->OutputSimpleMesh(m_vert_pos, m_vert_vel, m_triangles);
+    assert(m_vert_pos.size() == segment.num_vert && m_triangles.size() == segment.num_tri);
+    std::copy(m_triangles.begin(), m_triangles.end(), segment.triangles);
+
+    const auto& trilist = m_contact_load->GetContactMesh()->GetTriangleList();
+    m_vert_nodes.resize(segment.num_vert);
+    for (size_t it = 0; it < trilist.size(); it++) {
+        m_vert_nodes[m_triangles[it].x()] = trilist[it]->GetNode1();
+        m_vert_nodes[m_triangles[it].y()] = trilist[it]->GetNode2();
+        m_vert_nodes[m_triangles[it].z()] = trilist[it]->GetNode3();
+    }
+
+    m_buffer->Sync();
+}
+
+// Exchange data with the terrain node through MPI messages.
+void ChCosimTireNode::ExchangeMessage() {
     // Extract tire mesh vertex locations and velocities
-    std::vector<ChVector<>> vert_pos;
-    std::vector<ChVector<>> vert_vel;
-    std::vector<ChVector<int>> triangles;
-    m_contact_load->OutputSimpleMesh(vert_pos, vert_vel, triangles);
-    unsigned int num_vert = (unsigned int)vert_pos.size();
-    unsigned int num_tri = (unsigned int)triangles.size();
+    m_contact_load->OutputSimpleMesh(m_vert_pos, m_vert_vel, m_triangles);
+    unsigned int num_vert = (unsigned int)m_vert_pos.size();
+    unsigned int num_tri = (unsigned int)m_triangles.size();
 
     // Send tire mesh vertex locations and velocities to the terrain node
     //// TODO: use custom derived MPI types?
     double* vert_data = new double[2 * 3 * num_vert];
     int* tri_data = new int[3 * num_tri];
     for (unsigned int iv = 0; iv < num_vert; iv++) {
-        vert_data[3 * iv + 0] = vert_pos[iv].x;
-        vert_data[3 * iv + 1] = vert_pos[iv].y;
-        vert_data[3 * iv + 2] = vert_pos[iv].z;
+        vert_data[3 * iv + 0] = m_vert_pos[iv].x();
+        vert_data[3 * iv + 1] = m_vert_pos[iv].y();
+        vert_data[3 * iv + 2] = m_vert_pos[iv].z();
     }
     for (unsigned int iv = 0; iv < num_vert; iv++) {
-        vert_data[3 * num_vert + 3 * iv + 0] = vert_vel[iv].x;
-        vert_data[3 * num_vert + 3 * iv + 1] = vert_vel[iv].y;
-        vert_data[3 * num_vert + 3 * iv + 2] = vert_vel[iv].z;
+        vert_data[3 * num_vert + 3 * iv + 0] = m_vert_vel[iv].x();
+        vert_data[3 * num_vert + 3 * iv + 1] = m_vert_vel[iv].y();
+        vert_data[3 * num_vert + 3 * iv + 2] = m_vert_vel[iv].z();
     }
     for (unsigned int it = 0; it < num_tri; it++) {
-        tri_data[3 * it + 0] = triangles[it].x;
-        tri_data[3 * it + 1] = triangles[it].y;
-        tri_data[3 * it + 2] = triangles[it].z;
+        tri_data[3 * it + 0] = m_triangles[it].x();
+        tri_data[3 * it + 1] = m_triangles[it].y();
+        tri_data[3 * it + 2] = m_triangles[it].z();
     }
     MPI_Send(vert_data, 2 * 3 * num_vert, MPI_DOUBLE, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
     MPI_Send(tri_data, 3 * num_tri, MPI_INT, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
@@ -148,25 +196,70 @@ void ChCosimTireNode::Synchronize(double time) {
     MPI_Recv(index_data, count, MPI_INT, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD, &status);
     MPI_Recv(force_data, 3 * count, MPI_DOUBLE, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD, &status);
 
-    // Repack data and apply forces to the mesh vertices
-    std::vector<ChVector<>> vert_forces;
-    std::vector<int> vert_indeces;
+    // Repack data
+    m_vert_forces.clear();
+    m_vert_indices.clear();
     for (int iv = 0; iv < count; iv++) {
-        vert_forces.push_back(ChVector<>(force_data[3 * iv + 0], force_data[3 * iv + 1], force_data[3 * iv + 2]));
-        vert_indeces.push_back(index_data[iv]);
+        m_vert_forces.push_back(ChVector<>(force_data[3 * iv + 0], force_data[3 * iv + 1], force_data[3 * iv + 2]));
+        m_vert_indices.push_back(index_data[iv]);
     }
-    m_contact_load->InputSimpleForces(vert_forces, vert_indeces);
 
     delete[] index_data;
     delete[] force_data;
+}
 
-    // Synchronize the ghost wheel and the tire
-    m_wheel->SetPos(wheel_state.pos);
-    m_wheel->SetRot(wheel_state.rot);
-    m_wheel->SetPos_dt(wheel_state.lin_vel);
-    m_wheel->SetWvel_par(wheel_state.ang_vel);
+// Exchange data with the terrain node through the shared-memory buffer.
+// Mesh states are written directly into this node's segment and the terrain node is notified with an empty
+// message; the terrain node writes the contact forces in the same segment and notifies back.
+// In pipelined mode, the forces for the current mesh state are collected only at the next exchange, so that the
+// terrain node computes them while this node advances with the forces from the previous exchange.
+void ChCosimTireNode::ExchangeShared() {
+    if (m_pipelined) {
+        CollectShared();
+        PublishShared();
+    } else {
+        PublishShared();
+        CollectShared();
+    }
+}
 
-    m_tire->Synchronize(time, wheel_state, *m_terrain);
+// Write the current tire mesh vertex states directly into the shared segment, then publish and notify the
+// terrain node (the triangles were written once, in InitializeShared).
+void ChCosimTireNode::PublishShared() {
+    ChCosimSharedBuffer::Segment segment = m_buffer->GetSegment(m_rank);
+
+    for (unsigned int iv = 0; iv < segment.num_vert; iv++) {
+        segment.vert_pos[iv] = m_vert_nodes[iv]->GetPos();
+        segment.vert_vel[iv] = m_vert_nodes[iv]->GetPos_dt();
+    }
+
+    m_buffer->Sync();
+    MPI_Send(NULL, 0, MPI_BYTE, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
+    m_pending = true;
+}
+
+// Wait for the terrain node to produce contact forces for the last published mesh state and load them.
+// A no-op if no mesh state was published (first exchange in pipelined mode).
+void ChCosimTireNode::CollectShared() {
+    if (!m_pending)
+        return;
+
+    ChCosimSharedBuffer::Segment segment = m_buffer->GetSegment(m_rank);
+
+    MPI_Status status;
+    MPI_Recv(NULL, 0, MPI_BYTE, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD, &status);
+    m_buffer->Sync();
+    m_pending = false;
+
+    unsigned int count = *segment.num_forces;
+    m_vert_forces.assign(segment.vert_forces, segment.vert_forces + count);
+    m_vert_indices.assign(segment.vert_indices, segment.vert_indices + count);
+}
+
+// Match the last notification from the terrain node (pipelined mode) before shutting down.
+void ChCosimTireNode::Flush() {
+    if (m_buffer)
+        CollectShared();
 }
 
 void ChCosimTireNode::Advance(double step) {
@@ -25,11 +25,14 @@
 #include "chrono_fea/ChLoadContactSurfaceMesh.h"
 #include "chrono_vehicle/ChApiVehicle.h"
 #include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimNode.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimSharedBuffer.h"
 #include "chrono_vehicle/wheeled_vehicle/tire/ChDeformableTire.h"
 
 namespace chrono {
 namespace vehicle {
 
+class ChCosimManager;
+
 class CH_VEHICLE_API ChCosimTireNode : public ChCosimNode {
   public:
     ChCosimTireNode(int rank, ChSystem* system, ChDeformableTire* tire, WheelID id);
@@ -39,12 +42,36 @@ class CH_VEHICLE_API ChCosimTireNode : public ChCosimNode {
     void Advance(double step);
 
   private:
+    void InitializeShared(ChCosimSharedBuffer* buffer, bool pipelined);
+    void ExchangeMessage();
+    void ExchangeShared();
+    void PublishShared();
+    void CollectShared();
+    void Flush();
+
     ChDeformableTire* m_tire;
     WheelID m_id;
     std::shared_ptr<ChBody> m_wheel;
     std::shared_ptr<ChTerrain> m_terrain;
 
     std::shared_ptr<fea::ChLoadContactSurfaceMesh> m_contact_load;
+
+    unsigned int m_num_vert;  // number of contact mesh vertices
+    unsigned int m_num_tri;   // number of contact mesh triangles
+
+    ChCosimSharedBuffer* m_buffer;  // shared-memory exchange buffer (NULL if using message passing)
+    bool m_pipelined;               // do not wait for the terrain node after publishing the mesh state?
+    bool m_pending;                 // are contact forces for a published mesh state still expected?
+
+    std::vector<std::shared_ptr<fea::ChNodeFEAxyz>> m_vert_nodes;  // contact mesh vertex nodes (shared transport)
+
+    std::vector<ChVector<>> m_vert_pos;      // scratch contact mesh vertex positions
+    std::vector<ChVector<>> m_vert_vel;      // scratch contact mesh vertex velocities
+    std::vector<ChVector<int>> m_triangles;  // scratch contact mesh triangles
+    std::vector<ChVector<>> m_vert_forces;   // scratch vertex contact forces
+    std::vector<int> m_vert_indices;         // scratch indices of vertices with contact forces
+
+    friend class ChCosimManager;
 };
 
 }  // end namespace vehicle
@@ -26,7 +26,7 @@ namespace chrono {
 namespace vehicle {
 
 ChCosimVehicleNode::ChCosimVehicleNode(int rank, ChWheeledVehicle* vehicle, ChPowertrain* powertrain, ChDriver* driver)
-    : ChCosimNode(rank, m_vehicle->GetSystem()), m_vehicle(vehicle), m_powertrain(powertrain), m_driver(driver) {
+    : ChCosimNode(rank, vehicle->GetSystem()), m_vehicle(vehicle), m_powertrain(powertrain), m_driver(driver) {
     m_num_wheels = 2 * m_vehicle->GetNumberAxles();
     m_tire_forces.resize(m_num_wheels);
 }
@@ -47,9 +47,9 @@ void ChCosimVehicleNode::Initialize(const ChCoordsys<>& chassisPos) {
         double mass = m_vehicle->GetWheelBody(WheelID(iw))->GetMass();
         ChVector<> inertia = m_vehicle->GetWheelBody(WheelID(iw))->GetInertiaXX();
         props[0] = mass;
-        props[1] = inertia.x;
-        props[2] = inertia.y;
-        props[3] = inertia.z;
+        props[1] = inertia.x();
+        props[2] = inertia.y();
+        props[3] = inertia.z();
         MPI_Send(props, 4, MPI_DOUBLE, TIRE_NODE_RANK(iw), iw, MPI_COMM_WORLD);
         if (m_verbose) {
             printf("Vehicle node %d.  Send to %d props = %g %g %g %g\n", m_rank, TIRE_NODE_RANK(iw), props[0], props[1],
@@ -82,19 +82,19 @@ void ChCosimVehicleNode::Synchronize(double time) {
     double bufWS[14];
     for (int iw = 0; iw < m_num_wheels; iw++) {
         WheelState wheel_state = m_vehicle->GetWheelState(WheelID(iw));
-        bufWS[0] = wheel_state.pos.x;
-        bufWS[1] = wheel_state.pos.y;
-        bufWS[2] = wheel_state.pos.z;
-        bufWS[3] = wheel_state.rot.e0;
-        bufWS[4] = wheel_state.rot.e1;
-        bufWS[5] = wheel_state.rot.e2;
-        bufWS[6] = wheel_state.rot.e3;
-        bufWS[7] = wheel_state.lin_vel.x;
-        bufWS[8] = wheel_state.lin_vel.y;
-        bufWS[9] = wheel_state.lin_vel.z;
-        bufWS[10] = wheel_state.ang_vel.x;
-        bufWS[11] = wheel_state.ang_vel.y;
-        bufWS[12] = wheel_state.ang_vel.z;
+        bufWS[0] = wheel_state.pos.x();
+        bufWS[1] = wheel_state.pos.y();
+        bufWS[2] = wheel_state.pos.z();
+        bufWS[3] = wheel_state.rot.e0();
+        bufWS[4] = wheel_state.rot.e1();
+        bufWS[5] = wheel_state.rot.e2();
+        bufWS[6] = wheel_state.rot.e3();
+        bufWS[7] = wheel_state.lin_vel.x();
+        bufWS[8] = wheel_state.lin_vel.y();
+        bufWS[9] = wheel_state.lin_vel.z();
+        bufWS[10] = wheel_state.ang_vel.x();
+        bufWS[11] = wheel_state.ang_vel.y();
+        bufWS[12] = wheel_state.ang_vel.z();
         bufWS[13] = wheel_state.omega;
         MPI_Send(bufWS, 14, MPI_DOUBLE, TIRE_NODE_RANK(iw), iw, MPI_COMM_WORLD);
     }
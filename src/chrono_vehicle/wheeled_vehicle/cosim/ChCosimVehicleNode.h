@@ -46,7 +46,7 @@ class CH_VEHICLE_API ChCosimVehicleNode : public ChCosimNode {
     ChDriver* m_driver;
 
     int m_num_wheels;
-    TireForces m_tire_forces;
+    TerrainForces m_tire_forces;
 };
 
 }  // end namespace vehicle
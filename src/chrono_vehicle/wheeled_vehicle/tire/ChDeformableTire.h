@@ -192,6 +192,8 @@ class CH_VEHICLE_API ChDeformableTire : public ChTire {
 
     std::shared_ptr<ChMaterialSurfaceSMC> m_contact_mat;           ///< tire contact material
     std::shared_ptr<fea::ChVisualizationFEAmesh> m_visualization;  ///< tire mesh visualization
+
+    friend class ChModalTireBasis;
 };
 
 /// @} vehicle_wheeled_tire
@@ -0,0 +1,200 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Template for a reduced-order (modal) flexible tire.
+//
+// Notes:
+//   - the modal equations are decoupled and integrated with implicit Euler,
+//     with the modal forces held constant over the step.
+//   - inertial coupling between the wheel motion and the tire deformation is
+//     neglected (the modal coordinates are relative to the wheel frame).
+//   - over the contact patch, the terrain is approximated by its tangent plane
+//     below the lowest point of the wheel (as in ChTire::disc_terrain_contact),
+//     so that the terrain is queried a fixed number of times per step,
+//     independent of the number of mesh nodes.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "chrono_vehicle/wheeled_vehicle/tire/ChModalTire.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+ChModalTire::ChModalTire(const std::string& name)
+    : ChTire(name),
+      m_zeta(0.05),
+      m_kn(2e5),
+      m_gn(1e2),
+      m_kt(1e3),
+      m_stepsize(1e-3),
+      m_num_contacts(0),
+      m_max_depth(0) {
+    m_tireforce.force = ChVector<>(0, 0, 0);
+    m_tireforce.point = ChVector<>(0, 0, 0);
+    m_tireforce.moment = ChVector<>(0, 0, 0);
+}
+
+void ChModalTire::SetContactCoefficients(double kn, double gn, double kt) {
+    m_kn = kn;
+    m_gn = gn;
+    m_kt = kt;
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+void ChModalTire::Initialize(std::shared_ptr<ChBody> wheel, VehicleSide side) {
+    assert(m_basis);
+
+    ChTire::Initialize(wheel, side);
+
+    int num_modes = m_basis->GetNumModes();
+    m_q.assign(num_modes, 0.0);
+    m_qd.assign(num_modes, 0.0);
+    m_fq.assign(num_modes, 0.0);
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+void ChModalTire::AddVisualizationAssets(VisualizationType vis) {
+    if (vis == VisualizationType::NONE)
+        return;
+
+    m_cyl_shape = std::make_shared<ChCylinderShape>();
+    m_cyl_shape->GetCylinderGeometry().rad = GetRadius();
+    m_cyl_shape->GetCylinderGeometry().p1 = ChVector<>(0, m_basis->GetWidth() / 2, 0);
+    m_cyl_shape->GetCylinderGeometry().p2 = ChVector<>(0, -m_basis->GetWidth() / 2, 0);
+    m_wheel->AddAsset(m_cyl_shape);
+}
+
+void ChModalTire::RemoveVisualizationAssets() {
+    // Make sure we only remove the assets added by ChModalTire::AddVisualizationAssets.
+    // This is important for the ChTire object because a wheel may add its own assets
+    // to the same body (the spindle/wheel).
+    auto it = std::find(m_wheel->GetAssets().begin(), m_wheel->GetAssets().end(), m_cyl_shape);
+    if (it != m_wheel->GetAssets().end())
+        m_wheel->GetAssets().erase(it);
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+ChVector<> ChModalTire::GetNodePosition(int node) const {
+    ChVector<> local = m_basis->GetNodePosition(node);
+    for (int j = 0; j < (int)m_q.size(); j++)
+        local += m_basis->GetModeShape(j, node) * m_q[j];
+    return m_frame.TransformPointLocalToParent(local);
+}
+
+void ChModalTire::Synchronize(double time, const WheelState& wheel_state, const ChTerrain& terrain) {
+    // Invoke the base class function.
+    ChTire::Synchronize(time, wheel_state, terrain);
+
+    // Cache the wheel frame.
+    m_frame.SetCoord(wheel_state.pos, wheel_state.rot);
+    m_frame.SetPos_dt(wheel_state.lin_vel);
+    m_frame.SetWvel_par(wheel_state.ang_vel);
+
+    // Clear the force accumulators and set the application point to the wheel center.
+    m_tireforce.force = ChVector<>(0, 0, 0);
+    m_tireforce.moment = ChVector<>(0, 0, 0);
+    m_tireforce.point = wheel_state.pos;
+    std::fill(m_fq.begin(), m_fq.end(), 0.0);
+    m_num_contacts = 0;
+    m_max_depth = 0;
+
+    int num_modes = (int)m_q.size();
+    int num_nodes = m_basis->GetNumNodes();
+
+    // Approximate the terrain with its tangent plane below the lowest point of the (undeformed) wheel disc.
+    // If the disc is (almost) horizontal, use the point below the wheel center.
+    ChVector<> disc_normal = wheel_state.rot.GetYaxis();
+    ChVector<> dir1 = Vcross(disc_normal, ChVector<>(0, 0, 1));
+    double sinTilt2 = dir1.Length2();
+    ChVector<> ptD = wheel_state.pos;
+    if (sinTilt2 >= 1e-3)
+        ptD += GetRadius() * Vcross(disc_normal, dir1 / std::sqrt(sinTilt2));
+    ChVector<> plane_pt(ptD.x(), ptD.y(), terrain.GetHeight(ptD.x(), ptD.y()));
+    ChVector<> normal = terrain.GetNormal(ptD.x(), ptD.y());
+    double mu = terrain.GetCoefficientFriction(ptD.x(), ptD.y());
+
+    for (int i = 0; i < num_nodes; i++) {
+        // Node position and velocity relative to the wheel frame.
+        ChVector<> local_pos = m_basis->GetNodePosition(i);
+        ChVector<> local_vel(0, 0, 0);
+        for (int j = 0; j < num_modes; j++) {
+            const ChVector<>& phi = m_basis->GetModeShape(j, i);
+            local_pos += phi * m_q[j];
+            local_vel += phi * m_qd[j];
+        }
+
+        // Node position and velocity in the global frame.
+        ChVector<> pos = m_frame.TransformPointLocalToParent(local_pos);
+        ChVector<> vel = m_frame.PointSpeedLocalToParent(local_pos, local_vel);
+
+        // Check penetration into the terrain.
+        double depth = Vdot(plane_pt - pos, normal);
+        if (depth <= 0)
+            continue;
+
+        // Normal force (penalty with damping); no force if the node separates fast enough.
+        double vn = Vdot(vel, normal);
+        double fn = m_kn * depth - m_gn * vn;
+        if (fn <= 0)
+            continue;
+
+        // Regularized Coulomb friction force.
+        ChVector<> vt = vel - normal * vn;
+        double vt_mag = vt.Length();
+        ChVector<> f = normal * fn;
+        if (vt_mag > 1e-10) {
+            f -= vt * (std::min(m_kt * vt_mag, mu * fn) / vt_mag);
+        }
+
+        // Accumulate resultant on the wheel and generalized modal forces.
+        m_tireforce.force += f;
+        m_tireforce.moment += Vcross(pos - wheel_state.pos, f);
+        ChVector<> local_f = m_frame.TransformDirectionParentToLocal(f);
+        for (int j = 0; j < num_modes; j++)
+            m_fq[j] += Vdot(m_basis->GetModeShape(j, i), local_f);
+
+        m_num_contacts++;
+        m_max_depth = std::max(m_max_depth, depth);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+void ChModalTire::Advance(double step) {
+    int num_modes = (int)m_q.size();
+    double t = 0;
+    while (t < step) {
+        double h = std::min<>(m_stepsize, step - t);
+        for (int j = 0; j < num_modes; j++) {
+            double omega = m_basis->GetFrequency(j);
+            double v = (m_qd[j] + h * (m_fq[j] - omega * omega * m_q[j])) /
+                       (1 + 2 * m_zeta * omega * h + omega * omega * h * h);
+            m_q[j] += h * v;
+            m_qd[j] = v;
+        }
+        t += h;
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
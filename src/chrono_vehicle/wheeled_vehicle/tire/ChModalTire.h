@@ -0,0 +1,149 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Template for a reduced-order (modal) flexible tire.
+// The tire deformation relative to the wheel is described by a small number of
+// modal coordinates (see ChModalTireBasis). Contact with the terrain is
+// evaluated at the mesh nodes of the source tire; the resulting node forces
+// are projected onto the modal basis and their resultant is applied to the
+// wheel body.
+//
+// =============================================================================
+
+#ifndef CH_MODAL_TIRE_H
+#define CH_MODAL_TIRE_H
+
+#include <vector>
+
+#include "chrono/assets/ChCylinderShape.h"
+#include "chrono/physics/ChBody.h"
+
+#include "chrono_vehicle/ChTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/ChTire.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChModalTireBasis.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled_tire
+/// @{
+
+/// Reduced-order (modal) flexible tire model.
+/// Each modal coordinate obeys q'' + 2*zeta*omega*q' + omega^2*q = Phi'*f, with f the terrain contact forces at
+/// the nodes of the source mesh (expressed in the wheel frame). Node contact forces use a penalty model with
+/// regularized Coulomb friction, against the tangent plane of the terrain below the lowest point of the wheel.
+/// The terrain height, normal, and friction coefficient are queried once per Synchronize, so that the cost of a
+/// terrain query (e.g., GranularTerrain::GetHeight loops over all particles) is not multiplied by the number of
+/// mesh nodes.  Terrain features smaller than the contact patch are therefore not resolved.
+class CH_VEHICLE_API ChModalTire : public ChTire {
+  public:
+    ChModalTire(const std::string& name  ///< [in] name of this tire system
+                );
+
+    virtual ~ChModalTire() {}
+
+    /// Get the name of the vehicle subsystem template.
+    virtual std::string GetTemplateName() const override { return "ModalTire"; }
+
+    /// Set the modal basis (must be called before Initialize).
+    void SetModalBasis(std::shared_ptr<ChModalTireBasis> basis) { m_basis = basis; }
+
+    /// Set the modal damping ratio, applied to all modes (default: 0.05).
+    void SetModalDamping(double zeta) { m_zeta = zeta; }
+
+    /// Set the contact penalty coefficients.
+    void SetContactCoefficients(double kn,  ///< [in] normal stiffness per node [N/m]
+                                double gn,  ///< [in] normal damping per node [N.s/m]
+                                double kt   ///< [in] tangential regularization coefficient per node [N.s/m]
+                                );
+
+    /// Set the integration step size for the modal coordinates (default: 1e-3).
+    /// The modal equations are integrated with an implicit scheme, so this only affects accuracy.
+    void SetStepsize(double val) { m_stepsize = val; }
+
+    /// Initialize this tire system.
+    virtual void Initialize(std::shared_ptr<ChBody> wheel,  ///< [in] associated wheel body
+                            VehicleSide side                ///< [in] left/right vehicle side
+                            ) override;
+
+    /// Add visualization assets for the modal tire subsystem.
+    virtual void AddVisualizationAssets(VisualizationType vis) override;
+
+    /// Remove visualization assets for the modal tire subsystem.
+    virtual void RemoveVisualizationAssets() override;
+
+    /// Get the tire radius.
+    virtual double GetRadius() const override { return m_basis->GetRadius(); }
+
+    /// Get the tire mass.
+    virtual double GetMass() const override { return m_basis->GetMass(); }
+
+    /// Get the tire moments of inertia.
+    virtual ChVector<> GetInertia() const override { return m_basis->GetInertia(); }
+
+    /// Get the tire force and moment.
+    virtual TerrainForce GetTireForce() const override { return m_tireforce; }
+
+    /// Report the tire force and moment.
+    virtual TerrainForce ReportTireForce(ChTerrain* terrain) const override { return m_tireforce; }
+
+    /// Update the state of this tire system at the current time.
+    /// Calculate the node contact forces and their resultant on the wheel, given the current wheel state.
+    virtual void Synchronize(double time,                    ///< [in] current time
+                             const WheelState& wheel_state,  ///< [in] current state of associated wheel body
+                             const ChTerrain& terrain        ///< [in] reference to the terrain system
+                             ) override;
+
+    /// Advance the modal coordinates by the specified time step.
+    virtual void Advance(double step) override;
+
+    /// Get the current modal coordinates.
+    const std::vector<double>& GetModalCoordinates() const { return m_q; }
+
+    /// Get the current position of the specified node (expressed in the global frame).
+    ChVector<> GetNodePosition(int node) const;
+
+    /// Get the number of nodes currently in contact with the terrain.
+    int GetNumContactNodes() const { return m_num_contacts; }
+
+    /// Report the tire deflection (maximum node penetration in the last Synchronize).
+    virtual double GetDeflection() const override { return m_max_depth; }
+
+  private:
+    std::shared_ptr<ChModalTireBasis> m_basis;  ///< modal basis
+
+    double m_zeta;      ///< modal damping ratio
+    double m_kn;        ///< normal contact stiffness
+    double m_gn;        ///< normal contact damping
+    double m_kt;        ///< tangential contact regularization
+    double m_stepsize;  ///< integration step size
+
+    std::vector<double> m_q;   ///< modal coordinates
+    std::vector<double> m_qd;  ///< modal velocities
+    std::vector<double> m_fq;  ///< modal forces (from last Synchronize)
+    ChFrameMoving<> m_frame;   ///< wheel frame (from last Synchronize)
+    int m_num_contacts;        ///< number of nodes in contact
+    double m_max_depth;        ///< maximum penetration depth
+
+    TerrainForce m_tireforce;
+
+    std::shared_ptr<ChCylinderShape> m_cyl_shape;  ///< visualization cylinder asset
+};
+
+/// @} vehicle_wheeled_tire
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
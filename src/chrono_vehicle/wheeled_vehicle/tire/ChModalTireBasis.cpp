@@ -0,0 +1,429 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Modal basis for a reduced-order flexible tire model.
+//
+// The lowest eigenpairs of K*x = lambda*M*x (with rim nodes clamped) are
+// obtained through subspace iteration:
+//   - solve K*Y = M*X using a sparse LU factorization of K
+//   - M-orthonormalize Y
+//   - solve the reduced eigenproblem (Y'*K*Y)*Q = Q*Lambda
+//   - set X = Y*Q
+// Element stiffness and mass matrices are evaluated once and kept, so that
+// the products with K and M are performed element by element.
+// If the tire is pressurized, the element stiffness matrices include the
+// load stiffness of the inflation pressure (a follower load), obtained by
+// forward differences of the element pressure loads and symmetrized.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+
+#include "chrono/core/ChLinearAlgebra.h"
+#include "chrono/core/ChLinkedListMatrix.h"
+#include "chrono/physics/ChLoad.h"
+#include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChLoaderUV.h"
+
+#include "chrono_vehicle/wheeled_vehicle/tire/ChModalTireBasis.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+// Element data cached during the modal analysis.
+// -----------------------------------------------------------------------------
+struct ModalElementData {
+    std::vector<int> dofs;   // free DOF index of each element DOF (-1 if clamped)
+    std::vector<int> nodes;  // mesh node index of each element DOF
+    std::vector<int> comps;  // component of each element DOF within its node
+    ChMatrixDynamic<> K;     // element tangent stiffness matrix
+    ChMatrixDynamic<> M;     // element mass matrix
+};
+
+// Calculate y = A*x, with A the global matrix assembled from the element matrices selected by 'stiffness'.
+static void ElementProduct(const std::vector<ModalElementData>& elements,
+                           bool stiffness,
+                           const std::vector<double>& x,
+                           std::vector<double>& y) {
+    std::fill(y.begin(), y.end(), 0.0);
+    for (const auto& el : elements) {
+        const ChMatrixDynamic<>& A = stiffness ? el.K : el.M;
+        int nd = (int)el.dofs.size();
+        for (int i = 0; i < nd; i++) {
+            if (el.dofs[i] < 0)
+                continue;
+            double sum = 0;
+            for (int j = 0; j < nd; j++) {
+                if (el.dofs[j] >= 0)
+                    sum += A(i, j) * x[el.dofs[j]];
+            }
+            y[el.dofs[i]] += sum;
+        }
+    }
+}
+
+// Add to the element stiffness matrix the (symmetrized) load stiffness K = -dQ/dx of the pressure load acting on
+// the element, computed by forward differences on the element node coordinates. Coordinates of nodes with
+// rotational states (with a position part of different size than the velocity part) are not perturbed.
+static void AddPressureStiffness(ChLoad<ChLoaderPressure>& load,
+                                 fea::ChElementBase& element,
+                                 ModalElementData& el) {
+    const double delta = 1e-7;
+
+    int nd = (int)el.dofs.size();
+    load.ComputeQ(nullptr, nullptr);
+    if (load.loader.Q.GetRows() != nd)
+        return;
+    ChVectorDynamic<> Q0 = load.loader.Q;
+
+    ChMatrixDynamic<> Kp(nd, nd);
+    int col = 0;
+    for (int j = 0; j < element.GetNnodes(); j++) {
+        auto node = element.GetNodeN(j);
+        int nx = node->Get_ndof_x();
+        int nw = node->Get_ndof_w();
+        if (nx != nw) {
+            col += nw;
+            continue;
+        }
+        ChState x(nx, nullptr);
+        ChStateDelta v(nw, nullptr);
+        double T;
+        node->NodeIntStateGather(0, x, 0, v, T);
+        for (int k = 0; k < nw; k++, col++) {
+            double xk = x(k);
+            x(k) = xk + delta;
+            node->NodeIntStateScatter(0, x, 0, v, T);
+            load.ComputeQ(nullptr, nullptr);
+            for (int i = 0; i < nd; i++)
+                Kp(i, col) = -(load.loader.Q(i) - Q0(i)) / delta;
+            x(k) = xk;
+            node->NodeIntStateScatter(0, x, 0, v, T);
+        }
+    }
+    load.ComputeQ(nullptr, nullptr);
+
+    for (int i = 0; i < nd; i++)
+        for (int j = 0; j < nd; j++)
+            el.K(i, j) += 0.5 * (Kp(i, j) + Kp(j, i));
+}
+
+static double Dot(const std::vector<double>& a, const std::vector<double>& b) {
+    double sum = 0;
+    for (size_t i = 0; i < a.size(); i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+ChModalTireBasis::ChModalTireBasis() : m_mass(0), m_inertia(0, 0, 0), m_radius(0), m_width(0) {}
+
+bool ChModalTireBasis::Compute(ChDeformableTire& tire,
+                               int num_modes,
+                               int max_iterations,
+                               double tolerance,
+                               bool verbose) {
+    auto mesh = tire.GetMesh();
+    ChFrame<> wheel_frame(tire.m_wheel->GetPos(), tire.m_wheel->GetRot());
+
+    // Index mesh nodes and flag nodes connected to the rim (or otherwise fixed).
+    unsigned int num_nodes = mesh->GetNnodes();
+    std::map<fea::ChNodeFEAbase*, int> node_index;
+    std::vector<bool> clamped(num_nodes, false);
+    for (unsigned int in = 0; in < num_nodes; in++) {
+        auto node = std::dynamic_pointer_cast<fea::ChNodeFEAbase>(mesh->GetNode(in));
+        node_index[node.get()] = in;
+        clamped[in] = node->GetFixed();
+    }
+    for (auto node : tire.GetConnectedNodes()) {
+        clamped[node_index[node.get()]] = true;
+    }
+
+    // Assign free DOF offsets and extract node reference positions (in wheel frame).
+    std::vector<int> offsets(num_nodes, -1);
+    int n = 0;
+    m_positions.resize(num_nodes);
+    m_radius = 0;
+    double ymin = 1e30;
+    double ymax = -1e30;
+    for (unsigned int in = 0; in < num_nodes; in++) {
+        auto node = std::dynamic_pointer_cast<fea::ChNodeFEAxyz>(mesh->GetNode(in));
+        auto node_rot = std::dynamic_pointer_cast<fea::ChNodeFEAxyzrot>(mesh->GetNode(in));
+        ChVector<> pos = node ? node->GetPos() : node_rot ? node_rot->GetPos() : ChVector<>(0, 0, 0);
+        m_positions[in] = wheel_frame.TransformPointParentToLocal(pos);
+        m_radius = std::max(m_radius, std::sqrt(m_positions[in].x() * m_positions[in].x() +
+                                                m_positions[in].z() * m_positions[in].z()));
+        ymin = std::min(ymin, m_positions[in].y());
+        ymax = std::max(ymax, m_positions[in].y());
+        if (!clamped[in]) {
+            offsets[in] = n;
+            n += mesh->GetNode(in)->Get_ndof_w();
+        }
+    }
+    m_width = ymax - ymin;
+
+    if (n == 0 || num_modes <= 0)
+        return false;
+    num_modes = std::min(num_modes, n);
+
+    // Evaluate and cache element matrices at the current configuration.
+    std::vector<ModalElementData> elements(mesh->GetNelements());
+    for (unsigned int ie = 0; ie < mesh->GetNelements(); ie++) {
+        auto element = mesh->GetElement(ie);
+        auto& el = elements[ie];
+        for (int j = 0; j < element->GetNnodes(); j++) {
+            int in = node_index[element->GetNodeN(j).get()];
+            for (int k = 0; k < element->GetNodeNdofs(j); k++) {
+                el.dofs.push_back(offsets[in] < 0 ? -1 : offsets[in] + k);
+                el.nodes.push_back(in);
+                el.comps.push_back(k);
+            }
+        }
+        int nd = element->GetNdofs();
+        el.K.Reset(nd, nd);
+        el.M.Reset(nd, nd);
+        element->ComputeKRMmatricesGlobal(el.K, 1, 0, 0);
+        element->ComputeKRMmatricesGlobal(el.M, 0, 0, 1);
+    }
+
+    // Add the load stiffness of the inflation pressure.
+    if (tire.IsPressureEnabled() && tire.GetLoadContainer()) {
+        std::map<fea::ChElementBase*, int> element_index;
+        for (unsigned int ie = 0; ie < mesh->GetNelements(); ie++)
+            element_index[mesh->GetElement(ie).get()] = ie;
+        for (auto load : tire.GetLoadContainer()->GetLoadList()) {
+            auto pload = std::dynamic_pointer_cast<ChLoad<ChLoaderPressure>>(load);
+            if (!pload)
+                continue;
+            auto element = std::dynamic_pointer_cast<fea::ChElementBase>(pload->loader.GetLoadable());
+            auto it = element ? element_index.find(element.get()) : element_index.end();
+            if (it != element_index.end())
+                AddPressureStiffness(*pload, *element, elements[it->second]);
+        }
+    }
+
+    // Lumped translational node masses (response of M to a unit rigid translation), used for the tire inertia.
+    std::vector<double> node_mass(num_nodes, 0.0);
+    for (const auto& el : elements) {
+        int nd = (int)el.nodes.size();
+        for (int d = 0; d < 3; d++) {
+            for (int i = 0; i < nd; i++) {
+                if (el.comps[i] != d)
+                    continue;
+                double sum = 0;
+                for (int j = 0; j < nd; j++) {
+                    if (el.comps[j] == d)
+                        sum += el.M(i, j);
+                }
+                node_mass[el.nodes[i]] += sum / 3;
+            }
+        }
+    }
+    m_mass = 0;
+    m_inertia = ChVector<>(0, 0, 0);
+    for (unsigned int in = 0; in < num_nodes; in++) {
+        const ChVector<>& p = m_positions[in];
+        m_mass += node_mass[in];
+        m_inertia.x() += node_mass[in] * (p.y() * p.y() + p.z() * p.z());
+        m_inertia.y() += node_mass[in] * (p.x() * p.x() + p.z() * p.z());
+        m_inertia.z() += node_mass[in] * (p.x() * p.x() + p.y() * p.y());
+    }
+
+    // Assemble and factorize the global stiffness matrix (free DOFs only).
+    ChLinkedListMatrix K(n, n);
+    for (const auto& el : elements) {
+        int nd = (int)el.dofs.size();
+        for (int i = 0; i < nd; i++) {
+            if (el.dofs[i] < 0)
+                continue;
+            for (int j = 0; j < nd; j++) {
+                if (el.dofs[j] >= 0 && el.K(i, j) != 0)
+                    K.SetElement(el.dofs[i], el.dofs[j], el.K(i, j), false);
+            }
+        }
+    }
+    if (K.Setup_LU() != 0) {
+        if (verbose)
+            std::cout << "ChModalTireBasis: singular stiffness matrix" << std::endl;
+        return false;
+    }
+
+    // Size of iteration subspace.
+    int p = std::min(n, std::max(2 * num_modes, num_modes + 8));
+
+    // Initial subspace (deterministic pseudo-random vectors).
+    std::vector<std::vector<double>> X(p, std::vector<double>(n));
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (int j = 0; j < p; j++)
+        for (int i = 0; i < n; i++)
+            X[j][i] = distribution(generator);
+
+    std::vector<std::vector<double>> Y(p, std::vector<double>(n));
+    std::vector<std::vector<double>> MY(p, std::vector<double>(n));
+    std::vector<double> MX(n);
+    std::vector<double> KY(n);
+    std::vector<double> lambda(p, 0.0);
+    ChMatrixDynamic<> b(n, 1);
+    ChMatrixDynamic<> y(n, 1);
+    ChMatrixDynamic<> Kr(p, p);
+    bool converged = false;
+
+    for (int iter = 0; iter < max_iterations && !converged; iter++) {
+        // Inverse iteration step: K*Y = M*X.
+        for (int j = 0; j < p; j++) {
+            ElementProduct(elements, false, X[j], MX);
+            for (int i = 0; i < n; i++)
+                b(i, 0) = MX[i];
+            K.Solve_LU(b, y);
+            for (int i = 0; i < n; i++)
+                Y[j][i] = y(i, 0);
+        }
+
+        // M-orthonormalize Y (modified Gram-Schmidt).
+        for (int j = 0; j < p; j++) {
+            for (int k = 0; k < j; k++) {
+                double c = Dot(MY[k], Y[j]);
+                for (int i = 0; i < n; i++)
+                    Y[j][i] -= c * Y[k][i];
+            }
+            ElementProduct(elements, false, Y[j], MY[j]);
+            double norm = std::sqrt(std::max(Dot(MY[j], Y[j]), 1e-300));
+            for (int i = 0; i < n; i++) {
+                Y[j][i] /= norm;
+                MY[j][i] /= norm;
+            }
+        }
+
+        // Reduced stiffness matrix.
+        for (int j = 0; j < p; j++) {
+            ElementProduct(elements, true, Y[j], KY);
+            for (int k = 0; k <= j; k++) {
+                double val = Dot(Y[k], KY);
+                Kr(k, j) = val;
+                Kr(j, k) = val;
+            }
+        }
+
+        // Reduced eigenproblem (Kr is symmetric positive definite, so its SVD is an eigendecomposition).
+        // Singular values are returned in decreasing order; reverse to obtain increasing eigenvalues.
+        ChMatrixDynamic<> U;
+        ChMatrixDynamic<> W;
+        ChMatrixDynamic<> V;
+        double cond_num;
+        ChLinearAlgebra::SVD(Kr, U, W, V, cond_num);
+
+        converged = true;
+        for (int j = 0; j < p; j++) {
+            double lambda_new = W(p - 1 - j, p - 1 - j);
+            if (j < num_modes && std::abs(lambda_new - lambda[j]) > tolerance * std::abs(lambda_new))
+                converged = false;
+            lambda[j] = lambda_new;
+        }
+
+        // Ritz vectors: X = Y*Q.
+        for (int j = 0; j < p; j++) {
+            std::fill(X[j].begin(), X[j].end(), 0.0);
+            for (int k = 0; k < p; k++) {
+                double q = U(k, p - 1 - j);
+                for (int i = 0; i < n; i++)
+                    X[j][i] += q * Y[k][i];
+            }
+        }
+
+        if (verbose) {
+            std::cout << "ChModalTireBasis: iteration " << iter << "  lowest frequency [Hz] "
+                      << std::sqrt(lambda[0]) / CH_C_2PI << "  highest retained [Hz] "
+                      << std::sqrt(lambda[num_modes - 1]) / CH_C_2PI << std::endl;
+        }
+    }
+
+    if (!converged)
+        return false;
+
+    // Store frequencies and translational mode shape components (expressed in the wheel frame).
+    m_omega.resize(num_modes);
+    m_shapes.assign(num_modes * num_nodes, ChVector<>(0, 0, 0));
+    for (int j = 0; j < num_modes; j++) {
+        m_omega[j] = std::sqrt(std::max(lambda[j], 0.0));
+        for (unsigned int in = 0; in < num_nodes; in++) {
+            if (offsets[in] < 0)
+                continue;
+            const double* u = &X[j][offsets[in]];
+            m_shapes[j * num_nodes + in] = wheel_frame.TransformDirectionParentToLocal(ChVector<>(u[0], u[1], u[2]));
+        }
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// File format (ASCII):
+//   num_nodes num_modes
+//   mass inertia_x inertia_y inertia_z radius width
+//   num_modes lines with modal frequencies
+//   num_nodes lines with node positions
+//   num_modes * num_nodes lines with mode shape components
+// -----------------------------------------------------------------------------
+bool ChModalTireBasis::Write(const std::string& filename) const {
+    std::ofstream ofile(filename);
+    if (!ofile.is_open())
+        return false;
+
+    ofile.precision(17);
+    ofile << m_positions.size() << " " << m_omega.size() << "\n";
+    ofile << m_mass << " " << m_inertia.x() << " " << m_inertia.y() << " " << m_inertia.z() << " " << m_radius << " "
+          << m_width << "\n";
+    for (auto omega : m_omega)
+        ofile << omega << "\n";
+    for (const auto& p : m_positions)
+        ofile << p.x() << " " << p.y() << " " << p.z() << "\n";
+    for (const auto& s : m_shapes)
+        ofile << s.x() << " " << s.y() << " " << s.z() << "\n";
+
+    return ofile.good();
+}
+
+bool ChModalTireBasis::Read(const std::string& filename) {
+    std::ifstream ifile(filename);
+    if (!ifile.is_open())
+        return false;
+
+    size_t num_nodes;
+    size_t num_modes;
+    ifile >> num_nodes >> num_modes;
+    ifile >> m_mass >> m_inertia.x() >> m_inertia.y() >> m_inertia.z() >> m_radius >> m_width;
+
+    m_omega.resize(num_modes);
+    m_positions.resize(num_nodes);
+    m_shapes.resize(num_modes * num_nodes);
+    for (auto& omega : m_omega)
+        ifile >> omega;
+    for (auto& p : m_positions)
+        ifile >> p.x() >> p.y() >> p.z();
+    for (auto& s : m_shapes)
+        ifile >> s.x() >> s.y() >> s.z();
+
+    return !ifile.fail();
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,108 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Modal basis for a reduced-order flexible tire model.
+// The basis is extracted (offline) from the FEA mesh of a deformable tire and
+// consists of the lowest eigenmodes of the tire clamped at the rim.
+//
+// =============================================================================
+
+#ifndef CH_MODAL_TIRE_BASIS_H
+#define CH_MODAL_TIRE_BASIS_H
+
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChVector.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChDeformableTire.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled_tire
+/// @{
+
+/// Modal basis for a reduced-order flexible tire.
+/// All quantities are expressed in the frame of the wheel body to which the source tire was attached.
+/// Mode shapes are mass-normalized and only their translational components at the mesh nodes are stored.
+class CH_VEHICLE_API ChModalTireBasis {
+  public:
+    ChModalTireBasis();
+
+    /// Compute the modal basis from the FEA mesh of the specified deformable tire.
+    /// The tire must have been initialized (i.e., its mesh created and connected to a wheel body) and its
+    /// elements set up. Nodes connected to the rim are clamped. The basis consists of the lowest 'num_modes'
+    /// eigenmodes of the tangent stiffness and mass matrices at the current mesh configuration, obtained
+    /// through subspace iteration. If tire pressure is enabled, the stiffness includes the load stiffness of the
+    /// pressure loads. The prestress due to inflation is captured only if the mesh is in its inflated
+    /// configuration (e.g., after a static solve with the wheel fixed). Return false if the stiffness matrix is
+    /// singular or the iteration does not converge.
+    bool Compute(ChDeformableTire& tire,    ///< [in] source deformable tire
+                 int num_modes,             ///< [in] number of modes in the basis
+                 int max_iterations = 100,  ///< [in] maximum number of subspace iterations
+                 double tolerance = 1e-6,   ///< [in] relative tolerance on eigenvalues
+                 bool verbose = false       ///< [in] print iteration progress
+                 );
+
+    /// Write the basis to the specified file.
+    bool Write(const std::string& filename) const;
+
+    /// Read the basis from the specified file (as produced by Write).
+    bool Read(const std::string& filename);
+
+    /// Get the number of nodes.
+    int GetNumNodes() const { return (int)m_positions.size(); }
+
+    /// Get the number of modes.
+    int GetNumModes() const { return (int)m_omega.size(); }
+
+    /// Get the reference position of the specified node.
+    const ChVector<>& GetNodePosition(int node) const { return m_positions[node]; }
+
+    /// Get the translational component of the specified mode at the specified node.
+    const ChVector<>& GetModeShape(int mode, int node) const { return m_shapes[mode * m_positions.size() + node]; }
+
+    /// Get the natural circular frequency of the specified mode [rad/s].
+    double GetFrequency(int mode) const { return m_omega[mode]; }
+
+    /// Get the mass of the source tire.
+    double GetMass() const { return m_mass; }
+
+    /// Get the moments of inertia of the source tire (relative to the wheel center).
+    const ChVector<>& GetInertia() const { return m_inertia; }
+
+    /// Get the maximum radial distance of the reference nodes.
+    double GetRadius() const { return m_radius; }
+
+    /// Get the extent of the reference nodes along the wheel axis.
+    double GetWidth() const { return m_width; }
+
+  private:
+    std::vector<ChVector<>> m_positions;  ///< node reference positions
+    std::vector<ChVector<>> m_shapes;     ///< translational mode shape components (mode-major)
+    std::vector<double> m_omega;          ///< natural circular frequencies
+    double m_mass;                        ///< tire mass
+    ChVector<> m_inertia;                 ///< tire moments of inertia
+    double m_radius;                      ///< tire radius
+    double m_width;                       ///< tire width
+};
+
+/// @} vehicle_wheeled_tire
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
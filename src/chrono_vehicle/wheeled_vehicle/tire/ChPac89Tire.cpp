@@ -41,7 +41,17 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 ChPac89Tire::ChPac89Tire(const std::string& name)
-    : ChTire(name), m_kappa(0), m_alpha(0), m_gamma(0), m_gamma_limit(3), m_stepsize(1e-6) {
+    : ChTire(name),
+      m_kappa(0),
+      m_alpha(0),
+      m_gamma(0),
+      m_gamma_limit(3),
+      m_stepsize(1e-6),
+      m_coeff_valid(false),
+      m_coeff_Fz(0),
+      m_coeff_gamma(0),
+      m_Fz_bin(0),
+      m_gamma_bin(0) {
     m_tireforce.force = ChVector<>(0, 0, 0);
     m_tireforce.point = ChVector<>(0, 0, 0);
     m_tireforce.moment = ChVector<>(0, 0, 0);
@@ -53,6 +63,7 @@ void ChPac89Tire::Initialize(std::shared_ptr<ChBody> wheel, VehicleSide side) {
     ChTire::Initialize(wheel, side);
 
     SetPac89Params();
+    m_coeff_valid = false;
 
     // Initialize contact patch state variables to 0;
     m_states.cp_long_slip = 0;
@@ -150,6 +161,14 @@ void ChPac89Tire::Synchronize(double time, const WheelState& wheel_state, const
     }
 }
 
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+void ChPac89Tire::SetCoefficientBins(double Fz_bin, double gamma_bin) {
+    m_Fz_bin = Fz_bin;
+    m_gamma_bin = gamma_bin;
+    m_coeff_valid = false;
+}
+
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 void ChPac89Tire::Advance(double step) {
@@ -157,6 +176,75 @@ void ChPac89Tire::Advance(double step) {
     if (!m_data.in_contact)
         return;
 
+    double gamma = CalculateSlips();
+    UpdateCoefficients(m_data.normal_force / 1000, gamma);
+
+    double B[3], C[3], D[3], E[3], Sv[3], X[3], Y[3];
+    LoadMagicFormulaInputs(B, C, D, E, Sv, X);
+    EvaluateMagicFormula(3, B, C, D, E, Sv, X, Y);
+
+    CalculateForces(Y[0], Y[1], Y[2]);
+}
+
+void ChPac89Tire::AdvanceBatch(const std::vector<ChPac89Tire*>& tires, BatchWorkspace& work) {
+    size_t n = 3 * tires.size();
+    if (work.X.size() < n) {
+        work.B.resize(n);
+        work.C.resize(n);
+        work.D.resize(n);
+        work.E.resize(n);
+        work.Sv.resize(n);
+        work.X.resize(n);
+        work.Y.resize(n);
+    }
+
+    // Gather the Magic Formula inputs from all tires in contact.
+    size_t k = 0;
+    for (auto tire : tires) {
+        if (!tire->m_data.in_contact)
+            continue;
+        double gamma = tire->CalculateSlips();
+        tire->UpdateCoefficients(tire->m_data.normal_force / 1000, gamma);
+        tire->LoadMagicFormulaInputs(&work.B[k], &work.C[k], &work.D[k], &work.E[k], &work.Sv[k], &work.X[k]);
+        k += 3;
+    }
+
+    EvaluateMagicFormula(k, work.B.data(), work.C.data(), work.D.data(), work.E.data(), work.Sv.data(),
+                         work.X.data(), work.Y.data());
+
+    // Scatter the results back to the tires.
+    k = 0;
+    for (auto tire : tires) {
+        if (!tire->m_data.in_contact)
+            continue;
+        tire->CalculateForces(work.Y[k], work.Y[k + 1], work.Y[k + 2]);
+        k += 3;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Magic Formula kernel.
+// The loop body is branch-free and operates on contiguous arrays, so that it
+// can be vectorized when vector math routines are available (e.g., glibc
+// libmvec with -O3 -ffast-math).
+// -----------------------------------------------------------------------------
+void ChPac89Tire::EvaluateMagicFormula(size_t n,
+                                       const double* B,
+                                       const double* C,
+                                       const double* D,
+                                       const double* E,
+                                       const double* Sv,
+                                       const double* X,
+                                       double* Y) {
+    for (size_t i = 0; i < n; i++) {
+        double BX = B[i] * X[i];
+        Y[i] = D[i] * std::sin(C[i] * std::atan(BX - E[i] * (BX - std::atan(BX)))) + Sv[i];
+    }
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+double ChPac89Tire::CalculateSlips() {
     if (m_states.vx != 0) {
         m_states.cp_long_slip = -m_states.vsx / m_states.vx;
         m_states.cp_side_slip = std::atan(m_states.vsy / std::abs(m_states.omega * (m_unloaded_radius - m_data.depth)));
@@ -171,17 +259,6 @@ void ChPac89Tire::Advance(double step) {
     // Ensure that cp_side_slip stays between -pi()/2 & pi()/2 (a little less to prevent tan from going to infinity)
     ChClampValue(m_states.cp_side_slip, -CH_C_PI_2 + 0.001, CH_C_PI_2 - 0.001);
 
-    // Calculate the new force and moment values (normal force and moment have already been accounted for in
-    // Synchronize()).
-    // Express Fz in kN (note that all other forces and moments are in N and Nm).
-    // See reference for details on the calculations.
-    double Fx = 0;
-    double Fy = 0;
-    double Fz = m_data.normal_force / 1000;
-    double Mx = 0;
-    double My = 0;
-    double Mz = 0;
-
     // Express alpha and gamma in degrees. Express kappa as percentage.
     // Flip sign of alpha to convert to PAC89 modified SAE coordinates.
     m_gamma = 90.0 - std::acos(m_states.disc_normal.z()) * CH_C_RAD_TO_DEG;
@@ -189,60 +266,98 @@ void ChPac89Tire::Advance(double step) {
     m_kappa = m_states.cp_long_slip * 100.0;
 
     // Clamp |gamma| to specified value: Limit due to tire testing, avoids erratic extrapolation.
-    double gamma = ChClamp(m_gamma, -m_gamma_limit, m_gamma_limit);
+    return ChClamp(m_gamma, -m_gamma_limit, m_gamma_limit);
+}
+
+// -----------------------------------------------------------------------------
+// Calculate the Magic Formula coefficients for the longitudinal force, lateral
+// force, and self-aligning torque. These depend only on the normal load Fz (kN)
+// and the camber angle gamma (degrees), so they are cached and recomputed only
+// when the (binned) load or camber changes.
+// See reference for details on the calculations.
+// -----------------------------------------------------------------------------
+void ChPac89Tire::UpdateCoefficients(double Fz, double gamma) {
+    if (m_Fz_bin > 0)
+        Fz = m_Fz_bin * std::round(Fz / m_Fz_bin);
+    if (m_gamma_bin > 0)
+        gamma = m_gamma_bin * std::round(gamma / m_gamma_bin);
+
+    if (m_coeff_valid && Fz == m_coeff_Fz && gamma == m_coeff_gamma)
+        return;
+
+    m_coeff_valid = true;
+    m_coeff_Fz = Fz;
+    m_coeff_gamma = gamma;
+
+    double Fz2 = Fz * Fz;
+    double abs_gamma = std::abs(gamma);
 
     // Longitudinal Force
     {
-        double C = m_PacCoeff.B0;
-        double D = (m_PacCoeff.B1 * std::pow(Fz, 2) + m_PacCoeff.B2 * Fz);
-        double BCD = (m_PacCoeff.B3 * std::pow(Fz, 2) + m_PacCoeff.B4 * Fz) * std::exp(-m_PacCoeff.B5 * Fz);
-        double B = BCD / (C * D);
-        double Sh = m_PacCoeff.B9 * Fz + m_PacCoeff.B10;
-        double Sv = 0.0;
-        double X1 = (m_kappa + Sh);
-        double E = (m_PacCoeff.B6 * std::pow(Fz, 2) + m_PacCoeff.B7 * Fz + m_PacCoeff.B8);
-
-        Fx = (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
+        MagicFormulaCoeff& c = m_coeff[0];
+        c.C = m_PacCoeff.B0;
+        c.D = m_PacCoeff.B1 * Fz2 + m_PacCoeff.B2 * Fz;
+        double BCD = (m_PacCoeff.B3 * Fz2 + m_PacCoeff.B4 * Fz) * std::exp(-m_PacCoeff.B5 * Fz);
+        c.B = BCD / (c.C * c.D);
+        c.Sh = m_PacCoeff.B9 * Fz + m_PacCoeff.B10;
+        c.Sv = 0.0;
+        c.E = m_PacCoeff.B6 * Fz2 + m_PacCoeff.B7 * Fz + m_PacCoeff.B8;
     }
 
     // Lateral Force
     {
-        double C = m_PacCoeff.A0;
-        double D = (m_PacCoeff.A1 * std::pow(Fz, 2) + m_PacCoeff.A2 * Fz);
-        double BCD =
-            m_PacCoeff.A3 * std::sin(std::atan(Fz / m_PacCoeff.A4) * 2.0) * (1.0 - m_PacCoeff.A5 * std::abs(gamma));
-        double B = BCD / (C * D);
-        double Sh = m_PacCoeff.A9 * Fz + m_PacCoeff.A10 + m_PacCoeff.A8 * gamma;
-        double Sv = m_PacCoeff.A11 * Fz * gamma + m_PacCoeff.A12 * Fz + m_PacCoeff.A13;
-        double X1 = m_alpha + Sh;
-        double E = m_PacCoeff.A6 * Fz + m_PacCoeff.A7;
-
-        // Ensure that X1 stays within +/-90 deg minus a little bit
-        ChClampValue(X1, -89.5, 89.5);
-
-        Fy = (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
+        MagicFormulaCoeff& c = m_coeff[1];
+        c.C = m_PacCoeff.A0;
+        c.D = m_PacCoeff.A1 * Fz2 + m_PacCoeff.A2 * Fz;
+        double BCD = m_PacCoeff.A3 * std::sin(std::atan(Fz / m_PacCoeff.A4) * 2.0) * (1.0 - m_PacCoeff.A5 * abs_gamma);
+        c.B = BCD / (c.C * c.D);
+        c.Sh = m_PacCoeff.A9 * Fz + m_PacCoeff.A10 + m_PacCoeff.A8 * gamma;
+        c.Sv = m_PacCoeff.A11 * Fz * gamma + m_PacCoeff.A12 * Fz + m_PacCoeff.A13;
+        c.E = m_PacCoeff.A6 * Fz + m_PacCoeff.A7;
     }
 
     // Self-Aligning Torque
     {
-        double C = m_PacCoeff.C0;
-        double D = (m_PacCoeff.C1 * std::pow(Fz, 2) + m_PacCoeff.C2 * Fz);
-        double BCD = (m_PacCoeff.C3 * std::pow(Fz, 2) + m_PacCoeff.C4 * Fz) * (1 - m_PacCoeff.C6 * std::abs(gamma)) *
+        MagicFormulaCoeff& c = m_coeff[2];
+        c.C = m_PacCoeff.C0;
+        c.D = m_PacCoeff.C1 * Fz2 + m_PacCoeff.C2 * Fz;
+        double BCD = (m_PacCoeff.C3 * Fz2 + m_PacCoeff.C4 * Fz) * (1 - m_PacCoeff.C6 * abs_gamma) *
                      std::exp(-m_PacCoeff.C5 * Fz);
-        double B = BCD / (C * D);
-        double Sh = m_PacCoeff.C11 * gamma + m_PacCoeff.C12 * Fz + m_PacCoeff.C13;
-        double Sv =
-            (m_PacCoeff.C14 * std::pow(Fz, 2) + m_PacCoeff.C15 * Fz) * gamma + m_PacCoeff.C16 * Fz + m_PacCoeff.C17;
-        double X1 = m_alpha + Sh;
-        double E = (m_PacCoeff.C7 * std::pow(Fz, 2) + m_PacCoeff.C8 * Fz + m_PacCoeff.C9) *
-                   (1.0 - m_PacCoeff.C10 * std::abs(gamma));
-
-        // Ensure that X1 stays within +/-90 deg minus a little bit
-        ChClampValue(X1, -89.5, 89.5);
-
-        Mz = (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
+        c.B = BCD / (c.C * c.D);
+        c.Sh = m_PacCoeff.C11 * gamma + m_PacCoeff.C12 * Fz + m_PacCoeff.C13;
+        c.Sv = (m_PacCoeff.C14 * Fz2 + m_PacCoeff.C15 * Fz) * gamma + m_PacCoeff.C16 * Fz + m_PacCoeff.C17;
+        c.E = (m_PacCoeff.C7 * Fz2 + m_PacCoeff.C8 * Fz + m_PacCoeff.C9) * (1.0 - m_PacCoeff.C10 * abs_gamma);
+    }
+}
+
+void ChPac89Tire::LoadMagicFormulaInputs(double* B, double* C, double* D, double* E, double* Sv, double* X) const {
+    for (int i = 0; i < 3; i++) {
+        B[i] = m_coeff[i].B;
+        C[i] = m_coeff[i].C;
+        D[i] = m_coeff[i].D;
+        E[i] = m_coeff[i].E;
+        Sv[i] = m_coeff[i].Sv;
     }
 
+    X[0] = m_kappa + m_coeff[0].Sh;
+    X[1] = m_alpha + m_coeff[1].Sh;
+    X[2] = m_alpha + m_coeff[2].Sh;
+
+    // Ensure that X stays within +/-90 deg minus a little bit (lateral force and aligning torque)
+    ChClampValue(X[1], -89.5, 89.5);
+    ChClampValue(X[2], -89.5, 89.5);
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+void ChPac89Tire::CalculateForces(double Fx, double Fy, double Mz) {
+    // Calculate the new force and moment values (normal force and moment have already been accounted for in
+    // Synchronize()).
+    // Express Fz in kN (note that all other forces and moments are in N and Nm).
+    double Fz = m_data.normal_force / 1000;
+    double Mx = 0;
+    double My = 0;
+
     // Overturning Moment
     {
         double deflection = Fy / m_lateral_stiffness;
@@ -257,19 +372,6 @@ void ChPac89Tire::Advance(double step) {
         My = m_rolling_resistance * m_data.normal_force * Lrad * ChSignum(m_states.omega);
     }
 
-    // std::cout << "Fx:" << Fx
-    //    << " Fy:" << Fy
-    //    << " Fz:" << Fz
-    //    << " Mx:" << Mx
-    //    << " My:" << My
-    //    << " Mz:" << Mz
-    //    << std::endl
-    //    << " G:" << gamma
-    //    << " A:" << alpha
-    //    << " K:" << kappa
-    //    << " O:" << m_states.omega
-    //    << std::endl;
-
     // Compile the force and moment vectors so that they can be
     // transformed into the global coordinate system.
     // Convert from SAE to ISO Coordinates at the contact patch.
@@ -79,6 +79,60 @@ class CH_VEHICLE_API ChPac89Tire : public ChTire {
     /// Advance the state of this tire by the specified time step.
     virtual void Advance(double step) override;
 
+    /// Coefficients of one Magic Formula channel: y = D*sin(C*atan(B*x - E*(B*x - atan(B*x)))) + Sv, x = X + Sh.
+    struct MagicFormulaCoeff {
+        double B;
+        double C;
+        double D;
+        double E;
+        double Sh;
+        double Sv;
+    };
+
+    /// Scratch storage for batched Magic Formula evaluation (structure of arrays, one entry per channel).
+    struct BatchWorkspace {
+        std::vector<double> B;
+        std::vector<double> C;
+        std::vector<double> D;
+        std::vector<double> E;
+        std::vector<double> Sv;
+        std::vector<double> X;
+        std::vector<double> Y;
+    };
+
+    /// Advance the specified tires.
+    /// Equivalent to calling Advance() on each tire (the PAC89 model is steady-state, so no time step is needed),
+    /// but the Magic Formula for all tires in contact is evaluated in a single loop over contiguous arrays, which
+    /// the compiler can vectorize. The workspace is resized as needed and can be reused across calls to avoid
+    /// allocations.
+    static void AdvanceBatch(const std::vector<ChPac89Tire*>& tires,  ///< [in] tires to advance
+                             BatchWorkspace& work                     ///< [in,out] scratch storage
+                             );
+
+    /// Evaluate the Magic Formula for n inputs: Y[i] = D[i]*sin(C[i]*atan(B[i]*X[i] - E[i]*(B[i]*X[i] -
+    /// atan(B[i]*X[i])))) + Sv[i]. The inputs X must already include the horizontal shift Sh.
+    static void EvaluateMagicFormula(size_t n,
+                                     const double* B,
+                                     const double* C,
+                                     const double* D,
+                                     const double* E,
+                                     const double* Sv,
+                                     const double* X,
+                                     double* Y);
+
+    /// Set the bin sizes used for caching the Magic Formula coefficients.
+    /// The coefficients depend only on the normal load and the camber angle, and are recomputed only when one of
+    /// these changes. By default (zero bin sizes), any change triggers a recomputation and the results are exact.
+    /// With nonzero bin sizes, the load and camber are rounded to the center of their bin, so that the cache hits
+    /// as long as they stay within the same bin; the forces then become piecewise constant in load and camber
+    /// (e.g., with bins of 0.01 kN and 0.01 deg, the peak forces are off by at most about 0.1% at a 5 kN load).
+    void SetCoefficientBins(double Fz_bin,    ///< [in] normal load bin size (kN)
+                            double gamma_bin  ///< [in] camber angle bin size (degrees)
+                            );
+
+    /// Get the current Magic Formula coefficients (0: longitudinal force, 1: lateral force, 2: aligning moment).
+    const MagicFormulaCoeff& GetMagicFormulaCoeff(int channel) const { return m_coeff[channel]; }
+
     /// Set the value of the integration step size for the underlying dynamics.
     void SetStepsize(double val) { m_stepsize = val; }
 
@@ -186,8 +240,27 @@ class CH_VEHICLE_API ChPac89Tire : public ChTire {
     PacCoeff m_PacCoeff;
 
   private:
+    /// Calculate the slip quantities and the (clamped) camber angle from the current contact state.
+    double CalculateSlips();
+
+    /// Update the cached Magic Formula coefficients for the given normal load (kN) and camber angle (degrees).
+    void UpdateCoefficients(double Fz, double gamma);
+
+    /// Load the inputs of the three Magic Formula channels (3 consecutive entries in each array).
+    void LoadMagicFormulaInputs(double* B, double* C, double* D, double* E, double* Sv, double* X) const;
+
+    /// Complete the tire force and moment calculation, given the Magic Formula outputs.
+    void CalculateForces(double Fx, double Fy, double Mz);
+
     double m_stepsize;
 
+    MagicFormulaCoeff m_coeff[3];  ///< cached Magic Formula coefficients
+    bool m_coeff_valid;            ///< true if the cached coefficients are up to date
+    double m_coeff_Fz;             ///< normal load (kN) for the cached coefficients
+    double m_coeff_gamma;          ///< camber angle (degrees) for the cached coefficients
+    double m_Fz_bin;               ///< normal load bin size for coefficient caching
+    double m_gamma_bin;            ///< camber angle bin size for coefficient caching
+
     struct ContactData {
         bool in_contact;      // true if disc in contact with terrain
         ChCoordsys<> frame;   // contact frame (x: long, y: lat, z: normal)
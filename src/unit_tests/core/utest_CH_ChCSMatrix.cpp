@@ -13,7 +13,11 @@
 // =============================================================================
 
 #include "chrono/core/ChCSMatrix.h"
+#include "chrono/core/ChLinkedListMatrix.h"
 #include "chrono/core/ChMatrixDynamic.h"
+#include "chrono/solver/ChKblockGeneric.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChVariablesGeneric.h"
 
 using namespace chrono;
 
@@ -250,14 +254,68 @@ bool test_sparsity_lock()
 }
 
 
+bool test_scatter_map()
+{
+	// Three variables (2 dofs each), chained by two stiffness blocks sharing the middle variable.
+	ChVariablesGeneric varA(2), varB(2), varC(2);
+	varA.GetMass().FillDiag(1.0);
+	varB.GetMass().FillDiag(1.0);
+	varC.GetMass().FillDiag(1.0);
+
+	ChKblockGeneric blockAB(&varA, &varB);
+	ChKblockGeneric blockBC(&varB, &varC);
+
+	ChSystemDescriptor descriptor;
+	descriptor.BeginInsertion();
+	descriptor.InsertVariables(&varA);
+	descriptor.InsertVariables(&varB);
+	descriptor.InsertVariables(&varC);
+	descriptor.InsertKblock(&blockAB);
+	descriptor.InsertKblock(&blockBC);
+	descriptor.EndInsertion();
+
+	ChCSMatrix mat(6, 6, true);
+	mat.SetSparsityPatternLock(true);
+	ChLinkedListMatrix mat_ref;
+
+	for (int step = 0; step < 3; step++) {
+		for (int i = 0; i < 4; i++)
+			for (int j = 0; j < 4; j++) {
+				(*blockAB.Get_K())(i, j) = step + 1.0 + i + 0.1 * j;
+				(*blockBC.Get_K())(i, j) = step - 2.0 * i + 0.01 * j;
+			}
+
+		// first assembly populates the pattern; later ones scatter through the maps
+		descriptor.ConvertToMatrixForm(&mat, nullptr);
+		mat.Compress();
+		descriptor.ConvertToMatrixForm(&mat_ref, nullptr);
+
+		if (CompareMatrix(mat, mat_ref))
+			return true;
+
+		bool mapped = blockAB.IsScatterMapValid(mat) && blockBC.IsScatterMapValid(mat);
+		if (step > 0 && !mapped)
+			return true;
+	}
+
+	// a change in the sparsity pattern must invalidate the maps
+	mat.SetElement(0, 5, 1.0);
+	if (blockAB.IsScatterMapValid(mat))
+		return true;
+
+	return false;
+}
+
 
 int main() {
 
 	bool test_sparsity_lock_errors = test_sparsity_lock();
 	bool test_Compress_errors = test_Compress();
 	bool testColumnMajor_errors = testColumnMajor();
+	bool test_scatter_map_errors = test_scatter_map();
 
-    bool general_error = test_sparsity_lock_errors || test_Compress_errors || testColumnMajor_errors;
+    bool general_error =
+        test_sparsity_lock_errors || test_Compress_errors || testColumnMajor_errors || test_scatter_map_errors;
 
     std::cout << (general_error ? "error on CSR matrix" : "test passed" )<< std::endl;
 
@@ -0,0 +1,121 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the consistency of the ANCF shell internal forces and Jacobian.
+// A single element with one, two, and three orthotropic layers is deformed, and
+// the stiffness matrix is compared against central finite differences of the
+// internal forces. A wrong quadrature scaling of the internal forces in one of
+// the layers shows up as a mismatch of the order of the force itself.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_fea/ChElementShellANCF.h"
+#include "chrono_fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+const double tolerance = 1e-2;  // relative error between analytical and finite difference stiffness
+
+// Relative error of the stiffness matrix of a deformed element with the given number of layers.
+double CheckJacobian(int num_layers) {
+    ChSystemNSC system;
+    auto mesh = std::make_shared<ChMesh>();
+
+    double len = 0.5;
+    ChVector<> dir(0, 0, 1);
+    std::shared_ptr<ChNodeFEAxyzD> nodes[4];
+    nodes[0] = std::make_shared<ChNodeFEAxyzD>(ChVector<>(0, 0, 0), dir);
+    nodes[1] = std::make_shared<ChNodeFEAxyzD>(ChVector<>(len, 0, 0), dir);
+    nodes[2] = std::make_shared<ChNodeFEAxyzD>(ChVector<>(len, len, 0), dir);
+    nodes[3] = std::make_shared<ChNodeFEAxyzD>(ChVector<>(0, len, 0), dir);
+    for (int i = 0; i < 4; i++)
+        mesh->AddNode(nodes[i]);
+
+    auto mat = std::make_shared<ChMaterialShellANCF>(500, ChVector<>(2e8, 1e8, 1e8), ChVector<>(0.3, 0.3, 0.3),
+                                                     ChVector<>(3.84615e7, 3.84615e7, 3.84615e7));
+
+    auto element = std::make_shared<ChElementShellANCF>();
+    element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3]);
+    element->SetDimensions(len, len);
+    for (int kl = 0; kl < num_layers; kl++)
+        element->AddLayer(0.01 / num_layers, (20 - 40 * (kl % 2)) * CH_C_DEG_TO_RAD, mat);
+    element->SetAlphaDamp(0);
+    element->SetGravityOn(false);
+    mesh->AddElement(element);
+
+    system.Add(mesh);
+    system.SetupInitial();
+
+    // Deform the element (stretch, bend, and twist).
+    nodes[1]->SetPos(ChVector<>(len + 2e-3, 1e-3, 2e-3));
+    nodes[2]->SetPos(ChVector<>(len - 1e-3, len + 1e-3, 5e-3));
+    nodes[3]->SetPos(ChVector<>(1e-3, len, -1e-3));
+    nodes[1]->SetD(ChVector<>(-0.01, 0.005, 1).GetNormalized());
+    nodes[2]->SetD(ChVector<>(-0.02, -0.01, 1).GetNormalized());
+    nodes[3]->SetD(ChVector<>(0.005, 0.01, 1).GetNormalized());
+
+    // Analytical stiffness matrix at the deformed configuration.
+    ChMatrixDynamic<> Fi(24, 1);
+    ChMatrixDynamic<> H(24, 24);
+    element->ComputeInternalForces(Fi);
+    element->ComputeKRMmatricesGlobal(H, 1, 0, 0);
+
+    // Central finite differences of the internal forces (Fi = -Fint, hence dFi/dq = -K).
+    double delta = 1e-7;
+    double err = 0;
+    double norm = 0;
+    ChMatrixDynamic<> Fp(24, 1);
+    ChMatrixDynamic<> Fm(24, 1);
+    for (int j = 0; j < 24; j++) {
+        auto node = nodes[j / 6];
+        bool pos = (j % 6) < 3;
+        int k = j % 3;
+        ChVector<> q0 = pos ? node->GetPos() : node->GetD();
+
+        ChVector<> q = q0;
+        q[k] += delta;
+        pos ? node->SetPos(q) : node->SetD(q);
+        element->ComputeInternalForces(Fp);
+        q[k] -= 2 * delta;
+        pos ? node->SetPos(q) : node->SetD(q);
+        element->ComputeInternalForces(Fm);
+        pos ? node->SetPos(q0) : node->SetD(q0);
+
+        for (int i = 0; i < 24; i++) {
+            double fd = -(Fp(i) - Fm(i)) / (2 * delta);
+            err += (fd - H(i, j)) * (fd - H(i, j));
+            norm += H(i, j) * H(i, j);
+        }
+    }
+
+    double rel_err = std::sqrt(err / norm);
+    GetLog() << "Layers: " << num_layers << "  relative stiffness error: " << rel_err << "\n";
+    return rel_err;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    for (int num_layers = 1; num_layers <= 3; num_layers++)
+        passed &= CheckJacobian(num_layers) < tolerance;
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if the test passed.
+    return !passed;
+}
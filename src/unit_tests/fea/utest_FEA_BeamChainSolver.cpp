@@ -0,0 +1,189 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the block-tridiagonal chain solver.
+// A set of Euler beams (clamped at one end) and ANCF cables (hinged to ground,
+// two of them also joined at their free ends) fall under gravity. The results
+// obtained with ChSolverBlockTridiagonal must match those obtained with a dense
+// direct solution of the KKT system.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/core/ChCSMatrix.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChSolverBlockTridiagonal.h"
+#include "chrono/timestepper/ChTimestepper.h"
+
+#include "chrono_fea/ChBuilderBeam.h"
+#include "chrono_fea/ChLinkPointFrame.h"
+#include "chrono_fea/ChLinkPointPoint.h"
+#include "chrono_fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// ====================================================================================
+
+double rtol = 1e-8;  // validation relative error
+
+// Reference solver: dense LU factorization (partial pivoting) of the KKT matrix.
+class ChSolverDenseKKT : public ChSolver {
+  public:
+    virtual bool SolveRequiresMatrix() const override { return true; }
+
+    virtual double Solve(ChSystemDescriptor& sysd) override {
+        ChCSMatrix Zs(1, 1);
+        ChMatrixDynamic<> x;
+        sysd.ConvertToMatrixForm(&Zs, &x);
+
+        int n = x.GetRows();
+        ChMatrixDynamic<> Z(n, n);
+        for (int i = 0; i < n; i++)
+            for (int j = 0; j < n; j++)
+                Z(i, j) = Zs.GetElement(i, j);
+
+        for (int k = 0; k < n; k++) {
+            int p = k;
+            for (int i = k + 1; i < n; i++)
+                if (std::abs(Z(i, k)) > std::abs(Z(p, k)))
+                    p = i;
+            Z.SwapRows(k, p);
+            x.SwapRows(k, p);
+            for (int i = k + 1; i < n; i++) {
+                double r = Z(i, k) / Z(k, k);
+                for (int j = k; j < n; j++)
+                    Z(i, j) -= r * Z(k, j);
+                x(i) -= r * x(k);
+            }
+        }
+        for (int i = n - 1; i >= 0; i--) {
+            for (int j = i + 1; j < n; j++)
+                x(i) -= Z(i, j) * x(j);
+            x(i) /= Z(i, i);
+        }
+
+        sysd.FromVectorToUnknowns(x);
+        return 0;
+    }
+};
+
+// Create the model: clamped Euler beams and ANCF cables.
+std::shared_ptr<ChMesh> CreateModel(ChSystem& system) {
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.Add(ground);
+
+    auto mesh = std::make_shared<ChMesh>();
+    system.Add(mesh);
+
+    auto section = std::make_shared<ChBeamSectionAdvanced>();
+    section->SetAsRectangularSection(0.012, 0.025);
+    section->SetYoungModulus(0.02e10);
+    section->SetGshearModulus(0.02e10 * 0.3);
+    section->SetBeamRaleyghDamping(0.01);
+
+    for (int i = 0; i < 3; i++) {
+        ChBuilderBeam builder;
+        builder.BuildBeam(mesh, section, 8 + 2 * i, ChVector<>(0, 0, 0.2 * i), ChVector<>(0.5, 0.1 * i, 0.2 * i),
+                          ChVector<>(0, 1, 0));
+        builder.GetLastBeamNodes().front()->SetFixed(true);
+    }
+
+    auto cable_section = std::make_shared<ChBeamSectionCable>();
+    cable_section->SetDiameter(0.015);
+    cable_section->SetYoungModulus(0.01e9);
+    cable_section->SetBeamRaleyghDamping(0.000);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> ends;
+    for (int i = 0; i < 3; i++) {
+        ChBuilderBeamANCF builder;
+        builder.BuildBeam(mesh, cable_section, 10, ChVector<>(0, 1, 0.2 * i), ChVector<>(0.6, 1, 0.2 * i + 0.1));
+        auto hinge = std::make_shared<ChLinkPointFrame>();
+        hinge->Initialize(builder.GetLastBeamNodes().front(), ground);
+        system.Add(hinge);
+        ends.push_back(builder.GetLastBeamNodes().back());
+    }
+
+    // Join the free ends of the last two cables.
+    ends[2]->SetPos(ends[1]->GetPos());
+    auto joint = std::make_shared<ChLinkPointPoint>();
+    joint->Initialize(ends[1], ends[2]);
+    system.Add(joint);
+
+    return mesh;
+}
+
+// ====================================================================================
+
+int main(int argc, char* argv[]) {
+    double step = 1e-3;
+    int num_steps = 50;
+
+    ChSystemSMC system_ref;
+    ChSystemSMC system_chain;
+    auto mesh_ref = CreateModel(system_ref);
+    auto mesh_chain = CreateModel(system_chain);
+
+    system_ref.SetSolver(std::make_shared<ChSolverDenseKKT>());
+    system_ref.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    system_chain.SetSolverType(ChSolver::Type::BLOCK_TRIDIAGONAL);
+    system_chain.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    auto solver = std::static_pointer_cast<ChSolverBlockTridiagonal>(system_chain.GetSolver());
+
+    system_ref.SetupInitial();
+    system_chain.SetupInitial();
+
+    for (int i = 0; i < num_steps; i++) {
+        system_ref.DoStepDynamics(step);
+        system_chain.DoStepDynamics(step);
+    }
+
+    // Compare the node positions (relative to the maximum displacement).
+    double max_displ = 0;
+    double max_err = 0;
+    for (unsigned int i = 0; i < mesh_ref->GetNnodes(); i++) {
+        ChVector<> pos_ref, pos_chain, pos_init;
+        if (auto node = std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh_ref->GetNode(i))) {
+            pos_ref = node->GetPos();
+            pos_init = node->GetX0();
+            pos_chain = std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh_chain->GetNode(i))->GetPos();
+        } else {
+            auto node_rot = std::dynamic_pointer_cast<ChNodeFEAxyzrot>(mesh_ref->GetNode(i));
+            pos_ref = node_rot->GetPos();
+            pos_init = node_rot->GetX0().GetPos();
+            pos_chain = std::dynamic_pointer_cast<ChNodeFEAxyzrot>(mesh_chain->GetNode(i))->GetPos();
+        }
+        max_displ = std::max(max_displ, (pos_ref - pos_init).Length());
+        max_err = std::max(max_err, (pos_ref - pos_chain).Length());
+    }
+
+    GetLog() << "Chains: " << solver->GetNumChains() << "  max length: " << solver->GetMaxChainLength()
+             << "  clusters: " << solver->GetNumClusters() << "  max cluster size: " << solver->GetMaxClusterSize()
+             << "\n";
+    GetLog() << "Max displacement: " << max_displ << "  max difference: " << max_err << "\n";
+
+    // 3 beams and 3 cables; the hinges of the first cable, and the hinges and joint of the last two cables.
+    bool passed = solver->GetNumChains() == 6 && solver->GetNumClusters() == 2 && solver->GetMaxClusterSize() == 9 &&
+                  max_displ > 0 && max_err < rtol * max_displ;
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if the test passed.
+    return !passed;
+}
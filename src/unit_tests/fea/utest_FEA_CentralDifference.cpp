@@ -0,0 +1,182 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the explicit central difference timestepper on an FEA mesh.
+// A tetrahedral cantilever block, released from rest under gravity, is
+// simulated with the explicit integrator (lumped mass, substeps based on the
+// estimated critical time step) and with the implicit Newmark integrator (with
+// a small step). The tip deflections must agree. The explicit integrator must
+// also refuse systems with rigid bodies, for which the lumped mass is not valid.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverMINRES.h"
+
+#include "chrono_fea/ChElementTetra_4.h"
+#include "chrono_fea/ChMesh.h"
+#include "chrono_fea/ChNodeFEAxyz.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// ====================================================================================
+
+int nx = 2;
+int ny = 2;
+int nz = 8;
+double h = 0.1;
+
+double end_time = 0.05;  // total simulation time
+double rtol = 2e-2;      // validation relative error
+
+// Create the cantilever block mesh (along the z axis, clamped at z = 0) and return its tip node.
+std::shared_ptr<ChNodeFEAxyz> CreateBlock(ChSystem& system, std::shared_ptr<ChMesh> mesh) {
+    auto material = std::make_shared<ChContinuumElastic>();
+    material->Set_E(1e7);
+    material->Set_v(0.3);
+    material->Set_density(1000);
+
+    auto grid_index = [](int i, int j, int k) { return (k * (ny + 1) + j) * (nx + 1) + i; };
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes((nx + 1) * (ny + 1) * (nz + 1));
+    for (int k = 0; k <= nz; k++) {
+        for (int j = 0; j <= ny; j++) {
+            for (int i = 0; i <= nx; i++) {
+                auto node = std::make_shared<ChNodeFEAxyz>(ChVector<>(i * h, j * h, k * h));
+                node->SetFixed(k == 0);
+                nodes[grid_index(i, j, k)] = node;
+                mesh->AddNode(node);
+            }
+        }
+    }
+
+    // Split each grid cell into 6 tetrahedrons sharing the cell diagonal.
+    int perms[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+    for (int k = 0; k < nz; k++) {
+        for (int j = 0; j < ny; j++) {
+            for (int i = 0; i < nx; i++) {
+                for (int p = 0; p < 6; p++) {
+                    int c[3] = {i, j, k};
+                    std::shared_ptr<ChNodeFEAxyz> tet[4];
+                    tet[0] = nodes[grid_index(c[0], c[1], c[2])];
+                    for (int s = 0; s < 3; s++) {
+                        c[perms[p][s]]++;
+                        tet[s + 1] = nodes[grid_index(c[0], c[1], c[2])];
+                    }
+                    // Ensure positive orientation.
+                    ChVector<> a = tet[1]->GetPos() - tet[0]->GetPos();
+                    ChVector<> b = tet[2]->GetPos() - tet[0]->GetPos();
+                    ChVector<> d = tet[3]->GetPos() - tet[0]->GetPos();
+                    if (Vdot(Vcross(a, b), d) < 0)
+                        std::swap(tet[1], tet[2]);
+
+                    auto element = std::make_shared<ChElementTetra_4>();
+                    element->SetNodes(tet[0], tet[1], tet[2], tet[3]);
+                    element->SetMaterial(material);
+                    mesh->AddElement(element);
+                }
+            }
+        }
+    }
+
+    system.Add(mesh);
+    system.SetupInitial();
+
+    return nodes[grid_index(nx, ny, nz)];
+}
+
+// Simulate with the explicit central difference integrator; return the tip deflection.
+double SimulateExplicit() {
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    auto mesh = std::make_shared<ChMesh>();
+    auto tip = CreateBlock(system, mesh);
+
+    double dt_crit = mesh->ComputeStableTimestep();
+    GetLog() << "Estimated critical time step: " << dt_crit << "\n";
+    if (!(dt_crit > 0) || std::isinf(dt_crit))
+        return 0;
+
+    system.SetTimestepperType(ChTimestepper::Type::CENTRAL_DIFFERENCE);
+    auto integrator = std::static_pointer_cast<ChTimestepperCentralDifference>(system.GetTimestepper());
+    integrator->SetMaxSubstep(0.9 * dt_crit);
+
+    double step = 1e-3;
+    while (system.GetChTime() < end_time - 1e-10)
+        system.DoStepDynamics(step);
+    GetLog() << "Explicit substeps per step: " << integrator->GetNumSubsteps() << "\n";
+
+    return tip->GetPos().y() - tip->GetX0().y();
+}
+
+// Simulate with the implicit Newmark integrator; return the tip deflection.
+double SimulateImplicit() {
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    auto mesh = std::make_shared<ChMesh>();
+    auto tip = CreateBlock(system, mesh);
+
+    auto solver = std::make_shared<ChSolverMINRES>();
+    solver->SetDiagonalPreconditioning(true);
+    system.SetSolver(solver);
+    system.SetMaxItersSolverSpeed(500);
+    system.SetTolForce(1e-12);
+
+    system.SetTimestepperType(ChTimestepper::Type::NEWMARK);
+    auto integrator = std::static_pointer_cast<ChTimestepperNewmark>(system.GetTimestepper());
+    integrator->SetGammaBeta(0.5, 0.25);
+
+    double step = 2e-4;
+    while (system.GetChTime() < end_time - 1e-10)
+        system.DoStepDynamics(step);
+
+    return tip->GetPos().y() - tip->GetX0().y();
+}
+
+// Check that the explicit integrator throws for a system with an active rigid body.
+bool RejectsRigidBodies() {
+    ChSystemNSC system;
+    auto body = std::make_shared<ChBody>();
+    system.AddBody(body);
+    system.SetTimestepperType(ChTimestepper::Type::CENTRAL_DIFFERENCE);
+
+    try {
+        system.DoStepDynamics(1e-3);
+    } catch (const ChException&) {
+        return true;
+    }
+    GetLog() << "No exception with rigid bodies\n";
+    return false;
+}
+
+// ====================================================================================
+
+int main(int argc, char* argv[]) {
+    double defl_explicit = SimulateExplicit();
+    double defl_implicit = SimulateImplicit();
+
+    GetLog() << "Tip deflection  explicit: " << defl_explicit << "  implicit: " << defl_implicit << "\n";
+
+    bool passed = (defl_implicit < 0) && std::abs(defl_explicit - defl_implicit) < rtol * std::abs(defl_implicit);
+    passed &= RejectsRigidBodies();
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,191 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the single collision model option of ChContactSurfaceMesh.
+// An ANCF shell plate falls on a box. The simulation is run twice: with one
+// collision model per mesh face and with a single (refittable) collision model
+// for the entire contact surface. The number of contacts and the resultant
+// contact force on the box must be the same in both cases.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChSolverMINRES.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_fea/ChContactSurfaceMesh.h"
+#include "chrono_fea/ChElementShellANCF.h"
+#include "chrono_fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// ====================================================================================
+
+double end_time = 0.02;   // total simulation time
+double time_step = 2e-4;  // integration step size
+double rtol = 1e-6;       // validation relative error
+
+int numDiv_x = 4;
+int numDiv_z = 4;
+
+struct StepData {
+    int num_contacts;
+    double force;
+};
+
+// Simulate the falling plate and record contact information at each step.
+std::vector<StepData> SimulatePlate(bool single_model) {
+    ChSystemSMC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto material = std::make_shared<ChMaterialSurfaceSMC>();
+    material->SetYoungModulus(2e5f);
+    material->SetFriction(0.4f);
+    material->SetRestitution(0);
+
+    // Create the ANCF shell element mesh (plate in the x-z plane)
+    auto my_mesh = std::make_shared<ChMesh>();
+    double plate_length = 0.5;
+    double thickness = 0.01;
+    double dx = plate_length / numDiv_x;
+    double dz = plate_length / numDiv_z;
+    int N_x = numDiv_x + 1;
+
+    for (int i = 0; i < (numDiv_x + 1) * (numDiv_z + 1); i++) {
+        double loc_x = (i % N_x) * dx;
+        double loc_z = (i / N_x) * dz;
+        // Slightly tilted plate, so that the contacts change over time. The lowest edge starts just above
+        // the box (the SMC collision envelope is zero), accounting for the contact sphere-swept radius.
+        double loc_y = 0.0055 + 0.02 * loc_x;
+        auto node = std::make_shared<ChNodeFEAxyzD>(ChVector<>(loc_x, loc_y, loc_z), ChVector<>(0, 1, 0));
+        node->SetMass(0);
+        my_mesh->AddNode(node);
+    }
+
+    auto mat = std::make_shared<ChMaterialShellANCF>(500, 2.1e7, 0.3);
+
+    for (int i = 0; i < numDiv_x * numDiv_z; i++) {
+        int node0 = (i / numDiv_x) * N_x + i % numDiv_x;
+        int node1 = (i / numDiv_x) * N_x + i % numDiv_x + N_x;
+        int node2 = (i / numDiv_x) * N_x + i % numDiv_x + 1 + N_x;
+        int node3 = (i / numDiv_x) * N_x + i % numDiv_x + 1;
+
+        auto element = std::make_shared<ChElementShellANCF>();
+        element->SetNodes(std::dynamic_pointer_cast<ChNodeFEAxyzD>(my_mesh->GetNode(node0)),
+                          std::dynamic_pointer_cast<ChNodeFEAxyzD>(my_mesh->GetNode(node1)),
+                          std::dynamic_pointer_cast<ChNodeFEAxyzD>(my_mesh->GetNode(node2)),
+                          std::dynamic_pointer_cast<ChNodeFEAxyzD>(my_mesh->GetNode(node3)));
+        element->SetDimensions(dz, dx);
+        element->AddLayer(thickness, 0.0, mat);
+        element->SetAlphaDamp(0.05);
+        element->SetGravityOn(true);
+        my_mesh->AddElement(element);
+    }
+
+    // Create the mesh contact surface
+    auto contact_surf = std::make_shared<ChContactSurfaceMesh>();
+    contact_surf->SetUseSingleCollisionModel(single_model);
+    my_mesh->AddContactSurface(contact_surf);
+    contact_surf->AddFacesFromBoundary(0.005);
+    contact_surf->SetMaterialSurface(material);
+
+    // The faces in a single collision model cannot collide with each other, so disable self-collision in both
+    // modes (otherwise the single model option is ignored).
+    for (auto face : contact_surf->GetTriangleList()) {
+        face->GetCollisionModel()->SetFamily(2);
+        face->GetCollisionModel()->SetFamilyMaskNoCollisionWithFamily(2);
+    }
+
+    my_mesh->SetAutomaticGravity(false);
+    system.Add(my_mesh);
+
+    system.SetupInitial();
+
+    // Create the ground box (top face at y = 0)
+    auto ground = std::make_shared<ChBody>(ChMaterialSurface::SMC);
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->SetMaterialSurface(material);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), ChVector<>(2, 0.1, 2), ChVector<>(0.25, -0.1, 0.25));
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBody(ground);
+
+    // Solver and integrator settings
+    auto minres_solver = std::make_shared<ChSolverMINRES>();
+    minres_solver->SetDiagonalPreconditioning(true);
+    system.SetSolver(minres_solver);
+    system.SetMaxItersSolverSpeed(100);
+    system.SetTolForce(1e-6);
+
+    system.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(system.GetTimestepper());
+    integrator->SetAlpha(0.0);
+    integrator->SetMaxiters(100);
+    integrator->SetAbsTolerances(1e-08);
+    integrator->SetScaling(false);
+
+    // Simulation loop
+    std::vector<StepData> data;
+    while (system.GetChTime() < end_time) {
+        system.DoStepDynamics(time_step);
+        system.GetContactContainer()->ComputeContactForces();
+        StepData step;
+        step.num_contacts = system.GetContactContainer()->GetNcontacts();
+        step.force = ground->GetContactForce().y();
+        data.push_back(step);
+    }
+
+    return data;
+}
+
+// ====================================================================================
+
+int main(int argc, char* argv[]) {
+    std::vector<StepData> data_faces = SimulatePlate(false);
+    std::vector<StepData> data_single = SimulatePlate(true);
+
+    bool passed = (data_faces.size() == data_single.size());
+    int max_contacts = 0;
+    for (size_t i = 0; passed && i < data_faces.size(); i++) {
+        max_contacts = std::max(max_contacts, data_faces[i].num_contacts);
+        if (data_faces[i].num_contacts != data_single[i].num_contacts) {
+            GetLog() << "Step " << (int)i << ": num contacts " << data_faces[i].num_contacts << " vs "
+                     << data_single[i].num_contacts << "\n";
+            passed = false;
+        }
+        double scale = std::max(std::abs(data_faces[i].force), 1.0);
+        if (std::abs(data_faces[i].force - data_single[i].force) > rtol * scale) {
+            GetLog() << "Step " << (int)i << ": contact force " << data_faces[i].force << " vs "
+                     << data_single[i].force << "\n";
+            passed = false;
+        }
+    }
+
+    // Make sure the test is not vacuous.
+    if (max_contacts == 0) {
+        GetLog() << "No contacts generated\n";
+        passed = false;
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,189 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the reference stiffness store of corotational elements.
+// A ChElementTetra_4 and a ChElementHexa_8 are rotated and deformed. The tangent
+// stiffness and internal forces computed with the compact reference stiffness
+// (in double and in single precision) must match those obtained by explicitly
+// corotating the dense local stiffness matrix.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/core/ChMatrixDynamic.h"
+
+#include "chrono_fea/ChElementHexa_8.h"
+#include "chrono_fea/ChElementTetra_4.h"
+#include "chrono_fea/ChNodeFEAxyz.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// ====================================================================================
+
+double rtol_double = 1e-10;  // validation relative error, double precision store
+double rtol_single = 1e-5;   // validation relative error, single precision store
+
+// Move the nodes to a rotated and slightly deformed configuration.
+void DeformNodes(std::vector<std::shared_ptr<ChNodeFEAxyz>>& nodes) {
+    ChMatrix33<> rot(Q_from_AngAxis(0.7, ChVector<>(1, 2, 3).GetNormalized()));
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ChVector<> X0 = nodes[i]->GetX0();
+        ChVector<> def(0.01 * std::sin(3.0 * i), 0.02 * std::cos(2.0 * i), 0.015 * std::sin(1.0 + i));
+        nodes[i]->SetPos(rot * (X0 + def) + ChVector<>(0.3, -0.2, 0.1));
+    }
+}
+
+// Maximum absolute entry of a matrix.
+double MaxAbs(const ChMatrix<>& M) {
+    double max = 0;
+    for (int i = 0; i < M.GetRows(); i++)
+        for (int j = 0; j < M.GetColumns(); j++)
+            max = std::max(max, std::abs(M(i, j)));
+    return max;
+}
+
+// Compare the element matrices and forces against those obtained with the dense stiffness K.
+template <class Element>
+bool CheckElement(std::shared_ptr<Element> element, const ChMatrix<>& K, int nnodes, double rtol) {
+    int ndofs = 3 * nnodes;
+    element->Update();
+
+    // Reference tangent stiffness: C * K * C'
+    ChMatrixDynamic<> CK(ndofs, ndofs);
+    ChMatrixDynamic<> CKCt(ndofs, ndofs);
+    ChMatrixCorotation<>::ComputeCK(K, element->Rotation(), nnodes, CK);
+    ChMatrixCorotation<>::ComputeKCt(CK, element->Rotation(), nnodes, CKCt);
+
+    // Reference internal forces: -C * K * displ (nodes at rest)
+    ChMatrixDynamic<> displ(ndofs, 1);
+    element->GetStateBlock(displ);
+    ChMatrixDynamic<> Fi_local(ndofs, 1);
+    Fi_local.MatrMultiply(K, displ);
+    Fi_local.MatrScale(-1.0);
+    ChMatrixDynamic<> Fi_ref(ndofs, 1);
+    ChMatrixCorotation<>::ComputeCK(Fi_local, element->Rotation(), nnodes, Fi_ref);
+
+    ChMatrixDynamic<> H(ndofs, ndofs);
+    element->ComputeKRMmatricesGlobal(H, 1.0, 0, 0);
+    ChMatrixDynamic<> Fi(ndofs, 1);
+    element->ComputeInternalForces(Fi);
+
+    double err_K = MaxAbs(H - CKCt) / MaxAbs(CKCt);
+    double err_F = MaxAbs(Fi - Fi_ref) / MaxAbs(Fi_ref);
+
+    double err_sym = 0;
+    for (int i = 0; i < ndofs; i++)
+        for (int j = 0; j < ndofs; j++)
+            err_sym = std::max(err_sym, std::abs(H(i, j) - H(j, i)));
+
+    GetLog() << "   stiffness error: " << err_K << "  force error: " << err_F << "  asymmetry: " << err_sym << "\n";
+
+    return err_K < rtol && err_F < rtol && err_sym == 0;
+}
+
+bool TestTetra(ChReferenceStiffness::Precision precision, double rtol) {
+    auto material = std::make_shared<ChContinuumElastic>();
+    material->Set_E(1e7);
+    material->Set_v(0.3);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    nodes.push_back(std::make_shared<ChNodeFEAxyz>(ChVector<>(0, 0, 0)));
+    nodes.push_back(std::make_shared<ChNodeFEAxyz>(ChVector<>(1, 0, 0.1)));
+    nodes.push_back(std::make_shared<ChNodeFEAxyz>(ChVector<>(0.2, 1.1, 0)));
+    nodes.push_back(std::make_shared<ChNodeFEAxyz>(ChVector<>(0.1, 0.2, 0.9)));
+
+    // Dense reference stiffness, from an element with double precision store.
+    auto element_ref = std::make_shared<ChElementTetra_4>();
+    element_ref->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3]);
+    element_ref->SetMaterial(material);
+    element_ref->SetupInitial(nullptr);
+    ChMatrixDynamic<> K = element_ref->GetStiffnessMatrix();
+
+    auto element = std::make_shared<ChElementTetra_4>();
+    element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3]);
+    element->SetMaterial(material);
+    element->SetStiffnessPrecision(precision);
+    element->SetupInitial(nullptr);
+
+    DeformNodes(nodes);
+    return CheckElement(element, K, 4, rtol);
+}
+
+bool TestHexa(ChReferenceStiffness::Precision precision, double rtol) {
+    auto material = std::make_shared<ChContinuumElastic>();
+    material->Set_E(1e7);
+    material->Set_v(0.3);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    double h[3] = {1.0, 0.6, 0.8};
+    int corners[8][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}};
+    for (int i = 0; i < 8; i++)
+        nodes.push_back(std::make_shared<ChNodeFEAxyz>(
+            ChVector<>(corners[i][0] * h[0], corners[i][1] * h[1], corners[i][2] * h[2])));
+
+    auto element_ref = std::make_shared<ChElementHexa_8>();
+    element_ref->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3], nodes[4], nodes[5], nodes[6], nodes[7]);
+    element_ref->SetMaterial(material);
+    element_ref->SetupInitial(nullptr);
+    ChMatrixDynamic<> K = element_ref->GetStiffnessMatrix();
+
+    auto element = std::make_shared<ChElementHexa_8>();
+    element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3], nodes[4], nodes[5], nodes[6], nodes[7]);
+    element->SetMaterial(material);
+    element->SetStiffnessPrecision(precision);
+    element->SetupInitial(nullptr);
+
+    DeformNodes(nodes);
+    return CheckElement(element, K, 8, rtol);
+}
+
+bool TestPolarDecomposition() {
+    ChMatrix33<> F(1.1, 0.2, -0.3, 0.1, 0.9, 0.25, -0.2, 0.15, 1.2);
+    ChMatrix33<> Q1, Q2, S;
+    double det1 = ChPolarDecomposition<>::Compute(F, Q1, S, 1e-6);
+    double det2 = ChPolarDecomposition<>::ComputeRotation(F, Q2, 1e-6);
+    double err = MaxAbs(Q1 - Q2);
+
+    GetLog() << "   rotation difference: " << err << "\n";
+
+    return std::abs(det1 - det2) < 1e-12 && err < 1e-14;
+}
+
+// ====================================================================================
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    GetLog() << "Polar decomposition\n";
+    passed &= TestPolarDecomposition();
+
+    GetLog() << "Tetra_4, double precision store\n";
+    passed &= TestTetra(ChReferenceStiffness::Precision::DOUBLE, rtol_double);
+    GetLog() << "Tetra_4, single precision store\n";
+    passed &= TestTetra(ChReferenceStiffness::Precision::SINGLE, rtol_single);
+
+    GetLog() << "Hexa_8, double precision store\n";
+    passed &= TestHexa(ChReferenceStiffness::Precision::DOUBLE, rtol_double);
+    GetLog() << "Hexa_8, single precision store\n";
+    passed &= TestHexa(ChReferenceStiffness::Precision::SINGLE, rtol_single);
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
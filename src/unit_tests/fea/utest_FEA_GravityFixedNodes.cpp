@@ -0,0 +1,138 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the automatic gravity load of a mesh with fixed nodes.
+// A tetrahedral block is loaded by the automatic mesh gravity, once with all
+// nodes free and once with some nodes fixed. The fixed nodes carry no state,
+// so their share of the gravity load must be dropped, and the residual of every
+// free node must be the same in both cases. The first element has no fixed
+// nodes, so that a load reused across elements with stale variables also fails.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_fea/ChElementTetra_4.h"
+#include "chrono_fea/ChMesh.h"
+#include "chrono_fea/ChNodeFEAxyz.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+const int nx = 2;
+const int ny = 2;
+const int nz = 3;
+const double h = 0.1;
+const double tolerance = 1e-10;
+
+// Gravity residual of each grid node of the block (zero for fixed nodes).
+std::vector<ChVector<>> GravityResidual(bool fix_nodes) {
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto mesh = std::make_shared<ChMesh>();
+    mesh->SetAutomaticGravity(true);
+
+    auto material = std::make_shared<ChContinuumElastic>();
+    material->Set_E(1e7);
+    material->Set_v(0.3);
+    material->Set_density(1000);
+
+    // Grid nodes. If requested, the nodes at the top (not in the first element) are fixed.
+    auto grid_index = [](int i, int j, int k) { return (k * (ny + 1) + j) * (nx + 1) + i; };
+    int num_nodes = (nx + 1) * (ny + 1) * (nz + 1);
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes(num_nodes);
+    for (int k = 0; k <= nz; k++) {
+        for (int j = 0; j <= ny; j++) {
+            for (int i = 0; i <= nx; i++) {
+                auto node = std::make_shared<ChNodeFEAxyz>(ChVector<>(i * h, j * h, k * h));
+                node->SetFixed(fix_nodes && k == nz);
+                nodes[grid_index(i, j, k)] = node;
+                mesh->AddNode(node);
+            }
+        }
+    }
+
+    // Split each grid cell into 6 tetrahedrons sharing the cell diagonal.
+    int perms[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+    for (int k = 0; k < nz; k++) {
+        for (int j = 0; j < ny; j++) {
+            for (int i = 0; i < nx; i++) {
+                for (int p = 0; p < 6; p++) {
+                    int c[3] = {i, j, k};
+                    std::shared_ptr<ChNodeFEAxyz> tet[4];
+                    tet[0] = nodes[grid_index(c[0], c[1], c[2])];
+                    for (int s = 0; s < 3; s++) {
+                        c[perms[p][s]]++;
+                        tet[s + 1] = nodes[grid_index(c[0], c[1], c[2])];
+                    }
+                    // Ensure positive orientation.
+                    ChVector<> a = tet[1]->GetPos() - tet[0]->GetPos();
+                    ChVector<> b = tet[2]->GetPos() - tet[0]->GetPos();
+                    ChVector<> d = tet[3]->GetPos() - tet[0]->GetPos();
+                    if (Vdot(Vcross(a, b), d) < 0)
+                        std::swap(tet[1], tet[2]);
+
+                    auto element = std::make_shared<ChElementTetra_4>();
+                    element->SetNodes(tet[0], tet[1], tet[2], tet[3]);
+                    element->SetMaterial(material);
+                    mesh->AddElement(element);
+                }
+            }
+        }
+    }
+
+    system.Add(mesh);
+    system.SetupInitial();
+    system.Setup();
+
+    // The block is undeformed, so the residual only contains the gravity load.
+    ChVectorDynamic<> R(mesh->GetDOF_w());
+    R.Reset();
+    mesh->IntLoadResidual_F(0, R, 1.0);
+
+    std::vector<ChVector<>> forces(num_nodes, VNULL);
+    for (int i = 0; i < num_nodes; i++) {
+        if (nodes[i]->GetFixed())
+            continue;
+        unsigned int offset = nodes[i]->NodeGetOffset_w();
+        forces[i] = ChVector<>(R(offset), R(offset + 1), R(offset + 2));
+    }
+    return forces;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<ChVector<>> forces_free = GravityResidual(false);
+    std::vector<ChVector<>> forces_fixed = GravityResidual(true);
+
+    // Total weight of the block, for the relative error.
+    double weight = 1000 * (nx * h) * (ny * h) * (nz * h) * 9.81;
+
+    // The fixed nodes are the last layer of grid nodes.
+    int num_free = (nx + 1) * (ny + 1) * nz;
+    double max_err = 0;
+    for (int i = 0; i < num_free; i++)
+        max_err = std::max(max_err, (forces_fixed[i] - forces_free[i]).Length() / weight);
+
+    bool passed = max_err < tolerance;
+    GetLog() << "Free nodes: " << num_free << "  max relative error: " << max_err << "\n";
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if the test passed.
+    return !passed;
+}
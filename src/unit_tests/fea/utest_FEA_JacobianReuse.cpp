@@ -0,0 +1,192 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the element Jacobian reuse option of ChMesh.
+// A corotational tetrahedral cantilever block, released from rest under
+// gravity, is simulated with the HHT integrator, with and without Jacobian
+// reuse. Without reuse, all element Jacobians must be evaluated at each load.
+// With reuse, some Jacobians must be reused and some refreshed, and the tip
+// deflection must match the one obtained with full recomputation.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverMINRES.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+#include "chrono_fea/ChElementTetra_4.h"
+#include "chrono_fea/ChMesh.h"
+#include "chrono_fea/ChNodeFEAxyz.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// ====================================================================================
+
+int nx = 2;
+int ny = 2;
+int nz = 8;
+double h = 0.1;
+
+double end_time = 0.05;   // total simulation time
+double reuse_tol = 1e-5;  // state change threshold for Jacobian reuse
+double rtol = 1e-3;       // validation relative error
+
+struct RunData {
+    double deflection;  // tip deflection at the final time
+    int num_elements;   // number of mesh elements
+    int num_loads;      // number of calls to load the Jacobian information
+    int num_evals;      // number of element Jacobian evaluations
+    int num_reuses;     // number of reused element Jacobians
+};
+
+// Simulate the cantilever block (along the z axis, clamped at z = 0) with the given reuse tolerance.
+RunData Simulate(double tolerance) {
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto mesh = std::make_shared<ChMesh>();
+    mesh->SetJacobianReuseTolerance(tolerance);
+
+    auto material = std::make_shared<ChContinuumElastic>();
+    material->Set_E(1e6);
+    material->Set_v(0.3);
+    material->Set_density(1000);
+
+    auto grid_index = [](int i, int j, int k) { return (k * (ny + 1) + j) * (nx + 1) + i; };
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes((nx + 1) * (ny + 1) * (nz + 1));
+    for (int k = 0; k <= nz; k++) {
+        for (int j = 0; j <= ny; j++) {
+            for (int i = 0; i <= nx; i++) {
+                auto node = std::make_shared<ChNodeFEAxyz>(ChVector<>(i * h, j * h, k * h));
+                node->SetFixed(k == 0);
+                nodes[grid_index(i, j, k)] = node;
+                mesh->AddNode(node);
+            }
+        }
+    }
+
+    // Split each grid cell into 6 tetrahedrons sharing the cell diagonal.
+    int perms[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+    for (int k = 0; k < nz; k++) {
+        for (int j = 0; j < ny; j++) {
+            for (int i = 0; i < nx; i++) {
+                for (int p = 0; p < 6; p++) {
+                    int c[3] = {i, j, k};
+                    std::shared_ptr<ChNodeFEAxyz> tet[4];
+                    tet[0] = nodes[grid_index(c[0], c[1], c[2])];
+                    for (int s = 0; s < 3; s++) {
+                        c[perms[p][s]]++;
+                        tet[s + 1] = nodes[grid_index(c[0], c[1], c[2])];
+                    }
+                    // Ensure positive orientation.
+                    ChVector<> a = tet[1]->GetPos() - tet[0]->GetPos();
+                    ChVector<> b = tet[2]->GetPos() - tet[0]->GetPos();
+                    ChVector<> d = tet[3]->GetPos() - tet[0]->GetPos();
+                    if (Vdot(Vcross(a, b), d) < 0)
+                        std::swap(tet[1], tet[2]);
+
+                    auto element = std::make_shared<ChElementTetra_4>();
+                    element->SetNodes(tet[0], tet[1], tet[2], tet[3]);
+                    element->SetMaterial(material);
+                    mesh->AddElement(element);
+                }
+            }
+        }
+    }
+    auto tip = nodes[grid_index(nx, ny, nz)];
+
+    system.Add(mesh);
+    system.SetupInitial();
+
+    auto solver = std::make_shared<ChSolverMINRES>();
+    solver->SetDiagonalPreconditioning(true);
+    system.SetSolver(solver);
+    system.SetMaxItersSolverSpeed(500);
+    system.SetTolForce(1e-12);
+
+    // Full Newton iterations to a tight tolerance, so that the converged solution does not depend on the
+    // (possibly lagged) Jacobian.
+    system.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(system.GetTimestepper());
+    integrator->SetAlpha(-0.2);
+    integrator->SetMaxiters(50);
+    integrator->SetAbsTolerances(1e-10);
+    integrator->SetMode(ChTimestepperHHT::POSITION);
+    integrator->SetModifiedNewton(false);
+    integrator->SetScaling(true);
+
+    mesh->ResetCounters();
+    double step = 1e-3;
+    while (system.GetChTime() < end_time - 1e-10)
+        system.DoStepDynamics(step);
+
+    RunData data;
+    data.deflection = tip->GetPos().y() - tip->GetX0().y();
+    data.num_elements = (int)mesh->GetNelements();
+    data.num_loads = mesh->GetNumCallsJacobianLoad();
+    data.num_evals = mesh->GetNumElementJacobianEvaluations();
+    data.num_reuses = mesh->GetNumElementJacobianReuses();
+
+    GetLog() << "Reuse tolerance: " << tolerance << "\n";
+    GetLog() << "  Tip deflection: " << data.deflection << "\n";
+    GetLog() << "  Jacobian loads: " << data.num_loads << "  element evaluations: " << data.num_evals
+             << "  element reuses: " << data.num_reuses << "\n";
+
+    return data;
+}
+
+// ====================================================================================
+
+int main(int argc, char* argv[]) {
+    RunData full = Simulate(0);
+    RunData reuse = Simulate(reuse_tol);
+
+    bool passed = true;
+
+    // Without reuse, every element Jacobian is evaluated at each load.
+    if (full.num_loads == 0 || full.num_reuses != 0 || full.num_evals != full.num_elements * full.num_loads) {
+        GetLog() << "Incorrect counters without Jacobian reuse\n";
+        passed = false;
+    }
+
+    // With reuse, each element Jacobian is either evaluated or reused at each load; some must be reused, and some
+    // must be refreshed after their first evaluation.
+    if (reuse.num_evals + reuse.num_reuses != reuse.num_elements * reuse.num_loads) {
+        GetLog() << "Inconsistent counters with Jacobian reuse\n";
+        passed = false;
+    }
+    if (reuse.num_reuses == 0) {
+        GetLog() << "No element Jacobian reused\n";
+        passed = false;
+    }
+    if (reuse.num_evals <= reuse.num_elements) {
+        GetLog() << "No element Jacobian refreshed\n";
+        passed = false;
+    }
+
+    // The solution must match the one obtained with full Jacobian recomputation.
+    if (!(full.deflection < 0) || std::abs(reuse.deflection - full.deflection) > rtol * std::abs(full.deflection)) {
+        GetLog() << "Tip deflections differ\n";
+        passed = false;
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,183 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the binary mesh cache of ChMeshFileLoader.
+// Each supported mesh file format is imported three times: without cache, with
+// cache (first import, which writes the cache file), and with cache again (which
+// reads the cache file). The resulting meshes must be identical.
+//
+// =============================================================================
+
+#include "chrono/core/ChFileutils.h"
+#include "chrono/physics/ChGlobal.h"
+
+#include "chrono_fea/ChElementTetra_4.h"
+#include "chrono_fea/ChMeshFileLoader.h"
+#include "chrono_fea/ChNodeFEAxyz.h"
+#include "chrono_fea/ChNodeFEAxyzD.h"
+#include "chrono_fea/ChNodeFEAxyzP.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+const std::string cache_dir = "mesh_cache";
+
+// Check that two meshes have the same nodes (positions and directions) and element connectivity.
+bool CompareMeshes(std::shared_ptr<ChMesh> mesh1, std::shared_ptr<ChMesh> mesh2) {
+    if (mesh1->GetNnodes() != mesh2->GetNnodes() || mesh1->GetNelements() != mesh2->GetNelements()) {
+        GetLog() << "  Mesh sizes differ: " << mesh1->GetNnodes() << "/" << mesh1->GetNelements() << " vs "
+                 << mesh2->GetNnodes() << "/" << mesh2->GetNelements() << "\n";
+        return false;
+    }
+
+    for (unsigned int i = 0; i < mesh1->GetNnodes(); i++) {
+        auto n1 = mesh1->GetNode(i);
+        auto n2 = mesh2->GetNode(i);
+        ChVector<> p1, p2;
+        if (auto nD1 = std::dynamic_pointer_cast<ChNodeFEAxyzD>(n1)) {
+            auto nD2 = std::dynamic_pointer_cast<ChNodeFEAxyzD>(n2);
+            if (!nD2 || nD1->GetD() != nD2->GetD()) {
+                GetLog() << "  Node " << i << " directions differ\n";
+                return false;
+            }
+        }
+        if (auto nxyz1 = std::dynamic_pointer_cast<ChNodeFEAxyz>(n1)) {
+            p1 = nxyz1->GetPos();
+            p2 = std::dynamic_pointer_cast<ChNodeFEAxyz>(n2)->GetPos();
+        } else if (auto nP1 = std::dynamic_pointer_cast<ChNodeFEAxyzP>(n1)) {
+            p1 = nP1->GetPos();
+            p2 = std::dynamic_pointer_cast<ChNodeFEAxyzP>(n2)->GetPos();
+        }
+        if (p1 != p2) {
+            GetLog() << "  Node " << i << " positions differ\n";
+            return false;
+        }
+    }
+
+    for (unsigned int i = 0; i < mesh1->GetNelements(); i++) {
+        auto e1 = mesh1->GetElement(i);
+        auto e2 = mesh2->GetElement(i);
+        if (e1->GetNnodes() != e2->GetNnodes())
+            return false;
+        for (int k = 0; k < e1->GetNnodes(); k++) {
+            // Compare node positions, since node objects differ between meshes.
+            auto n1 = std::dynamic_pointer_cast<ChNodeFEAxyz>(e1->GetNodeN(k));
+            auto n2 = std::dynamic_pointer_cast<ChNodeFEAxyz>(e2->GetNodeN(k));
+            if (n1 && (!n2 || n1->GetPos() != n2->GetPos())) {
+                GetLog() << "  Element " << i << " connectivity differs\n";
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool TestTetGen() {
+    GetLog() << "TetGen import\n";
+    std::string node_file = GetChronoDataFile("fea/beam.node");
+    std::string ele_file = GetChronoDataFile("fea/beam.ele");
+    auto material = std::make_shared<ChContinuumElastic>();
+    ChVector<> pos(0.1, 0.2, 0.3);
+    ChMatrix33<> rot(Q_from_AngX(0.3));
+
+    ChMeshFileLoader::SetBinaryCache(false);
+    auto mesh_ref = std::make_shared<ChMesh>();
+    ChMeshFileLoader::FromTetGenFile(mesh_ref, node_file.c_str(), ele_file.c_str(), material, pos, rot);
+
+    ChMeshFileLoader::SetBinaryCache(true, cache_dir);
+    auto mesh_write = std::make_shared<ChMesh>();
+    ChMeshFileLoader::FromTetGenFile(mesh_write, node_file.c_str(), ele_file.c_str(), material, pos, rot);
+    auto mesh_read = std::make_shared<ChMesh>();
+    ChMeshFileLoader::FromTetGenFile(mesh_read, node_file.c_str(), ele_file.c_str(), material, pos, rot);
+    ChMeshFileLoader::SetBinaryCache(false);
+
+    return mesh_ref->GetNelements() > 0 && CompareMeshes(mesh_ref, mesh_write) && CompareMeshes(mesh_ref, mesh_read);
+}
+
+bool TestAbaqus() {
+    GetLog() << "Abaqus import\n";
+    std::string inp_file = GetChronoDataFile("fea/tractor_wheel_coarse.INP");
+    auto material = std::make_shared<ChContinuumElastic>();
+    std::vector<std::vector<std::shared_ptr<ChNodeFEAbase>>> sets_ref, sets_read;
+
+    ChMeshFileLoader::SetBinaryCache(false);
+    auto mesh_ref = std::make_shared<ChMesh>();
+    ChMeshFileLoader::FromAbaqusFile(mesh_ref, inp_file.c_str(), material, sets_ref);
+
+    ChMeshFileLoader::SetBinaryCache(true, cache_dir);
+    auto mesh_write = std::make_shared<ChMesh>();
+    ChMeshFileLoader::FromAbaqusFile(mesh_write, inp_file.c_str(), material, sets_read);
+    auto mesh_read = std::make_shared<ChMesh>();
+    ChMeshFileLoader::FromAbaqusFile(mesh_read, inp_file.c_str(), material, sets_read);
+    ChMeshFileLoader::SetBinaryCache(false);
+
+    if (sets_ref.size() != sets_read.size())
+        return false;
+    for (size_t i = 0; i < sets_ref.size(); i++) {
+        if (sets_ref[i].size() != sets_read[i].size())
+            return false;
+        for (size_t j = 0; j < sets_ref[i].size(); j++) {
+            auto n1 = std::dynamic_pointer_cast<ChNodeFEAxyz>(sets_ref[i][j]);
+            auto n2 = std::dynamic_pointer_cast<ChNodeFEAxyz>(sets_read[i][j]);
+            if (n1->GetPos() != n2->GetPos())
+                return false;
+        }
+    }
+
+    return mesh_ref->GetNelements() > 0 && CompareMeshes(mesh_ref, mesh_write) && CompareMeshes(mesh_ref, mesh_read);
+}
+
+bool TestGMF() {
+    GetLog() << "GMF import\n";
+    std::string mesh_file = GetChronoDataFile("fea/Plate.mesh");
+    auto material = std::make_shared<ChMaterialShellANCF>(500, 2.1e7, 0.3);
+    std::vector<double> area_ref, area_read;
+    std::vector<int> bc_ref, bc_read;
+
+    ChMeshFileLoader::SetBinaryCache(false);
+    auto mesh_ref = std::make_shared<ChMesh>();
+    ChMeshFileLoader::ANCFShellFromGMFFile(mesh_ref, mesh_file.c_str(), material, area_ref, bc_ref, VNULL,
+                                           ChMatrix33<>(1), 0.5);
+
+    ChMeshFileLoader::SetBinaryCache(true, cache_dir);
+    auto mesh_write = std::make_shared<ChMesh>();
+    ChMeshFileLoader::ANCFShellFromGMFFile(mesh_write, mesh_file.c_str(), material, area_read, bc_read, VNULL,
+                                           ChMatrix33<>(1), 0.5);
+    area_read.clear();
+    bc_read.clear();
+    auto mesh_read = std::make_shared<ChMesh>();
+    ChMeshFileLoader::ANCFShellFromGMFFile(mesh_read, mesh_file.c_str(), material, area_read, bc_read, VNULL,
+                                           ChMatrix33<>(1), 0.5);
+    ChMeshFileLoader::SetBinaryCache(false);
+
+    return mesh_ref->GetNelements() > 0 && area_ref == area_read && bc_ref == bc_read &&
+           CompareMeshes(mesh_ref, mesh_write) && CompareMeshes(mesh_ref, mesh_read);
+}
+
+// ====================================================================================
+
+int main(int argc, char* argv[]) {
+    ChFileutils::MakeDirectory(cache_dir.c_str());
+
+    bool passed = true;
+    passed &= TestTetGen();
+    passed &= TestAbaqus();
+    passed &= TestGMF();
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,184 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the node reordering option of ChMesh.
+// A tetrahedral cantilever block is created with nodes added in random order.
+// The reverse Cuthill-McKee and Morton orderings must reduce the bandwidth of
+// the node connectivity, keep node indices consistent, and produce the same
+// dynamic response as the original ordering.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverMINRES.h"
+
+#include "chrono_fea/ChElementTetra_4.h"
+#include "chrono_fea/ChMesh.h"
+#include "chrono_fea/ChNodeFEAxyz.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// ====================================================================================
+
+int nx = 3;
+int ny = 3;
+int nz = 8;
+double h = 0.1;
+
+double rtol = 1e-4;  // validation relative error (with respect to the maximum displacement)
+
+struct Result {
+    int bandwidth;                 ///< maximum index difference between nodes of the same element
+    bool indices_ok;               ///< node indices consistent with positions in the mesh
+    std::vector<ChVector<>> disp;  ///< final node displacements (in grid order)
+};
+
+// Create the block mesh, with nodes added in shuffled order, and simulate it.
+Result SimulateBlock(ChMesh::NodeOrdering ordering) {
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto mesh = std::make_shared<ChMesh>();
+    mesh->SetNodeOrdering(ordering);
+
+    auto material = std::make_shared<ChContinuumElastic>();
+    material->Set_E(1e7);
+    material->Set_v(0.3);
+    material->Set_density(1000);
+
+    // Grid nodes, added to the mesh in random order. Nodes at z = 0 are fixed.
+    auto grid_index = [](int i, int j, int k) { return (k * (ny + 1) + j) * (nx + 1) + i; };
+    int num_nodes = (nx + 1) * (ny + 1) * (nz + 1);
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes(num_nodes);
+    for (int k = 0; k <= nz; k++) {
+        for (int j = 0; j <= ny; j++) {
+            for (int i = 0; i <= nx; i++) {
+                auto node = std::make_shared<ChNodeFEAxyz>(ChVector<>(i * h, j * h, k * h));
+                node->SetFixed(k == 0);
+                nodes[grid_index(i, j, k)] = node;
+            }
+        }
+    }
+    std::vector<int> order(num_nodes);
+    for (int i = 0; i < num_nodes; i++)
+        order[i] = i;
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+    for (auto i : order)
+        mesh->AddNode(nodes[i]);
+
+    // Split each grid cell into 6 tetrahedrons sharing the cell diagonal.
+    int perms[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+    for (int k = 0; k < nz; k++) {
+        for (int j = 0; j < ny; j++) {
+            for (int i = 0; i < nx; i++) {
+                for (int p = 0; p < 6; p++) {
+                    int c[3] = {i, j, k};
+                    std::shared_ptr<ChNodeFEAxyz> tet[4];
+                    tet[0] = nodes[grid_index(c[0], c[1], c[2])];
+                    for (int s = 0; s < 3; s++) {
+                        c[perms[p][s]]++;
+                        tet[s + 1] = nodes[grid_index(c[0], c[1], c[2])];
+                    }
+                    // Ensure positive orientation.
+                    ChVector<> a = tet[1]->GetPos() - tet[0]->GetPos();
+                    ChVector<> b = tet[2]->GetPos() - tet[0]->GetPos();
+                    ChVector<> d = tet[3]->GetPos() - tet[0]->GetPos();
+                    if (Vdot(Vcross(a, b), d) < 0)
+                        std::swap(tet[1], tet[2]);
+
+                    auto element = std::make_shared<ChElementTetra_4>();
+                    element->SetNodes(tet[0], tet[1], tet[2], tet[3]);
+                    element->SetMaterial(material);
+                    mesh->AddElement(element);
+                }
+            }
+        }
+    }
+
+    system.Add(mesh);
+    system.SetupInitial();
+
+    Result result;
+
+    // Check node indices and compute the connectivity bandwidth.
+    result.indices_ok = (mesh->GetNnodes() == (unsigned int)num_nodes);
+    for (unsigned int i = 0; i < mesh->GetNnodes(); i++) {
+        auto node = std::dynamic_pointer_cast<ChNodeFEAbase>(mesh->GetNode(i));
+        result.indices_ok &= (node->GetIndex() == i + 1);
+    }
+    result.bandwidth = 0;
+    for (unsigned int ie = 0; ie < mesh->GetNelements(); ie++) {
+        auto element = mesh->GetElement(ie);
+        for (int a = 0; a < element->GetNnodes(); a++) {
+            for (int b = 0; b < element->GetNnodes(); b++) {
+                int ia = (int)element->GetNodeN(a)->GetIndex();
+                int ib = (int)element->GetNodeN(b)->GetIndex();
+                result.bandwidth = std::max(result.bandwidth, std::abs(ia - ib));
+            }
+        }
+    }
+
+    // Simulate a few steps.
+    auto solver = std::make_shared<ChSolverMINRES>();
+    solver->SetDiagonalPreconditioning(true);
+    system.SetSolver(solver);
+    system.SetMaxItersSolverSpeed(500);
+    system.SetTolForce(1e-12);
+    system.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    for (int istep = 0; istep < 20; istep++)
+        system.DoStepDynamics(1e-3);
+
+    for (auto node : nodes)
+        result.disp.push_back(node->GetPos() - node->GetX0());
+
+    return result;
+}
+
+// ====================================================================================
+
+int main(int argc, char* argv[]) {
+    Result res_none = SimulateBlock(ChMesh::NodeOrdering::NONE);
+    Result res_rcm = SimulateBlock(ChMesh::NodeOrdering::REVERSE_CUTHILL_MCKEE);
+    Result res_morton = SimulateBlock(ChMesh::NodeOrdering::MORTON);
+
+    GetLog() << "Bandwidth  NONE: " << res_none.bandwidth << "  RCM: " << res_rcm.bandwidth
+             << "  MORTON: " << res_morton.bandwidth << "\n";
+
+    bool passed = res_none.indices_ok && res_rcm.indices_ok && res_morton.indices_ok;
+    passed &= (res_rcm.bandwidth < res_none.bandwidth / 2);
+    passed &= (res_morton.bandwidth < res_none.bandwidth);
+
+    // The dynamic response must not depend on the node ordering.
+    double max_disp = 0;
+    double max_err = 0;
+    for (size_t i = 0; i < res_none.disp.size(); i++) {
+        max_disp = std::max(max_disp, res_none.disp[i].Length());
+        max_err = std::max(max_err, (res_rcm.disp[i] - res_none.disp[i]).Length());
+        max_err = std::max(max_err, (res_morton.disp[i] - res_none.disp[i]).Length());
+    }
+    GetLog() << "Max displacement: " << max_disp << "  max difference: " << max_err << "\n";
+    passed &= (max_disp > 0 && max_err < rtol * max_disp);
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,195 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// ChronoParallel unit test for the collision statistics.
+// Spheres and boxes are dropped in a container, with the collection of
+// collision statistics enabled. At each step, the statistics must be consistent
+// with the broadphase and narrowphase results:
+// - the bin histograms must account for all active bins;
+// - the counts per pair of shape types must add up to the numbers of candidate
+//   pairs and of rigid contacts.
+// The statistics of the last step must also be written in CSV format.
+// Finally, two parallel capsules side by side must be counted as one candidate
+// pair but two rigid contacts (NarrowphaseR).
+// =============================================================================
+
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// Sum of the entries of a histogram.
+uint Total(const std::vector<uint>& histogram) {
+    uint total = 0;
+    for (auto count : histogram)
+        total += count;
+    return total;
+}
+
+// Sum of the counts per pair of shape types.
+uint Total(const std::vector<vec3>& counts) {
+    uint total = 0;
+    for (auto& count : counts)
+        total += count.z;
+    return total;
+}
+
+// Count of the given pair of shape types.
+uint Count(const std::vector<vec3>& counts, int type1, int type2) {
+    for (auto& count : counts) {
+        if (count.x == type1 && count.y == type2)
+            return count.z;
+    }
+    return 0;
+}
+
+// Two parallel capsules side by side, which produce two contacts with NarrowphaseR.
+bool TestCapsulePair() {
+    ChSystemParallelSMC msystem;
+    msystem.Set_G_acc(ChVector<>(0, 0, 0));
+    CHOMPfunctions::SetNumThreads(1);
+    msystem.GetSettings()->max_threads = 1;
+    msystem.GetSettings()->perform_thread_tuning = false;
+    msystem.GetSettings()->collision.bins_per_axis = vec3(2, 2, 2);
+    msystem.GetSettings()->collision.narrowphase_algorithm = NarrowPhaseType::NARROWPHASE_R;
+    msystem.GetSettings()->collision.collect_statistics = true;
+
+    auto material = std::make_shared<ChMaterialSurfaceSMC>();
+
+    for (int i = 0; i < 2; i++) {
+        auto body = std::make_shared<ChBody>(std::make_shared<ChCollisionModelParallel>(), ChMaterialSurface::SMC);
+        body->SetMaterialSurface(material);
+        body->SetPos(ChVector<>(0.19 * i, 0, 0));
+        body->SetBodyFixed(i == 0);
+        body->SetCollide(true);
+        body->GetCollisionModel()->ClearModel();
+        body->GetCollisionModel()->AddCapsule(0.1, 0.5);
+        body->GetCollisionModel()->BuildModel();
+        msystem.AddBody(body);
+    }
+
+    msystem.DoStepDynamics(1e-4);
+
+    const collision_measures& measures = msystem.data_manager->measures.collision;
+    uint possible = Count(measures.contacts_possible_types, CAPSULE, CAPSULE);
+    uint active = Count(measures.contacts_active_types, CAPSULE, CAPSULE);
+    printf("Capsule pair: %d candidate pairs, %d contacts\n", possible, active);
+
+    return possible == 1 && active == 2 && msystem.data_manager->num_rigid_contacts == 2;
+}
+
+int main(int argc, char* argv[]) {
+    ChSystemParallelSMC msystem;
+    msystem.Set_G_acc(ChVector<>(0, -9.81, 0));
+    CHOMPfunctions::SetNumThreads(2);
+    msystem.GetSettings()->max_threads = 2;
+    msystem.GetSettings()->perform_thread_tuning = false;
+    msystem.GetSettings()->collision.bins_per_axis = vec3(10, 10, 10);
+    msystem.GetSettings()->collision.collision_envelope = 0.01;
+    msystem.GetSettings()->collision.collect_statistics = true;
+
+    auto material = std::make_shared<ChMaterialSurfaceSMC>();
+    material->SetYoungModulus(1e6f);
+    material->SetFriction(0.4f);
+
+    // Container: ground and 4 walls.
+    auto container = std::make_shared<ChBody>(std::make_shared<ChCollisionModelParallel>(), ChMaterialSurface::SMC);
+    container->SetMaterialSurface(material);
+    container->SetBodyFixed(true);
+    container->SetCollide(true);
+    container->GetCollisionModel()->ClearModel();
+    container->GetCollisionModel()->AddBox(1, 0.1, 1, ChVector<>(0, -0.1, 0));
+    container->GetCollisionModel()->AddBox(0.1, 1, 1, ChVector<>(-1.1, 1, 0));
+    container->GetCollisionModel()->AddBox(0.1, 1, 1, ChVector<>(1.1, 1, 0));
+    container->GetCollisionModel()->AddBox(1, 1, 0.1, ChVector<>(0, 1, -1.1));
+    container->GetCollisionModel()->AddBox(1, 1, 0.1, ChVector<>(0, 1, 1.1));
+    container->GetCollisionModel()->BuildModel();
+    msystem.AddBody(container);
+
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            for (int k = 0; k < 2; k++) {
+                auto body =
+                    std::make_shared<ChBody>(std::make_shared<ChCollisionModelParallel>(), ChMaterialSurface::SMC);
+                body->SetMaterialSurface(material);
+                body->SetMass(1);
+                body->SetInertiaXX(ChVector<>(0.01, 0.01, 0.01));
+                body->SetPos(ChVector<>(-0.75 + 0.3 * i, 0.1 + 0.25 * k, -0.75 + 0.3 * j));
+                body->SetCollide(true);
+                body->GetCollisionModel()->ClearModel();
+                if ((i + j + k) % 2)
+                    body->GetCollisionModel()->AddSphere(0.1);
+                else
+                    body->GetCollisionModel()->AddBox(0.08, 0.08, 0.08);
+                body->GetCollisionModel()->BuildModel();
+                msystem.AddBody(body);
+            }
+        }
+    }
+
+    bool passed = true;
+    uint max_contacts = 0;
+    for (int i = 0; i < 200; i++) {
+        msystem.DoStepDynamics(1e-3);
+
+        const collision_measures& measures = msystem.data_manager->measures.collision;
+        uint bins = measures.number_of_bins_active;
+        uint possible = measures.number_of_contacts_possible;
+        uint active = msystem.data_manager->num_rigid_contacts;
+
+        bool consistent = Total(measures.bin_shapes_histogram) == bins && Total(measures.bin_pairs_histogram) == bins;
+        consistent &= measures.bin_shapes_histogram.empty() || measures.bin_shapes_histogram[0] == 0;
+        consistent &= bins == 0 || measures.max_bin_shapes > 0;
+        consistent &= Total(measures.contacts_possible_types) == possible;
+        consistent &= measures.number_of_contacts_active == active;
+        consistent &= Total(measures.contacts_active_types) == active;
+        consistent &= active == 0 || measures.contact_memory > 0;
+        if (!consistent) {
+            printf("Step %d: inconsistent statistics (%d bins, %d candidate pairs, %d contacts)\n", i, bins, possible,
+                   active);
+            passed = false;
+        }
+        max_contacts = std::max(max_contacts, active);
+    }
+
+    // Statistics of the last step in CSV format: a header and one line per quantity.
+    std::ostringstream csv;
+    msystem.WriteCollisionStatistics(csv, true);
+    std::istringstream lines(csv.str());
+    std::string line;
+    std::getline(lines, line);
+    bool header = line == "time,quantity,index,value";
+    int num_lines = 0;
+    while (std::getline(lines, line))
+        num_lines++;
+
+    printf("Max. contacts: %d  CSV lines: %d\n", max_contacts, num_lines);
+
+    // The test is not vacuous only if the shapes interact.
+    passed &= max_contacts > 0 && header && num_lines > 10;
+
+    passed &= TestCapsulePair();
+
+    printf("Test %s\n", passed ? "PASSED" : "FAILED");
+
+    // Return 0 if the test passed.
+    return !passed;
+}
@@ -0,0 +1,121 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// ChronoParallel unit test for the reduction of rigid contacts (NSC only).
+// A box settles on a flat ground mesh made of many small triangles, so that
+// each triangle under the box produces a contact. The simulation is run with
+// and without contact reduction:
+// - with reduction, there are at most 4 contacts between the box and the ground;
+// - the box must come to rest at the same position in both cases.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "chrono/collision/ChCCollisionModel.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// Simulate the box settling on the ground mesh. Return the final box position and the maximum
+// number of contacts over all steps.
+ChVector<> SimulateBox(bool reduction, uint& max_contacts) {
+    double time_step = 1e-3;
+    int num_steps = 500;
+
+    ChSystemParallelNSC msystem;
+    msystem.Set_G_acc(ChVector<>(0, -9.81, 0));
+    CHOMPfunctions::SetNumThreads(1);
+    msystem.GetSettings()->max_threads = 1;
+    msystem.GetSettings()->perform_thread_tuning = false;
+    msystem.GetSettings()->collision.narrowphase_algorithm = NarrowPhaseType::NARROWPHASE_HYBRID_MPR;
+    msystem.GetSettings()->collision.bins_per_axis = vec3(10, 10, 10);
+    msystem.GetSettings()->collision.contact_reduction = reduction;
+    msystem.GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    msystem.GetSettings()->solver.max_iteration_normal = 0;
+    msystem.GetSettings()->solver.max_iteration_sliding = 100;
+    msystem.GetSettings()->solver.max_iteration_spinning = 0;
+    msystem.GetSettings()->solver.tolerance = 1e-5;
+
+    auto material = std::make_shared<ChMaterialSurfaceNSC>();
+    material->SetFriction(0.4f);
+
+    // Flat ground mesh: 16 x 16 grid of quads, each split in two triangles.
+    geometry::ChTriangleMeshConnected terrain;
+    for (int i = 0; i < 16; i++) {
+        for (int j = 0; j < 16; j++) {
+            double x0 = -2 + 0.25 * i, x1 = x0 + 0.25;
+            double z0 = -2 + 0.25 * j, z1 = z0 + 0.25;
+            terrain.addTriangle(ChVector<>(x0, 0, z0), ChVector<>(x0, 0, z1), ChVector<>(x1, 0, z0));
+            terrain.addTriangle(ChVector<>(x1, 0, z0), ChVector<>(x0, 0, z1), ChVector<>(x1, 0, z1));
+        }
+    }
+
+    auto ground = std::make_shared<ChBody>(std::make_shared<ChCollisionModelParallel>(), ChMaterialSurface::NSC);
+    ground->SetMaterialSurface(material);
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddTriangleMesh(terrain, true, false);
+    ground->GetCollisionModel()->BuildModel();
+    msystem.AddBody(ground);
+
+    // Box slightly above the ground, covering many mesh triangles.
+    auto box = std::make_shared<ChBody>(std::make_shared<ChCollisionModelParallel>(), ChMaterialSurface::NSC);
+    box->SetMaterialSurface(material);
+    box->SetMass(1);
+    box->SetInertiaXX(ChVector<>(0.1, 0.1, 0.1));
+    box->SetPos(ChVector<>(0.1, 0.21, 0.1));
+    box->SetCollide(true);
+    box->GetCollisionModel()->ClearModel();
+    box->GetCollisionModel()->AddBox(0.6, 0.2, 0.6);
+    box->GetCollisionModel()->BuildModel();
+    msystem.AddBody(box);
+
+    max_contacts = 0;
+    for (int i = 0; i < num_steps; i++) {
+        msystem.DoStepDynamics(time_step);
+        max_contacts = std::max(max_contacts, msystem.data_manager->num_rigid_contacts);
+    }
+
+    return box->GetPos();
+}
+
+int main(int argc, char* argv[]) {
+    uint max_contacts_full;
+    uint max_contacts_reduced;
+    ChVector<> pos_full = SimulateBox(false, max_contacts_full);
+    ChVector<> pos_reduced = SimulateBox(true, max_contacts_reduced);
+
+    printf("Max. contacts without reduction: %d  with reduction: %d\n", max_contacts_full, max_contacts_reduced);
+    printf("Final box position without reduction: %f %f %f\n", pos_full.x(), pos_full.y(), pos_full.z());
+    printf("Final box position with reduction:    %f %f %f\n", pos_reduced.x(), pos_reduced.y(), pos_reduced.z());
+
+    // The test is not vacuous only if the full contact set is larger than the reduced one.
+    bool passed = max_contacts_full > 4;
+    passed &= max_contacts_reduced > 0 && max_contacts_reduced <= 4;
+    passed &= (pos_full - pos_reduced).Length() < 1e-3;
+    passed &= std::abs(pos_reduced.y() - 0.2) < 1e-2;
+
+    printf("Test %s\n", passed ? "PASSED" : "FAILED");
+
+    // Return 0 if the test passed.
+    return !passed;
+}
@@ -0,0 +1,120 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// ChronoParallel unit test for triangle mesh collision shapes.
+// A box slides (without friction) over a flat ground mesh made of many
+// triangles. All contacts must be face contacts (vertical normal): contacts
+// with the internal edges and vertices of the mesh must be discarded. The
+// shape pair recorded for each contact must match the contact bodies.
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "chrono/collision/ChCCollisionModel.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+int main(int argc, char* argv[]) {
+    double time_step = 1e-3;
+    int num_steps = 1000;
+
+    ChSystemParallelSMC msystem;
+    msystem.Set_G_acc(ChVector<>(0, -9.81, 0));
+    CHOMPfunctions::SetNumThreads(1);
+    msystem.GetSettings()->max_threads = 1;
+    msystem.GetSettings()->perform_thread_tuning = false;
+    msystem.GetSettings()->collision.narrowphase_algorithm = NarrowPhaseType::NARROWPHASE_HYBRID_MPR;
+    msystem.GetSettings()->collision.bins_per_axis = vec3(10, 10, 10);
+
+    auto material = std::make_shared<ChMaterialSurfaceSMC>();
+    material->SetFriction(0);
+    material->SetYoungModulus(1e7f);
+    material->SetRestitution(0);
+
+    // Flat ground mesh: 8 x 8 grid of quads, each split in two triangles.
+    geometry::ChTriangleMeshConnected terrain;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            double x0 = -2 + 0.5 * i, x1 = x0 + 0.5;
+            double z0 = -2 + 0.5 * j, z1 = z0 + 0.5;
+            terrain.addTriangle(ChVector<>(x0, 0, z0), ChVector<>(x0, 0, z1), ChVector<>(x1, 0, z0));
+            terrain.addTriangle(ChVector<>(x1, 0, z0), ChVector<>(x0, 0, z1), ChVector<>(x1, 0, z1));
+        }
+    }
+
+    auto ground = std::make_shared<ChBody>(std::make_shared<ChCollisionModelParallel>(), ChMaterialSurface::SMC);
+    ground->SetMaterialSurface(material);
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddTriangleMesh(terrain, true, false);
+    ground->GetCollisionModel()->BuildModel();
+    msystem.AddBody(ground);
+
+    // Box sliding along a diagonal, crossing internal edges and vertices of the mesh.
+    auto box = std::make_shared<ChBody>(std::make_shared<ChCollisionModelParallel>(), ChMaterialSurface::SMC);
+    box->SetMaterialSurface(material);
+    box->SetMass(1);
+    box->SetInertiaXX(ChVector<>(0.1, 0.1, 0.1));
+    box->SetPos(ChVector<>(-1.25, 0.2, -1.25));
+    box->SetPos_dt(ChVector<>(1, 0, 1));
+    box->SetCollide(true);
+    box->GetCollisionModel()->ClearModel();
+    box->GetCollisionModel()->AddBox(0.2, 0.2, 0.2);
+    box->GetCollisionModel()->BuildModel();
+    msystem.AddBody(box);
+
+    bool passed = true;
+    int num_contacts = 0;
+    for (int i = 0; i < num_steps; i++) {
+        msystem.DoStepDynamics(time_step);
+
+        // The shape pair and triangles are recorded per contact and must match the contact bodies.
+        const custom_vector<real3>& norm = msystem.data_manager->host_data.norm_rigid_rigid;
+        const custom_vector<vec2>& bids = msystem.data_manager->host_data.bids_rigid_rigid;
+        const custom_vector<long long>& pairs = msystem.data_manager->host_data.contact_pairs;
+        const custom_vector<vec2>& triangles = msystem.data_manager->host_data.contact_triangles;
+        const custom_vector<uint>& shape_body = msystem.data_manager->shape_data.id_rigid;
+        passed &= pairs.size() == msystem.data_manager->num_rigid_contacts;
+        passed &= triangles.size() == msystem.data_manager->num_rigid_contacts;
+        for (uint j = 0; j < msystem.data_manager->num_rigid_contacts; j++) {
+            passed &= std::abs(norm[j].y) > 1 - 1e-6;
+            passed &= (triangles[j].x >= 0) != (triangles[j].y >= 0);
+            passed &= shape_body[int(pairs[j] >> 32)] == (uint)bids[j].x;
+            passed &= shape_body[int(pairs[j] & 0xffffffff)] == (uint)bids[j].y;
+        }
+        num_contacts += msystem.data_manager->num_rigid_contacts;
+    }
+
+    printf("Total contacts: %d\n", num_contacts);
+    printf("Final box position: %f %f %f\n", box->GetPos().x(), box->GetPos().y(), box->GetPos().z());
+
+    // The box must have kept in contact with the ground and slid without bumps.
+    passed &= num_contacts > 0;
+    passed &= std::abs(box->GetPos().y() - 0.2) < 1e-2;
+    passed &= std::abs(box->GetPos_dt().x() - 1) < 1e-2 && std::abs(box->GetPos_dt().z() - 1) < 1e-2;
+
+    printf("Test %s\n", passed ? "PASSED" : "FAILED");
+
+    // Return 0 if the test passed.
+    return !passed;
+}
@@ -0,0 +1,191 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// ChronoParallel unit test for the batching of the MPR narrowphase pairs.
+// Shapes of different types are dropped on a ground box, with the MPR and
+// hybrid MPR narrowphases, with and without batching (sorting the candidate
+// pairs by shape types and rejecting pairs with separated bounding spheres):
+// - the rigid contacts must be identical at each step;
+// - with batching, the pairs of spheres placed diagonally (overlapping AABBs,
+//   separated bounding spheres) must be culled before the narrowphase.
+// =============================================================================
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// Rigid contacts found at one step.
+struct Contacts {
+    std::vector<vec2> bids;
+    std::vector<real3> norm;
+    std::vector<real3> cpta;
+    std::vector<real3> cptb;
+    std::vector<real> dpth;
+};
+
+bool Equal(const Contacts& c1, const Contacts& c2) {
+    if (c1.bids.size() != c2.bids.size())
+        return false;
+    for (size_t i = 0; i < c1.bids.size(); i++) {
+        if (c1.bids[i].x != c2.bids[i].x || c1.bids[i].y != c2.bids[i].y)
+            return false;
+        if (!(c1.norm[i] == c2.norm[i]) || !(c1.cpta[i] == c2.cpta[i]) || !(c1.cptb[i] == c2.cptb[i]))
+            return false;
+        if (c1.dpth[i] != c2.dpth[i])
+            return false;
+    }
+    return true;
+}
+
+std::shared_ptr<ChBody> AddBody(ChSystemParallelSMC& msystem,
+                                std::shared_ptr<ChMaterialSurfaceSMC> material,
+                                const ChVector<>& pos) {
+    auto body = std::make_shared<ChBody>(std::make_shared<ChCollisionModelParallel>(), ChMaterialSurface::SMC);
+    body->SetMaterialSurface(material);
+    body->SetMass(1);
+    body->SetInertiaXX(ChVector<>(0.01, 0.01, 0.01));
+    body->SetPos(pos);
+    body->SetRot(Q_from_AngAxis(0.3, ChVector<>(1, 1, 0).GetNormalized()));
+    body->SetCollide(true);
+    body->GetCollisionModel()->ClearModel();
+    msystem.AddBody(body);
+    return body;
+}
+
+// Simulate the falling shapes and record the contacts at each step. Return the total number of culled pairs.
+uint Simulate(NarrowPhaseType narrowphase, bool batching, std::vector<Contacts>& contacts) {
+    ChSystemParallelSMC msystem;
+    msystem.Set_G_acc(ChVector<>(0, -9.81, 0));
+    CHOMPfunctions::SetNumThreads(1);
+    msystem.GetSettings()->max_threads = 1;
+    msystem.GetSettings()->perform_thread_tuning = false;
+    msystem.GetSettings()->collision.bins_per_axis = vec3(10, 10, 10);
+    msystem.GetSettings()->collision.collision_envelope = 0.01;
+    msystem.GetSettings()->collision.narrowphase_algorithm = narrowphase;
+    msystem.GetSettings()->collision.mpr_batching = batching;
+
+    auto material = std::make_shared<ChMaterialSurfaceSMC>();
+    material->SetYoungModulus(1e6f);
+    material->SetFriction(0.4f);
+
+    auto ground = std::make_shared<ChBody>(std::make_shared<ChCollisionModelParallel>(), ChMaterialSurface::SMC);
+    ground->SetMaterialSurface(material);
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddBox(2, 0.1, 2, ChVector<>(0, -0.1, 0));
+    ground->GetCollisionModel()->BuildModel();
+    msystem.AddBody(ground);
+
+    // Shapes of different types, in layers, so that they collide while falling and settle on the ground.
+    for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < 5; j++) {
+            for (int k = 0; k < 2; k++) {
+                auto body = AddBody(msystem, material, ChVector<>(-1 + 0.45 * i, 0.15 + 0.22 * k, -1 + 0.45 * j));
+                switch ((i + 2 * j + 3 * k) % 5) {
+                    case 0:
+                        body->GetCollisionModel()->AddSphere(0.1);
+                        break;
+                    case 1:
+                        body->GetCollisionModel()->AddBox(0.08, 0.06, 0.1);
+                        break;
+                    case 2:
+                        body->GetCollisionModel()->AddCapsule(0.05, 0.06);
+                        break;
+                    case 3:
+                        body->GetCollisionModel()->AddCylinder(0.08, 0.06, 0.08);
+                        break;
+                    case 4:
+                        body->GetCollisionModel()->AddEllipsoid(0.1, 0.06, 0.08);
+                        break;
+                }
+                body->GetCollisionModel()->BuildModel();
+            }
+        }
+    }
+
+    // Pairs of spheres placed diagonally: their AABBs overlap, but their bounding spheres are separated.
+    for (int i = 0; i < 3; i++) {
+        ChVector<> pos(-1 + 0.9 * i, 1.5, 1.5);
+        auto body1 = AddBody(msystem, material, pos);
+        body1->GetCollisionModel()->AddSphere(0.1);
+        body1->GetCollisionModel()->BuildModel();
+        auto body2 = AddBody(msystem, material, pos + ChVector<>(0.18, 0.18, 0.18));
+        body2->GetCollisionModel()->AddSphere(0.1);
+        body2->GetCollisionModel()->BuildModel();
+    }
+
+    uint num_culled = 0;
+    contacts.clear();
+    for (int i = 0; i < 250; i++) {
+        msystem.DoStepDynamics(1e-3);
+
+        const host_container& host_data = msystem.data_manager->host_data;
+        uint num_contacts = msystem.data_manager->num_rigid_contacts;
+        Contacts step;
+        step.bids.assign(host_data.bids_rigid_rigid.begin(), host_data.bids_rigid_rigid.begin() + num_contacts);
+        step.norm.assign(host_data.norm_rigid_rigid.begin(), host_data.norm_rigid_rigid.begin() + num_contacts);
+        step.cpta.assign(host_data.cpta_rigid_rigid.begin(), host_data.cpta_rigid_rigid.begin() + num_contacts);
+        step.cptb.assign(host_data.cptb_rigid_rigid.begin(), host_data.cptb_rigid_rigid.begin() + num_contacts);
+        step.dpth.assign(host_data.dpth_rigid_rigid.begin(), host_data.dpth_rigid_rigid.begin() + num_contacts);
+        contacts.push_back(step);
+
+        num_culled += msystem.data_manager->measures.collision.number_of_pairs_culled;
+    }
+
+    return num_culled;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    NarrowPhaseType narrowphases[2] = {NarrowPhaseType::NARROWPHASE_MPR, NarrowPhaseType::NARROWPHASE_HYBRID_MPR};
+    const char* names[2] = {"MPR", "hybrid MPR"};
+
+    for (int n = 0; n < 2; n++) {
+        std::vector<Contacts> contacts;
+        std::vector<Contacts> contacts_batched;
+        uint culled = Simulate(narrowphases[n], false, contacts);
+        uint culled_batched = Simulate(narrowphases[n], true, contacts_batched);
+
+        uint max_contacts = 0;
+        bool equal = contacts.size() == contacts_batched.size();
+        for (size_t i = 0; equal && i < contacts.size(); i++) {
+            max_contacts = std::max(max_contacts, (uint)contacts[i].bids.size());
+            if (!Equal(contacts[i], contacts_batched[i])) {
+                printf("%s: contacts differ at step %d\n", names[n], (int)i);
+                equal = false;
+            }
+        }
+
+        printf("%s: max. contacts: %d  culled pairs without batching: %d  with batching: %d\n", names[n],
+               max_contacts, culled, culled_batched);
+
+        // The test is not vacuous only if there are contacts.
+        passed &= equal && max_contacts > 0;
+        passed &= culled == 0 && culled_batched > 0;
+    }
+
+    printf("Test %s\n", passed ? "PASSED" : "FAILED");
+
+    // Return 0 if the test passed.
+    return !passed;
+}
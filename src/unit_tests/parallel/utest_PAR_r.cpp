@@ -806,6 +806,304 @@ void test_roundedcyl_sphere() {
 
 // =============================================================================
 
+void test_ellipsoid_sphere() {
+    cout << "ellipsoid_sphere" << endl;
+
+    // Ellipsoid position and orientation fixed for all tests.
+    // Rotated by 90 degrees around Z axis (the ellipsoid X axis is along the global Y axis).
+    real3 e_hdims(1.0, 2.0, 3.0);
+    quaternion e_rot = ToQuaternion(Q_from_AngAxis(CH_C_PI_2, ChVector<>(0, 0, 1)));
+
+    ConvexShapeCustom* shapeE = new ConvexShapeCustom(ShapeType::ELLIPSOID, real3(0, 0, 0), e_rot, e_hdims);
+
+    // Sphere position changes for each test.
+    real s_rad = 0.5;  // sphere radius
+
+    ConvexShapeCustom* shapeS = new ConvexShapeCustom(ShapeType::SPHERE, real3(0, 0, 0), quaternion(1, 0, 0, 0),
+                                                      real3(s_rad, 0, 0));
+
+    // Output quantities.
+    real3 norm;
+    real3 pt1;
+    real3 pt2;
+    real depth;
+    real eff_rad;
+    int nC;
+
+    {
+        cout << "  sphere center inside ellipsoid" << endl;
+        shapeS->position = real3(0, 0.5, 0);
+        bool res = RCollision(shapeE, shapeS, 0, &norm, &pt1, &pt2, &depth, &eff_rad, nC);
+        if (res || nC != 0) {
+            cout << "    test failed" << endl;
+            exit(1);
+        }
+    }
+
+    {
+        cout << "  separated" << endl;
+        shapeS->position = real3(0, 3.0, 0);
+        bool res = RCollision(shapeE, shapeS, 0, &norm, &pt1, &pt2, &depth, &eff_rad, nC);
+        if (!res || nC != 0) {
+            cout << "    test failed" << endl;
+            exit(1);
+        }
+    }
+
+    {
+        cout << "  penetrated" << endl;
+        shapeS->position = real3(0, 1.4, 0);
+        bool res = RCollision(shapeE, shapeS, 0, &norm, &pt1, &pt2, &depth, &eff_rad, nC);
+        if (!res || nC != 1) {
+            cout << "    test failed" << endl;
+            exit(1);
+        }
+        WeakEqual(norm, real3(0, 1, 0), precision);
+        WeakEqual(depth, -0.1, precision);
+        WeakEqual(pt1, real3(0, 1, 0), precision);
+        WeakEqual(pt2, real3(0, 0.9, 0), precision);
+        WeakEqual(eff_rad, 6 * s_rad / (6 + s_rad), precision);
+    }
+
+    {
+        cout << "  penetrated (swapped shapes)" << endl;
+        shapeS->position = real3(0, 1.4, 0);
+        bool res = RCollision(shapeS, shapeE, 0, &norm, &pt1, &pt2, &depth, &eff_rad, nC);
+        if (!res || nC != 1) {
+            cout << "    test failed" << endl;
+            exit(1);
+        }
+        WeakEqual(norm, real3(0, -1, 0), precision);
+        WeakEqual(depth, -0.1, precision);
+        WeakEqual(pt1, real3(0, 0.9, 0), precision);
+        WeakEqual(pt2, real3(0, 1, 0), precision);
+    }
+
+    {
+        cout << "  off-axis (closest point on the surface)" << endl;
+        shapeS->position = real3(-1.0, 1.2, 0.5);
+        bool res = RCollision(shapeE, shapeS, 0, &norm, &pt1, &pt2, &depth, &eff_rad, nC);
+        if (!res || nC != 1) {
+            cout << "    test failed" << endl;
+            exit(1);
+        }
+        // The contact point is on the ellipsoid and the normal is along the ellipsoid gradient.
+        real3 loc = RotateT(pt1, e_rot);
+        WeakEqual(Dot(loc / e_hdims, loc / e_hdims), 1.0, precision);
+        real3 grad = Normalize(Rotate(loc / (e_hdims * e_hdims), e_rot));
+        WeakEqual(norm, grad, precision);
+        WeakEqual(pt2, shapeS->position - s_rad * norm, precision);
+    }
+
+    delete shapeS;
+    delete shapeE;
+}
+
+// =============================================================================
+
+void test_box_ellipsoid() {
+    cout << "box_ellipsoid" << endl;
+
+    // Box position and orientation fixed for all tests.
+    real3 b_hdims(2.0, 0.5, 2.0);
+
+    ConvexShapeCustom* shapeB =
+        new ConvexShapeCustom(ShapeType::BOX, real3(0, 0, 0), quaternion(1, 0, 0, 0), b_hdims);
+
+    // Ellipsoid position changes for each test.
+    // Rotated by 90 degrees around X axis (the ellipsoid Z axis is along the global -Y axis).
+    real3 e_hdims(0.3, 0.2, 0.4);
+    quaternion e_rot = ToQuaternion(Q_from_AngAxis(CH_C_PI_2, ChVector<>(1, 0, 0)));
+
+    ConvexShapeCustom* shapeE = new ConvexShapeCustom(ShapeType::ELLIPSOID, real3(0, 0, 0), e_rot, e_hdims);
+
+    // Output quantities.
+    real3 norm;
+    real3 pt1;
+    real3 pt2;
+    real depth;
+    real eff_rad;
+    int nC;
+
+    {
+        cout << "  face interaction (separated)" << endl;
+        shapeE->position = real3(0.5, 1.5, -0.3);
+        bool res = RCollision(shapeB, shapeE, 0.1, &norm, &pt1, &pt2, &depth, &eff_rad, nC);
+        if (!res || nC != 0) {
+            cout << "    test failed" << endl;
+            exit(1);
+        }
+    }
+
+    {
+        cout << "  face interaction (penetrated)" << endl;
+        shapeE->position = real3(0.5, 0.85, -0.3);
+        bool res = RCollision(shapeB, shapeE, 0.1, &norm, &pt1, &pt2, &depth, &eff_rad, nC);
+        if (!res || nC != 1) {
+            cout << "    test failed" << endl;
+            exit(1);
+        }
+        WeakEqual(norm, real3(0, 1, 0), precision);
+        WeakEqual(depth, -0.05, precision);
+        WeakEqual(pt1, real3(0.5, 0.5, -0.3), precision);
+        WeakEqual(pt2, real3(0.5, 0.45, -0.3), precision);
+        WeakEqual(eff_rad, 0.3 * 0.2 / 0.4, precision);
+    }
+
+    {
+        cout << "  face interaction (swapped shapes)" << endl;
+        shapeE->position = real3(0.5, 0.85, -0.3);
+        bool res = RCollision(shapeE, shapeB, 0.1, &norm, &pt1, &pt2, &depth, &eff_rad, nC);
+        if (!res || nC != 1) {
+            cout << "    test failed" << endl;
+            exit(1);
+        }
+        WeakEqual(norm, real3(0, -1, 0), precision);
+        WeakEqual(depth, -0.05, precision);
+        WeakEqual(pt1, real3(0.5, 0.45, -0.3), precision);
+        WeakEqual(pt2, real3(0.5, 0.5, -0.3), precision);
+    }
+
+    {
+        cout << "  edge interaction (not resolved)" << endl;
+        shapeE->position = real3(2.1, 0.6, 0);
+        bool res = RCollision(shapeB, shapeE, 0.1, &norm, &pt1, &pt2, &depth, &eff_rad, nC);
+        if (res || nC != 0) {
+            cout << "    test failed" << endl;
+            exit(1);
+        }
+    }
+
+    delete shapeE;
+    delete shapeB;
+}
+
+// =============================================================================
+
+void test_face_ellipsoid() {
+    cout << "face_ellipsoid" << endl;
+
+    // Triangular face in the XZ plane, with normal along the Y axis.
+    real3 A(0, 0, 0);
+    real3 B(0, 0, 1);
+    real3 C(1, 0, 0);
+
+    real3 e_hdims(0.1, 0.2, 0.1);
+    quaternion e_rot(1, 0, 0, 0);
+
+    // Output quantities.
+    real3 norm;
+    real3 pt1;
+    real3 pt2;
+    real depth;
+    real eff_rad;
+
+    {
+        cout << "  face interaction (penetrated)" << endl;
+        int nC = face_ellipsoid(A, B, C, real3(0.25, 0.19, 0.25), e_rot, e_hdims, 0, norm, depth, pt1, pt2, eff_rad);
+        StrictEqual(nC, 1);
+        WeakEqual(norm, real3(0, 1, 0), precision);
+        WeakEqual(depth, -0.01, precision);
+        WeakEqual(pt1, real3(0.25, 0, 0.25), precision);
+        WeakEqual(pt2, real3(0.25, -0.01, 0.25), precision);
+        WeakEqual(eff_rad, 0.1 * 0.1 / 0.2, precision);
+    }
+
+    {
+        cout << "  face interaction (separated)" << endl;
+        int nC = face_ellipsoid(A, B, C, real3(0.25, 0.5, 0.25), e_rot, e_hdims, 0.1, norm, depth, pt1, pt2, eff_rad);
+        StrictEqual(nC, 0);
+    }
+
+    {
+        cout << "  edge interaction (not resolved)" << endl;
+        int nC = face_ellipsoid(A, B, C, real3(0.8, 0.19, 0.8), e_rot, e_hdims, 0, norm, depth, pt1, pt2, eff_rad);
+        StrictEqual(nC, -1);
+    }
+}
+
+// =============================================================================
+
+void test_ellipsoid_ellipsoid() {
+    cout << "ellipsoid_ellipsoid" << endl;
+
+    // First ellipsoid fixed for all tests.
+    real3 e1_hdims(2.0, 1.0, 1.0);
+    quaternion e1_rot(1, 0, 0, 0);
+
+    // Second ellipsoid, aligned with the first one or rotated by 90 degrees around the Z axis.
+    real3 e2_hdims(1.0, 0.5, 0.5);
+    quaternion e2_rot(1, 0, 0, 0);
+    quaternion e2_rotZ = ToQuaternion(Q_from_AngAxis(CH_C_PI_2, ChVector<>(0, 0, 1)));
+
+    // Output quantities.
+    real3 norm;
+    real3 pt1;
+    real3 pt2;
+    real depth;
+    real eff_rad;
+
+    {
+        cout << "  separated" << endl;
+        int nC = ellipsoid_ellipsoid(real3(0, 0, 0), e1_rot, e1_hdims, real3(3.5, 0, 0), e2_rot, e2_hdims, 0, norm,
+                                     depth, pt1, pt2, eff_rad);
+        StrictEqual(nC, 0);
+    }
+
+    {
+        cout << "  separated (within separation distance)" << endl;
+        int nC = ellipsoid_ellipsoid(real3(0, 0, 0), e1_rot, e1_hdims, real3(3.5, 0, 0), e2_rot, e2_hdims, 1.0, norm,
+                                     depth, pt1, pt2, eff_rad);
+        StrictEqual(nC, 1);
+        WeakEqual(norm, real3(1, 0, 0), precision);
+        WeakEqual(depth, 0.5, precision);
+        WeakEqual(pt1, real3(2, 0, 0), precision);
+        WeakEqual(pt2, real3(2.5, 0, 0), precision);
+        WeakEqual(eff_rad, 0.5 * 0.25 / 0.75, precision);
+    }
+
+    {
+        cout << "  penetrated (rotated)" << endl;
+        int nC = ellipsoid_ellipsoid(real3(0, 0, 0), e1_rot, e1_hdims, real3(2.3, 0, 0), e2_rotZ, e2_hdims, 0, norm,
+                                     depth, pt1, pt2, eff_rad);
+        StrictEqual(nC, 1);
+        WeakEqual(norm, real3(1, 0, 0), precision);
+        WeakEqual(depth, -0.2, precision);
+        WeakEqual(pt1, real3(2, 0, 0), precision);
+        WeakEqual(pt2, real3(1.8, 0, 0), precision);
+    }
+
+    {
+        cout << "  penetrated (spheres, oblique)" << endl;
+        real3 pos2(0.8, 1.2, 0.16);
+        real3 dir = pos2 / Length(pos2);
+        int nC = ellipsoid_ellipsoid(real3(0, 0, 0), e1_rot, real3(1, 1, 1), pos2, e2_rotZ, real3(0.8, 0.8, 0.8), 0,
+                                     norm, depth, pt1, pt2, eff_rad);
+        StrictEqual(nC, 1);
+        WeakEqual(norm, dir, precision);
+        WeakEqual(depth, Length(pos2) - 1.8, precision);
+        WeakEqual(pt1, dir, precision);
+        WeakEqual(pt2, pos2 - 0.8 * dir, precision);
+        WeakEqual(eff_rad, 0.8 / 1.8, precision);
+    }
+
+    {
+        cout << "  coincident centers (not resolved)" << endl;
+        ConvexShapeCustom* shape1 = new ConvexShapeCustom(ShapeType::ELLIPSOID, real3(0, 0, 0), e1_rot, e1_hdims);
+        ConvexShapeCustom* shape2 = new ConvexShapeCustom(ShapeType::ELLIPSOID, real3(0, 0, 0), e2_rot, e2_hdims);
+        int nC;
+        bool res = RCollision(shape1, shape2, 0, &norm, &pt1, &pt2, &depth, &eff_rad, nC);
+        if (res || nC != 0) {
+            cout << "    test failed" << endl;
+            exit(1);
+        }
+        delete shape1;
+        delete shape2;
+    }
+}
+
+// =============================================================================
+
 int main() {
     // Utility functions
     test_snap_to_box();
@@ -818,6 +1116,10 @@ int main() {
     test_capsule_sphere();
     test_cylinder_sphere();
     test_roundedcyl_sphere();
+    test_ellipsoid_sphere();
+    test_box_ellipsoid();
+    test_face_ellipsoid();
+    test_ellipsoid_ellipsoid();
 
     cout << endl << "With separation distance" << endl;
     test_sphere_sphere(true);
@@ -0,0 +1,174 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// ChronoParallel unit test for the sweep and prune broadphase.
+// Spheres and boxes of very different sizes are dropped in a container, with
+// the grid and with the sweep and prune broadphase. At each step, the number of
+// candidate pairs reported by the broadphase must match the number of
+// overlapping shape AABBs, found by brute force. At the end, ray casts (which
+// use the AABB tree of the shapes with sweep and prune) must find the closest
+// hit among the ones found by casting against each body in turn.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// Count the pairs of shapes with overlapping AABBs that the broadphase must report.
+uint CountOverlaps(ChParallelDataManager* data_manager) {
+    const custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
+    const custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+    const custom_vector<short2>& fam = data_manager->shape_data.fam_rigid;
+    const custom_vector<uint>& id = data_manager->shape_data.id_rigid;
+    const custom_vector<char>& active = data_manager->host_data.active_rigid;
+    const custom_vector<char>& collide = data_manager->host_data.collide_rigid;
+
+    uint count = 0;
+    for (uint a = 0; a < data_manager->num_rigid_shapes; a++) {
+        for (uint b = a + 1; b < data_manager->num_rigid_shapes; b++) {
+            if (id[a] == id[b] || !collide[id[a]] || !collide[id[b]] || (!active[id[a]] && !active[id[b]]))
+                continue;
+            if (!((fam[a].y & fam[b].x) && (fam[b].y & fam[a].x)))
+                continue;
+            if (aabb_min[a].x <= aabb_max[b].x && aabb_min[b].x <= aabb_max[a].x && aabb_min[a].y <= aabb_max[b].y &&
+                aabb_min[b].y <= aabb_max[a].y && aabb_min[a].z <= aabb_max[b].z && aabb_min[b].z <= aabb_max[a].z)
+                count++;
+        }
+    }
+    return count;
+}
+
+// Drop the shapes with the given broadphase and check the number of candidate pairs at each step.
+// Return the maximum number of candidate pairs.
+bool Simulate(BroadPhaseType broadphase, uint& max_pairs) {
+    ChSystemParallelSMC msystem;
+    msystem.Set_G_acc(ChVector<>(0, -9.81, 0));
+    CHOMPfunctions::SetNumThreads(2);
+    msystem.GetSettings()->max_threads = 2;
+    msystem.GetSettings()->perform_thread_tuning = false;
+    msystem.GetSettings()->collision.bins_per_axis = vec3(10, 10, 10);
+    msystem.GetSettings()->collision.collision_envelope = 0.01;
+    msystem.GetSettings()->collision.broadphase_algorithm = broadphase;
+
+    auto material = std::make_shared<ChMaterialSurfaceSMC>();
+    material->SetYoungModulus(1e6f);
+    material->SetFriction(0.4f);
+
+    // Container: ground and 4 walls.
+    auto container = std::make_shared<ChBody>(std::make_shared<ChCollisionModelParallel>(), ChMaterialSurface::SMC);
+    container->SetMaterialSurface(material);
+    container->SetBodyFixed(true);
+    container->SetCollide(true);
+    container->GetCollisionModel()->ClearModel();
+    container->GetCollisionModel()->AddBox(2, 0.1, 2, ChVector<>(0, -0.1, 0));
+    container->GetCollisionModel()->AddBox(0.1, 1, 2, ChVector<>(-2.1, 1, 0));
+    container->GetCollisionModel()->AddBox(0.1, 1, 2, ChVector<>(2.1, 1, 0));
+    container->GetCollisionModel()->AddBox(2, 1, 0.1, ChVector<>(0, 1, -2.1));
+    container->GetCollisionModel()->AddBox(2, 1, 0.1, ChVector<>(0, 1, 2.1));
+    container->GetCollisionModel()->BuildModel();
+    msystem.AddBody(container);
+
+    // A large boulder among many small grains.
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            for (int k = 0; k < 3; k++) {
+                auto body =
+                    std::make_shared<ChBody>(std::make_shared<ChCollisionModelParallel>(), ChMaterialSurface::SMC);
+                body->SetMaterialSurface(material);
+                body->SetMass(1);
+                body->SetInertiaXX(ChVector<>(0.01, 0.01, 0.01));
+                body->SetPos(ChVector<>(-1.75 + 0.5 * i, 0.1 + 0.25 * k, -1.75 + 0.5 * j));
+                body->SetCollide(true);
+                body->GetCollisionModel()->ClearModel();
+                if ((i + j + k) % 2)
+                    body->GetCollisionModel()->AddSphere(0.1);
+                else
+                    body->GetCollisionModel()->AddBox(0.08, 0.05, 0.08);
+                body->GetCollisionModel()->BuildModel();
+                msystem.AddBody(body);
+            }
+        }
+    }
+
+    auto boulder = std::make_shared<ChBody>(std::make_shared<ChCollisionModelParallel>(), ChMaterialSurface::SMC);
+    boulder->SetMaterialSurface(material);
+    boulder->SetMass(100);
+    boulder->SetInertiaXX(ChVector<>(10, 10, 10));
+    boulder->SetPos(ChVector<>(0.2, 1.8, 0.1));
+    boulder->SetCollide(true);
+    boulder->GetCollisionModel()->ClearModel();
+    boulder->GetCollisionModel()->AddSphere(0.8);
+    boulder->GetCollisionModel()->BuildModel();
+    msystem.AddBody(boulder);
+
+    bool passed = true;
+    max_pairs = 0;
+    for (int i = 0; i < 200; i++) {
+        msystem.DoStepDynamics(1e-3);
+        uint pairs = msystem.data_manager->measures.collision.number_of_contacts_possible;
+        uint overlaps = CountOverlaps(msystem.data_manager);
+        if (pairs != overlaps) {
+            printf("Step %d: %d candidate pairs, %d AABB overlaps\n", i, pairs, overlaps);
+            passed = false;
+        }
+        max_pairs = std::max(max_pairs, pairs);
+    }
+
+    // Vertical rays through the container.
+    auto collision_system = msystem.GetCollisionSystem();
+    for (int i = 0; i < 9; i++) {
+        for (int j = 0; j < 9; j++) {
+            ChVector<> from(-1.9 + 0.475 * i, 3, -1.9 + 0.475 * j);
+            ChVector<> to = from - ChVector<>(0, 4, 0);
+            ChCollisionSystem::ChRayhitResult result;
+            bool hit = collision_system->RayHit(from, to, result);
+            double closest = 2;
+            for (auto body : *msystem.Get_bodylist()) {
+                ChCollisionSystem::ChRayhitResult body_result;
+                if (collision_system->RayHit(from, to, body->GetCollisionModel().get(), body_result))
+                    closest = std::min(closest, body_result.dist_factor);
+            }
+            if (hit != (closest <= 1) || (hit && std::abs(result.dist_factor - closest) > 1e-10)) {
+                printf("Ray %d %d: hit %d at %f, closest body hit at %f\n", i, j, hit, result.dist_factor, closest);
+                passed = false;
+            }
+        }
+    }
+
+    return passed;
+}
+
+int main(int argc, char* argv[]) {
+    uint max_pairs_grid;
+    uint max_pairs_sap;
+    bool passed_grid = Simulate(BroadPhaseType::BROADPHASE_GRID, max_pairs_grid);
+    bool passed_sap = Simulate(BroadPhaseType::BROADPHASE_SAP, max_pairs_sap);
+
+    printf("Max. candidate pairs with grid: %d  with sweep and prune: %d\n", max_pairs_grid, max_pairs_sap);
+
+    // The test is not vacuous only if the shapes interact.
+    bool passed = passed_grid && passed_sap && max_pairs_sap > 0;
+
+    printf("Test %s\n", passed ? "PASSED" : "FAILED");
+
+    // Return 0 if the test passed.
+    return !passed;
+}
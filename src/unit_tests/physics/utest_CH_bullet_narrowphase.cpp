@@ -0,0 +1,239 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the parallel narrow-phase of the Bullet collision system.
+// A pile of spheres, boxes, convex hulls, compound shapes and (GImpact) meshes
+// falls on a ground made of a box and a static triangle mesh.
+// At each step, the contacts are recomputed at the same configuration:
+// - the contacts found with the multithreaded narrow-phase must match those
+//   found with the legacy single-threaded narrow-phase;
+// - the sequence of reported contacts must not depend on the number of threads.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/collision/ChCCollisionSystemBullet.h"
+#include "chrono/collision/ChCModelBullet.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// ====================================================================================
+
+double time_step = 1e-2;  // integration step size
+int num_steps = 50;       // number of simulation steps
+double tol = 1e-12;       // tolerance for comparing contacts from legacy and parallel narrow-phase
+
+// Terrain mesh (the triangle shapes of a connected mesh reference its vertices, so it must outlive the model).
+geometry::ChTriangleMeshConnected terrain;
+
+// Contact data recorded during the narrow-phase.
+struct ContactData {
+    int idA;
+    int idB;
+    ChVector<> vpA;
+    ChVector<> vpB;
+    double distance;
+};
+
+bool operator<(const ContactData& a, const ContactData& b) {
+    if (a.idA != b.idA)
+        return a.idA < b.idA;
+    if (a.idB != b.idB)
+        return a.idB < b.idB;
+    for (int i = 0; i < 3; i++) {
+        if (a.vpA[i] != b.vpA[i])
+            return a.vpA[i] < b.vpA[i];
+    }
+    return a.distance < b.distance;
+}
+
+// Narrow-phase callback recording all contacts, with body identifiers in increasing order.
+class ContactRecorder : public ChCollisionSystem::NarrowphaseCallback {
+  public:
+    virtual void OnNarrowphase(ChCollisionInfo& cinfo) override {
+        ContactData data;
+        data.idA = cinfo.modelA->GetPhysicsItem()->GetIdentifier();
+        data.idB = cinfo.modelB->GetPhysicsItem()->GetIdentifier();
+        data.vpA = cinfo.vpA;
+        data.vpB = cinfo.vpB;
+        data.distance = cinfo.distance;
+        if (data.idA > data.idB) {
+            std::swap(data.idA, data.idB);
+            std::swap(data.vpA, data.vpB);
+        }
+        contacts.push_back(data);
+    }
+
+    std::vector<ContactData> contacts;
+};
+
+// Create a tetrahedron mesh with given size.
+geometry::ChTriangleMeshConnected CreateTetrahedron(double size) {
+    ChVector<> v0(-size, -size, -size);
+    ChVector<> v1(size, -size, size);
+    ChVector<> v2(-size, size, size);
+    ChVector<> v3(size, size, -size);
+    geometry::ChTriangleMeshConnected mesh;
+    mesh.addTriangle(v0, v2, v1);
+    mesh.addTriangle(v0, v1, v3);
+    mesh.addTriangle(v0, v3, v2);
+    mesh.addTriangle(v1, v2, v3);
+    return mesh;
+}
+
+// Create the ground (a box and a static triangle mesh) and the pile of bodies.
+void CreateModel(ChSystem& system) {
+    auto material = std::make_shared<ChMaterialSurfaceNSC>();
+    material->SetFriction(0.4f);
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetIdentifier(0);
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->SetMaterialSurface(material);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddBox(4, 0.5, 2, ChVector<>(-2, -0.5, 0));
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            double x0 = 0.5 * i, x1 = 0.5 * (i + 1);
+            double z0 = -2 + 0.5 * j, z1 = -2 + 0.5 * (j + 1);
+            double y00 = 0.05 * std::sin(x0 + z0), y10 = 0.05 * std::sin(x1 + z0);
+            double y01 = 0.05 * std::sin(x0 + z1), y11 = 0.05 * std::sin(x1 + z1);
+            terrain.addTriangle(ChVector<>(x0, y00, z0), ChVector<>(x0, y01, z1), ChVector<>(x1, y10, z0));
+            terrain.addTriangle(ChVector<>(x1, y10, z0), ChVector<>(x0, y01, z1), ChVector<>(x1, y11, z1));
+        }
+    }
+    ground->GetCollisionModel()->AddTriangleMesh(terrain, true, false);
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBody(ground);
+
+    std::vector<ChVector<double>> hull;
+    for (int i = 0; i < 8; i++)
+        hull.push_back(ChVector<>(0.4 * std::cos(0.8 * i), 0.3 * ((i % 3) - 1), 0.4 * std::sin(0.8 * i)));
+    auto tetrahedron = CreateTetrahedron(0.3);
+
+    int id = 1;
+    for (int ix = 0; ix < 6; ix++) {
+        for (int iy = 0; iy < 3; iy++) {
+            for (int iz = 0; iz < 4; iz++) {
+                auto body = std::make_shared<ChBody>();
+                body->SetIdentifier(id);
+                body->SetMass(1);
+                body->SetPos(ChVector<>(-2.9 + 0.95 * ix, 0.45 + 0.9 * iy, -1.4 + 0.9 * iz));
+                body->SetRot(Q_from_AngAxis(0.3 * id, ChVector<>(1, 1, 0).GetNormalized()));
+                body->SetCollide(true);
+                body->SetMaterialSurface(material);
+                body->GetCollisionModel()->ClearModel();
+                switch (id % 5) {
+                    case 0:
+                        body->GetCollisionModel()->AddSphere(0.45);
+                        break;
+                    case 1:
+                        body->GetCollisionModel()->AddBox(0.4, 0.3, 0.35);
+                        break;
+                    case 2:
+                        body->GetCollisionModel()->AddConvexHull(hull);
+                        break;
+                    case 3:
+                        body->GetCollisionModel()->AddSphere(0.25, ChVector<>(-0.2, 0, 0));
+                        body->GetCollisionModel()->AddSphere(0.25, ChVector<>(0.2, 0, 0));
+                        body->GetCollisionModel()->AddBox(0.1, 0.1, 0.4, ChVector<>(0, 0.2, 0));
+                        break;
+                    case 4:
+                        std::static_pointer_cast<ChModelBullet>(body->GetCollisionModel())
+                            ->AddTriangleMeshConcave(tetrahedron);
+                        break;
+                }
+                body->GetCollisionModel()->BuildModel();
+                system.AddBody(body);
+                id++;
+            }
+        }
+    }
+}
+
+// Compare two contact lists, within the given tolerance.
+bool CompareContacts(const std::vector<ContactData>& c1, const std::vector<ContactData>& c2, double tolerance) {
+    if (c1.size() != c2.size()) {
+        GetLog() << "   different number of contacts: " << (int)c1.size() << " and " << (int)c2.size() << "\n";
+        return false;
+    }
+    for (size_t i = 0; i < c1.size(); i++) {
+        if (c1[i].idA != c2[i].idA || c1[i].idB != c2[i].idB || (c1[i].vpA - c2[i].vpA).Length() > tolerance ||
+            (c1[i].vpB - c2[i].vpB).Length() > tolerance || std::abs(c1[i].distance - c2[i].distance) > tolerance) {
+            GetLog() << "   contact " << (int)i << " differs\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Recompute the contacts at the current configuration, with the given number of narrow-phase threads.
+// The persistent manifolds are cleared first, so that all contacts are generated anew.
+std::vector<ContactData> ComputeContacts(ChSystem& system, ContactRecorder& recorder, int nthreads) {
+    auto collision_system = std::dynamic_pointer_cast<ChCollisionSystemBullet>(system.GetCollisionSystem());
+    collision_system->SetNumThreads(nthreads);
+    btDispatcher* dispatcher = collision_system->GetBulletCollisionWorld()->getDispatcher();
+    for (int i = 0; i < dispatcher->getNumManifolds(); i++)
+        dispatcher->getManifoldByIndexInternal(i)->clearManifold();
+    recorder.contacts.clear();
+    system.ComputeCollisions();
+    return recorder.contacts;
+}
+
+// ====================================================================================
+
+int main(int argc, char* argv[]) {
+    ChSystemNSC system;
+    CreateModel(system);
+    ContactRecorder recorder;
+    system.GetCollisionSystem()->RegisterNarrowphaseCallback(&recorder);
+    auto collision_system = std::dynamic_pointer_cast<ChCollisionSystemBullet>(system.GetCollisionSystem());
+
+    bool same_contacts = true;
+    bool same_order = true;
+    size_t num_contacts = 0;
+    for (int i = 0; i < num_steps; i++) {
+        collision_system->SetNumThreads(4);
+        system.DoStepDynamics(time_step);
+
+        // Contacts from the legacy and from the parallel narrow-phase, at the same configuration.
+        auto contacts_legacy = ComputeContacts(system, recorder, 1);
+        auto contacts_4 = ComputeContacts(system, recorder, 4);
+        auto contacts_2 = ComputeContacts(system, recorder, 2);
+        num_contacts = contacts_legacy.size();
+
+        // The parallel narrow-phase reports contacts in the same order, independent of the number of threads.
+        same_order &= CompareContacts(contacts_2, contacts_4, 0);
+
+        std::sort(contacts_legacy.begin(), contacts_legacy.end());
+        std::sort(contacts_4.begin(), contacts_4.end());
+        same_contacts &= CompareContacts(contacts_legacy, contacts_4, tol);
+    }
+
+    GetLog() << "Contacts at last step: " << (int)num_contacts << "\n";
+    GetLog() << "   legacy vs. parallel: " << same_contacts << "  2 vs. 4 threads: " << same_order << "\n";
+    bool passed = num_contacts > 0 && same_contacts && same_order;
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
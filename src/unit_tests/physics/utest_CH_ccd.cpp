@@ -0,0 +1,108 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the continuous collision detection of fast bodies.
+// A small sphere is shot at a thin wall, moving by several times its diameter
+// at each step:
+// - without continuous collision detection, the sphere tunnels through the wall;
+// - with continuous collision detection, the sphere stays in front of the wall.
+// A second, slow sphere flagged for continuous collision detection must move
+// exactly as without it.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// Shoot a sphere at a thin wall (at x = 0) and return its final position, as well as the final
+// position of a slow sphere falling on the ground.
+void Simulate(bool ccd, ChVector<>& fast_pos, ChVector<>& slow_pos) {
+    double radius = 0.05;
+
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    ChCollisionModel::SetDefaultSuggestedEnvelope(0.01);
+    ChCollisionModel::SetDefaultSuggestedMargin(0.005);
+
+    auto material = std::make_shared<ChMaterialSurfaceNSC>();
+    material->SetFriction(0.2f);
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->SetMaterialSurface(material);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddBox(0.01, 2, 2, ChVector<>(0, 0, 0));
+    ground->GetCollisionModel()->AddBox(1, 0.1, 1, ChVector<>(-2, -0.1, 0));
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBody(ground);
+
+    auto fast = std::make_shared<ChBody>();
+    fast->SetMass(0.1);
+    fast->SetInertiaXX(ChVector<>(1e-4, 1e-4, 1e-4));
+    fast->SetPos(ChVector<>(-0.5, 1, 0));
+    fast->SetPos_dt(ChVector<>(200, 0, 0));
+    fast->SetCollide(true);
+    fast->SetMaterialSurface(material);
+    fast->GetCollisionModel()->ClearModel();
+    fast->GetCollisionModel()->AddSphere(radius);
+    fast->GetCollisionModel()->BuildModel();
+    fast->SetContinuousCollision(ccd);
+    fast->SetCcdRadius((float)radius);
+    system.AddBody(fast);
+
+    auto slow = std::make_shared<ChBody>();
+    slow->SetMass(0.1);
+    slow->SetInertiaXX(ChVector<>(1e-4, 1e-4, 1e-4));
+    slow->SetPos(ChVector<>(-2, 0.1, 0));
+    slow->SetCollide(true);
+    slow->SetMaterialSurface(material);
+    slow->GetCollisionModel()->ClearModel();
+    slow->GetCollisionModel()->AddSphere(radius);
+    slow->GetCollisionModel()->BuildModel();
+    slow->SetContinuousCollision(ccd);
+    slow->SetCcdRadius((float)radius);
+    system.AddBody(slow);
+
+    for (int i = 0; i < 20; i++) {
+        system.DoStepDynamics(1e-3);
+    }
+
+    fast_pos = fast->GetPos();
+    slow_pos = slow->GetPos();
+}
+
+int main(int argc, char* argv[]) {
+    ChVector<> fast_discrete, slow_discrete;
+    ChVector<> fast_ccd, slow_ccd;
+    Simulate(false, fast_discrete, slow_discrete);
+    Simulate(true, fast_ccd, slow_ccd);
+
+    GetLog() << "Fast sphere final x without CCD: " << fast_discrete.x() << "  with CCD: " << fast_ccd.x() << "\n";
+    GetLog() << "Slow sphere final y without CCD: " << slow_discrete.y() << "  with CCD: " << slow_ccd.y() << "\n";
+
+    // The test is not vacuous only if the sphere tunnels through the wall without CCD.
+    bool passed = fast_discrete.x() > 0.01;
+    passed = passed && fast_ccd.x() < -0.01;
+    passed = passed && (slow_ccd - slow_discrete).Length() < 1e-10;
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
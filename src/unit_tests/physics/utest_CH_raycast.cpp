@@ -0,0 +1,192 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the batched ray-hit and sphere-cast queries of the Bullet
+// collision system. A grid of vertical rays is cast on a scene of spheres,
+// boxes, compound shapes, (GImpact) meshes and a static triangle mesh:
+// - the batched queries (with 1 and 4 threads) must return the same results
+//   as the corresponding single queries;
+// - the hits on a sphere and on the ground box must match analytic results.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/collision/ChCCollisionSystemBullet.h"
+#include "chrono/collision/ChCModelBullet.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// ====================================================================================
+
+double envelope = 1e-3;  // collision envelope and margin
+double tol = 1e-2;       // tolerance for comparing with analytic results
+
+typedef ChCollisionSystem::ChRayhitResult RayhitResult;
+
+// Terrain mesh (the triangle shapes of a connected mesh reference its vertices, so it must outlive the model).
+geometry::ChTriangleMeshConnected terrain;
+
+// Create the ground (a box and a static triangle mesh) and a few bodies with different shapes.
+void CreateModel(ChSystem& system) {
+    auto material = std::make_shared<ChMaterialSurfaceNSC>();
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->SetMaterialSurface(material);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddBox(2, 0.5, 2, ChVector<>(-2, -0.5, 0));
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 8; j++) {
+            double x0 = 0.5 * i, x1 = 0.5 * (i + 1);
+            double z0 = -2 + 0.5 * j, z1 = -2 + 0.5 * (j + 1);
+            double y00 = 0.05 * std::sin(x0 + z0), y10 = 0.05 * std::sin(x1 + z0);
+            double y01 = 0.05 * std::sin(x0 + z1), y11 = 0.05 * std::sin(x1 + z1);
+            terrain.addTriangle(ChVector<>(x0, y00, z0), ChVector<>(x0, y01, z1), ChVector<>(x1, y10, z0));
+            terrain.addTriangle(ChVector<>(x1, y10, z0), ChVector<>(x0, y01, z1), ChVector<>(x1, y11, z1));
+        }
+    }
+    ground->GetCollisionModel()->AddTriangleMesh(terrain, true, false);
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBody(ground);
+
+    geometry::ChTriangleMeshConnected tetrahedron;
+    ChVector<> v0(-0.3, -0.3, -0.3);
+    ChVector<> v1(0.3, -0.3, 0.3);
+    ChVector<> v2(-0.3, 0.3, 0.3);
+    ChVector<> v3(0.3, 0.3, -0.3);
+    tetrahedron.addTriangle(v0, v2, v1);
+    tetrahedron.addTriangle(v0, v1, v3);
+    tetrahedron.addTriangle(v0, v3, v2);
+    tetrahedron.addTriangle(v1, v2, v3);
+
+    for (int id = 0; id < 8; id++) {
+        auto body = std::make_shared<ChBody>();
+        body->SetPos(ChVector<>(-3.5 + id, 0.6 + 0.1 * id, 1.0 - 0.3 * id));
+        body->SetRot(Q_from_AngAxis(0.3 * id, ChVector<>(1, 1, 0).GetNormalized()));
+        body->SetCollide(true);
+        body->SetMaterialSurface(material);
+        body->GetCollisionModel()->ClearModel();
+        switch (id % 4) {
+            case 0:
+                body->GetCollisionModel()->AddSphere(0.45);
+                break;
+            case 1:
+                body->GetCollisionModel()->AddBox(0.4, 0.3, 0.35);
+                break;
+            case 2:
+                body->GetCollisionModel()->AddSphere(0.25, ChVector<>(-0.2, 0, 0));
+                body->GetCollisionModel()->AddBox(0.1, 0.1, 0.4, ChVector<>(0.2, 0, 0));
+                break;
+            case 3:
+                std::static_pointer_cast<ChModelBullet>(body->GetCollisionModel())->AddTriangleMeshConcave(tetrahedron);
+                break;
+        }
+        body->GetCollisionModel()->BuildModel();
+        system.AddBody(body);
+    }
+}
+
+// Compare two lists of query results (exactly).
+bool CompareResults(const std::vector<RayhitResult>& r1, const std::vector<RayhitResult>& r2) {
+    if (r1.size() != r2.size())
+        return false;
+    for (size_t i = 0; i < r1.size(); i++) {
+        if (r1[i].hit != r2[i].hit)
+            return false;
+        if (!r1[i].hit)
+            continue;
+        if (r1[i].hitModel != r2[i].hitModel || r1[i].dist_factor != r2[i].dist_factor ||
+            r1[i].abs_hitPoint != r2[i].abs_hitPoint || r1[i].abs_hitNormal != r2[i].abs_hitNormal)
+            return false;
+    }
+    return true;
+}
+
+// ====================================================================================
+
+int main(int argc, char* argv[]) {
+    // The system constructor sets the default envelope: change it afterwards.
+    ChSystemNSC system;
+    ChCollisionModel::SetDefaultSuggestedEnvelope(envelope);
+    ChCollisionModel::SetDefaultSuggestedMargin(envelope);
+
+    CreateModel(system);
+    system.ComputeCollisions();
+    auto collision_system = std::dynamic_pointer_cast<ChCollisionSystemBullet>(system.GetCollisionSystem());
+
+    // Grid of vertical rays, from y = 3 to y = -2.
+    std::vector<ChVector<>> from;
+    std::vector<ChVector<>> to;
+    for (int i = 0; i < 80; i++) {
+        for (int j = 0; j < 40; j++) {
+            double x = -3.95 + 0.1 * i;
+            double z = -1.95 + 0.1 * j;
+            from.push_back(ChVector<>(x, 3, z));
+            to.push_back(ChVector<>(x, -2, z));
+        }
+    }
+    int num_rays = (int)from.size();
+
+    // Single queries.
+    std::vector<RayhitResult> rays(num_rays);
+    std::vector<RayhitResult> spheres(num_rays);
+    int num_hits = 0;
+    for (int i = 0; i < num_rays; i++) {
+        collision_system->RayHit(from[i], to[i], rays[i]);
+        collision_system->SphereCast(from[i], to[i], 0.1, spheres[i]);
+        num_hits += rays[i].hit;
+    }
+
+    // Batched queries, with 1 and 4 threads.
+    bool same_rays = true;
+    bool same_spheres = true;
+    for (int nthreads = 1; nthreads <= 4; nthreads += 3) {
+        collision_system->SetNumThreads(nthreads);
+        std::vector<RayhitResult> batch_rays;
+        std::vector<RayhitResult> batch_spheres;
+        collision_system->BatchRayHit(from, to, batch_rays);
+        collision_system->BatchSphereCast(from, to, 0.1, batch_spheres);
+        same_rays &= CompareResults(rays, batch_rays);
+        same_spheres &= CompareResults(spheres, batch_spheres);
+    }
+
+    GetLog() << "Rays: " << num_rays << "  hits: " << num_hits << "\n";
+    GetLog() << "   single vs. batch rays: " << same_rays << "  sphere casts: " << same_spheres << "\n";
+
+    // Ray through the center of the first sphere (at (-3.5, 0.6, 1.0), radius 0.45).
+    RayhitResult result;
+    bool analytic = collision_system->RayHit(ChVector<>(-3.5, 3, 1.0), ChVector<>(-3.5, -2, 1.0), result);
+    analytic = analytic && std::abs(result.abs_hitPoint.y() - 1.05) < tol;
+    analytic = analytic && std::abs(result.dist_factor - (3 - 1.05) / 5) < tol;
+    analytic = analytic && (result.abs_hitNormal - ChVector<>(0, 1, 0)).Length() < tol;
+
+    // Sphere cast on the ground box (top face at y = 0), away from the other bodies.
+    analytic = analytic && collision_system->SphereCast(ChVector<>(-1.2, 3, -1.5), ChVector<>(-1.2, -2, -1.5), 0.2, result);
+    analytic = analytic && std::abs(result.abs_hitPoint.y()) < tol;
+    analytic = analytic && std::abs(result.dist_factor - (3 - 0.2) / 5) < tol;
+    analytic = analytic && (result.abs_hitNormal - ChVector<>(0, 1, 0)).Length() < tol;
+    GetLog() << "   analytic results: " << analytic << "\n";
+
+    bool passed = num_hits > 0 && same_rays && same_spheres && analytic;
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,182 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for signed distance field collision shapes.
+// - the field built from a box mesh must match the analytic signed distance
+//   of the box within the band, and be preserved by a save/load cycle;
+// - a sphere and a box dropped on a ground described by the field must come
+//   to rest on its top face (Bullet collision system).
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "chrono/collision/ChCSignedDistanceField.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// ====================================================================================
+
+ChVector<> hdims(1.5, 1.0, 1.25);  // half-dimensions of the box
+double spacing = 0.05;             // grid spacing
+double band = 0.4;                 // band half-width
+
+// Create a closed box mesh (outward normals).
+geometry::ChTriangleMeshConnected CreateBoxMesh(const ChVector<>& h) {
+    ChVector<> v[8];
+    for (int i = 0; i < 8; i++)
+        v[i] = ChVector<>((i & 1) ? h.x() : -h.x(), (i & 2) ? h.y() : -h.y(), (i & 4) ? h.z() : -h.z());
+    int faces[12][3] = {{0, 4, 6}, {0, 6, 2}, {1, 3, 7}, {1, 7, 5}, {0, 1, 5}, {0, 5, 4},
+                        {2, 6, 7}, {2, 7, 3}, {0, 2, 3}, {0, 3, 1}, {4, 5, 7}, {4, 7, 6}};
+    geometry::ChTriangleMeshConnected mesh;
+    for (auto& f : faces)
+        mesh.addTriangle(v[f[0]], v[f[1]], v[f[2]]);
+    return mesh;
+}
+
+// Analytic signed distance of the box.
+double BoxDistance(const ChVector<>& p, const ChVector<>& h) {
+    ChVector<> q(std::abs(p.x()) - h.x(), std::abs(p.y()) - h.y(), std::abs(p.z()) - h.z());
+    ChVector<> qp(std::max(q.x(), 0.0), std::max(q.y(), 0.0), std::max(q.z(), 0.0));
+    return qp.Length() + std::min(std::max(q.x(), std::max(q.y(), q.z())), 0.0);
+}
+
+// Compare the field with the analytic distance.
+bool CheckAccuracy(const ChSignedDistanceField& sdf) {
+    double max_err = 0;
+    int num_points = 0;
+    ChVector<> ext = hdims + ChVector<>(band);
+    for (double x = -ext.x(); x <= ext.x(); x += 0.037) {
+        for (double y = -ext.y(); y <= ext.y(); y += 0.037) {
+            for (double z = -ext.z(); z <= ext.z(); z += 0.037) {
+                ChVector<> p(x, y, z);
+                double exact = BoxDistance(p, hdims);
+                if (std::abs(exact) > band - 2 * spacing)
+                    continue;
+                max_err = std::max(max_err, std::abs(sdf.GetDistance(p) - exact));
+                num_points++;
+            }
+        }
+    }
+
+    // Gradient above the top face and distance far from the surface.
+    ChVector<> gradient;
+    double dist_top = sdf.GetDistance(ChVector<>(0.3, hdims.y() + 0.1, -0.2), &gradient);
+    double dist_in = sdf.GetDistance(ChVector<>(0, 0, 0));
+    double dist_out = sdf.GetDistance(ChVector<>(10, 0, 0));
+
+    GetLog() << "Sampled blocks: " << sdf.GetNumSampledBlocks() << " / " << sdf.GetNumBlocks() << "\n";
+    GetLog() << "   points: " << num_points << "  max error: " << max_err << "\n";
+    GetLog() << "   top face: " << dist_top << "  gradient: " << gradient << "\n";
+    GetLog() << "   center: " << dist_in << "  far: " << dist_out << "\n";
+
+    return sdf.GetNumSampledBlocks() < sdf.GetNumBlocks() && max_err < 0.5 * spacing &&
+           std::abs(dist_top - 0.1) < 1e-6 && (gradient - ChVector<>(0, 1, 0)).Length() < 1e-6 &&
+           dist_in == -band && dist_out == band;
+}
+
+// Check that a save/load cycle preserves the field.
+bool CheckSaveLoad(const ChSignedDistanceField& sdf) {
+    std::string filename = "utest_CH_sdf_collision.sdf";
+    ChSignedDistanceField sdf_loaded;
+    bool passed = sdf.Save(filename) && sdf_loaded.Load(filename);
+    std::remove(filename.c_str());
+    if (!passed)
+        return false;
+
+    ChVector<> ext = hdims + ChVector<>(band);
+    for (double x = -ext.x(); x <= ext.x(); x += 0.11) {
+        for (double y = -ext.y(); y <= ext.y(); y += 0.11) {
+            for (double z = -ext.z(); z <= ext.z(); z += 0.11) {
+                ChVector<> p(x, y, z);
+                passed &= sdf.GetDistance(p) == sdf_loaded.GetDistance(p);
+            }
+        }
+    }
+    GetLog() << "Save/load: " << passed << "\n";
+    return passed && sdf_loaded.GetNumSampledBlocks() == sdf.GetNumSampledBlocks();
+}
+
+// Drop a sphere and a box on the field and check their final heights.
+bool CheckContact(std::shared_ptr<ChSignedDistanceField> sdf) {
+    ChSystemNSC system;
+    auto material = std::make_shared<ChMaterialSurfaceNSC>();
+    material->SetFriction(0.4f);
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->SetMaterialSurface(material);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddSignedDistanceField(sdf);
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBody(ground);
+
+    double radius = 0.2;
+    auto sphere = std::make_shared<ChBody>();
+    sphere->SetInertiaXX(ChVector<>(0.4 * radius * radius));
+    sphere->SetPos(ChVector<>(0.5, hdims.y() + radius + 0.1, 0.3));
+    sphere->SetCollide(true);
+    sphere->SetMaterialSurface(material);
+    sphere->GetCollisionModel()->ClearModel();
+    sphere->GetCollisionModel()->AddSphere(radius);
+    sphere->GetCollisionModel()->BuildModel();
+    system.AddBody(sphere);
+
+    ChVector<> box_hdims(0.15, 0.1, 0.2);
+    auto box = std::make_shared<ChBody>();
+    box->SetInertiaXX(ChVector<>(box_hdims.y() * box_hdims.y() + box_hdims.z() * box_hdims.z(),
+                                 box_hdims.x() * box_hdims.x() + box_hdims.z() * box_hdims.z(),
+                                 box_hdims.x() * box_hdims.x() + box_hdims.y() * box_hdims.y()) /
+                      3);
+    box->SetPos(ChVector<>(-0.5, hdims.y() + box_hdims.y() + 0.1, -0.2));
+    box->SetCollide(true);
+    box->SetMaterialSurface(material);
+    box->GetCollisionModel()->ClearModel();
+    box->GetCollisionModel()->AddBox(box_hdims.x(), box_hdims.y(), box_hdims.z());
+    box->GetCollisionModel()->BuildModel();
+    system.AddBody(box);
+
+    while (system.GetChTime() < 1)
+        system.DoStepDynamics(1e-3);
+
+    GetLog() << "Sphere position: " << sphere->GetPos() << "\n";
+    GetLog() << "Box position:    " << box->GetPos() << "\n";
+    GetLog() << "Contacts: " << system.GetNcontacts() << "\n";
+
+    return std::abs(sphere->GetPos().y() - (hdims.y() + radius)) < 1e-2 &&
+           std::abs(box->GetPos().y() - (hdims.y() + box_hdims.y())) < 1e-2 && sphere->GetPos_dt().Length() < 1e-2 &&
+           box->GetPos_dt().Length() < 1e-2;
+}
+
+// ====================================================================================
+
+int main(int argc, char* argv[]) {
+    auto sdf = std::make_shared<ChSignedDistanceField>();
+    bool passed = sdf->Build(CreateBoxMesh(hdims), spacing, band);
+
+    passed &= CheckAccuracy(*sdf);
+    passed &= CheckSaveLoad(*sdf);
+    passed &= CheckContact(sdf);
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
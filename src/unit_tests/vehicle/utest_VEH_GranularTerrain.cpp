@@ -0,0 +1,125 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the moving patch feature of GranularTerrain.
+// The moving patch is enabled either before or after the terrain is initialized
+// (the order used in the vehicle demos).  In both cases, the particles recycled
+// at the front of the patch must be placed in the relocation volume, above the
+// bottom boundary, and must not overlap each other.  They must also form a
+// settled bed: each one rests either on the lowest level above the bottom
+// boundary or on another recycled particle below it.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/terrain/GranularTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const int start_id = 1000000;
+const double length = 1.0;
+const double width = 0.4;
+const double radius = 0.02;
+const double shift = 0.2;
+const double contact_radius = 1.001 * radius;  // particle radius used when building the relocation bed
+const double bed_floor = 3 * contact_radius;       // height of the lowest particles above the bottom boundary
+
+bool TestMovingPatch(bool enable_before_init) {
+    GetLog() << "Enable moving patch " << (enable_before_init ? "before" : "after") << " Initialize\n";
+
+    ChSystemNSC system;
+
+    // Monitored body, placed within the look-ahead distance of the front boundary.
+    auto body = std::make_shared<ChBody>();
+    body->SetPos(ChVector<>(0.4, 0, 0.5));
+    body->SetBodyFixed(true);
+    system.AddBody(body);
+
+    GranularTerrain terrain(&system);
+    terrain.SetStartIdentifier(start_id);
+    if (enable_before_init)
+        terrain.EnableMovingPatch(body, 0.5, shift);
+    terrain.Initialize(ChVector<>(0, 0, 0), length, width, 3, radius, 2000);
+    if (!enable_before_init)
+        terrain.EnableMovingPatch(body, 0.5, shift);
+
+    double front = terrain.GetPatchFront();
+    double bottom = terrain.GetPatchBottom();
+
+    // Move the patch once.
+    terrain.Synchronize(0);
+    if (!terrain.PatchMoved()) {
+        GetLog() << "  Patch was not moved\n";
+        return false;
+    }
+
+    // Collect the relocated particles (all particles beyond the old front boundary).
+    std::vector<ChVector<>> moved;
+    for (auto b : *system.Get_bodylist()) {
+        if (b->GetIdentifier() <= start_id)
+            continue;
+        const ChVector<>& pos = b->GetPos();
+        if (pos.x() > front)
+            moved.push_back(pos);
+    }
+    GetLog() << "  Relocated " << (int)moved.size() << " particles\n";
+    if (moved.empty()) {
+        GetLog() << "  No particle was relocated\n";
+        return false;
+    }
+
+    for (size_t i = 0; i < moved.size(); i++) {
+        const ChVector<>& p = moved[i];
+        if (p.x() - radius < front || p.x() + radius > front + shift + 1e-10) {
+            GetLog() << "  Particle outside relocation volume (x = " << p.x() << ")\n";
+            return false;
+        }
+        if (p.z() - radius < bottom + radius) {
+            GetLog() << "  Particle too close to bottom boundary (z = " << p.z() << ")\n";
+            return false;
+        }
+        bool supported = p.z() < bottom + bed_floor + 1e-9;
+        for (size_t j = 0; j < moved.size(); j++) {
+            if (j == i)
+                continue;
+            double dist = (moved[j] - p).Length();
+            if (dist < 2 * radius) {
+                GetLog() << "  Overlapping relocated particles " << (int)i << " and " << (int)j << "\n";
+                return false;
+            }
+            if (moved[j].z() < p.z() && dist < 2 * contact_radius + 1e-9)
+                supported = true;
+        }
+        if (!supported) {
+            GetLog() << "  Relocated particle " << (int)i << " not resting on the bed (z = " << p.z() << ")\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    passed &= TestMovingPatch(true);
+    passed &= TestMovingPatch(false);
+
+    GetLog() << (passed ? "PASSED\n" : "FAILED\n");
+    return passed ? 0 : 1;
+}
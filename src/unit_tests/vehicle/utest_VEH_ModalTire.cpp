@@ -0,0 +1,189 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the reduced-order modal tire.
+// - a modal basis is extracted from a coarse ANCF toroidal tire, with and
+//   without inflation pressure, and checked for consistency
+// - the basis is written to file, read back, and compared
+// - a ChModalTire using this basis is pressed onto flat terrain and must
+//   produce a supporting force, which vanishes when the wheel is lifted
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/FlatTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ANCFToroidalTire.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChModalTire.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChModalTireBasis.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const int num_modes = 4;
+const double wheel_height = 1.0;
+
+// Extract the modal basis of a coarse ANCF toroidal tire mounted on a fixed wheel.
+std::shared_ptr<ChModalTireBasis> ExtractBasis(bool pressure) {
+    ChSystemSMC system;
+
+    auto wheel = std::shared_ptr<ChBody>(system.NewBody());
+    wheel->SetPos(ChVector<>(0, 0, wheel_height));
+    wheel->SetBodyFixed(true);
+    system.AddBody(wheel);
+
+    ANCFToroidalTire tire("tire");
+    tire.SetDivCircumference(12);
+    tire.SetDivWidth(4);
+    tire.EnablePressure(pressure);
+    tire.EnableContact(false);
+    tire.Initialize(wheel, LEFT);
+    system.SetupInitial();
+
+    auto basis = std::make_shared<ChModalTireBasis>();
+    if (!basis->Compute(tire, num_modes))
+        return nullptr;
+
+    return basis;
+}
+
+bool CheckBasis(std::shared_ptr<ChModalTireBasis> basis) {
+    if (!basis) {
+        GetLog() << "  Modal basis extraction failed\n";
+        return false;
+    }
+    if (basis->GetNumModes() != num_modes || basis->GetNumNodes() != 12 * 5) {
+        GetLog() << "  Incorrect basis size: " << basis->GetNumModes() << " modes, " << basis->GetNumNodes()
+                 << " nodes\n";
+        return false;
+    }
+    for (int j = 0; j < num_modes; j++) {
+        GetLog() << "  Mode " << j << "  frequency [Hz] = " << basis->GetFrequency(j) / CH_C_2PI << "\n";
+        if (basis->GetFrequency(j) <= 0 || (j > 0 && basis->GetFrequency(j) < basis->GetFrequency(j - 1))) {
+            GetLog() << "  Frequencies not positive and increasing\n";
+            return false;
+        }
+    }
+    if (basis->GetMass() <= 0 || std::abs(basis->GetRadius() - (0.35 + 0.195)) > 1e-6) {
+        GetLog() << "  Incorrect mass or radius: " << basis->GetMass() << " " << basis->GetRadius() << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool CompareBases(const ChModalTireBasis& b1, const ChModalTireBasis& b2) {
+    if (b1.GetNumModes() != b2.GetNumModes() || b1.GetNumNodes() != b2.GetNumNodes())
+        return false;
+    if (b1.GetMass() != b2.GetMass() || b1.GetRadius() != b2.GetRadius() || b1.GetWidth() != b2.GetWidth())
+        return false;
+    for (int j = 0; j < b1.GetNumModes(); j++) {
+        if (b1.GetFrequency(j) != b2.GetFrequency(j))
+            return false;
+    }
+    for (int i = 0; i < b1.GetNumNodes(); i++) {
+        if (b1.GetNodePosition(i) != b2.GetNodePosition(i))
+            return false;
+        for (int j = 0; j < b1.GetNumModes(); j++) {
+            if (b1.GetModeShape(j, i) != b2.GetModeShape(j, i))
+                return false;
+        }
+    }
+    return true;
+}
+
+bool TestModalTire(std::shared_ptr<ChModalTireBasis> basis) {
+    ChSystemSMC system;
+    auto wheel = std::shared_ptr<ChBody>(system.NewBody());
+    system.AddBody(wheel);
+
+    ChModalTire tire("modal_tire");
+    tire.SetModalBasis(basis);
+    tire.Initialize(wheel, LEFT);
+
+    FlatTerrain terrain(0);
+    double radius = tire.GetRadius();
+
+    WheelState state;
+    state.rot = QUNIT;
+    state.lin_vel = ChVector<>(0, 0, 0);
+    state.ang_vel = ChVector<>(0, 0, 0);
+    state.omega = 0;
+
+    // Wheel lifted above the terrain: no contact.
+    state.pos = ChVector<>(0, 0, radius + 0.05);
+    tire.Synchronize(0, state, terrain);
+    if (tire.GetNumContactNodes() != 0 || tire.GetTireForce().force.Length() != 0) {
+        GetLog() << "  Unexpected contact force with lifted wheel\n";
+        return false;
+    }
+
+    // Wheel pressed into the terrain: the tire must settle with a supporting vertical force.
+    state.pos = ChVector<>(0, 0, radius - 0.01);
+    double step = 1e-3;
+    for (int i = 0; i < 500; i++) {
+        tire.Synchronize(i * step, state, terrain);
+        tire.Advance(step);
+    }
+    tire.Synchronize(500 * step, state, terrain);
+    TerrainForce force = tire.GetTireForce();
+    GetLog() << "  Contact nodes: " << tire.GetNumContactNodes() << "  vertical force: " << force.force.z()
+             << "  deflection: " << tire.GetDeflection() << "\n";
+    if (tire.GetNumContactNodes() == 0 || force.force.z() <= 0) {
+        GetLog() << "  No supporting force with wheel pressed into terrain\n";
+        return false;
+    }
+    for (double q : tire.GetModalCoordinates()) {
+        if (!std::isfinite(q)) {
+            GetLog() << "  Modal coordinates diverged\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    GetLog() << "Modal basis (inflated tire)\n";
+    auto basis = ExtractBasis(true);
+    if (!CheckBasis(basis))
+        return 1;
+
+    GetLog() << "Modal basis (no pressure)\n";
+    auto basis0 = ExtractBasis(false);
+    if (!CheckBasis(basis0))
+        return 1;
+
+    // The pressure load stiffness must change the modal frequencies.
+    if (std::abs(basis->GetFrequency(0) - basis0->GetFrequency(0)) < 1e-3 * basis0->GetFrequency(0)) {
+        GetLog() << "Pressure load stiffness not accounted for\n";
+        return 1;
+    }
+
+    GetLog() << "Write / read modal basis\n";
+    ChModalTireBasis basis_read;
+    if (!basis->Write("modal_tire_basis.txt") || !basis_read.Read("modal_tire_basis.txt") ||
+        !CompareBases(*basis, basis_read)) {
+        GetLog() << "  Basis read from file differs\n";
+        return 1;
+    }
+
+    GetLog() << "Modal tire on flat terrain\n";
+    if (!TestModalTire(basis))
+        return 1;
+
+    GetLog() << "PASSED\n";
+    return 0;
+}
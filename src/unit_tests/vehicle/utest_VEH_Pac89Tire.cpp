@@ -0,0 +1,124 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the batched evaluation of the PAC89 tire.
+// Two identical sets of tires, with different loads, slips, and camber angles
+// (one of them off the ground), are advanced over several steps, one set with
+// ChPac89Tire::Advance on each tire and the other with ChPac89Tire::AdvanceBatch.
+// The tire forces and moments must match, with exact coefficient evaluation
+// (the default) and with coefficient binning.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/terrain/FlatTerrain.h"
+
+#include "chrono_models/vehicle/hmmwv/HMMWV_Pac89Tire.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+const int num_tires = 6;
+const double radius = 0.326;     // unloaded radius of the HMMWV PAC89 tire
+const double tolerance = 1e-10;  // relative tolerance on forces and moments
+
+// State of the wheel of the given tire at the given step.
+WheelState GetWheelState(int tire, int step) {
+    double depth = 0.01 + 0.004 * tire + 0.001 * step;
+    double camber = (tire - 2) * 0.5 * CH_C_DEG_TO_RAD;
+    double speed = 5 + tire;
+    double slip = 0.02 * (tire - 3) + 0.005 * step;
+
+    WheelState state;
+    state.pos = ChVector<>(0, 0, (tire == num_tires - 1) ? radius + 0.1 : radius - depth);
+    state.rot = Q_from_AngX(camber);
+    state.lin_vel = ChVector<>(speed, 0.1 * (tire - 2) + 0.02 * step, 0);
+    state.ang_vel = ChVector<>(0, 0, 0);
+    state.omega = speed * (1 + slip) / (radius - depth);
+    return state;
+}
+
+bool Compare(const ChVector<>& v1, const ChVector<>& v2) {
+    return (v1 - v2).Length() <= tolerance * (1 + v1.Length());
+}
+
+bool TestBatch(double Fz_bin, double gamma_bin) {
+    ChSystemNSC system;
+    FlatTerrain terrain(0);
+
+    std::vector<std::shared_ptr<ChPac89Tire>> tires;
+    std::vector<std::shared_ptr<ChPac89Tire>> tires_batch;
+    std::vector<ChPac89Tire*> batch;
+    for (int i = 0; i < 2 * num_tires; i++) {
+        auto wheel = std::shared_ptr<ChBody>(system.NewBody());
+        system.AddBody(wheel);
+        auto tire = std::make_shared<HMMWV_Pac89Tire>("tire");
+        tire->Initialize(wheel, LEFT);
+        if (Fz_bin > 0 || gamma_bin > 0)
+            tire->SetCoefficientBins(Fz_bin, gamma_bin);
+        if (i < num_tires) {
+            tires.push_back(tire);
+        } else {
+            tires_batch.push_back(tire);
+            batch.push_back(tire.get());
+        }
+    }
+
+    ChPac89Tire::BatchWorkspace work;
+    int num_contacts = 0;
+
+    for (int step = 0; step < 5; step++) {
+        double time = step * 1e-3;
+        for (int i = 0; i < num_tires; i++) {
+            WheelState state = GetWheelState(i, step);
+            tires[i]->Synchronize(time, state, terrain);
+            tires_batch[i]->Synchronize(time, state, terrain);
+        }
+
+        for (int i = 0; i < num_tires; i++)
+            tires[i]->Advance(1e-3);
+        ChPac89Tire::AdvanceBatch(batch, work);
+
+        for (int i = 0; i < num_tires; i++) {
+            TerrainForce force = tires[i]->GetTireForce();
+            TerrainForce force_batch = tires_batch[i]->GetTireForce();
+            if (!Compare(force.force, force_batch.force) || !Compare(force.moment, force_batch.moment)) {
+                GetLog() << "  Tire " << i << " step " << step << ": batched force " << force_batch.force
+                         << " moment " << force_batch.moment << " differ from " << force.force << " "
+                         << force.moment << "\n";
+                return false;
+            }
+            if (force.force.Length() > 0)
+                num_contacts++;
+        }
+    }
+
+    // The test is not vacuous only if the tires in contact produce forces.
+    GetLog() << "  Bins (" << Fz_bin << ", " << gamma_bin << "): " << num_contacts << " tire forces compared\n";
+    return num_contacts == 5 * (num_tires - 1);
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    passed &= TestBatch(0, 0);
+    passed &= TestBatch(0.01, 0.01);
+
+    GetLog() << (passed ? "PASSED\n" : "FAILED\n");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the real-time stepping mode of ChVehicle.
+// A minimal vehicle (a pendulum on the ground) is advanced with deadlines that
+// cannot be met (1 ns) and that are always met (1000 s), so that the expected
+// adaptation of the solver iterations does not depend on the machine speed:
+// - with the impossible deadline, every call overruns and the solver
+//   iterations drop to the minimum;
+// - with the generous deadline, there are no overruns and the iterations grow
+//   back to the nominal values, by at most 25% per call;
+// - disabling the real-time mode restores the nominal iteration counts.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystem.h"
+
+#include "chrono_vehicle/ChVehicle.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const int min_iterations = 5;
+
+// Minimal vehicle: a pendulum connected to the ground through a revolute joint, so that the solver runs at
+// each step.
+class TestVehicle : public ChVehicle {
+  public:
+    TestVehicle() : ChVehicle("test_vehicle") {
+        auto ground = std::shared_ptr<ChBody>(m_system->NewBody());
+        ground->SetBodyFixed(true);
+        m_system->AddBody(ground);
+
+        auto pendulum = std::shared_ptr<ChBody>(m_system->NewBody());
+        pendulum->SetPos(ChVector<>(1, 0, 0));
+        m_system->AddBody(pendulum);
+
+        auto revolute = std::make_shared<ChLinkLockRevolute>();
+        revolute->Initialize(ground, pendulum, ChCoordsys<>(ChVector<>(0, 0, 0), Q_from_AngX(CH_C_PI_2)));
+        m_system->AddLink(revolute);
+    }
+
+    virtual std::string GetTemplateName() const override { return "TestVehicle"; }
+    virtual double GetVehicleMass() const override { return 1; }
+    virtual ChVector<> GetVehicleCOMPos() const override { return ChVector<>(0, 0, 0); }
+    virtual std::shared_ptr<ChShaft> GetDriveshaft() const override { return nullptr; }
+    virtual double GetDriveshaftSpeed() const override { return 0; }
+    virtual void Initialize(const ChCoordsys<>& chassisPos, double chassisFwdVel = 0) override {}
+    virtual void LogConstraintViolations() override {}
+    virtual std::string ExportComponentList() const override { return ""; }
+    virtual void ExportComponentList(const std::string& filename) const override {}
+    virtual void Output(int frame, ChVehicleOutput& database) const override {}
+
+    ChSystem* GetSystem() const { return m_system; }
+};
+
+int main(int argc, char* argv[]) {
+    TestVehicle vehicle;
+    ChSystem* system = vehicle.GetSystem();
+    int max_speed = system->GetMaxItersSolverSpeed();
+    int max_stab = system->GetMaxItersSolverStab();
+
+    // Impossible deadline: all calls overrun and the iterations drop to the minimum.
+    vehicle.EnableRealtime(true, 1e-9, min_iterations);
+    for (int i = 0; i < 3; i++)
+        vehicle.Advance(2e-3);
+    const RealtimeStats& stats = vehicle.GetRealtimeStats();
+    GetLog() << "Deadline 1 ns: overruns " << stats.num_overruns << " / " << stats.num_advance
+             << "  iterations: " << system->GetMaxItersSolverSpeed() << "\n";
+    if (stats.num_advance != 3 || stats.num_overruns != 3 || stats.time <= 0 || stats.time_solver <= 0) {
+        GetLog() << "Incorrect statistics with impossible deadline\n";
+        return 1;
+    }
+    if (system->GetMaxItersSolverSpeed() != min_iterations || system->GetMaxItersSolverStab() != min_iterations) {
+        GetLog() << "Solver iterations not reduced to the minimum\n";
+        return 1;
+    }
+
+    // Generous deadline: no overruns, and the iterations grow back by at most 25% per call.
+    vehicle.EnableRealtime(true, 1e3, min_iterations);
+    int iters = system->GetMaxItersSolverSpeed();
+    int num_calls = 0;
+    while (iters < max_speed && num_calls < 100) {
+        vehicle.Advance(2e-3);
+        num_calls++;
+        int new_iters = system->GetMaxItersSolverSpeed();
+        if (new_iters <= iters || new_iters > std::ceil(1.25 * iters)) {
+            GetLog() << "Incorrect iteration increase from " << iters << " to " << new_iters << "\n";
+            return 1;
+        }
+        int stab = system->GetMaxItersSolverStab();
+        if (stab != std::max(min_iterations, (int)((double)max_stab * new_iters / max_speed))) {
+            GetLog() << "Incorrect stabilization iterations: " << stab << "\n";
+            return 1;
+        }
+        iters = new_iters;
+    }
+    GetLog() << "Deadline 1000 s: overruns " << stats.num_overruns << " / " << stats.num_advance
+             << "  iterations: " << iters << " after " << num_calls << " calls\n";
+    if (iters != max_speed || stats.num_overruns != 0 || stats.num_advance != num_calls) {
+        GetLog() << "Solver iterations not restored with generous deadline\n";
+        return 1;
+    }
+
+    // Disabling the real-time mode restores the nominal iteration counts.
+    vehicle.EnableRealtime(true, 1e-9, min_iterations);
+    vehicle.Advance(2e-3);
+    vehicle.EnableRealtime(false);
+    if (system->GetMaxItersSolverSpeed() != max_speed || system->GetMaxItersSolverStab() != max_stab) {
+        GetLog() << "Nominal solver iterations not restored\n";
+        return 1;
+    }
+
+    GetLog() << "PASSED\n";
+    return 0;
+}